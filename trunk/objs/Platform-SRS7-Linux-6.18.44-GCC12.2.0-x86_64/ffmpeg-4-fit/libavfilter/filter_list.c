@@ -0,0 +1,6 @@
+static const AVFilter * const filter_list[] = {
+    &ff_asrc_abuffer,
+    &ff_vsrc_buffer,
+    &ff_asink_abuffer,
+    &ff_vsink_buffer,
+    NULL };
@@ -0,0 +1,6 @@
+LIBAVUTIL_MAJOR {
+    global:
+        av*;
+    local:
+        *;
+};
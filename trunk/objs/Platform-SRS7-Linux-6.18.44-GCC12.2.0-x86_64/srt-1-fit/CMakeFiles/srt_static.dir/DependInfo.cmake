@@ -0,0 +1,19 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/trunk/objs/Platform-SRS7-Linux-6.18.44-GCC12.2.0-x86_64/srt-1-fit/cmake_object_lib_support.c" "CMakeFiles/srt_static.dir/cmake_object_lib_support.c.o" "gcc" "CMakeFiles/srt_static.dir/cmake_object_lib_support.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
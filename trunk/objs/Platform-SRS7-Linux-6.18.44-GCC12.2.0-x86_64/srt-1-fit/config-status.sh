@@ -0,0 +1,2 @@
+#!/bin/bash
+./configure --prefix=/root/repo/trunk/objs/Platform-SRS7-Linux-6.18.44-GCC12.2.0-x86_64/3rdparty/srt --enable-apps=0 --enable-static=1 --enable-c++11=0 --enable-shared=0 
@@ -0,0 +1,103 @@
+// auto generated by configure
+#ifndef SRS_AUTO_HEADER_HPP
+#define SRS_AUTO_HEADER_HPP
+
+#define SRS_PACKAGER ""
+#define SRS_BUILD_TS "1792227493"
+#define SRS_BUILD_DATE "2026-10-17 08:58:13"
+#define SRS_UNAME "Linux vm 6.18.44-fc-v139 #1 SMP PREEMPT_DYNAMIC @0 x86_64 GNU/Linux"
+#define SRS_USER_CONFIGURE "--sys-ssl=on --nasm=off --srtp-nasm=off --utest=on --gb28181=on --rtsp=on --jobs=4 --clean=off"
+#define SRS_CONFIGURE "--prefix=/usr/local/srs --config=conf/srs.conf --osx=off --hls=on --hds=off --dvr=on --ssl=on --https=on --ssl-1-0=off --ssl-local=off --sys-ssl=on --transcode=on --ingest=on --stat=on --http-callback=on --http-server=on --stream-converter=on --http-api=on --utest=on --srt=on --sys-srt=off --rtc=on --rtsp=on --gb28181=on --simulator=off --cxx11=off --cxx14=off --backtrace=on --ffmpeg-fit=on --sys-ffmpeg=off --ffmpeg-opus=off --nasm=off --srtp-nasm=off --sys-srtp=off --clean=off --gperf=off --gmc=off --gmd=off --gmp=off --gcp=off --gprof=off --static=off --shared-st=off --shared-srt=reserved --shared-ffmpeg=reserved --shared-srtp=reserved --log-verbose=off --log-info=off --log-trace=on --log-level_v2=on --gcov=off --debug=off --debug-stats=off --debug-nack-drop=off --cross-build=off --sanitizer=on --sanitizer-static=off --sanitizer-log=off --single-thread=on --signal-api=off --generic-linux=off --build-cache=on --cc=gcc --cxx=g++ --ar=ar --ld=ld --randlib=randlib"
+
+#undef SRS_HDS
+#define SRS_HDS_BOOL false
+#define SRS_SRT
+#define SRS_SRT_BOOL true
+#undef SRS_CXX11
+#define SRS_CXX11_BOOL false
+#undef SRS_CXX14
+#define SRS_CXX14_BOOL false
+#define SRS_BACKTRACE
+#define SRS_BACKTRACE_BOOL true
+#define SRS_RTC
+#define SRS_RTC_BOOL true
+#define SRS_RTSP
+#define SRS_RTSP_BOOL true
+#define SRS_FFMPEG_FIT
+#define SRS_FFMPEG_FIT_BOOL true
+#undef SRS_FFMPEG_OPUS
+#define SRS_FFMPEG_OPUS_BOOL false
+#define SRS_H265
+#define SRS_H265_BOOL true
+#undef SRS_SIMULATOR
+#define SRS_SIMULATOR_BOOL false
+#define SRS_HTTPS
+#define SRS_HTTPS_BOOL true
+#define SRS_GB28181
+#define SRS_GB28181_BOOL true
+#define SRS_UTEST
+#define SRS_UTEST_BOOL true
+#define SRS_FORCE_PUBLIC4UTEST
+#define SRS_FORCE_PUBLIC4UTEST_BOOL true
+#define SRS_FFMPEG_STUB
+#define SRS_FFMPEG_STUB_BOOL true
+#undef SRS_GPERF
+#define SRS_GPERF_BOOL false
+#undef SRS_GPERF_MC
+#define SRS_GPERF_MC_BOOL false
+#undef SRS_GPERF_MD
+#define SRS_GPERF_MD_BOOL false
+#undef SRS_GPERF_MP
+#define SRS_GPERF_MP_BOOL false
+#undef SRS_GPERF_CP
+#define SRS_GPERF_CP_BOOL false
+#define SRS_SANITIZER
+#define SRS_SANITIZER_BOOL true
+#define SRS_SANITIZER_LOG
+#define SRS_SANITIZER_LOG_BOOL true
+#undef SRS_VALGRIND
+#define SRS_VALGRIND_BOOL false
+#undef SRS_VERBOSE
+#define SRS_VERBOSE_BOOL false
+#undef SRS_INFO
+#define SRS_INFO_BOOL false
+#define SRS_TRACE
+#define SRS_TRACE_BOOL true
+#define SRS_SINGLE_THREAD
+#define SRS_SINGLE_THREAD_BOOL true
+#undef SRS_SIGNAL_API
+#define SRS_SIGNAL_API_BOOL false
+#define SRS_LOG_LEVEL_V2
+#define SRS_LOG_LEVEL_V2_BOOL true
+#undef SRS_CROSSBUILD
+#define SRS_CROSSBUILD_BOOL false
+#undef SRS_CYGWIN64
+#define SRS_CYGWIN64_BOOL false
+#undef SRS_OSX
+#define SRS_OSX_BOOL false
+#undef SRS_DEBUG
+#define SRS_DEBUG_BOOL false
+#undef SRS_DEBUG_STATS
+#define SRS_DEBUG_STATS_BOOL false
+#undef SRS_DEBUG_NACK_DROP
+#define SRS_DEBUG_NACK_DROP_BOOL false
+
+#define SRS_PREFIX "/usr/local/srs"
+#define SRS_DEFAULT_CONFIG "conf/srs.conf"
+
+#define RTMP_SIG_SRS_AUTHORS "\
+Winlin<winlinvip@gmail.com> \
+XiaoZhihong<hondaxiao@tencent.com> \
+ChenHaibo<nmgchenhaibo@foxmail.com> \
+ZhangJunqin<chundonglinlin@126.com> \
+XiaLixin<xialixin@kanzhun.com> \
+JacobSu<suzp1984@gmail.com> \
+ShiWei<xiaoq_bj@126.com> \
+ChenGuanghua<chengh_math@126.com> \
+LiPeng<lipeng19811218@gmail.com> \
+ZhaoWenjie<zhaowenjie@tal.com> \
+WuPengqiang<309554135@qq.com> \
+"
+
+#endif
+
@@ -0,0 +1,886 @@
+//
+// Copyright (c) 2013-2025 The SRS Authors
+//
+// SPDX-License-Identifier: MIT
+//
+
+#include <srs_app_async_io.hpp>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std;
+
+#include <srs_app_config.hpp>
+#include <srs_core_autofree.hpp>
+#include <srs_kernel_error.hpp>
+#include <srs_kernel_log.hpp>
+#include <srs_kernel_utility.hpp>
+
+SrsAsyncIo *_srs_async_io = NULL;
+
+// The FNV-1a hash of path, to select the I/O thread.
+uint32_t srs_async_io_hash(const std::string &path)
+{
+    uint32_t hash = 2166136261u;
+    for (int i = 0; i < (int)path.length(); i++) {
+        hash ^= (uint8_t)path.at(i);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+SrsAsyncIoTask::SrsAsyncIoTask(SrsAsyncIoType type)
+{
+    type_ = type;
+    fd_ = -1;
+    flags_ = 0;
+    buf_ = NULL;
+    size_ = 0;
+    offset_ = 0;
+    wait_ = true;
+    r0_ = 0;
+    errno_ = 0;
+    file_size_ = 0;
+    file_mtime_ = 0;
+    done_ = false;
+    cond_ = srs_cond_new();
+}
+
+SrsAsyncIoTask::~SrsAsyncIoTask()
+{
+    srs_cond_destroy(cond_);
+}
+
+void SrsAsyncIoTask::execute()
+{
+    if (type_ == SrsAsyncIoTypeOpen) {
+        r0_ = ::open(path_.c_str(), flags_, 0644);
+
+        // For read, get the size and modify time of file, to check whether file is changed.
+        struct stat st;
+        if (r0_ >= 0 && (flags_ & O_ACCMODE) == O_RDONLY && ::fstat((int)r0_, &st) == 0) {
+            file_size_ = (int64_t)st.st_size;
+            file_mtime_ = (int64_t)st.st_mtime;
+        }
+    } else if (type_ == SrsAsyncIoTypeWrite) {
+        const char *p = buf_;
+        size_t left = size_;
+        off_t offset = offset_;
+
+        r0_ = 0;
+        while (left > 0) {
+            ssize_t nn = ::pwrite(fd_, p, left, offset);
+            if (nn < 0 && errno == EINTR) {
+                continue;
+            }
+            if (nn <= 0) {
+                r0_ = -1;
+                break;
+            }
+
+            p += nn;
+            left -= nn;
+            offset += nn;
+        }
+    } else if (type_ == SrsAsyncIoTypeRead) {
+        do {
+            r0_ = ::pread(fd_, (char *)buf_, size_, offset_);
+        } while (r0_ < 0 && errno == EINTR);
+    } else if (type_ == SrsAsyncIoTypeClose) {
+        r0_ = ::close(fd_);
+    } else if (type_ == SrsAsyncIoTypeRename) {
+        r0_ = ::rename(path_.c_str(), target_.c_str());
+    } else if (type_ == SrsAsyncIoTypeUnlink) {
+        r0_ = ::unlink(path_.c_str());
+    }
+
+    errno_ = (r0_ < 0) ? errno : 0;
+}
+
+srs_error_t SrsAsyncIoTask::result()
+{
+    if (r0_ >= 0) {
+        return srs_success;
+    }
+
+    if (type_ == SrsAsyncIoTypeOpen) {
+        return srs_error_new(ERROR_SYSTEM_FILE_OPENE, "open file %s failed, errno=%d", path_.c_str(), errno_);
+    } else if (type_ == SrsAsyncIoTypeWrite) {
+        return srs_error_new(ERROR_SYSTEM_FILE_WRITE, "write fd=%d failed, size=%d, offset=%d, errno=%d", fd_, (int)size_, (int)offset_, errno_);
+    } else if (type_ == SrsAsyncIoTypeRead) {
+        return srs_error_new(ERROR_SYSTEM_FILE_READ, "read fd=%d failed, size=%d, offset=%d, errno=%d", fd_, (int)size_, (int)offset_, errno_);
+    } else if (type_ == SrsAsyncIoTypeClose) {
+        return srs_error_new(ERROR_SYSTEM_FILE_CLOSE, "close fd=%d failed, errno=%d", fd_, errno_);
+    } else if (type_ == SrsAsyncIoTypeRename) {
+        return srs_error_new(ERROR_SYSTEM_FILE_RENAME, "rename %s to %s failed, errno=%d", path_.c_str(), target_.c_str(), errno_);
+    }
+    return srs_error_new(ERROR_SYSTEM_FILE_UNLINK, "unlink %s failed, errno=%d", path_.c_str(), errno_);
+}
+
+ISrsAsyncIo::ISrsAsyncIo()
+{
+}
+
+ISrsAsyncIo::~ISrsAsyncIo()
+{
+}
+
+SrsAsyncIo::SrsAsyncIo()
+{
+    trd_ = new SrsDummyCoroutine();
+    started_ = false;
+    quit_ = false;
+    pthread_mutex_init(&lock_, NULL);
+    pipes_[0] = pipes_[1] = -1;
+    notify_ = NULL;
+
+    max_queue_ = 0;
+    nn_queue_ = 0;
+    slot_ = srs_cond_new();
+    nn_ops_ = 0;
+    nn_full_ = 0;
+
+    config_ = _srs_config;
+}
+
+SrsAsyncIo::~SrsAsyncIo()
+{
+    stop();
+
+    srs_freep(trd_);
+    srs_cond_destroy(slot_);
+    pthread_mutex_destroy(&lock_);
+
+    config_ = NULL;
+}
+
+// LCOV_EXCL_START
+srs_error_t SrsAsyncIo::start()
+{
+    srs_error_t err = srs_success;
+
+    if (started_ || !config_->get_async_io_enabled()) {
+        return err;
+    }
+
+    int nn_threads = config_->get_async_io_threads();
+    max_queue_ = config_->get_async_io_queue();
+
+    if (::pipe(pipes_) < 0) {
+        return srs_error_new(ERROR_SYSTEM_ASYNC_IO, "create pipe");
+    }
+
+    // The I/O threads should never block on the pipe, the ST thread will be notified anyway when pipe is full.
+    int flags = fcntl(pipes_[1], F_GETFL, 0);
+    if (flags == -1 || fcntl(pipes_[1], F_SETFL, flags | O_NONBLOCK) == -1) {
+        return srs_error_new(ERROR_SYSTEM_ASYNC_IO, "set pipe nonblock");
+    }
+
+    if ((notify_ = srs_netfd_open(pipes_[0])) == NULL) {
+        return srs_error_new(ERROR_SYSTEM_ASYNC_IO, "open pipe fd=%d", pipes_[0]);
+    }
+
+    quit_ = false;
+    for (int i = 0; i < nn_threads; i++) {
+        SrsAsyncIoThread *thread = new SrsAsyncIoThread();
+        thread->aio_ = this;
+        pthread_cond_init(&thread->cond_, NULL);
+
+        int r0 = pthread_create(&thread->trd_, NULL, io_thread, thread);
+        if (r0 != 0) {
+            pthread_cond_destroy(&thread->cond_);
+            srs_freep(thread);
+            return srs_error_new(ERROR_SYSTEM_ASYNC_IO, "create thread, r0=%d", r0);
+        }
+
+        threads_.push_back(thread);
+    }
+
+    srs_freep(trd_);
+    trd_ = new SrsSTCoroutine("aio", this, _srs_context->get_id());
+    if ((err = trd_->start()) != srs_success) {
+        return srs_error_wrap(err, "start dispatcher");
+    }
+
+    started_ = true;
+    srs_trace("Async I/O: start threads=%d, queue=%d", nn_threads, max_queue_);
+
+    return err;
+}
+
+void SrsAsyncIo::stop()
+{
+    if (threads_.empty() && pipes_[0] < 0) {
+        return;
+    }
+
+    started_ = false;
+
+    // The I/O threads quit after all pending operations are done.
+    pthread_mutex_lock(&lock_);
+    quit_ = true;
+    for (int i = 0; i < (int)threads_.size(); i++) {
+        pthread_cond_signal(&threads_[i]->cond_);
+    }
+    pthread_mutex_unlock(&lock_);
+
+    for (int i = 0; i < (int)threads_.size(); i++) {
+        SrsAsyncIoThread *thread = threads_[i];
+        pthread_join(thread->trd_, NULL);
+        pthread_cond_destroy(&thread->cond_);
+        srs_freep(thread);
+    }
+    threads_.clear();
+
+    trd_->stop();
+
+    // Wakeup the coroutines which still wait for the done operations.
+    on_completed();
+
+    if (notify_) {
+        srs_close_stfd(notify_);
+    } else if (pipes_[0] >= 0) {
+        ::close(pipes_[0]);
+    }
+    if (pipes_[1] >= 0) {
+        ::close(pipes_[1]);
+    }
+    pipes_[0] = pipes_[1] = -1;
+
+    srs_trace("Async I/O: stopped, ops=%" PRId64 ", full=%" PRId64, nn_ops_, nn_full_);
+}
+// LCOV_EXCL_STOP
+
+bool SrsAsyncIo::enabled()
+{
+    return started_;
+}
+
+srs_error_t SrsAsyncIo::open(const std::string &path, int *pfd)
+{
+    srs_error_t err = srs_success;
+
+    SrsUniquePtr<SrsAsyncIoTask> task(new SrsAsyncIoTask(SrsAsyncIoTypeOpen));
+    task->path_ = path;
+    task->flags_ = O_WRONLY | O_CREAT | O_TRUNC;
+
+    execute(task.get(), srs_async_io_hash(path));
+
+    if ((err = task->result()) != srs_success) {
+        return err;
+    }
+
+    *pfd = (int)task->r0_;
+    return err;
+}
+
+srs_error_t SrsAsyncIo::pwrite(int fd, const void *buf, size_t size, off_t offset)
+{
+    SrsUniquePtr<SrsAsyncIoTask> task(new SrsAsyncIoTask(SrsAsyncIoTypeWrite));
+    task->fd_ = fd;
+    task->buf_ = (const char *)buf;
+    task->size_ = size;
+    task->offset_ = offset;
+
+    execute(task.get(), (uint32_t)fd);
+
+    return task->result();
+}
+
+srs_error_t SrsAsyncIo::open_read(const std::string &path, int *pfd, int64_t *psize, int64_t *pmtime)
+{
+    srs_error_t err = srs_success;
+
+    SrsUniquePtr<SrsAsyncIoTask> task(new SrsAsyncIoTask(SrsAsyncIoTypeOpen));
+    task->path_ = path;
+    task->flags_ = O_RDONLY;
+
+    execute(task.get(), srs_async_io_hash(path));
+
+    if ((err = task->result()) != srs_success) {
+        return err;
+    }
+
+    *pfd = (int)task->r0_;
+    *psize = task->file_size_;
+    *pmtime = task->file_mtime_;
+    return err;
+}
+
+srs_error_t SrsAsyncIo::pread(int fd, void *buf, size_t size, off_t offset, ssize_t *pnread)
+{
+    srs_error_t err = srs_success;
+
+    SrsUniquePtr<SrsAsyncIoTask> task(new SrsAsyncIoTask(SrsAsyncIoTypeRead));
+    task->fd_ = fd;
+    task->buf_ = (const char *)buf;
+    task->size_ = size;
+    task->offset_ = offset;
+
+    execute(task.get(), (uint32_t)fd);
+
+    if ((err = task->result()) != srs_success) {
+        return err;
+    }
+
+    *pnread = task->r0_;
+    return err;
+}
+
+srs_error_t SrsAsyncIo::close(int fd)
+{
+    SrsUniquePtr<SrsAsyncIoTask> task(new SrsAsyncIoTask(SrsAsyncIoTypeClose));
+    task->fd_ = fd;
+
+    execute(task.get(), (uint32_t)fd);
+
+    return task->result();
+}
+
+srs_error_t SrsAsyncIo::rename(const std::string &from, const std::string &to)
+{
+    SrsUniquePtr<SrsAsyncIoTask> task(new SrsAsyncIoTask(SrsAsyncIoTypeRename));
+    task->path_ = from;
+    task->target_ = to;
+
+    // Use the target path, so that it's in order with the unlink of target in future.
+    execute(task.get(), srs_async_io_hash(to));
+
+    return task->result();
+}
+
+srs_error_t SrsAsyncIo::unlink(const std::string &path)
+{
+    SrsPath p;
+    if (!started_ || p.forbidden(path)) {
+        return p.unlink(path);
+    }
+
+    SrsAsyncIoTask *task = new SrsAsyncIoTask(SrsAsyncIoTypeUnlink);
+    task->path_ = path;
+    task->wait_ = false;
+
+    execute(task, srs_async_io_hash(path));
+
+    return srs_success;
+}
+
+int SrsAsyncIo::depth(const std::string &owner)
+{
+    std::map<std::string, int>::iterator it = depths_.find(owner);
+    return (it != depths_.end()) ? it->second : 0;
+}
+
+// LCOV_EXCL_START
+srs_error_t SrsAsyncIo::cycle()
+{
+    srs_error_t err = srs_success;
+
+    char buf[128];
+    while (true) {
+        if ((err = trd_->pull()) != srs_success) {
+            return srs_error_wrap(err, "async io");
+        }
+
+        ssize_t nn = srs_read(notify_, buf, sizeof(buf), SRS_UTIME_NO_TIMEOUT);
+        if (nn <= 0) {
+            if ((err = trd_->pull()) != srs_success) {
+                return srs_error_wrap(err, "async io");
+            }
+            return srs_error_new(ERROR_SYSTEM_ASYNC_IO, "read notify, nn=%d", (int)nn);
+        }
+
+        on_completed();
+    }
+
+    return err;
+}
+// LCOV_EXCL_STOP
+
+void SrsAsyncIo::execute(SrsAsyncIoTask *task, uint32_t key)
+{
+    task->owner_ = _srs_context->get_id().c_str();
+
+    // Backpressure, wait for the I/O threads to catch up.
+    while (started_ && nn_queue_ >= max_queue_) {
+        if ((nn_full_++ % 100) == 0) {
+            srs_warn("Async I/O: queue full, queue=%d, owner=%s, full=%" PRId64, nn_queue_, task->owner_.c_str(), nn_full_);
+        }
+        srs_cond_wait(slot_);
+    }
+
+    // Execute in place, for the I/O threads are not started, or stopped.
+    if (!started_) {
+        task->execute();
+        task->done_ = true;
+
+        if (!task->wait_) {
+            srs_error_t err = task->result();
+            if (err != srs_success) {
+                srs_warn("Async I/O: ignore err %s", srs_error_desc(err).c_str());
+                srs_freep(err);
+            }
+            srs_freep(task);
+        }
+        return;
+    }
+
+    nn_ops_++;
+    nn_queue_++;
+    depths_[task->owner_]++;
+
+    SrsAsyncIoThread *thread = threads_.at(key % threads_.size());
+
+    pthread_mutex_lock(&lock_);
+    thread->pending_.push_back(task);
+    pthread_cond_signal(&thread->cond_);
+    pthread_mutex_unlock(&lock_);
+
+    if (!task->wait_) {
+        return;
+    }
+
+    // The data of task is owned by the caller, so we must wait for it even if interrupted.
+    while (!task->done_) {
+        srs_cond_wait(task->cond_);
+    }
+}
+
+void SrsAsyncIo::on_completed()
+{
+    std::vector<SrsAsyncIoTask *> tasks;
+
+    pthread_mutex_lock(&lock_);
+    tasks.swap(completed_);
+    pthread_mutex_unlock(&lock_);
+
+    for (int i = 0; i < (int)tasks.size(); i++) {
+        SrsAsyncIoTask *task = tasks.at(i);
+
+        nn_queue_--;
+        std::map<std::string, int>::iterator it = depths_.find(task->owner_);
+        if (it != depths_.end() && --it->second <= 0) {
+            depths_.erase(it);
+        }
+
+        if (task->wait_) {
+            task->done_ = true;
+            srs_cond_signal(task->cond_);
+            continue;
+        }
+
+        srs_error_t err = task->result();
+        if (err != srs_success) {
+            srs_warn("Async I/O: ignore err %s", srs_error_desc(err).c_str());
+            srs_freep(err);
+        }
+        srs_freep(task);
+    }
+
+    if (!tasks.empty()) {
+        srs_cond_broadcast(slot_);
+    }
+}
+
+// LCOV_EXCL_START
+void *SrsAsyncIo::io_thread(void *arg)
+{
+    SrsAsyncIoThread *thread = (SrsAsyncIoThread *)arg;
+
+    // The signals are handled by ST thread.
+    sigset_t mask;
+    sigfillset(&mask);
+    pthread_sigmask(SIG_BLOCK, &mask, NULL);
+
+    thread->aio_->io_cycle(thread);
+    return NULL;
+}
+// LCOV_EXCL_STOP
+
+void SrsAsyncIo::io_cycle(SrsAsyncIoThread *thread)
+{
+    while (true) {
+        SrsAsyncIoTask *task = NULL;
+
+        pthread_mutex_lock(&lock_);
+        while (thread->pending_.empty() && !quit_) {
+            pthread_cond_wait(&thread->cond_, &lock_);
+        }
+        if (!thread->pending_.empty()) {
+            task = thread->pending_.front();
+            thread->pending_.pop_front();
+        }
+        pthread_mutex_unlock(&lock_);
+
+        // Quit when all pending operations are done.
+        if (!task) {
+            break;
+        }
+
+        task->execute();
+
+        pthread_mutex_lock(&lock_);
+        completed_.push_back(task);
+        pthread_mutex_unlock(&lock_);
+
+        // Ignore the error, for the pipe is full and the ST thread will be notified anyway.
+        char c = 0;
+        if (::write(pipes_[1], &c, 1) < 0) {
+            continue;
+        }
+    }
+}
+
+SrsAsyncFileWriter::SrsAsyncFileWriter()
+{
+    fd_ = -1;
+    capacity_ = SRS_ASYNC_IO_BUFFER_SIZE;
+    buf_ = new char[capacity_];
+    nb_buf_ = 0;
+    offset_ = 0;
+    size_ = 0;
+
+    aio_ = _srs_async_io;
+}
+
+SrsAsyncFileWriter::~SrsAsyncFileWriter()
+{
+    close();
+    srs_freepa(buf_);
+
+    aio_ = NULL;
+}
+
+srs_error_t SrsAsyncFileWriter::set_iobuf_size(int size)
+{
+    srs_error_t err = srs_success;
+
+    if (fd_ < 0) {
+        return srs_error_new(ERROR_SYSTEM_FILE_NOT_OPEN, "file %s is not opened", path_.c_str());
+    }
+
+    if ((err = flush()) != srs_success) {
+        return srs_error_wrap(err, "flush");
+    }
+
+    srs_freepa(buf_);
+    capacity_ = srs_max(0, size);
+    buf_ = capacity_ > 0 ? new char[capacity_] : NULL;
+
+    return err;
+}
+
+srs_error_t SrsAsyncFileWriter::open(std::string p)
+{
+    srs_error_t err = srs_success;
+
+    if (fd_ >= 0) {
+        return srs_error_new(ERROR_SYSTEM_FILE_ALREADY_OPENED, "file %s already opened", p.c_str());
+    }
+
+    if ((err = aio_->open(p, &fd_)) != srs_success) {
+        return srs_error_wrap(err, "open %s", p.c_str());
+    }
+
+    path_ = p;
+    nb_buf_ = 0;
+    offset_ = size_ = 0;
+
+    return err;
+}
+
+void SrsAsyncFileWriter::close()
+{
+    srs_error_t err = srs_success;
+
+    if (fd_ < 0) {
+        return;
+    }
+
+    if ((err = flush()) != srs_success) {
+        srs_warn("flush file %s failed, %s", path_.c_str(), srs_error_desc(err).c_str());
+        srs_freep(err);
+    }
+
+    if ((err = aio_->close(fd_)) != srs_success) {
+        srs_warn("close file %s failed, %s", path_.c_str(), srs_error_desc(err).c_str());
+        srs_freep(err);
+    }
+    fd_ = -1;
+}
+
+bool SrsAsyncFileWriter::is_open()
+{
+    return fd_ >= 0;
+}
+
+void SrsAsyncFileWriter::seek2(int64_t offset)
+{
+    srs_assert(is_open());
+
+    srs_error_t err = lseek((off_t)offset, SEEK_SET, NULL);
+    if (err != srs_success) {
+        srs_warn("seek file %s failed, %s", path_.c_str(), srs_error_desc(err).c_str());
+        srs_freep(err);
+    }
+}
+
+int64_t SrsAsyncFileWriter::tellg()
+{
+    srs_assert(is_open());
+
+    return (int64_t)(offset_ + nb_buf_);
+}
+
+srs_error_t SrsAsyncFileWriter::write(void *buf, size_t count, ssize_t *pnwrite)
+{
+    srs_error_t err = srs_success;
+
+    if (fd_ < 0) {
+        return srs_error_new(ERROR_SYSTEM_FILE_NOT_OPEN, "file %s is not opened", path_.c_str());
+    }
+
+    if (nb_buf_ + count > (size_t)capacity_ && (err = flush()) != srs_success) {
+        return srs_error_wrap(err, "flush");
+    }
+
+    // Write the large data directly, without copying to buffer.
+    if (count >= (size_t)capacity_) {
+        if ((err = aio_->pwrite(fd_, buf, count, offset_)) != srs_success) {
+            return srs_error_wrap(err, "write to file %s", path_.c_str());
+        }
+
+        offset_ += count;
+        size_ = srs_max(size_, offset_);
+    } else {
+        memcpy(buf_ + nb_buf_, buf, count);
+        nb_buf_ += (int)count;
+    }
+
+    if (pnwrite != NULL) {
+        *pnwrite = (ssize_t)count;
+    }
+
+    return err;
+}
+
+srs_error_t SrsAsyncFileWriter::writev(const iovec *iov, int iovcnt, ssize_t *pnwrite)
+{
+    srs_error_t err = srs_success;
+
+    ssize_t nwrite = 0;
+    for (int i = 0; i < iovcnt; i++) {
+        const iovec *piov = iov + i;
+        ssize_t this_nwrite = 0;
+        if ((err = write(piov->iov_base, piov->iov_len, &this_nwrite)) != srs_success) {
+            return srs_error_wrap(err, "writev");
+        }
+        nwrite += this_nwrite;
+    }
+
+    if (pnwrite) {
+        *pnwrite = nwrite;
+    }
+
+    return err;
+}
+
+srs_error_t SrsAsyncFileWriter::lseek(off_t offset, int whence, off_t *seeked)
+{
+    srs_error_t err = srs_success;
+
+    srs_assert(is_open());
+
+    off_t current = offset_ + nb_buf_;
+    off_t pos = offset;
+    if (whence == SEEK_CUR) {
+        pos = current + offset;
+    } else if (whence == SEEK_END) {
+        pos = srs_max(size_, current) + offset;
+    }
+
+    if (pos < 0) {
+        return srs_error_new(ERROR_SYSTEM_FILE_SEEK, "seek file %s to %d", path_.c_str(), (int)pos);
+    }
+
+    // Flush the buffer before seek, the buffer is always continuous data at offset.
+    if (pos != current) {
+        if ((err = flush()) != srs_success) {
+            return srs_error_wrap(err, "flush");
+        }
+        offset_ = pos;
+    }
+
+    if (seeked) {
+        *seeked = pos;
+    }
+
+    return err;
+}
+
+srs_error_t SrsAsyncFileWriter::flush()
+{
+    srs_error_t err = srs_success;
+
+    if (nb_buf_ <= 0) {
+        return err;
+    }
+
+    if ((err = aio_->pwrite(fd_, buf_, nb_buf_, offset_)) != srs_success) {
+        return srs_error_wrap(err, "write to file %s", path_.c_str());
+    }
+
+    offset_ += nb_buf_;
+    size_ = srs_max(size_, offset_);
+    nb_buf_ = 0;
+
+    return err;
+}
+
+SrsAsyncFileReader::SrsAsyncFileReader()
+{
+    fd_ = -1;
+    size_ = 0;
+    mtime_ = 0;
+    capacity_ = SRS_ASYNC_IO_BUFFER_SIZE;
+    buf_ = new char[capacity_];
+    nb_buf_ = 0;
+    buf_offset_ = 0;
+    offset_ = 0;
+
+    aio_ = _srs_async_io;
+}
+
+SrsAsyncFileReader::~SrsAsyncFileReader()
+{
+    close();
+    srs_freepa(buf_);
+
+    aio_ = NULL;
+}
+
+srs_error_t SrsAsyncFileReader::open(std::string p)
+{
+    srs_error_t err = srs_success;
+
+    if (fd_ >= 0) {
+        return srs_error_new(ERROR_SYSTEM_FILE_ALREADY_OPENED, "file %s already opened", p.c_str());
+    }
+
+    if ((err = aio_->open_read(p, &fd_, &size_, &mtime_)) != srs_success) {
+        return srs_error_wrap(err, "open %s", p.c_str());
+    }
+
+    path_ = p;
+    nb_buf_ = 0;
+    buf_offset_ = offset_ = 0;
+
+    return err;
+}
+
+void SrsAsyncFileReader::close()
+{
+    srs_error_t err = srs_success;
+
+    if (fd_ < 0) {
+        return;
+    }
+
+    if ((err = aio_->close(fd_)) != srs_success) {
+        srs_warn("close file %s failed, %s", path_.c_str(), srs_error_desc(err).c_str());
+        srs_freep(err);
+    }
+    fd_ = -1;
+}
+
+int64_t SrsAsyncFileReader::mtime()
+{
+    return mtime_;
+}
+
+bool SrsAsyncFileReader::is_open()
+{
+    return fd_ >= 0;
+}
+
+int64_t SrsAsyncFileReader::tellg()
+{
+    return (int64_t)offset_;
+}
+
+void SrsAsyncFileReader::skip(int64_t size)
+{
+    offset_ += (off_t)size;
+}
+
+int64_t SrsAsyncFileReader::seek2(int64_t offset)
+{
+    offset_ = (off_t)offset;
+    return offset;
+}
+
+int64_t SrsAsyncFileReader::filesize()
+{
+    return size_;
+}
+
+srs_error_t SrsAsyncFileReader::read(void *buf, size_t count, ssize_t *pnread)
+{
+    srs_error_t err = srs_success;
+
+    if (fd_ < 0) {
+        return srs_error_new(ERROR_SYSTEM_FILE_NOT_OPEN, "file %s is not opened", path_.c_str());
+    }
+
+    // Read ahead to buffer, when the offset is not in buffer.
+    if (offset_ < buf_offset_ || offset_ >= buf_offset_ + nb_buf_) {
+        ssize_t nread = 0;
+        if ((err = aio_->pread(fd_, buf_, capacity_, offset_, &nread)) != srs_success) {
+            return srs_error_wrap(err, "read from file %s", path_.c_str());
+        }
+
+        buf_offset_ = offset_;
+        nb_buf_ = (int)nread;
+    }
+
+    if (nb_buf_ <= 0) {
+        return srs_error_new(ERROR_SYSTEM_FILE_EOF, "file EOF");
+    }
+
+    int pos = (int)(offset_ - buf_offset_);
+    int nn = srs_min(nb_buf_ - pos, (int)srs_min(count, (size_t)capacity_));
+    memcpy(buf, buf_ + pos, nn);
+    offset_ += nn;
+
+    if (pnread != NULL) {
+        *pnread = nn;
+    }
+
+    return err;
+}
+
+srs_error_t SrsAsyncFileReader::lseek(off_t offset, int whence, off_t *seeked)
+{
+    off_t pos = offset;
+    if (whence == SEEK_CUR) {
+        pos = offset_ + offset;
+    } else if (whence == SEEK_END) {
+        pos = (off_t)size_ + offset;
+    }
+
+    if (pos < 0) {
+        return srs_error_new(ERROR_SYSTEM_FILE_SEEK, "seek file %s to %d", path_.c_str(), (int)pos);
+    }
+
+    offset_ = pos;
+    if (seeked) {
+        *seeked = pos;
+    }
+
+    return srs_success;
+}
@@ -0,0 +1,281 @@
+//
+// Copyright (c) 2013-2025 The SRS Authors
+//
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef SRS_APP_ASYNC_IO_HPP
+#define SRS_APP_ASYNC_IO_HPP
+
+#include <srs_core.hpp>
+
+#include <pthread.h>
+#include <sys/types.h>
+
+#include <deque>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <srs_app_st.hpp>
+#include <srs_kernel_file.hpp>
+
+class ISrsAppConfig;
+class SrsAsyncIo;
+
+// The default buffer size of async file writer, data is written to disk when buffer is full.
+#define SRS_ASYNC_IO_BUFFER_SIZE 65536
+
+// The type of disk I/O operation.
+enum SrsAsyncIoType {
+    SrsAsyncIoTypeOpen = 1,
+    SrsAsyncIoTypeWrite,
+    SrsAsyncIoTypeClose,
+    SrsAsyncIoTypeRename,
+    SrsAsyncIoTypeUnlink,
+    SrsAsyncIoTypeRead,
+};
+
+// The disk I/O operation, which is executed by I/O thread.
+// @remark The I/O thread only touches the fields of operation and system calls, never the ST or log.
+class SrsAsyncIoTask
+{
+public:
+    SrsAsyncIoType type_;
+    // The fd for write, read and close, the flags for open.
+    int fd_;
+    int flags_;
+    // For write and read, the data is owned by the caller, who waits for the result.
+    const char *buf_;
+    size_t size_;
+    off_t offset_;
+    // The path for open, rename and unlink, and the target path for rename.
+    std::string path_;
+    std::string target_;
+    // The owner context, which is the stream connection, for queue depth of stream.
+    std::string owner_;
+    // Whether the caller waits for the result, or the task is freed when done.
+    bool wait_;
+    // The result of system call, the fd for open, the bytes for read. Set by I/O thread.
+    ssize_t r0_;
+    int errno_;
+    // For open to read, the size and modify time of file. Set by I/O thread.
+    int64_t file_size_;
+    int64_t file_mtime_;
+    // Whether the task is done, only accessed by ST thread.
+    bool done_;
+    srs_cond_t cond_;
+
+public:
+    SrsAsyncIoTask(SrsAsyncIoType type);
+    virtual ~SrsAsyncIoTask();
+
+public:
+    // Execute the blocking system call, in the I/O thread.
+    virtual void execute();
+    // Convert the result to error, in the ST thread.
+    virtual srs_error_t result();
+};
+
+// The interface for disk I/O, which might be offloaded to I/O threads.
+class ISrsAsyncIo
+{
+public:
+    ISrsAsyncIo();
+    virtual ~ISrsAsyncIo();
+
+public:
+    // Start the I/O threads if enabled, should be called in the process which serves streams.
+    virtual srs_error_t start() = 0;
+    // Wait for the pending operations and stop the I/O threads.
+    virtual void stop() = 0;
+    // Whether the I/O threads are running, or the I/O is done in place by ST thread.
+    virtual bool enabled() = 0;
+    // Open the file for write in truncate mode, return the fd in pfd.
+    virtual srs_error_t open(const std::string &path, int *pfd) = 0;
+    // Write all the data to fd at the offset.
+    virtual srs_error_t pwrite(int fd, const void *buf, size_t size, off_t offset) = 0;
+    // Open the file for read, return the fd in pfd, and the size and modify time of file.
+    virtual srs_error_t open_read(const std::string &path, int *pfd, int64_t *psize, int64_t *pmtime) = 0;
+    // Read at most size bytes from fd at the offset, the pnread is 0 for EOF.
+    virtual srs_error_t pread(int fd, void *buf, size_t size, off_t offset, ssize_t *pnread) = 0;
+    // Close the fd, which might flush data to NFS.
+    virtual srs_error_t close(int fd) = 0;
+    virtual srs_error_t rename(const std::string &from, const std::string &to) = 0;
+    // Unlink the file in background, never wait for it, for example, to reap the expired segment.
+    virtual srs_error_t unlink(const std::string &path) = 0;
+    // Get the number of pending operations of owner, which is the stream connection context id.
+    virtual int depth(const std::string &owner) = 0;
+};
+
+// The I/O thread, which has its own queue. The operations on the same path or fd are always
+// dispatched to the same thread, so they are executed in order.
+struct SrsAsyncIoThread {
+    SrsAsyncIo *aio_;
+    pthread_t trd_;
+    // Protected by the mutex of manager.
+    std::deque<SrsAsyncIoTask *> pending_;
+    pthread_cond_t cond_;
+};
+
+// The disk I/O offload, the ST coroutine submits the operation to a pool of I/O threads and waits
+// on a ST cond, so a slow disk only stalls the stream itself, not the whole event loop. The I/O
+// threads notify the ST thread by a pipe, which is read by the dispatcher coroutine.
+class SrsAsyncIo : public ISrsAsyncIo, public ISrsCoroutineHandler
+{
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    ISrsAppConfig *config_;
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    ISrsCoroutine *trd_;
+    bool started_;
+    std::vector<SrsAsyncIoThread *> threads_;
+    // Protect the queues of threads, the completed queue and the quit flag.
+    pthread_mutex_t lock_;
+    std::vector<SrsAsyncIoTask *> completed_;
+    bool quit_;
+    // The pipe to notify ST thread, written by I/O threads.
+    int pipes_[2];
+    srs_netfd_t notify_;
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // The max and current number of pending operations, for backpressure.
+    int max_queue_;
+    int nn_queue_;
+    // The coroutines wait for a free slot of queue.
+    srs_cond_t slot_;
+    // The number of pending operations of each owner.
+    std::map<std::string, int> depths_;
+    // The total number of operations, and the times that queue is full.
+    int64_t nn_ops_;
+    int64_t nn_full_;
+
+public:
+    SrsAsyncIo();
+    virtual ~SrsAsyncIo();
+
+public:
+    virtual srs_error_t start();
+    virtual void stop();
+    virtual bool enabled();
+    virtual srs_error_t open(const std::string &path, int *pfd);
+    virtual srs_error_t pwrite(int fd, const void *buf, size_t size, off_t offset);
+    virtual srs_error_t open_read(const std::string &path, int *pfd, int64_t *psize, int64_t *pmtime);
+    virtual srs_error_t pread(int fd, void *buf, size_t size, off_t offset, ssize_t *pnread);
+    virtual srs_error_t close(int fd);
+    virtual srs_error_t rename(const std::string &from, const std::string &to);
+    virtual srs_error_t unlink(const std::string &path);
+    virtual int depth(const std::string &owner);
+    // Interface ISrsCoroutineHandler
+public:
+    virtual srs_error_t cycle();
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // Execute the task by I/O thread selected by key, wait for result if task->wait_.
+    // @remark The task is executed in place if I/O threads are not started.
+    virtual void execute(SrsAsyncIoTask *task, uint32_t key);
+    // Finish the completed tasks, wakeup the waiting coroutines.
+    virtual void on_completed();
+    static void *io_thread(void *arg);
+    virtual void io_cycle(SrsAsyncIoThread *thread);
+};
+
+// The file writer which writes by the async I/O. The data is buffered, and written to disk by I/O
+// thread when buffer is full, or seek, or close, while the coroutine waits without blocking others.
+class SrsAsyncFileWriter : public ISrsFileWriter
+{
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    ISrsAsyncIo *aio_;
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    std::string path_;
+    int fd_;
+    char *buf_;
+    int capacity_;
+    int nb_buf_;
+    // The file offset of the first byte in buffer.
+    off_t offset_;
+    // The size of file, the max offset written.
+    off_t size_;
+
+public:
+    SrsAsyncFileWriter();
+    virtual ~SrsAsyncFileWriter();
+
+public:
+    virtual srs_error_t set_iobuf_size(int size);
+    virtual srs_error_t open(std::string p);
+    virtual void close();
+
+public:
+    virtual bool is_open();
+    virtual void seek2(int64_t offset);
+    virtual int64_t tellg();
+    // Interface ISrsWriteSeeker
+public:
+    virtual srs_error_t write(void *buf, size_t count, ssize_t *pnwrite);
+    virtual srs_error_t writev(const iovec *iov, int iovcnt, ssize_t *pnwrite);
+    virtual srs_error_t lseek(off_t offset, int whence, off_t *seeked);
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // Write the buffered data to disk.
+    virtual srs_error_t flush();
+};
+
+// The file reader which reads by the async I/O, for the files which are parsed by ST thread, for
+// example, the moov of MP4. The data is read ahead to buffer, to avoid an I/O operation for each
+// small read of box header.
+class SrsAsyncFileReader : public ISrsFileReader
+{
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    ISrsAsyncIo *aio_;
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    std::string path_;
+    int fd_;
+    // The size and modify time of file, when opened.
+    int64_t size_;
+    int64_t mtime_;
+    char *buf_;
+    int capacity_;
+    int nb_buf_;
+    // The file offset of the first byte in buffer.
+    off_t buf_offset_;
+    // The current offset to read.
+    off_t offset_;
+
+public:
+    SrsAsyncFileReader();
+    virtual ~SrsAsyncFileReader();
+
+public:
+    virtual srs_error_t open(std::string p);
+    virtual void close();
+    // Get the modify time of file, in seconds.
+    virtual int64_t mtime();
+
+public:
+    virtual bool is_open();
+    virtual int64_t tellg();
+    virtual void skip(int64_t size);
+    virtual int64_t seek2(int64_t offset);
+    virtual int64_t filesize();
+    // Interface ISrsReadSeeker
+public:
+    virtual srs_error_t read(void *buf, size_t count, ssize_t *pnread);
+    virtual srs_error_t lseek(off_t offset, int whence, off_t *seeked);
+};
+
+// The global async I/O, started by server.
+extern SrsAsyncIo *_srs_async_io;
+
+#endif
@@ -86,6 +86,9 @@ const char *_srs_version = "XCORE-" RTMP_SIG_SRS_SERVER;
 #define SRS_OVERWRITE_BY_ENV_FLOAT_MILLISECONDS(key) \
     if (!srs_getenv(key).empty())                    \
     return srs_utime_t(::atof(srs_getenv(key).c_str()) * SRS_UTIME_MILLISECONDS)
+#define SRS_OVERWRITE_BY_ENV_MBYTES(key) \
+    if (!srs_getenv(key).empty())        \
+    return (int64_t)::atoi(srs_getenv(key).c_str()) * 1024 * 1024
 #define SRS_OVERWRITE_BY_ENV_DIRECTIVE(key)                                    \
     {                                                                          \
         SrsConfDirective *dir = env_cache_->get(key);                          \
@@ -1388,6 +1391,143 @@ ISrsAppConfig::~ISrsAppConfig()
 {
 }
 
+SrsVhostSnapshot::SrsVhostSnapshot()
+{
+    enabled_ = false;
+    is_edge_ = false;
+    edge_token_traverse_ = false;
+    http_hooks_enabled_ = false;
+    debug_srs_upnode_ = false;
+    refer_enabled_ = false;
+
+    gop_cache_ = false;
+    gop_cache_max_frames_ = 0;
+    queue_length_ = 0;
+    atc_ = false;
+    atc_auto_ = false;
+    time_jitter_ = 0;
+    mix_correct_ = false;
+    realtime_enabled_ = false;
+    realtime_enabled_rtc_ = false;
+    tcp_nodelay_ = false;
+    send_min_interval_ = 0;
+    reduce_sequence_header_ = false;
+
+    mr_enabled_ = false;
+    mr_sleep_ = 0;
+    parse_sps_ = false;
+    publish_1stpkt_timeout_ = 0;
+    publish_normal_timeout_ = 0;
+    publish_kickoff_for_idle_ = 0;
+
+    chunk_size_ = 0;
+    in_ack_size_ = 0;
+    out_ack_size_ = 0;
+
+    rtc_enabled_ = false;
+    rtc_from_rtmp_ = false;
+    rtc_to_rtmp_ = false;
+    rtc_nack_enabled_ = false;
+    rtc_nack_no_copy_ = false;
+    rtc_twcc_enabled_ = false;
+    rtc_keep_original_ssrc_ = false;
+    rtc_drop_for_pt_ = 0;
+    rtc_stun_timeout_ = 0;
+    rtc_stun_strict_check_ = false;
+    rtc_init_rate_from_sdp_ = false;
+
+    rtsp_enabled_ = false;
+    rtsp_from_rtmp_ = false;
+    srt_enabled_ = false;
+    srt_to_rtmp_ = false;
+}
+
+SrsVhostSnapshot::~SrsVhostSnapshot()
+{
+}
+
+SrsConfigSnapshot::SrsConfigSnapshot()
+{
+    default_ = NULL;
+}
+
+SrsConfigSnapshot::~SrsConfigSnapshot()
+{
+    std::map<std::string, SrsVhostSnapshot *>::iterator it;
+    for (it = vhosts_.begin(); it != vhosts_.end(); ++it) {
+        SrsVhostSnapshot *vhost = it->second;
+        srs_freep(vhost);
+    }
+    vhosts_.clear();
+
+    srs_freep(default_);
+}
+
+SrsVhostSnapshot *SrsConfigSnapshot::vhost(const std::string &name)
+{
+    std::map<std::string, SrsVhostSnapshot *>::iterator it = vhosts_.find(name);
+    if (it != vhosts_.end()) {
+        return it->second;
+    }
+
+    return default_;
+}
+
+SrsVhostSnapshot *srs_config_compile_vhost(ISrsAppConfig *config, string vhost)
+{
+    SrsVhostSnapshot *v = new SrsVhostSnapshot();
+
+    v->enabled_ = config->get_vhost_enabled(vhost);
+    v->is_edge_ = config->get_vhost_is_edge(vhost);
+    v->edge_token_traverse_ = config->get_vhost_edge_token_traverse(vhost);
+    v->http_hooks_enabled_ = config->get_vhost_http_hooks_enabled(vhost);
+    v->debug_srs_upnode_ = config->get_debug_srs_upnode(vhost);
+    v->refer_enabled_ = config->get_refer_enabled(vhost);
+
+    v->gop_cache_ = config->get_gop_cache(vhost);
+    v->gop_cache_max_frames_ = config->get_gop_cache_max_frames(vhost);
+    v->queue_length_ = config->get_queue_length(vhost);
+    v->atc_ = config->get_atc(vhost);
+    v->atc_auto_ = config->get_atc_auto(vhost);
+    v->time_jitter_ = config->get_time_jitter(vhost);
+    v->mix_correct_ = config->get_mix_correct(vhost);
+    v->realtime_enabled_ = config->get_realtime_enabled(vhost, false);
+    v->realtime_enabled_rtc_ = config->get_realtime_enabled(vhost, true);
+    v->tcp_nodelay_ = config->get_tcp_nodelay(vhost);
+    v->send_min_interval_ = config->get_send_min_interval(vhost);
+    v->reduce_sequence_header_ = config->get_reduce_sequence_header(vhost);
+
+    v->mr_enabled_ = config->get_mr_enabled(vhost);
+    v->mr_sleep_ = config->get_mr_sleep(vhost);
+    v->parse_sps_ = config->get_parse_sps(vhost);
+    v->publish_1stpkt_timeout_ = config->get_publish_1stpkt_timeout(vhost);
+    v->publish_normal_timeout_ = config->get_publish_normal_timeout(vhost);
+    v->publish_kickoff_for_idle_ = config->get_publish_kickoff_for_idle(vhost);
+
+    v->chunk_size_ = config->get_chunk_size(vhost);
+    v->in_ack_size_ = config->get_in_ack_size(vhost);
+    v->out_ack_size_ = config->get_out_ack_size(vhost);
+
+    v->rtc_enabled_ = config->get_rtc_enabled(vhost);
+    v->rtc_from_rtmp_ = config->get_rtc_from_rtmp(vhost);
+    v->rtc_to_rtmp_ = config->get_rtc_to_rtmp(vhost);
+    v->rtc_nack_enabled_ = config->get_rtc_nack_enabled(vhost);
+    v->rtc_nack_no_copy_ = config->get_rtc_nack_no_copy(vhost);
+    v->rtc_twcc_enabled_ = config->get_rtc_twcc_enabled(vhost);
+    v->rtc_keep_original_ssrc_ = config->get_rtc_keep_original_ssrc(vhost);
+    v->rtc_drop_for_pt_ = config->get_rtc_drop_for_pt(vhost);
+    v->rtc_stun_timeout_ = config->get_rtc_stun_timeout(vhost);
+    v->rtc_stun_strict_check_ = config->get_rtc_stun_strict_check(vhost);
+    v->rtc_init_rate_from_sdp_ = config->get_rtc_init_rate_from_sdp(vhost);
+
+    v->rtsp_enabled_ = config->get_rtsp_enabled(vhost);
+    v->rtsp_from_rtmp_ = config->get_rtsp_from_rtmp(vhost);
+    v->srt_enabled_ = config->get_srt_enabled(vhost);
+    v->srt_to_rtmp_ = config->get_srt_to_rtmp(vhost);
+
+    return v;
+}
+
 SrsConfig::SrsConfig()
 {
     env_only_ = false;
@@ -1403,6 +1543,8 @@ SrsConfig::SrsConfig()
 
     env_cache_ = new SrsConfDirective();
     env_cache_->name_ = "env_cache_";
+
+    compiling_ = false;
 }
 
 SrsConfig::~SrsConfig()
@@ -1478,6 +1620,9 @@ srs_error_t SrsConfig::reload_conf(SrsConfig *conf)
     root_ = conf->root_;
     conf->root_ = NULL;
 
+    // Publish the compiled config of new root, while the old one is still available for its holders.
+    compile_snapshot();
+
     // merge config.
     std::vector<ISrsReloadHandler *>::iterator it;
 
@@ -1525,6 +1670,19 @@ srs_error_t SrsConfig::reload_conf(SrsConfig *conf)
             }
             srs_trace("vhost %s reload chunk_size success.", vhost.c_str());
         }
+
+        // http_static.segment_cache, the memory budget of segment cache.
+        SrsConfDirective *old_static = old_vhost->get("http_static");
+        SrsConfDirective *new_static = new_vhost->get("http_static");
+        if (!srs_directive_equals(new_static ? new_static->get("segment_cache") : NULL, old_static ? old_static->get("segment_cache") : NULL)) {
+            for (it = subscribes_.begin(); it != subscribes_.end(); ++it) {
+                ISrsReloadHandler *subscribe = *it;
+                if ((err = subscribe->on_reload_vhost_segment_cache(vhost)) != srs_success) {
+                    return srs_error_wrap(err, "vhost %s notify subscribes segment_cache failed", vhost.c_str());
+                }
+            }
+            srs_trace("vhost %s reload segment_cache success.", vhost.c_str());
+        }
     }
 
     return err;
@@ -1627,6 +1785,9 @@ srs_error_t SrsConfig::parse_options(int argc, char **argv)
             root_->get_or_create("vhost", "__defaultVhost__");
     }
 
+    // The root is transformed, so compile it again when used.
+    snapshot_ = SrsSharedPtr<SrsConfigSnapshot>(NULL);
+
     // Ignore any error while detecting docker.
     if ((err = srs_detect_docker()) != srs_success) {
         srs_freep(err);
@@ -1890,7 +2051,7 @@ srs_error_t SrsConfig::check_normal_config()
     for (int i = 0; i < (int)root_->directives_.size(); i++) {
         SrsConfDirective *conf = root_->at(i);
         std::string n = conf->name_;
-        if (n != "pid" && n != "ff_log_dir" && n != "srs_log_tank" && n != "srs_log_level" && n != "srs_log_level_v2" && n != "srs_log_file" && n != "max_connections" && n != "daemon" && n != "heartbeat" && n != "tencentcloud_apm" && n != "http_api" && n != "stats" && n != "vhost" && n != "pithy_print_ms" && n != "http_server" && n != "stream_caster" && n != "rtc_server" && n != "srt_server" && n != "utc_time" && n != "work_dir" && n != "asprocess" && n != "server_id" && n != "ff_log_level" && n != "grace_final_wait" && n != "force_grace_quit" && n != "grace_start_wait" && n != "empty_ip_ok" && n != "disable_daemon_for_docker" && n != "inotify_auto_reload" && n != "auto_reload_for_docker" && n != "tcmalloc_release_rate" && n != "query_latest_version" && n != "first_wait_for_qlv" && n != "circuit_breaker" && n != "is_full" && n != "in_docker" && n != "tencentcloud_cls" && n != "exporter" && n != "rtsp_server" && n != "rtmp" && n != "rtmps") {
+        if (n != "pid" && n != "ff_log_dir" && n != "srs_log_tank" && n != "srs_log_level" && n != "srs_log_level_v2" && n != "srs_log_file" && n != "srs_log_async" && n != "srs_log_limit" && n != "max_connections" && n != "media_memory_budget" && n != "daemon" && n != "heartbeat" && n != "tencentcloud_apm" && n != "http_api" && n != "stats" && n != "vhost" && n != "pithy_print_ms" && n != "http_server" && n != "stream_caster" && n != "rtc_server" && n != "srt_server" && n != "utc_time" && n != "work_dir" && n != "asprocess" && n != "server_id" && n != "ff_log_level" && n != "grace_final_wait" && n != "force_grace_quit" && n != "grace_start_wait" && n != "empty_ip_ok" && n != "disable_daemon_for_docker" && n != "inotify_auto_reload" && n != "auto_reload_for_docker" && n != "tcmalloc_release_rate" && n != "query_latest_version" && n != "first_wait_for_qlv" && n != "circuit_breaker" && n != "is_full" && n != "in_docker" && n != "tencentcloud_cls" && n != "exporter" && n != "rtsp_server" && n != "rtmp" && n != "rtmps" && n != "workers" && n != "async_io" && n != "ingest_thread" && n != "hooks_dispatcher") {
             return srs_error_new(ERROR_SYSTEM_CONFIG_INVALID, "illegal directive %s", n.c_str());
         }
     }
@@ -1962,7 +2123,7 @@ srs_error_t SrsConfig::check_normal_config()
         SrsConfDirective *conf = root_->get("rtc_server");
         for (int i = 0; conf && i < (int)conf->directives_.size(); i++) {
             string n = conf->at(i)->name_;
-            if (n != "enabled" && n != "listen" && n != "dir" && n != "candidate" && n != "ecdsa" && n != "tcp" && n != "encrypt" && n != "reuseport" && n != "merge_nalus" && n != "black_hole" && n != "protocol" && n != "ip_family" && n != "api_as_candidates" && n != "resolve_api_domain" && n != "keep_api_domain" && n != "use_auto_detect_network_ip") {
+            if (n != "enabled" && n != "listen" && n != "dir" && n != "candidate" && n != "ecdsa" && n != "tcp" && n != "encrypt" && n != "reuseport" && n != "merge_nalus" && n != "sendmmsg" && n != "recvmmsg" && n != "gso" && n != "black_hole" && n != "protocol" && n != "ip_family" && n != "api_as_candidates" && n != "resolve_api_domain" && n != "keep_api_domain" && n != "use_auto_detect_network_ip") {
                 return srs_error_new(ERROR_SYSTEM_CONFIG_INVALID, "illegal rtc_server.%s", n.c_str());
             }
         }
@@ -2220,7 +2381,7 @@ srs_error_t SrsConfig::check_normal_config()
             if (n == "dvr") {
                 for (int j = 0; j < (int)conf->directives_.size(); j++) {
                     string m = conf->at(j)->name_;
-                    if (m != "enabled" && m != "dvr_apply" && m != "dvr_path" && m != "dvr_plan" && m != "dvr_duration" && m != "dvr_wait_keyframe" && m != "time_jitter") {
+                    if (m != "enabled" && m != "dvr_apply" && m != "dvr_path" && m != "dvr_plan" && m != "dvr_duration" && m != "dvr_wait_keyframe" && m != "dvr_mp4_fragment" && m != "time_jitter") {
                         return srs_error_new(ERROR_SYSTEM_CONFIG_INVALID, "illegal vhost.dvr.%s of %s", m.c_str(), vhost->arg0().c_str());
                     }
                 }
@@ -2269,7 +2430,7 @@ srs_error_t SrsConfig::check_normal_config()
             } else if (n == "http_static") {
                 for (int j = 0; j < (int)conf->directives_.size(); j++) {
                     string m = conf->at(j)->name_;
-                    if (m != "enabled" && m != "mount" && m != "dir") {
+                    if (m != "enabled" && m != "mount" && m != "dir" && m != "segment_cache") {
                         return srs_error_new(ERROR_SYSTEM_CONFIG_INVALID, "illegal vhost.http_static.%s of %s", m.c_str(), vhost->arg0().c_str());
                     }
                 }
@@ -2290,7 +2451,7 @@ srs_error_t SrsConfig::check_normal_config()
             } else if (n == "hls") {
                 for (int j = 0; j < (int)conf->directives_.size(); j++) {
                     string m = conf->at(j)->name_;
-                    if (m != "enabled" && m != "hls_entry_prefix" && m != "hls_path" && m != "hls_fragment" && m != "hls_window" && m != "hls_on_error" && m != "hls_storage" && m != "hls_mount" && m != "hls_td_ratio" && m != "hls_aof_ratio" && m != "hls_acodec" && m != "hls_vcodec" && m != "hls_m3u8_file" && m != "hls_ts_file" && m != "hls_ts_floor" && m != "hls_cleanup" && m != "hls_nb_notify" && m != "hls_wait_keyframe" && m != "hls_dispose" && m != "hls_keys" && m != "hls_fragments_per_key" && m != "hls_key_file" && m != "hls_key_file_path" && m != "hls_key_url" && m != "hls_dts_directly" && m != "hls_ctx" && m != "hls_ts_ctx" && m != "hls_use_fmp4" && m != "hls_fmp4_file" && m != "hls_init_file" && m != "hls_recover" && m != "hls_master_m3u8_path_relative") {
+                    if (m != "enabled" && m != "hls_entry_prefix" && m != "hls_path" && m != "hls_fragment" && m != "hls_window" && m != "hls_on_error" && m != "hls_storage" && m != "hls_mount" && m != "hls_td_ratio" && m != "hls_aof_ratio" && m != "hls_acodec" && m != "hls_vcodec" && m != "hls_m3u8_file" && m != "hls_ts_file" && m != "hls_ts_floor" && m != "hls_cleanup" && m != "hls_nb_notify" && m != "hls_wait_keyframe" && m != "hls_dispose" && m != "hls_keys" && m != "hls_fragments_per_key" && m != "hls_key_file" && m != "hls_key_file_path" && m != "hls_key_url" && m != "hls_dts_directly" && m != "hls_ctx" && m != "hls_ts_ctx" && m != "hls_use_fmp4" && m != "hls_fmp4_file" && m != "hls_init_file" && m != "hls_recover" && m != "hls_master_m3u8_path_relative" && m != "hls_ll" && m != "hls_part" && m != "hls_ll_persist") {
                         return srs_error_new(ERROR_SYSTEM_CONFIG_INVALID, "illegal vhost.hls.%s of %s", m.c_str(), vhost->arg0().c_str());
                     }
 
@@ -2499,6 +2660,7 @@ srs_error_t SrsConfig::parse_buffer(SrsConfigBuffer *buffer)
     // We use a new root to parse buffer, to allow parse multiple times.
     srs_freep(root_);
     root_ = new SrsConfDirective();
+    snapshot_ = SrsSharedPtr<SrsConfigSnapshot>(NULL);
 
     // Parse root tree from buffer.
     if ((err = root_->parse(buffer, this)) != srs_success) {
@@ -2659,6 +2821,23 @@ int SrsConfig::get_max_connections()
     return ::atoi(conf->arg0().c_str());
 }
 
+int64_t SrsConfig::get_media_memory_budget()
+{
+    // SRS_MEDIA_MEMORY_BUDGET, in MB.
+    if (!srs_getenv("srs.media_memory_budget").empty()) {
+        return (int64_t)::atoi(srs_getenv("srs.media_memory_budget").c_str()) * 1024 * 1024;
+    }
+
+    static int64_t DEFAULT = 0;
+
+    SrsConfDirective *conf = root_->get("media_memory_budget");
+    if (!conf || conf->arg0().empty()) {
+        return DEFAULT;
+    }
+
+    return (int64_t)::atoi(conf->arg0().c_str()) * 1024 * 1024;
+}
+
 vector<string> SrsConfig::get_listens()
 {
     std::vector<string> ports;
@@ -3037,6 +3216,291 @@ int SrsConfig::get_dying_pulse()
     return ::atoi(conf->arg0().c_str());
 }
 
+bool SrsConfig::get_workers_enabled()
+{
+    SRS_OVERWRITE_BY_ENV_BOOL("srs.workers.enabled"); // SRS_WORKERS_ENABLED
+
+    static bool DEFAULT = false;
+
+    SrsConfDirective *conf = root_->get("workers");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    conf = conf->get("enabled");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    return SRS_CONF_PREFER_FALSE(conf->arg0());
+}
+
+int SrsConfig::get_workers_count()
+{
+    SRS_OVERWRITE_BY_ENV_INT("srs.workers.count"); // SRS_WORKERS_COUNT
+
+    static int DEFAULT = 0;
+
+    SrsConfDirective *conf = root_->get("workers");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    conf = conf->get("count");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    return srs_max(0, ::atoi(conf->arg0().c_str()));
+}
+
+bool SrsConfig::get_workers_cpu_affinity()
+{
+    SRS_OVERWRITE_BY_ENV_BOOL2("srs.workers.cpu_affinity"); // SRS_WORKERS_CPU_AFFINITY
+
+    static bool DEFAULT = true;
+
+    SrsConfDirective *conf = root_->get("workers");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    conf = conf->get("cpu_affinity");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    return SRS_CONF_PREFER_TRUE(conf->arg0());
+}
+
+int SrsConfig::get_workers_relay_port()
+{
+    SRS_OVERWRITE_BY_ENV_INT("srs.workers.relay_port"); // SRS_WORKERS_RELAY_PORT
+
+    static int DEFAULT = 19350;
+
+    SrsConfDirective *conf = root_->get("workers");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    conf = conf->get("relay_port");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    return ::atoi(conf->arg0().c_str());
+}
+
+bool SrsConfig::get_async_io_enabled()
+{
+    SRS_OVERWRITE_BY_ENV_BOOL("srs.async_io.enabled"); // SRS_ASYNC_IO_ENABLED
+
+    static bool DEFAULT = false;
+
+    SrsConfDirective *conf = root_->get("async_io");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    conf = conf->get("enabled");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    return SRS_CONF_PREFER_FALSE(conf->arg0());
+}
+
+int SrsConfig::get_async_io_threads()
+{
+    SRS_OVERWRITE_BY_ENV_INT("srs.async_io.threads"); // SRS_ASYNC_IO_THREADS
+
+    static int DEFAULT = 2;
+
+    SrsConfDirective *conf = root_->get("async_io");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    conf = conf->get("threads");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    return srs_max(1, ::atoi(conf->arg0().c_str()));
+}
+
+int SrsConfig::get_async_io_queue()
+{
+    SRS_OVERWRITE_BY_ENV_INT("srs.async_io.queue"); // SRS_ASYNC_IO_QUEUE
+
+    static int DEFAULT = 1024;
+
+    SrsConfDirective *conf = root_->get("async_io");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    conf = conf->get("queue");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    return srs_max(1, ::atoi(conf->arg0().c_str()));
+}
+
+bool SrsConfig::get_ingest_thread_enabled()
+{
+    SRS_OVERWRITE_BY_ENV_BOOL("srs.ingest_thread.enabled"); // SRS_INGEST_THREAD_ENABLED
+
+    static bool DEFAULT = false;
+
+    SrsConfDirective *conf = root_->get("ingest_thread");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    conf = conf->get("enabled");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    return SRS_CONF_PREFER_FALSE(conf->arg0());
+}
+
+int SrsConfig::get_ingest_threads()
+{
+    SRS_OVERWRITE_BY_ENV_INT("srs.ingest_thread.threads"); // SRS_INGEST_THREAD_THREADS
+
+    static int DEFAULT = 2;
+
+    SrsConfDirective *conf = root_->get("ingest_thread");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    conf = conf->get("threads");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    return srs_max(1, ::atoi(conf->arg0().c_str()));
+}
+
+int SrsConfig::get_ingest_thread_queue()
+{
+    SRS_OVERWRITE_BY_ENV_INT("srs.ingest_thread.queue"); // SRS_INGEST_THREAD_QUEUE
+
+    static int DEFAULT = 4096;
+
+    SrsConfDirective *conf = root_->get("ingest_thread");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    conf = conf->get("queue");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    return srs_max(2, ::atoi(conf->arg0().c_str()));
+}
+
+int SrsConfig::get_hooks_keepalive()
+{
+    SRS_OVERWRITE_BY_ENV_INT("srs.hooks_dispatcher.keepalive"); // SRS_HOOKS_DISPATCHER_KEEPALIVE
+
+    static int DEFAULT = 0;
+
+    SrsConfDirective *conf = root_->get("hooks_dispatcher");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    conf = conf->get("keepalive");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    return srs_max(0, ::atoi(conf->arg0().c_str()));
+}
+
+int SrsConfig::get_hooks_concurrency()
+{
+    SRS_OVERWRITE_BY_ENV_INT("srs.hooks_dispatcher.concurrency"); // SRS_HOOKS_DISPATCHER_CONCURRENCY
+
+    static int DEFAULT = 0;
+
+    SrsConfDirective *conf = root_->get("hooks_dispatcher");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    conf = conf->get("concurrency");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    return srs_max(0, ::atoi(conf->arg0().c_str()));
+}
+
+srs_utime_t SrsConfig::get_hooks_play_cache_ttl()
+{
+    SRS_OVERWRITE_BY_ENV_SECONDS("srs.hooks_dispatcher.play_cache_ttl"); // SRS_HOOKS_DISPATCHER_PLAY_CACHE_TTL
+
+    static srs_utime_t DEFAULT = 0;
+
+    SrsConfDirective *conf = root_->get("hooks_dispatcher");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    conf = conf->get("play_cache_ttl");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    return (srs_utime_t)(::atoi(conf->arg0().c_str()) * SRS_UTIME_SECONDS);
+}
+
+bool SrsConfig::get_hooks_async_notify()
+{
+    SRS_OVERWRITE_BY_ENV_BOOL("srs.hooks_dispatcher.async_notify"); // SRS_HOOKS_DISPATCHER_ASYNC_NOTIFY
+
+    static bool DEFAULT = false;
+
+    SrsConfDirective *conf = root_->get("hooks_dispatcher");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    conf = conf->get("async_notify");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    return SRS_CONF_PREFER_FALSE(conf->arg0());
+}
+
+int SrsConfig::get_hooks_retry_queue()
+{
+    SRS_OVERWRITE_BY_ENV_INT("srs.hooks_dispatcher.retry_queue"); // SRS_HOOKS_DISPATCHER_RETRY_QUEUE
+
+    static int DEFAULT = 1024;
+
+    SrsConfDirective *conf = root_->get("hooks_dispatcher");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    conf = conf->get("retry_queue");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    return srs_max(1, ::atoi(conf->arg0().c_str()));
+}
+
 bool SrsConfig::get_exporter_enabled()
 {
     SRS_OVERWRITE_BY_ENV_BOOL("srs.exporter.enabled"); // SRS_EXPORTER_ENABLED
@@ -3262,6 +3726,11 @@ SrsConfDirective *SrsConfig::get_rtsp(string vhost)
 
 bool SrsConfig::get_rtsp_enabled(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->rtsp_enabled_;
+    }
+
     SRS_OVERWRITE_BY_ENV_BOOL("srs.vhost.rtsp.enabled"); // SRS_VHOST_RTSP_ENABLED
 
     static bool DEFAULT = false;
@@ -3282,6 +3751,11 @@ bool SrsConfig::get_rtsp_enabled(string vhost)
 
 bool SrsConfig::get_rtsp_from_rtmp(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->rtsp_from_rtmp_;
+    }
+
     SRS_OVERWRITE_BY_ENV_BOOL("srs.vhost.rtsp.rtmp_to_rtsp"); // SRS_VHOST_RTSP_RTMP_TO_RTSP
 
     static bool DEFAULT = true;
@@ -3618,21 +4092,78 @@ int SrsConfig::get_rtc_server_reuseport()
     }
 #endif
 
-    return v;
+    return v;
+}
+
+int SrsConfig::get_rtc_server_reuseport2()
+{
+    SRS_OVERWRITE_BY_ENV_INT("srs.rtc_server.reuseport"); // SRS_RTC_SERVER_REUSEPORT
+
+    static int DEFAULT = 1;
+
+    SrsConfDirective *conf = root_->get("rtc_server");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    conf = conf->get("reuseport");
+    if (!conf || conf->arg0().empty()) {
+        return DEFAULT;
+    }
+
+    return ::atoi(conf->arg0().c_str());
+}
+
+bool SrsConfig::get_rtc_server_merge_nalus()
+{
+    SRS_OVERWRITE_BY_ENV_BOOL("srs.rtc_server.merge_nalus"); // SRS_RTC_SERVER_MERGE_NALUS
+
+    static int DEFAULT = false;
+
+    SrsConfDirective *conf = root_->get("rtc_server");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    conf = conf->get("merge_nalus");
+    if (!conf || conf->arg0().empty()) {
+        return DEFAULT;
+    }
+
+    return SRS_CONF_PREFER_FALSE(conf->arg0());
+}
+
+int SrsConfig::get_rtc_server_sendmmsg()
+{
+    SRS_OVERWRITE_BY_ENV_INT("srs.rtc_server.sendmmsg"); // SRS_RTC_SERVER_SENDMMSG
+
+    static int DEFAULT = 16;
+
+    SrsConfDirective *conf = root_->get("rtc_server");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    conf = conf->get("sendmmsg");
+    if (!conf || conf->arg0().empty()) {
+        return DEFAULT;
+    }
+
+    return ::atoi(conf->arg0().c_str());
 }
 
-int SrsConfig::get_rtc_server_reuseport2()
+int SrsConfig::get_rtc_server_recvmmsg()
 {
-    SRS_OVERWRITE_BY_ENV_INT("srs.rtc_server.reuseport"); // SRS_RTC_SERVER_REUSEPORT
+    SRS_OVERWRITE_BY_ENV_INT("srs.rtc_server.recvmmsg"); // SRS_RTC_SERVER_RECVMMSG
 
-    static int DEFAULT = 1;
+    static int DEFAULT = 16;
 
     SrsConfDirective *conf = root_->get("rtc_server");
     if (!conf) {
         return DEFAULT;
     }
 
-    conf = conf->get("reuseport");
+    conf = conf->get("recvmmsg");
     if (!conf || conf->arg0().empty()) {
         return DEFAULT;
     }
@@ -3640,18 +4171,18 @@ int SrsConfig::get_rtc_server_reuseport2()
     return ::atoi(conf->arg0().c_str());
 }
 
-bool SrsConfig::get_rtc_server_merge_nalus()
+bool SrsConfig::get_rtc_server_gso()
 {
-    SRS_OVERWRITE_BY_ENV_BOOL("srs.rtc_server.merge_nalus"); // SRS_RTC_SERVER_MERGE_NALUS
+    SRS_OVERWRITE_BY_ENV_BOOL("srs.rtc_server.gso"); // SRS_RTC_SERVER_GSO
 
-    static int DEFAULT = false;
+    static bool DEFAULT = false;
 
     SrsConfDirective *conf = root_->get("rtc_server");
     if (!conf) {
         return DEFAULT;
     }
 
-    conf = conf->get("merge_nalus");
+    conf = conf->get("gso");
     if (!conf || conf->arg0().empty()) {
         return DEFAULT;
     }
@@ -3715,6 +4246,11 @@ SrsConfDirective *SrsConfig::get_rtc(string vhost)
 
 bool SrsConfig::get_rtc_enabled(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->rtc_enabled_;
+    }
+
     SRS_OVERWRITE_BY_ENV_BOOL("srs.vhost.rtc.enabled"); // SRS_VHOST_RTC_ENABLED
 
     static bool DEFAULT = false;
@@ -3775,6 +4311,11 @@ bool SrsConfig::get_rtc_keep_avc_nalu_sei(std::string vhost)
 
 bool SrsConfig::get_rtc_from_rtmp(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->rtc_from_rtmp_;
+    }
+
     SRS_OVERWRITE_BY_ENV_BOOL("srs.vhost.rtc.rtmp_to_rtc"); // SRS_VHOST_RTC_RTMP_TO_RTC
 
     static bool DEFAULT = false;
@@ -3795,6 +4336,11 @@ bool SrsConfig::get_rtc_from_rtmp(string vhost)
 
 srs_utime_t SrsConfig::get_rtc_stun_timeout(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->rtc_stun_timeout_;
+    }
+
     SRS_OVERWRITE_BY_ENV_SECONDS("srs.vhost.rtc.stun_timeout"); // SRS_VHOST_RTC_STUN_TIMEOUT
 
     static srs_utime_t DEFAULT = 30 * SRS_UTIME_SECONDS;
@@ -3815,6 +4361,11 @@ srs_utime_t SrsConfig::get_rtc_stun_timeout(string vhost)
 
 bool SrsConfig::get_rtc_stun_strict_check(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->rtc_stun_strict_check_;
+    }
+
     SRS_OVERWRITE_BY_ENV_BOOL("srs.vhost.rtc.stun_strict_check"); // SRS_VHOST_RTC_STUN_STRICT_CHECK
 
     static bool DEFAULT = false;
@@ -3875,6 +4426,11 @@ std::string SrsConfig::get_rtc_dtls_version(string vhost)
 
 int SrsConfig::get_rtc_drop_for_pt(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->rtc_drop_for_pt_;
+    }
+
     SRS_OVERWRITE_BY_ENV_INT("srs.vhost.rtc.drop_for_pt"); // SRS_VHOST_RTC_DROP_FOR_PT
 
     static int DEFAULT = 0;
@@ -3894,6 +4450,11 @@ int SrsConfig::get_rtc_drop_for_pt(string vhost)
 
 bool SrsConfig::get_rtc_to_rtmp(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->rtc_to_rtmp_;
+    }
+
     SRS_OVERWRITE_BY_ENV_BOOL("srs.vhost.rtc.rtc_to_rtmp"); // SRS_VHOST_RTC_RTC_TO_RTMP
 
     static bool DEFAULT = false;
@@ -3942,6 +4503,11 @@ srs_utime_t SrsConfig::get_rtc_pli_for_rtmp(string vhost)
 
 bool SrsConfig::get_rtc_nack_enabled(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->rtc_nack_enabled_;
+    }
+
     SRS_OVERWRITE_BY_ENV_BOOL2("srs.vhost.rtc.nack"); // SRS_VHOST_RTC_NACK
 
     static bool DEFAULT = true;
@@ -3961,6 +4527,11 @@ bool SrsConfig::get_rtc_nack_enabled(string vhost)
 
 bool SrsConfig::get_rtc_nack_no_copy(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->rtc_nack_no_copy_;
+    }
+
     SRS_OVERWRITE_BY_ENV_BOOL2("srs.vhost.rtc.nack_no_copy"); // SRS_VHOST_RTC_NACK_NO_COPY
 
     static bool DEFAULT = true;
@@ -3980,6 +4551,11 @@ bool SrsConfig::get_rtc_nack_no_copy(string vhost)
 
 bool SrsConfig::get_rtc_twcc_enabled(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->rtc_twcc_enabled_;
+    }
+
     SRS_OVERWRITE_BY_ENV_BOOL2("srs.vhost.rtc.twcc"); // SRS_VHOST_RTC_TWCC
 
     static bool DEFAULT = true;
@@ -4067,6 +4643,11 @@ int SrsConfig::get_rtc_aac_bitrate(string vhost)
 
 bool SrsConfig::get_rtc_init_rate_from_sdp(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->rtc_init_rate_from_sdp_;
+    }
+
     SRS_OVERWRITE_BY_ENV_BOOL("srs.vhost.rtc.init_rate_from_sdp"); // SRS_VHOST_RTC_INIT_RATE_FROM_SDP
 
     static bool DEFAULT = false;
@@ -4086,6 +4667,11 @@ bool SrsConfig::get_rtc_init_rate_from_sdp(string vhost)
 
 bool SrsConfig::get_rtc_keep_original_ssrc(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->rtc_keep_original_ssrc_;
+    }
+
     SRS_OVERWRITE_BY_ENV_BOOL("srs.vhost.rtc.keep_original_ssrc"); // SRS_VHOST_RTC_KEEP_ORIGINAL_SSRC
 
     static bool DEFAULT = false;
@@ -4103,10 +4689,24 @@ bool SrsConfig::get_rtc_keep_original_ssrc(string vhost)
     return SRS_CONF_PREFER_FALSE(conf->arg0());
 }
 
-SrsConfDirective *SrsConfig::get_vhost(string vhost, bool try_default_vhost)
+SrsSharedPtr<SrsConfigSnapshot> SrsConfig::snapshot()
+{
+    if (!snapshot_.get()) {
+        compile_snapshot();
+    }
+
+    return snapshot_;
+}
+
+void SrsConfig::compile_snapshot()
 {
     srs_assert(root_);
 
+    SrsConfigSnapshot *snapshot = new SrsConfigSnapshot();
+    snapshot_ = SrsSharedPtr<SrsConfigSnapshot>(snapshot);
+
+    // Index the vhosts first, because the getters use it while compiling.
+    vhost_directives_.clear();
     for (int i = 0; i < (int)root_->directives_.size(); i++) {
         SrsConfDirective *conf = root_->at(i);
 
@@ -4114,13 +4714,57 @@ SrsConfDirective *SrsConfig::get_vhost(string vhost, bool try_default_vhost)
             continue;
         }
 
-        if (conf->arg0() == vhost) {
-            return conf;
+        if (vhost_directives_.find(conf->arg0()) == vhost_directives_.end()) {
+            vhost_directives_[conf->arg0()] = conf;
         }
     }
 
+    compiling_ = true;
+
+    std::map<std::string, SrsConfDirective *>::iterator it;
+    for (it = vhost_directives_.begin(); it != vhost_directives_.end(); ++it) {
+        snapshot->vhosts_[it->first] = srs_config_compile_vhost(this, it->first);
+    }
+
+    // For vhost not in config, the getters fallback to default vhost, or use default values.
+    snapshot->default_ = srs_config_compile_vhost(this, SRS_CONSTS_RTMP_DEFAULT_VHOST);
+
+    compiling_ = false;
+}
+
+SrsVhostSnapshot *SrsConfig::vhost_snapshot(const string &vhost)
+{
+    // While compiling, the getters read the directives.
+    if (compiling_) {
+        return NULL;
+    }
+
+    if (!snapshot_.get()) {
+        compile_snapshot();
+    }
+
+    return snapshot_->vhost(vhost);
+}
+
+SrsConfDirective *SrsConfig::get_vhost(string vhost, bool try_default_vhost)
+{
+    srs_assert(root_);
+
+    if (!snapshot_.get()) {
+        compile_snapshot();
+    }
+
+    std::map<std::string, SrsConfDirective *> &directives = vhost_directives_;
+    std::map<std::string, SrsConfDirective *>::iterator it = directives.find(vhost);
+    if (it != directives.end()) {
+        return it->second;
+    }
+
     if (try_default_vhost && vhost != SRS_CONSTS_RTMP_DEFAULT_VHOST) {
-        return get_vhost(SRS_CONSTS_RTMP_DEFAULT_VHOST);
+        it = directives.find(SRS_CONSTS_RTMP_DEFAULT_VHOST);
+        if (it != directives.end()) {
+            return it->second;
+        }
     }
 
     return NULL;
@@ -4143,6 +4787,11 @@ void SrsConfig::get_vhosts(vector<SrsConfDirective *> &vhosts)
 
 bool SrsConfig::get_vhost_enabled(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->enabled_;
+    }
+
     SrsConfDirective *conf = get_vhost(vhost);
 
     return get_vhost_enabled(conf);
@@ -4168,6 +4817,11 @@ bool SrsConfig::get_vhost_enabled(SrsConfDirective *conf)
 
 bool SrsConfig::get_gop_cache(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->gop_cache_;
+    }
+
     SRS_OVERWRITE_BY_ENV_BOOL2("srs.vhost.play.gop_cache"); // SRS_VHOST_PLAY_GOP_CACHE
 
     SrsConfDirective *conf = get_vhost(vhost);
@@ -4190,6 +4844,11 @@ bool SrsConfig::get_gop_cache(string vhost)
 
 int SrsConfig::get_gop_cache_max_frames(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->gop_cache_max_frames_;
+    }
+
     SRS_OVERWRITE_BY_ENV_INT("srs.vhost.play.gop_cache_max_frames"); // SRS_VHOST_PLAY_GOP_CACHE_MAX_FRAMES
 
     static int DEFAULT = 2500;
@@ -4214,6 +4873,11 @@ int SrsConfig::get_gop_cache_max_frames(string vhost)
 
 bool SrsConfig::get_debug_srs_upnode(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->debug_srs_upnode_;
+    }
+
     static bool DEFAULT = true;
 
     SrsConfDirective *conf = get_vhost(vhost);
@@ -4236,6 +4900,11 @@ bool SrsConfig::get_debug_srs_upnode(string vhost)
 
 bool SrsConfig::get_atc(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->atc_;
+    }
+
     SRS_OVERWRITE_BY_ENV_BOOL("srs.vhost.play.atc"); // SRS_VHOST_PLAY_ATC
 
     static bool DEFAULT = false;
@@ -4260,6 +4929,11 @@ bool SrsConfig::get_atc(string vhost)
 
 bool SrsConfig::get_atc_auto(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->atc_auto_;
+    }
+
     SRS_OVERWRITE_BY_ENV_BOOL("srs.vhost.play.atc_auto"); // SRS_VHOST_PLAY_ATC_AUTO
 
     static bool DEFAULT = false;
@@ -4284,6 +4958,11 @@ bool SrsConfig::get_atc_auto(string vhost)
 
 int SrsConfig::get_time_jitter(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->time_jitter_;
+    }
+
     if (!srs_getenv("srs.vhost.play.time_jitter").empty()) { // SRS_VHOST_PLAY_TIME_JITTER
         return srs_time_jitter_string2int(srs_getenv("srs.vhost.play.time_jitter"));
     }
@@ -4310,6 +4989,11 @@ int SrsConfig::get_time_jitter(string vhost)
 
 bool SrsConfig::get_mix_correct(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->mix_correct_;
+    }
+
     SRS_OVERWRITE_BY_ENV_BOOL("srs.vhost.play.mix_correct"); // SRS_VHOST_PLAY_MIX_CORRECT
 
     static bool DEFAULT = false;
@@ -4334,6 +5018,11 @@ bool SrsConfig::get_mix_correct(string vhost)
 
 srs_utime_t SrsConfig::get_queue_length(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->queue_length_;
+    }
+
     SRS_OVERWRITE_BY_ENV_SECONDS("srs.vhost.play.queue_length"); // SRS_VHOST_PLAY_QUEUE_LENGTH
 
     static srs_utime_t DEFAULT = SRS_PERF_PLAY_QUEUE;
@@ -4358,6 +5047,11 @@ srs_utime_t SrsConfig::get_queue_length(string vhost)
 
 bool SrsConfig::get_refer_enabled(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->refer_enabled_;
+    }
+
     static bool DEFAULT = false;
 
     SrsConfDirective *conf = get_vhost(vhost);
@@ -4431,6 +5125,11 @@ SrsConfDirective *SrsConfig::get_refer_publish(string vhost)
 
 int SrsConfig::get_in_ack_size(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->in_ack_size_;
+    }
+
     SRS_OVERWRITE_BY_ENV_INT("srs.vhost.in_ack_size"); // SRS_VHOST_IN_ACK_SIZE
 
     static int DEFAULT = 0;
@@ -4450,6 +5149,11 @@ int SrsConfig::get_in_ack_size(string vhost)
 
 int SrsConfig::get_out_ack_size(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->out_ack_size_;
+    }
+
     SRS_OVERWRITE_BY_ENV_INT("srs.vhost.out_ack_size"); // SRS_VHOST_OUT_ACK_SIZE
 
     static int DEFAULT = 2500000;
@@ -4469,6 +5173,11 @@ int SrsConfig::get_out_ack_size(string vhost)
 
 int SrsConfig::get_chunk_size(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->chunk_size_;
+    }
+
     SRS_OVERWRITE_BY_ENV_INT("srs.vhost.chunk_size"); // SRS_VHOST_CHUNK_SIZE
 
     if (vhost.empty()) {
@@ -4494,6 +5203,11 @@ int SrsConfig::get_chunk_size(string vhost)
 
 bool SrsConfig::get_parse_sps(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->parse_sps_;
+    }
+
     SRS_OVERWRITE_BY_ENV_BOOL2("srs.vhost.publish.parse_sps"); // SRS_VHOST_PUBLISH_PARSE_SPS
 
     static bool DEFAULT = true;
@@ -4544,6 +5258,11 @@ bool SrsConfig::try_annexb_first(string vhost)
 
 bool SrsConfig::get_mr_enabled(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->mr_enabled_;
+    }
+
     SRS_OVERWRITE_BY_ENV_BOOL("srs.vhost.publish.mr"); // SRS_VHOST_PUBLISH_MR
 
     SrsConfDirective *conf = get_vhost(vhost);
@@ -4566,6 +5285,11 @@ bool SrsConfig::get_mr_enabled(string vhost)
 
 srs_utime_t SrsConfig::get_mr_sleep(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->mr_sleep_;
+    }
+
     SRS_OVERWRITE_BY_ENV_MILLISECONDS("srs.vhost.publish.mr_latency"); // SRS_VHOST_PUBLISH_MR_LATENCY
 
     static srs_utime_t DEFAULT = SRS_PERF_MR_SLEEP;
@@ -4675,6 +5399,11 @@ int SrsConfig::get_mw_msgs(string vhost, bool is_realtime, bool is_rtc)
 
 bool SrsConfig::get_realtime_enabled(string vhost, bool is_rtc)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return is_rtc ? snapshot->realtime_enabled_rtc_ : snapshot->realtime_enabled_;
+    }
+
     if (is_rtc) {
         SRS_OVERWRITE_BY_ENV_BOOL2("srs.vhost.min_latency"); // SRS_VHOST_MIN_LATENCY
     } else {
@@ -4705,6 +5434,11 @@ bool SrsConfig::get_realtime_enabled(string vhost, bool is_rtc)
 
 bool SrsConfig::get_tcp_nodelay(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->tcp_nodelay_;
+    }
+
     SRS_OVERWRITE_BY_ENV_BOOL("srs.vhost.tcp_nodelay"); // SRS_VHOST_TCP_NODELAY
 
     static bool DEFAULT = false;
@@ -4724,6 +5458,11 @@ bool SrsConfig::get_tcp_nodelay(string vhost)
 
 srs_utime_t SrsConfig::get_send_min_interval(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->send_min_interval_;
+    }
+
     SRS_OVERWRITE_BY_ENV_FLOAT_MILLISECONDS("srs.vhost.play.send_min_interval"); // SRS_VHOST_PLAY_SEND_MIN_INTERVAL
 
     static srs_utime_t DEFAULT = 0;
@@ -4748,6 +5487,11 @@ srs_utime_t SrsConfig::get_send_min_interval(string vhost)
 
 bool SrsConfig::get_reduce_sequence_header(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->reduce_sequence_header_;
+    }
+
     SRS_OVERWRITE_BY_ENV_BOOL("srs.vhost.play.reduce_sequence_header"); // SRS_VHOST_PLAY_REDUCE_SEQUENCE_HEADER
 
     static bool DEFAULT = false;
@@ -4772,6 +5516,11 @@ bool SrsConfig::get_reduce_sequence_header(string vhost)
 
 srs_utime_t SrsConfig::get_publish_1stpkt_timeout(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->publish_1stpkt_timeout_;
+    }
+
     SRS_OVERWRITE_BY_ENV_MILLISECONDS("srs.vhost.publish.firstpkt_timeout"); // SRS_VHOST_PUBLISH_FIRSTPKT_TIMEOUT
 
     // when no msg recevied for publisher, use larger timeout.
@@ -4797,6 +5546,11 @@ srs_utime_t SrsConfig::get_publish_1stpkt_timeout(string vhost)
 
 srs_utime_t SrsConfig::get_publish_normal_timeout(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->publish_normal_timeout_;
+    }
+
     SRS_OVERWRITE_BY_ENV_MILLISECONDS("srs.vhost.publish.normal_timeout"); // SRS_VHOST_PUBLISH_NORMAL_TIMEOUT
 
     // the timeout for publish recv.
@@ -4824,6 +5578,11 @@ srs_utime_t SrsConfig::get_publish_normal_timeout(string vhost)
 
 srs_utime_t SrsConfig::get_publish_kickoff_for_idle(std::string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->publish_kickoff_for_idle_;
+    }
+
     return get_publish_kickoff_for_idle(get_vhost(vhost));
 }
 
@@ -4946,6 +5705,11 @@ SrsConfDirective *SrsConfig::get_vhost_http_hooks(string vhost)
 
 bool SrsConfig::get_vhost_http_hooks_enabled(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->http_hooks_enabled_;
+    }
+
     SRS_OVERWRITE_BY_ENV_BOOL("srs.vhost.http_hooks.enabled"); // SRS_VHOST_HTTP_HOOKS_ENABLED
 
     static bool DEFAULT = false;
@@ -5087,6 +5851,11 @@ SrsConfDirective *SrsConfig::get_vhost_on_hls_notify(string vhost)
 
 bool SrsConfig::get_vhost_is_edge(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->is_edge_;
+    }
+
     SrsConfDirective *conf = get_vhost(vhost);
     return get_vhost_is_edge(conf);
 }
@@ -5174,6 +5943,11 @@ bool SrsConfig::get_vhost_edge_follow_client(string vhost)
 
 bool SrsConfig::get_vhost_edge_token_traverse(string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->edge_token_traverse_;
+    }
+
     static bool DEFAULT = false;
 
     SrsConfDirective *conf = get_vhost(vhost);
@@ -5981,6 +6755,79 @@ string SrsConfig::get_log_file()
     return conf->arg0();
 }
 
+bool SrsConfig::get_log_async_enabled()
+{
+    SRS_OVERWRITE_BY_ENV_BOOL("srs.srs_log_async.enabled"); // SRS_SRS_LOG_ASYNC_ENABLED
+
+    static bool DEFAULT = false;
+
+    SrsConfDirective *conf = root_->get("srs_log_async");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    conf = conf->get("enabled");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    return SRS_CONF_PREFER_FALSE(conf->arg0());
+}
+
+int SrsConfig::get_log_async_buffer()
+{
+    if (!srs_getenv("srs.srs_log_async.buffer").empty()) { // SRS_SRS_LOG_ASYNC_BUFFER
+        return srs_max(64, ::atoi(srs_getenv("srs.srs_log_async.buffer").c_str())) * 1024;
+    }
+
+    static int DEFAULT = 4096 * 1024;
+
+    SrsConfDirective *conf = root_->get("srs_log_async");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    conf = conf->get("buffer");
+    if (!conf || conf->arg0().empty()) {
+        return DEFAULT;
+    }
+
+    return srs_max(64, ::atoi(conf->arg0().c_str())) * 1024;
+}
+
+string SrsConfig::get_log_async_overflow()
+{
+    SRS_OVERWRITE_BY_ENV_STRING("srs.srs_log_async.overflow"); // SRS_SRS_LOG_ASYNC_OVERFLOW
+
+    static string DEFAULT = "drop";
+
+    SrsConfDirective *conf = root_->get("srs_log_async");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    conf = conf->get("overflow");
+    if (!conf || conf->arg0().empty()) {
+        return DEFAULT;
+    }
+
+    return conf->arg0();
+}
+
+int SrsConfig::get_log_limit()
+{
+    SRS_OVERWRITE_BY_ENV_INT("srs.srs_log_limit"); // SRS_SRS_LOG_LIMIT
+
+    static int DEFAULT = 0;
+
+    SrsConfDirective *conf = root_->get("srs_log_limit");
+    if (!conf || conf->arg0().empty()) {
+        return DEFAULT;
+    }
+
+    return ::atoi(conf->arg0().c_str());
+}
+
 bool SrsConfig::get_ff_log_enabled()
 {
     string log = get_ff_log_dir();
@@ -6749,6 +7596,63 @@ bool SrsConfig::get_hls_master_m3u8_path_relative(string vhost)
     return SRS_CONF_PREFER_FALSE(conf->arg0());
 }
 
+bool SrsConfig::get_hls_ll(string vhost)
+{
+    SRS_OVERWRITE_BY_ENV_BOOL("srs.vhost.hls.hls_ll"); // SRS_VHOST_HLS_HLS_LL
+
+    static bool DEFAULT = false;
+
+    SrsConfDirective *conf = get_hls(vhost);
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    conf = conf->get("hls_ll");
+    if (!conf || conf->arg0().empty()) {
+        return DEFAULT;
+    }
+
+    return SRS_CONF_PREFER_FALSE(conf->arg0());
+}
+
+srs_utime_t SrsConfig::get_hls_part(string vhost)
+{
+    SRS_OVERWRITE_BY_ENV_FLOAT_SECONDS("srs.vhost.hls.hls_part"); // SRS_VHOST_HLS_HLS_PART
+
+    static srs_utime_t DEFAULT = 500 * SRS_UTIME_MILLISECONDS;
+
+    SrsConfDirective *conf = get_hls(vhost);
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    conf = conf->get("hls_part");
+    if (!conf || conf->arg0().empty()) {
+        return DEFAULT;
+    }
+
+    return srs_utime_t(::atof(conf->arg0().c_str()) * SRS_UTIME_SECONDS);
+}
+
+bool SrsConfig::get_hls_ll_persist(string vhost)
+{
+    SRS_OVERWRITE_BY_ENV_BOOL2("srs.vhost.hls.hls_ll_persist"); // SRS_VHOST_HLS_HLS_LL_PERSIST
+
+    static bool DEFAULT = true;
+
+    SrsConfDirective *conf = get_hls(vhost);
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    conf = conf->get("hls_ll_persist");
+    if (!conf || conf->arg0().empty()) {
+        return DEFAULT;
+    }
+
+    return SRS_CONF_PREFER_TRUE(conf->arg0());
+}
+
 bool SrsConfig::get_hls_recover(string vhost)
 {
     SRS_OVERWRITE_BY_ENV_BOOL2("srs.vhost.hls.hls_recover"); // SRS_VHOST_HLS_HLS_RECOVER
@@ -7003,6 +7907,25 @@ bool SrsConfig::get_dvr_wait_keyframe(string vhost)
     return SRS_CONF_PREFER_TRUE(conf->arg0());
 }
 
+srs_utime_t SrsConfig::get_dvr_mp4_fragment(string vhost)
+{
+    SRS_OVERWRITE_BY_ENV_SECONDS("srs.vhost.dvr.dvr_mp4_fragment"); // SRS_VHOST_DVR_DVR_MP4_FRAGMENT
+
+    static srs_utime_t DEFAULT = 0;
+
+    SrsConfDirective *conf = get_dvr(vhost);
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    conf = conf->get("dvr_mp4_fragment");
+    if (!conf || conf->arg0().empty()) {
+        return DEFAULT;
+    }
+
+    return (srs_utime_t)(::atoi(conf->arg0().c_str()) * SRS_UTIME_SECONDS);
+}
+
 int SrsConfig::get_dvr_time_jitter(string vhost)
 {
     if (!srs_getenv("srs.vhost.dvr.time_jitter").empty()) { // SRS_VHOST_DVR_TIME_JITTER
@@ -7695,6 +8618,11 @@ SrsConfDirective *SrsConfig::get_srt(std::string vhost)
 
 bool SrsConfig::get_srt_enabled(std::string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->srt_enabled_;
+    }
+
     SRS_OVERWRITE_BY_ENV_BOOL("srs.vhost.srt.enabled"); // SRS_VHOST_SRT_ENABLED
 
     static bool DEFAULT = false;
@@ -7715,6 +8643,11 @@ bool SrsConfig::get_srt_enabled(std::string vhost)
 
 bool SrsConfig::get_srt_to_rtmp(std::string vhost)
 {
+    SrsVhostSnapshot *snapshot = vhost_snapshot(vhost);
+    if (snapshot) {
+        return snapshot->srt_to_rtmp_;
+    }
+
     SRS_OVERWRITE_BY_ENV_BOOL2("srs.vhost.srt.srt_to_rtmp"); // SRS_VHOST_SRT_SRT_TO_RTMP
     SRS_OVERWRITE_BY_ENV_BOOL2("srs.vhost.srt.to_rtmp");     // SRS_VHOST_SRT_TO_RTMP
 
@@ -8002,6 +8935,30 @@ string SrsConfig::get_vhost_http_dir(string vhost)
     return conf->arg0();
 }
 
+int64_t SrsConfig::get_vhost_http_segment_cache(string vhost)
+{
+    SRS_OVERWRITE_BY_ENV_MBYTES("srs.vhost.http_static.segment_cache"); // SRS_VHOST_HTTP_STATIC_SEGMENT_CACHE
+
+    static int64_t DEFAULT = 0;
+
+    SrsConfDirective *conf = get_vhost(vhost);
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    conf = conf->get("http_static");
+    if (!conf) {
+        return DEFAULT;
+    }
+
+    conf = conf->get("segment_cache");
+    if (!conf || conf->arg0().empty()) {
+        return DEFAULT;
+    }
+
+    return (int64_t)::atoi(conf->arg0().c_str()) * 1024 * 1024;
+}
+
 bool SrsConfig::get_vhost_http_remux_enabled(string vhost)
 {
     SRS_OVERWRITE_BY_ENV_BOOL("srs.vhost.http_remux.enabled"); // SRS_VHOST_HTTP_REMUX_ENABLED
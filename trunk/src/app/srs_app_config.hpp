@@ -18,6 +18,7 @@
 #include <srs_app_async_call.hpp>
 #include <srs_app_reload.hpp>
 #include <srs_app_st.hpp>
+#include <srs_core_autofree.hpp>
 #include <srs_kernel_factory.hpp>
 
 class ISrsRequest;
@@ -27,6 +28,7 @@ class SrsJsonArray;
 class SrsJsonAny;
 
 class SrsConfig;
+class ISrsAppConfig;
 class SrsJsonArray;
 class SrsConfDirective;
 
@@ -276,6 +278,87 @@ enum SrsReloadState {
     SrsReloadStateFinished = 90,
 };
 
+// The compiled config of a vhost, which are the typed values of the hot getters, with the env
+// overrides and defaults resolved, to read them in O(1) for each connection.
+class SrsVhostSnapshot
+{
+public:
+    bool enabled_;
+    bool is_edge_;
+    bool edge_token_traverse_;
+    bool http_hooks_enabled_;
+    bool debug_srs_upnode_;
+    bool refer_enabled_;
+    // The play section.
+    bool gop_cache_;
+    int gop_cache_max_frames_;
+    srs_utime_t queue_length_;
+    bool atc_;
+    bool atc_auto_;
+    int time_jitter_;
+    bool mix_correct_;
+    bool realtime_enabled_;
+    bool realtime_enabled_rtc_;
+    bool tcp_nodelay_;
+    srs_utime_t send_min_interval_;
+    bool reduce_sequence_header_;
+    // The publish section.
+    bool mr_enabled_;
+    srs_utime_t mr_sleep_;
+    bool parse_sps_;
+    srs_utime_t publish_1stpkt_timeout_;
+    srs_utime_t publish_normal_timeout_;
+    srs_utime_t publish_kickoff_for_idle_;
+    // The RTMP protocol.
+    int chunk_size_;
+    int in_ack_size_;
+    int out_ack_size_;
+    // The rtc section.
+    bool rtc_enabled_;
+    bool rtc_from_rtmp_;
+    bool rtc_to_rtmp_;
+    bool rtc_nack_enabled_;
+    bool rtc_nack_no_copy_;
+    bool rtc_twcc_enabled_;
+    bool rtc_keep_original_ssrc_;
+    int rtc_drop_for_pt_;
+    srs_utime_t rtc_stun_timeout_;
+    bool rtc_stun_strict_check_;
+    bool rtc_init_rate_from_sdp_;
+    // The rtsp and srt section.
+    bool rtsp_enabled_;
+    bool rtsp_from_rtmp_;
+    bool srt_enabled_;
+    bool srt_to_rtmp_;
+
+public:
+    SrsVhostSnapshot();
+    virtual ~SrsVhostSnapshot();
+};
+
+// The compiled config, which is immutable and replaced as a whole when config is parsed or reloaded,
+// so a connection could hold a reference to a consistent version of config. It only holds the copied
+// values, never the directives, which are freed by reload.
+class SrsConfigSnapshot
+{
+public:
+    // The compiled vhosts by name.
+    std::map<std::string, SrsVhostSnapshot *> vhosts_;
+    // The compiled default vhost, for vhost not in config, or default values if no default vhost.
+    SrsVhostSnapshot *default_;
+
+public:
+    SrsConfigSnapshot();
+    virtual ~SrsConfigSnapshot();
+
+public:
+    // Get the compiled vhost, fallback to the default vhost, never NULL.
+    SrsVhostSnapshot *vhost(const std::string &name);
+};
+
+// Compile the hot getters of vhost to snapshot, by the getters of config.
+extern SrsVhostSnapshot *srs_config_compile_vhost(ISrsAppConfig *config, std::string vhost);
+
 // The app level config interface.
 class ISrsAppConfig : public ISrsConfig
 {
@@ -296,6 +379,7 @@ public:
 public:
     // Global server config
     virtual int get_max_connections() = 0;
+    virtual int64_t get_media_memory_budget() = 0;
     virtual std::string get_pid_file() = 0;
     virtual bool empty_ip_ok() = 0;
     virtual bool get_asprocess() = 0;
@@ -356,6 +440,9 @@ public:
     virtual std::vector<std::string> get_rtc_server_listens() = 0;
     virtual int get_rtc_server_reuseport() = 0;
     virtual bool get_rtc_server_encrypt() = 0;
+    virtual int get_rtc_server_sendmmsg() = 0;
+    virtual int get_rtc_server_recvmmsg() = 0;
+    virtual bool get_rtc_server_gso() = 0;
     virtual bool get_api_as_candidates() = 0;
     virtual bool get_resolve_api_domain() = 0;
     virtual bool get_keep_api_domain() = 0;
@@ -411,6 +498,33 @@ public:
     virtual int get_dying_threshold() = 0;
     virtual int get_dying_pulse() = 0;
 
+public:
+    // Workers config
+    virtual bool get_workers_enabled() = 0;
+    virtual int get_workers_count() = 0;
+    virtual bool get_workers_cpu_affinity() = 0;
+    virtual int get_workers_relay_port() = 0;
+
+public:
+    // Async disk I/O config
+    virtual bool get_async_io_enabled() = 0;
+    virtual int get_async_io_threads() = 0;
+    virtual int get_async_io_queue() = 0;
+
+public:
+    // Ingest threads config
+    virtual bool get_ingest_thread_enabled() = 0;
+    virtual int get_ingest_threads() = 0;
+    virtual int get_ingest_thread_queue() = 0;
+
+public:
+    // HTTP hooks dispatcher config
+    virtual int get_hooks_keepalive() = 0;
+    virtual int get_hooks_concurrency() = 0;
+    virtual srs_utime_t get_hooks_play_cache_ttl() = 0;
+    virtual bool get_hooks_async_notify() = 0;
+    virtual int get_hooks_retry_queue() = 0;
+
 public:
     // RTMPS config
     virtual std::string get_rtmps_ssl_cert() = 0;
@@ -419,6 +533,8 @@ public:
 public:
     // Vhost config
     virtual void get_vhosts(std::vector<SrsConfDirective *> &vhosts) = 0;
+    // Get the compiled config, which is never changed by reload, so it's safe to hold it.
+    virtual SrsSharedPtr<SrsConfigSnapshot> snapshot() = 0;
     virtual SrsConfDirective *get_vhost(std::string vhost, bool try_default_vhost = true) = 0;
     virtual bool get_vhost_enabled(std::string vhost) = 0;
     virtual bool get_vhost_enabled(SrsConfDirective *conf) = 0;
@@ -522,6 +638,9 @@ public:
     virtual bool get_hls_ctx_enabled(std::string vhost) = 0;
     virtual bool get_hls_ts_ctx_enabled(std::string vhost) = 0;
     virtual bool get_hls_master_m3u8_path_relative(std::string vhost) = 0;
+    virtual bool get_hls_ll(std::string vhost) = 0;
+    virtual srs_utime_t get_hls_part(std::string vhost) = 0;
+    virtual bool get_hls_ll_persist(std::string vhost) = 0;
     virtual bool get_hls_recover(std::string vhost) = 0;
     virtual bool get_dash_enabled(std::string vhost) = 0;
     virtual bool get_dash_enabled(SrsConfDirective *vhost) = 0;
@@ -551,6 +670,11 @@ public:
     virtual std::string get_dvr_path(std::string vhost) = 0;
     virtual int get_dvr_time_jitter(std::string vhost) = 0;
     virtual bool get_dvr_wait_keyframe(std::string vhost) = 0;
+    virtual srs_utime_t get_dvr_mp4_fragment(std::string vhost) = 0;
+
+public:
+    // HTTP static config
+    virtual int64_t get_vhost_http_segment_cache(std::string vhost) = 0;
 
 public:
     // HTTP remux config
@@ -669,6 +793,12 @@ SRS_DECLARE_PROTECTED: // clang-format on
 SRS_DECLARE_PRIVATE: // clang-format on
     // The cache for parsing the config from environment variables.
     SrsConfDirective *env_cache_;
+    // The compiled config, which is reset when root changed, and compiled when used.
+    SrsSharedPtr<SrsConfigSnapshot> snapshot_;
+    // The vhost directives by name, which is rebuilt with the snapshot for current root.
+    std::map<std::string, SrsConfDirective *> vhost_directives_;
+    // Whether compiling the snapshot, the getters read directives to compile the values.
+    bool compiling_;
     // Reload  section
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
@@ -789,6 +919,8 @@ public:
     //       user must use "ulimit -HSn 10000" and config the max connections
     //       of SRS.
     virtual int get_max_connections();
+    // Get the server-wide budget of media memory in bytes, 0 to disable.
+    virtual int64_t get_media_memory_budget();
     // Get the listen port of SRS.
     // user can specifies multiple listen ports,
     // each args of directive is a listen port.
@@ -839,6 +971,44 @@ public:
     virtual int get_critical_pulse();
     virtual int get_dying_threshold();
     virtual int get_dying_pulse();
+    // Workers section.
+public:
+    // Whether run in multiple worker processes mode.
+    virtual bool get_workers_enabled();
+    // The number of worker processes, 0 for the number of CPUs.
+    virtual int get_workers_count();
+    // Whether pin each worker to a CPU core.
+    virtual bool get_workers_cpu_affinity();
+    // The base port of the private loopback RTMP relay, worker N listens at base+N.
+    virtual int get_workers_relay_port();
+    // Async disk I/O section.
+public:
+    // Whether offload the disk I/O of HLS, DASH and DVR to I/O threads.
+    virtual bool get_async_io_enabled();
+    // The number of I/O threads.
+    virtual int get_async_io_threads();
+    // The max number of pending I/O operations, writers wait for the queue when exceed it.
+    virtual int get_async_io_queue();
+    // Ingest threads section.
+public:
+    // Whether demux the ingest streams, such as SRT, in ingest threads.
+    virtual bool get_ingest_thread_enabled();
+    // The number of ingest threads.
+    virtual int get_ingest_threads();
+    // The size of queue of each ingest thread, the publisher waits when exceed it.
+    virtual int get_ingest_thread_queue();
+    // HTTP hooks dispatcher section.
+public:
+    // The max number of idle keep-alive clients for each hook server, 0 to disable keep-alive.
+    virtual int get_hooks_keepalive();
+    // The max number of hooks in flight for each hook server, 0 for no limit.
+    virtual int get_hooks_concurrency();
+    // The time to cache the allowed on_play, for the same stream and param, 0 to disable it.
+    virtual srs_utime_t get_hooks_play_cache_ttl();
+    // Whether deliver the notification hooks, such as on_stop and on_hls, in background.
+    virtual bool get_hooks_async_notify();
+    // The max number of notifications to deliver or retry, the new ones are dropped when exceed it.
+    virtual int get_hooks_retry_queue();
 
     // stream_caster section
 public:
@@ -884,6 +1054,12 @@ public:
     virtual bool get_rtc_server_encrypt();
     virtual int get_rtc_server_reuseport();
     virtual bool get_rtc_server_merge_nalus();
+    // Get the max number of packets to send by one sendmmsg, disable it if not larger than 1.
+    virtual int get_rtc_server_sendmmsg();
+    // Get the max number of packets to receive by one recvmmsg, disable it if not larger than 1.
+    virtual int get_rtc_server_recvmmsg();
+    // Whether use UDP GSO to send packets in the same size, requires linux 4.18+.
+    virtual bool get_rtc_server_gso();
 
 public:
     virtual bool get_rtc_server_black_hole();
@@ -915,6 +1091,17 @@ public:
     bool get_rtc_keep_original_ssrc(std::string vhost);
 
     // vhost specified section
+public:
+    // Get the compiled config, which is never changed by reload, so it's safe to hold it.
+    virtual SrsSharedPtr<SrsConfigSnapshot> snapshot();
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // Compile the config to snapshot, for the hot getters.
+    virtual void compile_snapshot();
+    // Get the compiled vhost, or NULL when compiling.
+    virtual SrsVhostSnapshot *vhost_snapshot(const std::string &vhost);
+
 public:
     // Get the vhost directive by vhost name.
     // @param vhost, the name of vhost to get.
@@ -1272,6 +1459,14 @@ public:
     virtual std::string get_log_level_v2();
     // Get the log file path.
     virtual std::string get_log_file();
+    // Whether write log to file asynchronously, by the flusher thread.
+    virtual bool get_log_async_enabled();
+    // Get the size in bytes of ring for asynchronous log.
+    virtual int get_log_async_buffer();
+    // Get the policy when ring is full, drop or block.
+    virtual std::string get_log_async_overflow();
+    // Get the max number of lines per second for each level, 0 for no limit.
+    virtual int get_log_limit();
     // Whether ffmpeg log enabled
     virtual bool get_ff_log_enabled();
     // The ffmpeg log dir.
@@ -1376,6 +1571,12 @@ public:
     // When off, uses absolute path (e.g., "/live/livestream.m3u8?hls_ctx=xxx").
     // Default is off for backward compatibility.
     virtual bool get_hls_master_m3u8_path_relative(std::string vhost);
+    // Whether enable LL-HLS, which serves the playlist and partial segments from memory.
+    virtual bool get_hls_ll(std::string vhost);
+    // Get the target duration of LL-HLS partial segment.
+    virtual srs_utime_t get_hls_part(std::string vhost);
+    // Whether write the LL-HLS segments and playlist to disk, for DVR or CDN origin.
+    virtual bool get_hls_ll_persist(std::string vhost);
     // Toggles HLS recover mode.
     // In this mode HLS sequence number is started from where it stopped last time.
     // Old fragments are kept. Default is on.
@@ -1420,6 +1621,8 @@ public:
     virtual srs_utime_t get_dvr_duration(std::string vhost);
     // Whether wait keyframe to reap segment.
     virtual bool get_dvr_wait_keyframe(std::string vhost);
+    // Get the fragment duration of fragmented MP4 DVR, 0 to write a regular MP4.
+    virtual srs_utime_t get_dvr_mp4_fragment(std::string vhost);
     // Get the time_jitter algorithm for dvr.
     virtual int get_dvr_time_jitter(std::string vhost);
     // http api section
@@ -1507,6 +1710,8 @@ public:
     // Get the http dir for vhost.
     // The path on disk for mount root of http vhost.
     virtual std::string get_vhost_http_dir(std::string vhost);
+    // Get the memory budget in bytes of segment cache for vhost, 0 to disable.
+    virtual int64_t get_vhost_http_segment_cache(std::string vhost);
     // flv live streaming section
 public:
     // Get whether vhost enabled http flv live stream
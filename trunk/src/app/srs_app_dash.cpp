@@ -6,9 +6,11 @@
 
 #include <srs_app_dash.hpp>
 
+#include <srs_app_async_io.hpp>
 #include <srs_app_config.hpp>
 #include <srs_app_factory.hpp>
 #include <srs_app_rtmp_source.hpp>
+#include <srs_app_segment_cache.hpp>
 #include <srs_app_utility.hpp>
 #include <srs_core_autofree.hpp>
 #include <srs_kernel_codec.hpp>
@@ -46,7 +48,7 @@ ISrsInitMp4::~ISrsInitMp4()
 
 SrsInitMp4::SrsInitMp4()
 {
-    fw_ = new SrsFileWriter();
+    fw_ = _srs_app_factory->create_file_writer();
     init_ = new SrsMp4M2tsInitEncoder();
     fragment_ = new SrsFragment();
 }
@@ -83,6 +85,11 @@ void SrsInitMp4::set_path(std::string v)
     fragment_->set_path(v);
 }
 
+std::string SrsInitMp4::fullpath()
+{
+    return fragment_->fullpath();
+}
+
 std::string SrsInitMp4::tmppath()
 {
     return fragment_->tmppath();
@@ -143,11 +150,13 @@ ISrsFragmentedMp4::~ISrsFragmentedMp4()
 
 SrsFragmentedMp4::SrsFragmentedMp4()
 {
-    fw_ = new SrsFileWriter();
+    fw_ = _srs_app_factory->create_file_writer();
+    cache_writer_ = NULL;
     enc_ = new SrsMp4M2tsSegmentEncoder();
     fragment_ = new SrsFragment();
 
     config_ = _srs_config;
+    segment_cache_ = _srs_segment_cache;
 }
 
 SrsFragmentedMp4::~SrsFragmentedMp4()
@@ -157,6 +166,7 @@ SrsFragmentedMp4::~SrsFragmentedMp4()
     srs_freep(fragment_);
 
     config_ = NULL;
+    segment_cache_ = NULL;
 }
 
 srs_error_t SrsFragmentedMp4::initialize(ISrsRequest *r, bool video, int64_t time, ISrsMpdWriter *mpd, uint32_t tid)
@@ -180,6 +190,11 @@ srs_error_t SrsFragmentedMp4::initialize(ISrsRequest *r, bool video, int64_t tim
         return srs_error_wrap(err, "create dir");
     }
 
+    // Copy the segment to cache, for the HTTP static server.
+    if (!cache_writer_ && segment_cache_->enabled(r->vhost_)) {
+        fw_ = cache_writer_ = new SrsSegmentCacheWriter(r->vhost_, fw_);
+    }
+
     string path_tmp = fragment_->tmppath();
     if ((err = fw_->open(path_tmp)) != srs_success) {
         return srs_error_wrap(err, "Open fmp4 failed, path=%s", path_tmp.c_str());
@@ -229,12 +244,19 @@ srs_error_t SrsFragmentedMp4::reap(uint64_t &dts)
         return srs_error_wrap(err, "Flush encoder failed");
     }
 
-    srs_freep(fw_);
+    fw_->close();
 
     if ((err = fragment_->rename()) != srs_success) {
         return srs_error_wrap(err, "rename");
     }
 
+    if (cache_writer_) {
+        cache_writer_->on_reap(fragment_->fullpath());
+    }
+
+    srs_freep(fw_);
+    cache_writer_ = NULL;
+
     return err;
 }
 
@@ -243,6 +265,11 @@ void SrsFragmentedMp4::set_path(std::string v)
     fragment_->set_path(v);
 }
 
+std::string SrsFragmentedMp4::fullpath()
+{
+    return fragment_->fullpath();
+}
+
 std::string SrsFragmentedMp4::tmppath()
 {
     return fragment_->tmppath();
@@ -314,12 +341,16 @@ SrsMpdWriter::SrsMpdWriter()
 
     config_ = _srs_config;
     app_factory_ = _srs_app_factory;
+    async_io_ = _srs_async_io;
+    segment_cache_ = _srs_segment_cache;
 }
 
 SrsMpdWriter::~SrsMpdWriter()
 {
     config_ = NULL;
     app_factory_ = NULL;
+    async_io_ = NULL;
+    segment_cache_ = NULL;
 }
 
 // LCOV_EXCL_START
@@ -328,8 +359,11 @@ void SrsMpdWriter::dispose()
     if (req_) {
         string mpd_path = srs_path_build_stream(mpd_file_, req_->vhost_, req_->app_, req_->stream_);
         string full_path = home_ + "/" + mpd_path;
-        SrsPath path;
-        srs_error_t err = path.unlink(full_path);
+
+        // Never serve the mpd of disposed stream from cache.
+        segment_cache_->remove(full_path);
+
+        srs_error_t err = async_io_->unlink(full_path);
         if (err != srs_success) {
             srs_warn("ignore remove mpd failed, %s, %s", full_path.c_str(), srs_error_desc(err).c_str());
             srs_freep(err);
@@ -468,8 +502,13 @@ srs_error_t SrsMpdWriter::write(SrsFormat *format, ISrsFragmentWindow *afragment
         return srs_error_wrap(err, "Write MPD file=%s failed", full_path.c_str());
     }
 
-    if (::rename(full_path_tmp.c_str(), full_path.c_str()) < 0) {
-        return srs_error_new(ERROR_DASH_WRITE_FAILED, "Rename %s to %s failed", full_path_tmp.c_str(), full_path.c_str());
+    // The MPD is renamed to full_path later.
+    if (segment_cache_->enabled(req_->vhost_)) {
+        segment_cache_->put(req_->vhost_, full_path, content);
+    }
+
+    if ((err = async_io_->rename(full_path_tmp, full_path)) != srs_success) {
+        return srs_error_wrap(err, "Rename %s to %s failed", full_path_tmp.c_str(), full_path.c_str());
     }
 
     srs_trace("DASH: Refresh MPD success, size=%dB, file=%s", content.length(), full_path.c_str());
@@ -30,9 +30,12 @@ class ISrsMp4M2tsSegmentEncoder;
 class SrsFragment;
 class ISrsFragment;
 class ISrsAppFactory;
+class ISrsAsyncIo;
 class ISrsDashController;
 class ISrsFragmentWindow;
 class ISrsAppConfig;
+class ISrsSegmentCache;
+class SrsSegmentCacheWriter;
 
 // The init mp4 fragment interface.
 class ISrsInitMp4 : public ISrsFragment
@@ -66,6 +69,7 @@ public:
 public:
     // ISrsFragment interface implementations - delegate to fragment_
     virtual void set_path(std::string v);
+    virtual std::string fullpath();
     virtual std::string tmppath();
     virtual srs_error_t rename();
     virtual void append(int64_t dts);
@@ -100,10 +104,13 @@ class SrsFragmentedMp4 : public ISrsFragmentedMp4
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
     ISrsAppConfig *config_;
+    ISrsSegmentCache *segment_cache_;
 
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
     ISrsFileWriter *fw_;
+    // The writer which copies the segment to cache, NULL if disabled, which is the fw_.
+    SrsSegmentCacheWriter *cache_writer_;
     ISrsMp4M2tsSegmentEncoder *enc_;
     ISrsFragment *fragment_;
 
@@ -122,6 +129,7 @@ public:
 public:
     // ISrsFragment interface implementations - delegate to fragment_
     virtual void set_path(std::string v);
+    virtual std::string fullpath();
     virtual std::string tmppath();
     virtual srs_error_t rename();
     virtual void append(int64_t dts);
@@ -167,6 +175,8 @@ class SrsMpdWriter : public ISrsMpdWriter
 SRS_DECLARE_PRIVATE: // clang-format on
     ISrsAppConfig *config_;
     ISrsAppFactory *app_factory_;
+    ISrsAsyncIo *async_io_;
+    ISrsSegmentCache *segment_cache_;
 
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
@@ -45,7 +45,7 @@ SrsDvrSegmenter::SrsDvrSegmenter()
     wait_keyframe_ = true;
 
     fragment_ = new SrsFragment();
-    fs_ = new SrsFileWriter();
+    fs_ = _srs_app_factory->create_file_writer();
     jitter_algorithm_ = SrsRtmpJitterAlgorithmOFF;
 
     config_ = _srs_config;
@@ -531,6 +531,208 @@ srs_error_t SrsDvrMp4Segmenter::close_encoder()
     return err;
 }
 
+SrsDvrFmp4Segmenter::SrsDvrFmp4Segmenter()
+{
+    enc_ = NULL;
+    duration_ = 0;
+    has_video_ = false;
+    has_audio_ = false;
+    init_written_ = false;
+    init_video_ = false;
+    init_audio_ = false;
+    sequence_number_ = 1;
+    start_dts_ = 0;
+    last_dts_ = 0;
+
+    config_ = _srs_config;
+}
+
+SrsDvrFmp4Segmenter::~SrsDvrFmp4Segmenter()
+{
+    srs_freep(enc_);
+
+    config_ = NULL;
+}
+
+srs_error_t SrsDvrFmp4Segmenter::initialize(ISrsDvrPlan *p, ISrsRequest *r)
+{
+    srs_error_t err = srs_success;
+
+    if ((err = SrsDvrSegmenter::initialize(p, r)) != srs_success) {
+        return srs_error_wrap(err, "initialize");
+    }
+
+    duration_ = config_->get_dvr_mp4_fragment(r->vhost_);
+
+    return err;
+}
+
+srs_error_t SrsDvrFmp4Segmenter::refresh_metadata()
+{
+    return srs_success;
+}
+
+srs_error_t SrsDvrFmp4Segmenter::open_encoder()
+{
+    srs_freep(enc_);
+
+    // Each file has its own init header, written when the sequence headers are ready.
+    has_video_ = false;
+    has_audio_ = false;
+    init_written_ = false;
+    init_video_ = false;
+    init_audio_ = false;
+    sequence_number_ = 1;
+    start_dts_ = 0;
+    last_dts_ = 0;
+
+    return srs_success;
+}
+
+srs_error_t SrsDvrFmp4Segmenter::encode_metadata(SrsMediaPacket * /*metadata*/)
+{
+    return srs_success;
+}
+
+srs_error_t SrsDvrFmp4Segmenter::encode_audio(SrsMediaPacket *audio, SrsFormat *format)
+{
+    // The sequence header is written to the init header, and only AAC is supported, like HLS fMP4.
+    if (format->audio_->aac_packet_type_ == SrsAudioAacFrameTraitSequenceHeader) {
+        if (format->acodec_->id_ == SrsAudioCodecIdAAC && !format->acodec_->aac_extra_data_.empty()) {
+            has_audio_ = true;
+        }
+        return srs_success;
+    }
+
+    uint32_t dts = (uint32_t)audio->timestamp_;
+    return write_sample(false, 0x00, dts, dts, format);
+}
+
+srs_error_t SrsDvrFmp4Segmenter::encode_video(SrsMediaPacket *video, SrsFormat *format)
+{
+    // The sequence header is written to the init header.
+    if (format->video_->avc_packet_type_ == SrsVideoAvcFrameTraitSequenceHeader) {
+        has_video_ = true;
+        return srs_success;
+    }
+
+    SrsVideoAvcFrameType frame_type = format->video_->frame_type_;
+    uint32_t cts = (uint32_t)format->video_->cts_;
+
+    uint32_t dts = (uint32_t)video->timestamp_;
+    uint32_t pts = dts + cts;
+
+    return write_sample(true, frame_type, dts, pts, format);
+}
+
+srs_error_t SrsDvrFmp4Segmenter::close_encoder()
+{
+    srs_error_t err = srs_success;
+
+    if ((err = flush_fragment(last_dts_)) != srs_success) {
+        return srs_error_wrap(err, "flush fragment");
+    }
+
+    return err;
+}
+
+srs_error_t SrsDvrFmp4Segmenter::write_sample(bool video, uint16_t ft, uint32_t dts, uint32_t pts, SrsFormat *format)
+{
+    srs_error_t err = srs_success;
+
+    // Write the init header by the first sample, so all sequence headers are ready.
+    if (!init_written_ && (err = write_init(format)) != srs_success) {
+        return srs_error_wrap(err, "write init");
+    }
+
+    // Ignore the track which is not in the init header.
+    if ((video && !init_video_) || (!video && !init_audio_)) {
+        return err;
+    }
+
+    // Fragment always starts at keyframe, or any audio frame if no video.
+    bool startable = video ? (ft == SrsVideoAvcFrameTypeKeyFrame) : !init_video_;
+    if (!enc_ && !startable) {
+        return err;
+    }
+
+    if (startable && (!enc_ || (srs_utime_t)(dts - start_dts_) * SRS_UTIME_MILLISECONDS >= duration_)) {
+        if ((err = flush_fragment(dts)) != srs_success) {
+            return srs_error_wrap(err, "flush fragment");
+        }
+
+        enc_ = new SrsFmp4SegmentEncoder();
+        if ((err = enc_->initialize(fs_, sequence_number_++, dts * SRS_UTIME_MILLISECONDS, 1, 2)) != srs_success) {
+            return srs_error_wrap(err, "init fragment");
+        }
+        start_dts_ = dts;
+    }
+
+    SrsMp4HandlerType ht = video ? SrsMp4HandlerTypeVIDE : SrsMp4HandlerTypeSOUN;
+    if ((err = enc_->write_sample(ht, ft, dts, pts, (uint8_t *)format->raw_, (uint32_t)format->nb_raw_)) != srs_success) {
+        return srs_error_wrap(err, "write sample");
+    }
+    last_dts_ = dts;
+
+    return err;
+}
+
+srs_error_t SrsDvrFmp4Segmenter::write_init(SrsFormat *format)
+{
+    srs_error_t err = srs_success;
+
+    // Wait for the sequence header.
+    if (!has_video_ && !has_audio_) {
+        return err;
+    }
+
+    // Only AAC is supported for audio track, so the other audio codecs are ignored.
+    if (!has_audio_ && format->acodec_ && format->acodec_->id_ != SrsAudioCodecIdAAC) {
+        srs_warn("DVR: ignore audio codec %s, fMP4 only supports AAC", srs_audio_codec_id2str(format->acodec_->id_).c_str());
+    }
+
+    SrsMp4M2tsInitEncoder init;
+    if ((err = init.initialize(fs_)) != srs_success) {
+        return srs_error_wrap(err, "init");
+    }
+
+    // The track id is 1 for video and 2 for audio, same to the fragments.
+    if (has_video_ && has_audio_) {
+        err = init.write(format, 1, 2);
+    } else if (has_video_) {
+        err = init.write(format, true, 1);
+    } else {
+        err = init.write(format, false, 2);
+    }
+    if (err != srs_success) {
+        return srs_error_wrap(err, "write init, video=%d, audio=%d", has_video_, has_audio_);
+    }
+
+    init_written_ = true;
+    init_video_ = has_video_;
+    init_audio_ = has_audio_;
+
+    return err;
+}
+
+srs_error_t SrsDvrFmp4Segmenter::flush_fragment(uint32_t dts)
+{
+    srs_error_t err = srs_success;
+
+    if (!enc_) {
+        return err;
+    }
+
+    // Free the samples of fragment after written, so the memory does not grow with the file.
+    err = enc_->flush(dts);
+    srs_freep(enc_);
+    if (err != srs_success) {
+        return srs_error_wrap(err, "flush moof and mdat");
+    }
+
+    return err;
+}
+
 SrsDvrAsyncCallOnDvr::SrsDvrAsyncCallOnDvr(SrsContextId c, ISrsRequest *r, string p)
 {
     cid_ = c;
@@ -1003,7 +1205,9 @@ srs_error_t SrsDvr::initialize(ISrsOriginHub *h, ISrsRequest *r)
 
     std::string path = config_->get_dvr_path(r->vhost_);
     ISrsDvrSegmenter *segmenter = NULL;
-    if (srs_strings_ends_with(path, ".mp4")) {
+    if (srs_strings_ends_with(path, ".mp4") && config_->get_dvr_mp4_fragment(r->vhost_) > 0) {
+        segmenter = app_factory_->create_dvr_fmp4_segmenter();
+    } else if (srs_strings_ends_with(path, ".mp4")) {
         segmenter = app_factory_->create_dvr_mp4_segmenter();
     } else {
         segmenter = app_factory_->create_dvr_flv_segmenter();
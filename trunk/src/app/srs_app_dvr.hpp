@@ -30,6 +30,7 @@ class SrsFormat;
 class ISrsFileWriter;
 class ISrsDvrPlan;
 class ISrsMp4Encoder;
+class SrsFmp4SegmentEncoder;
 class ISrsOriginHub;
 class ISrsAppConfig;
 class ISrsAppFactory;
@@ -197,6 +198,60 @@ SRS_DECLARE_PROTECTED: // clang-format on
     virtual srs_error_t close_encoder();
 };
 
+// The fragmented MP4 segmenter, which writes the init header (ftyp and moov) once, then a moof
+// and mdat for each fragment. Only the samples of current fragment are kept in memory, while the
+// regular MP4 keeps all samples to write the moov when closing the file.
+class SrsDvrFmp4Segmenter : public SrsDvrSegmenter
+{
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    ISrsAppConfig *config_;
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // The encoder for current fragment, NULL if no fragment.
+    SrsFmp4SegmentEncoder *enc_;
+    // The duration of each fragment, start new fragment at keyframe when exceed it.
+    srs_utime_t duration_;
+    // Whether got the sequence header of track.
+    bool has_video_;
+    bool has_audio_;
+    // Whether the init header is written, by the first sample.
+    bool init_written_;
+    // The tracks written in the init header, only the samples of these tracks are written, even the
+    // sequence header of other track comes later.
+    bool init_video_;
+    bool init_audio_;
+    // The sequence number of next fragment.
+    uint32_t sequence_number_;
+    // The dts in ms of the first sample of current fragment.
+    uint32_t start_dts_;
+    // The dts in ms of the last sample, to flush the last fragment.
+    uint32_t last_dts_;
+
+public:
+    SrsDvrFmp4Segmenter();
+    virtual ~SrsDvrFmp4Segmenter();
+
+public:
+    virtual srs_error_t initialize(ISrsDvrPlan *p, ISrsRequest *r);
+    virtual srs_error_t refresh_metadata();
+
+// clang-format off
+SRS_DECLARE_PROTECTED: // clang-format on
+    virtual srs_error_t open_encoder();
+    virtual srs_error_t encode_metadata(SrsMediaPacket *metadata);
+    virtual srs_error_t encode_audio(SrsMediaPacket *audio, SrsFormat *format);
+    virtual srs_error_t encode_video(SrsMediaPacket *video, SrsFormat *format);
+    virtual srs_error_t close_encoder();
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    virtual srs_error_t write_sample(bool video, uint16_t ft, uint32_t dts, uint32_t pts, SrsFormat *format);
+    virtual srs_error_t write_init(SrsFormat *format);
+    virtual srs_error_t flush_fragment(uint32_t dts);
+};
+
 // the dvr async call.
 class SrsDvrAsyncCallOnDvr : public ISrsAsyncCallTask
 {
@@ -23,6 +23,7 @@ using namespace std;
 
 #include <srs_app_factory.hpp>
 #include <srs_app_utility.hpp>
+#include <srs_app_workers.hpp>
 #include <srs_core_autofree.hpp>
 #include <srs_kernel_balance.hpp>
 #include <srs_kernel_buffer.hpp>
@@ -59,6 +60,7 @@ SrsEdgeRtmpUpstream::SrsEdgeRtmpUpstream(string r)
 
     config_ = _srs_config;
     app_factory_ = _srs_app_factory;
+    workers_ = _srs_workers;
 }
 
 SrsEdgeRtmpUpstream::~SrsEdgeRtmpUpstream()
@@ -67,6 +69,7 @@ SrsEdgeRtmpUpstream::~SrsEdgeRtmpUpstream()
 
     config_ = NULL;
     app_factory_ = NULL;
+    workers_ = NULL;
 }
 
 srs_error_t SrsEdgeRtmpUpstream::connect(ISrsRequest *r, ISrsLbRoundRobin *lb)
@@ -77,16 +80,19 @@ srs_error_t SrsEdgeRtmpUpstream::connect(ISrsRequest *r, ISrsLbRoundRobin *lb)
 
     std::string url;
     if (true) {
+        // For workers mode, pull from the loopback relay of the worker which owns the publisher.
+        std::string relay = workers_->relay_of(req->get_stream_url());
+
         SrsConfDirective *conf = config_->get_vhost_edge_origin(req->vhost_);
 
         // when origin is error, for instance, server is shutdown,
         // then user remove the vhost then reload, the conf is empty.
-        if (!conf) {
+        if (!conf && relay.empty()) {
             return srs_error_new(ERROR_EDGE_VHOST_REMOVED, "vhost %s removed", req->vhost_.c_str());
         }
 
         // select the origin.
-        std::string server = lb->select(conf->args_);
+        std::string server = relay.empty() ? lb->select(conf->args_) : relay;
         int port = SRS_CONSTS_RTMP_DEFAULT_PORT;
         srs_net_split_hostport(server, server, port);
 
@@ -101,8 +107,8 @@ srs_error_t SrsEdgeRtmpUpstream::connect(ISrsRequest *r, ISrsLbRoundRobin *lb)
         selected_ip_ = server;
         selected_port_ = port;
 
-        // support vhost tranform for edge,
-        std::string vhost = config_->get_vhost_edge_transform_vhost(req->vhost_);
+        // support vhost tranform for edge, while the relay always use the same vhost.
+        std::string vhost = relay.empty() ? config_->get_vhost_edge_transform_vhost(req->vhost_) : req->vhost_;
         vhost = srs_strings_replace(vhost, "[vhost]", req->vhost_);
 
         url = srs_net_url_encode_rtmp_url(server, port, req->host_, vhost, req->app_, req->stream_, req->param_);
@@ -418,6 +424,7 @@ SrsEdgeIngester::SrsEdgeIngester()
     trd_ = new SrsDummyCoroutine();
 
     config_ = _srs_config;
+    workers_ = _srs_workers;
 }
 
 SrsEdgeIngester::~SrsEdgeIngester()
@@ -429,6 +436,7 @@ SrsEdgeIngester::~SrsEdgeIngester()
     srs_freep(trd_);
 
     config_ = NULL;
+    workers_ = NULL;
 }
 
 // CRITICAL: This method is called AFTER the source has been added to the source pool
@@ -529,9 +537,12 @@ srs_error_t SrsEdgeIngester::do_cycle()
             edge_protocol = req_->protocol_;
         }
 
+        // For workers mode, always use RTMP to pull from the loopback relay.
+        bool relayed = !workers_->relay_of(req_->get_stream_url()).empty();
+
         // Create object by protocol.
         srs_freep(upstream_);
-        if (edge_protocol == "flv" || edge_protocol == "flvs") {
+        if (!relayed && (edge_protocol == "flv" || edge_protocol == "flvs")) {
             upstream_ = new SrsEdgeFlvUpstream(edge_protocol == "flv" ? "http" : "https");
         } else {
             upstream_ = new SrsEdgeRtmpUpstream(redirect);
@@ -42,6 +42,7 @@ class ISrsLiveSource;
 class ISrsPlayEdge;
 class ISrsPublishEdge;
 class ISrsAppFactory;
+class ISrsWorkerManager;
 
 // The state of edge, auto machine
 enum SrsEdgeState {
@@ -91,6 +92,7 @@ class SrsEdgeRtmpUpstream : public ISrsEdgeUpstream
 SRS_DECLARE_PRIVATE: // clang-format on
     ISrsAppConfig *config_;
     ISrsAppFactory *app_factory_;
+    ISrsWorkerManager *workers_;
 
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
@@ -193,6 +195,7 @@ class SrsEdgeIngester : public ISrsCoroutineHandler, public ISrsEdgeIngester
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
     ISrsAppConfig *config_;
+    ISrsWorkerManager *workers_;
 
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
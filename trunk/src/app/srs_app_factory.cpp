@@ -6,6 +6,7 @@
 
 #include <srs_app_factory.hpp>
 
+#include <srs_app_async_io.hpp>
 #include <srs_app_caster_flv.hpp>
 #include <srs_app_config.hpp>
 #include <srs_app_dash.hpp>
@@ -59,6 +60,10 @@ SrsAppFactory::~SrsAppFactory()
 
 ISrsFileWriter *SrsAppFactory::create_file_writer()
 {
+    // Offload the disk I/O to I/O threads, if enabled.
+    if (_srs_async_io && _srs_async_io->enabled()) {
+        return new SrsAsyncFileWriter();
+    }
     return new SrsFileWriter();
 }
 
@@ -146,6 +151,11 @@ ISrsDvrSegmenter *SrsAppFactory::create_dvr_mp4_segmenter()
     return new SrsDvrMp4Segmenter();
 }
 
+ISrsDvrSegmenter *SrsAppFactory::create_dvr_fmp4_segmenter()
+{
+    return new SrsDvrFmp4Segmenter();
+}
+
 #ifdef SRS_GB28181
 ISrsGbMediaTcpConn *SrsAppFactory::create_gb_media_tcp_conn()
 {
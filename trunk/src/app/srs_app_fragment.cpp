@@ -6,6 +6,8 @@
 
 #include <srs_app_fragment.hpp>
 
+#include <srs_app_async_io.hpp>
+#include <srs_app_segment_cache.hpp>
 #include <srs_kernel_error.hpp>
 #include <srs_kernel_log.hpp>
 #include <srs_kernel_utility.hpp>
@@ -28,10 +30,15 @@ SrsFragment::SrsFragment()
     start_dts_ = -1;
     sequence_header_ = false;
     number_ = 0;
+
+    async_io_ = _srs_async_io;
+    segment_cache_ = _srs_segment_cache;
 }
 
 SrsFragment::~SrsFragment()
 {
+    async_io_ = NULL;
+    segment_cache_ = NULL;
 }
 
 void SrsFragment::append(int64_t dts)
@@ -92,8 +99,10 @@ srs_error_t SrsFragment::unlink_file()
 {
     srs_error_t err = srs_success;
 
-    SrsPath path;
-    if ((err = path.unlink(filepath_)) != srs_success) {
+    // The file is expired, never serve it from cache.
+    segment_cache_->remove(filepath_);
+
+    if ((err = async_io_->unlink(filepath_)) != srs_success) {
         return srs_error_wrap(err, "unlink %s", filepath_.c_str());
     }
 
@@ -128,8 +137,7 @@ srs_error_t SrsFragment::unlink_tmpfile()
     srs_error_t err = srs_success;
 
     string filepath = tmppath();
-    SrsPath path;
-    if ((err = path.unlink(filepath)) != srs_success) {
+    if ((err = async_io_->unlink(filepath)) != srs_success) {
         return srs_error_wrap(err, "unlink tmp file %s", filepath.c_str());
     }
 
@@ -149,9 +157,8 @@ srs_error_t SrsFragment::rename()
         full_path = srs_strings_replace(full_path, "[duration]", ss.str());
     }
 
-    int r0 = ::rename(tmp_file.c_str(), full_path.c_str());
-    if (r0 < 0) {
-        return srs_error_new(ERROR_SYSTEM_FRAGMENT_RENAME, "rename %s to %s", tmp_file.c_str(), full_path.c_str());
+    if ((err = async_io_->rename(tmp_file, full_path)) != srs_success) {
+        return srs_error_wrap(err, "rename %s to %s", tmp_file.c_str(), full_path.c_str());
     }
 
     filepath_ = full_path;
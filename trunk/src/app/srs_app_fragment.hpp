@@ -14,6 +14,8 @@
 
 // Forward declarations
 class SrsFormat;
+class ISrsAsyncIo;
+class ISrsSegmentCache;
 
 // The fragment interface.
 class ISrsFragment
@@ -25,6 +27,8 @@ public:
 public:
     // Set the full path of fragment.
     virtual void set_path(std::string v) = 0;
+    // Get the full path of fragment.
+    virtual std::string fullpath() = 0;
     // Get the temporary path for file.
     virtual std::string tmppath() = 0;
     // Rename the temp file to final file.
@@ -51,6 +55,11 @@ public:
 // It's a media file, for example FLV or MP4, with duration.
 class SrsFragment : public ISrsFragment
 {
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    ISrsAsyncIo *async_io_;
+    ISrsSegmentCache *segment_cache_;
+
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
     // The duration in srs_utime_t.
@@ -85,7 +94,7 @@ public:
     // Set the full path of fragment.
     virtual void set_path(std::string v);
     // Unlink the fragment, to delete the file.
-    // @remark Ignore any error.
+    // @remark Ignore any error, and the file might be deleted in background by async I/O.
     virtual srs_error_t unlink_file();
     // Create the dir for file recursively.
     virtual srs_error_t create_dir();
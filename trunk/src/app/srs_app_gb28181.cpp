@@ -9,10 +9,18 @@
 #include <srs_app_config.hpp>
 #include <srs_app_factory.hpp>
 #include <srs_app_http_api.hpp>
+#include <srs_app_http_hooks.hpp>
 #include <srs_app_listener.hpp>
+#include <srs_app_rtc_source.hpp>
 #include <srs_app_rtmp_conn.hpp>
+#include <srs_app_rtmp_source.hpp>
+#ifdef SRS_RTSP
+#include <srs_app_rtsp_source.hpp>
+#endif
 #include <srs_app_server.hpp>
 #include <srs_app_statistic.hpp>
+#include <srs_app_stream_bridge.hpp>
+#include <srs_app_stream_token.hpp>
 #include <srs_app_utility.hpp>
 #include <srs_core_autofree.hpp>
 #include <srs_kernel_pithy_print.hpp>
@@ -24,6 +32,7 @@
 #include <srs_protocol_http_conn.hpp>
 #include <srs_protocol_json.hpp>
 #include <srs_protocol_raw_avc.hpp>
+#include <srs_protocol_rtmp_stack.hpp>
 #include <srs_protocol_sdp.hpp>
 #include <srs_protocol_utility.hpp>
 
@@ -805,6 +814,9 @@ SrsGbMuxer::SrsGbMuxer(ISrsGbSession *session)
 {
     sdk_ = NULL;
     session_ = session;
+    req_ = NULL;
+    publish_token_ = NULL;
+    publishing_ = false;
 
     avc_ = new SrsRawH264Stream();
     h264_sps_changed_ = false;
@@ -821,6 +833,14 @@ SrsGbMuxer::SrsGbMuxer(ISrsGbSession *session)
     pprint_ = SrsPithyPrint::create_caster();
 
     app_factory_ = _srs_app_factory;
+    config_ = _srs_config;
+    live_sources_ = _srs_sources;
+    rtc_sources_ = _srs_rtc_sources;
+#ifdef SRS_RTSP
+    rtsp_sources_ = _srs_rtsp_sources;
+#endif
+    hooks_ = _srs_hooks;
+    stream_publish_tokens_ = _srs_stream_publish_tokens;
 }
 
 SrsGbMuxer::~SrsGbMuxer()
@@ -834,6 +854,14 @@ SrsGbMuxer::~SrsGbMuxer()
     srs_freep(pprint_);
 
     app_factory_ = NULL;
+    config_ = NULL;
+    live_sources_ = NULL;
+    rtc_sources_ = NULL;
+#ifdef SRS_RTSP
+    rtsp_sources_ = NULL;
+#endif
+    hooks_ = NULL;
+    stream_publish_tokens_ = NULL;
 }
 
 void SrsGbMuxer::setup(std::string output)
@@ -1301,7 +1329,8 @@ srs_error_t SrsGbMuxer::rtmp_write_packet(char type, uint32_t timestamp, char *d
     }
 
     SrsRtmpCommonMessage *cmsg = NULL;
-    if ((err = srs_rtmp_create_msg(type, timestamp, data, size, sdk_->sid(), &cmsg)) != srs_success) {
+    int sid = sdk_ ? sdk_->sid() : 1;
+    if ((err = srs_rtmp_create_msg(type, timestamp, data, size, sid, &cmsg)) != srs_success) {
         return srs_error_wrap(err, "create message");
     }
 
@@ -1327,6 +1356,16 @@ srs_error_t SrsGbMuxer::rtmp_write_packet(char type, uint32_t timestamp, char *d
                       pprint_->age(), msg->timestamp_, msg->size());
         }
 
+        // Deliver to the live source in process, which copies the message for consumers.
+        if (!sdk_) {
+            SrsUniquePtr<SrsMediaPacket> frame(msg);
+            if ((err = source_->on_frame(frame.get())) != srs_success) {
+                close();
+                return srs_error_wrap(err, "source on frame");
+            }
+            continue;
+        }
+
         // send out encoded msg.
         if ((err = sdk_->send_and_free_message(msg)) != srs_success) {
             close();
@@ -1343,7 +1382,7 @@ srs_error_t SrsGbMuxer::connect()
     srs_error_t err = srs_success;
 
     // Ignore when connected.
-    if (sdk_) {
+    if (sdk_ || source_.get()) {
         return err;
     }
 
@@ -1351,6 +1390,17 @@ srs_error_t SrsGbMuxer::connect()
     close();
 
     string url = srs_strings_replace(output_, "[stream]", session_->device_id_);
+
+    // Publish to the live source directly, without the RTMP client over loopback.
+    if (is_local_output(url)) {
+        srs_trace("Muxer: Convert GB to live source %s", url.c_str());
+        if ((err = publish_source(url)) != srs_success) {
+            close();
+            return srs_error_wrap(err, "publish %s", url.c_str());
+        }
+        return err;
+    }
+
     srs_trace("Muxer: Convert GB to RTMP %s", url.c_str());
 
     srs_utime_t cto = SRS_CONSTS_RTMP_TIMEOUT;
@@ -1374,6 +1424,7 @@ srs_error_t SrsGbMuxer::connect()
 void SrsGbMuxer::close()
 {
     srs_freep(sdk_);
+    unpublish_source();
 
     // Regenerate the AAC sequence header.
     aac_specific_config_ = "";
@@ -1384,6 +1435,196 @@ void SrsGbMuxer::close()
     h264_pps_ = "";
 }
 
+bool SrsGbMuxer::is_local_output(std::string url)
+{
+    string tcUrl, stream, schema, host, vhost, app, param;
+    int port = 0;
+    srs_net_url_parse_rtmp_url(url, tcUrl, stream);
+    srs_net_url_parse_tcurl(tcUrl, schema, host, vhost, app, stream, port, param);
+
+    if (schema != "rtmp" || (host != "127.0.0.1" && host != "localhost" && host != "::1")) {
+        return false;
+    }
+
+    // The edge vhost forwards the stream to origin, which is done by the RTMP connection, so we use
+    // the RTMP client rather than publish to live source directly.
+    if (config_->get_vhost_is_edge(vhost)) {
+        return false;
+    }
+
+    // The port must be one of the RTMP ports, or it's another server on this host.
+    vector<string> listens = config_->get_listens();
+    for (int i = 0; i < (int)listens.size(); i++) {
+        string ip;
+        int listen_port = 0;
+        srs_net_split_for_listener(listens.at(i), ip, listen_port);
+        if (listen_port == port) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+srs_error_t SrsGbMuxer::publish_source(std::string url)
+{
+    srs_error_t err = srs_success;
+
+    SrsRequest *req = new SrsRequest();
+    req_ = req;
+
+    srs_net_url_parse_rtmp_url(url, req->tcUrl_, req->stream_);
+    srs_net_url_parse_tcurl(req->tcUrl_, req->schema_, req->host_, req->vhost_, req->app_, req->stream_, req->port_, req->param_);
+
+    // discovery vhost, resolve the vhost from config
+    SrsConfDirective *parsed_vhost = config_->get_vhost(req->vhost_);
+    if (parsed_vhost) {
+        req->vhost_ = parsed_vhost->arg0();
+    }
+
+    // Acquire stream publish token to prevent race conditions across all protocols.
+    if ((err = stream_publish_tokens_->acquire_token(req, publish_token_)) != srs_success) {
+        return srs_error_wrap(err, "acquire stream publish token");
+    }
+
+    if ((err = live_sources_->fetch_or_create(req, source_)) != srs_success) {
+        return srs_error_wrap(err, "create source");
+    }
+
+    if (!source_->can_publish(false)) {
+        return srs_error_new(ERROR_SYSTEM_STREAM_BUSY, "gb: stream %s is busy", req->get_stream_url().c_str());
+    }
+
+    source_->set_cache(config_->get_gop_cache(req->vhost_));
+    source_->set_gop_cache_max_frames(config_->get_gop_cache_max_frames(req->vhost_));
+
+    // Bridge to RTC and RTSP streaming, like the RTMP publisher. Note that the edge vhost never
+    // publishes to source directly, see is_local_output.
+    SrsRtmpBridge *bridge = new SrsRtmpBridge(app_factory_);
+
+    bool rtc_enabled = config_->get_rtc_server_enabled() && config_->get_rtc_enabled(req->vhost_);
+    if (rtc_enabled && config_->get_rtc_from_rtmp(req->vhost_)) {
+        SrsSharedPtr<SrsRtcSource> rtc;
+        if ((err = rtc_sources_->fetch_or_create(req, rtc)) != srs_success) {
+            srs_freep(bridge);
+            return srs_error_wrap(err, "create source");
+        }
+
+        if (!rtc->can_publish()) {
+            srs_freep(bridge);
+            return srs_error_new(ERROR_SYSTEM_STREAM_BUSY, "rtc stream %s busy", req->get_stream_url().c_str());
+        }
+
+        bridge->enable_rtmp2rtc(rtc);
+    }
+
+#ifdef SRS_RTSP
+    bool rtsp_enabled = config_->get_rtsp_server_enabled() && config_->get_rtsp_enabled(req->vhost_);
+    if (rtsp_enabled && config_->get_rtsp_from_rtmp(req->vhost_)) {
+        SrsSharedPtr<SrsRtspSource> rtsp;
+        if ((err = rtsp_sources_->fetch_or_create(req, rtsp)) != srs_success) {
+            srs_freep(bridge);
+            return srs_error_wrap(err, "create source");
+        }
+        bridge->enable_rtmp2rtsp(rtsp);
+    }
+#endif
+
+    if (bridge->empty()) {
+        srs_freep(bridge);
+    } else if ((err = bridge->initialize(req)) != srs_success) {
+        srs_freep(bridge);
+        return srs_error_wrap(err, "bridge init");
+    }
+
+    source_->set_bridge(bridge);
+
+    if ((err = http_hooks_on_publish()) != srs_success) {
+        return srs_error_wrap(err, "callback on publish");
+    }
+
+    if ((err = source_->on_publish()) != srs_success) {
+        http_hooks_on_unpublish();
+        return srs_error_wrap(err, "source publish");
+    }
+    publishing_ = true;
+
+    return err;
+}
+
+void SrsGbMuxer::unpublish_source()
+{
+    if (publishing_) {
+        source_->on_unpublish();
+        http_hooks_on_unpublish();
+        publishing_ = false;
+    }
+
+    source_ = SrsSharedPtr<SrsLiveSource>(NULL);
+    srs_freep(publish_token_);
+    srs_freep(req_);
+}
+
+srs_error_t SrsGbMuxer::http_hooks_on_publish()
+{
+    srs_error_t err = srs_success;
+
+    if (!config_->get_vhost_http_hooks_enabled(req_->vhost_)) {
+        return err;
+    }
+
+    // the http hooks will cause context switch,
+    // so we must copy all hooks for the on_connect may freed.
+    // @see https://github.com/ossrs/srs/issues/475
+    vector<string> hooks;
+
+    if (true) {
+        SrsConfDirective *conf = config_->get_vhost_on_publish(req_->vhost_);
+
+        if (!conf) {
+            return err;
+        }
+
+        hooks = conf->args_;
+    }
+
+    for (int i = 0; i < (int)hooks.size(); i++) {
+        std::string url = hooks.at(i);
+        if ((err = hooks_->on_publish(url, req_)) != srs_success) {
+            return srs_error_wrap(err, "gb on_publish %s", url.c_str());
+        }
+    }
+
+    return err;
+}
+
+void SrsGbMuxer::http_hooks_on_unpublish()
+{
+    if (!config_->get_vhost_http_hooks_enabled(req_->vhost_)) {
+        return;
+    }
+
+    // the http hooks will cause context switch,
+    // so we must copy all hooks for the on_connect may freed.
+    // @see https://github.com/ossrs/srs/issues/475
+    vector<string> hooks;
+
+    if (true) {
+        SrsConfDirective *conf = config_->get_vhost_on_unpublish(req_->vhost_);
+
+        if (!conf) {
+            return;
+        }
+
+        hooks = conf->args_;
+    }
+
+    for (int i = 0; i < (int)hooks.size(); i++) {
+        std::string url = hooks.at(i);
+        hooks_->on_unpublish(url, req_);
+    }
+}
+
 ISrsPackContext::ISrsPackContext()
 {
     static uint32_t gid = 0;
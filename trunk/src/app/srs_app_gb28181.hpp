@@ -11,6 +11,7 @@
 
 #include <srs_app_listener.hpp>
 #include <srs_app_st.hpp>
+#include <srs_core_autofree.hpp>
 #include <srs_kernel_ps.hpp>
 #include <srs_protocol_conn.hpp>
 #include <srs_protocol_http_conn.hpp>
@@ -57,6 +58,14 @@ class ISrsApiServerOwner;
 class ISrsResourceManager;
 class ISrsAppFactory;
 class ISrsIpListener;
+class ISrsRequest;
+class SrsLiveSource;
+class ISrsLiveSourceManager;
+class ISrsRtcSourceManager;
+class ISrsRtspSourceManager;
+class ISrsHttpHooks;
+class ISrsStreamPublishTokenManager;
+class SrsStreamPublishToken;
 
 // The state machine for GB session.
 // init:
@@ -429,12 +438,21 @@ public:
     virtual srs_error_t on_ts_message(SrsTsMessage *msg) = 0;
 };
 
-// Mux GB28181 to RTMP.
+// Mux GB28181 to RTMP. When output to this server, the frames are delivered to the live source in
+// process, like SRT, without the RTMP client over loopback.
 class SrsGbMuxer : public ISrsGbMuxer
 {
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
     ISrsAppFactory *app_factory_;
+    ISrsAppConfig *config_;
+    ISrsLiveSourceManager *live_sources_;
+    ISrsRtcSourceManager *rtc_sources_;
+#ifdef SRS_RTSP
+    ISrsRtspSourceManager *rtsp_sources_;
+#endif
+    ISrsHttpHooks *hooks_;
+    ISrsStreamPublishTokenManager *stream_publish_tokens_;
 
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
@@ -442,6 +460,12 @@ SRS_DECLARE_PRIVATE: // clang-format on
     ISrsGbSession *session_;
     std::string output_;
     ISrsBasicRtmpClient *sdk_;
+    // The live source to publish in process, when output to this server.
+    ISrsRequest *req_;
+    SrsSharedPtr<SrsLiveSource> source_;
+    SrsStreamPublishToken *publish_token_;
+    // Whether the live source is published by this muxer.
+    bool publishing_;
 
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
@@ -492,10 +516,17 @@ SRS_DECLARE_PRIVATE: // clang-format on
 
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
-    // Connect to RTMP server.
+    // Connect to RTMP server, or publish to live source if output to this server.
     virtual srs_error_t connect();
-    // Close the connection to RTMP server.
+    // Close the connection to RTMP server, or unpublish the live source.
     virtual void close();
+    // Whether the output url is served by this server, that is, the loopback host and RTMP port.
+    virtual bool is_local_output(std::string url);
+    // Publish to live source in process, with the request parsed from url.
+    virtual srs_error_t publish_source(std::string url);
+    virtual void unpublish_source();
+    virtual srs_error_t http_hooks_on_publish();
+    virtual void http_hooks_on_unpublish();
 };
 
 // The interface for recoverable PS context.
@@ -18,10 +18,13 @@
 using namespace std;
 
 #include <openssl/rand.h>
+#include <srs_app_async_io.hpp>
 #include <srs_app_config.hpp>
 #include <srs_app_factory.hpp>
+#include <srs_app_hls_ll.hpp>
 #include <srs_app_http_hooks.hpp>
 #include <srs_app_rtmp_source.hpp>
+#include <srs_app_segment_cache.hpp>
 #include <srs_app_utility.hpp>
 #include <srs_core_autofree.hpp>
 #include <srs_kernel_codec.hpp>
@@ -46,6 +49,9 @@ using namespace std;
 // reset the piece id when deviation overflow this.
 #define SRS_JUMP_WHEN_PIECE_DEVIATION 20
 
+// The IO buffer of ts file, to flush the TS packets to disk in large blocks.
+#define SRS_HLS_FWRITE_CACHE_SIZE 65536
+
 // Build the full key URL by appending key_file to hls_key_url with proper query string handling.
 // If hls_key_url contains query string like "http://localhost:8080/?token=abc",
 // the result will be "http://localhost:8080/live/livestream-0.key?token=abc"
@@ -429,12 +435,15 @@ SrsHlsFmp4Muxer::SrsHlsFmp4Muxer()
     audio_track_id_ = 0;
     init_mp4_ready_ = false;
     video_dts_ = 0;
+    cache_writer_ = NULL;
 
     memset(key_, 0, 16);
     memset(iv_, 0, 16);
 
     config_ = _srs_config;
     app_factory_ = _srs_app_factory;
+    async_io_ = _srs_async_io;
+    segment_cache_ = _srs_segment_cache;
 }
 
 SrsHlsFmp4Muxer::~SrsHlsFmp4Muxer()
@@ -447,6 +456,8 @@ SrsHlsFmp4Muxer::~SrsHlsFmp4Muxer()
 
     config_ = NULL;
     app_factory_ = NULL;
+    async_io_ = NULL;
+    segment_cache_ = NULL;
 }
 
 void SrsHlsFmp4Muxer::dispose()
@@ -463,9 +474,12 @@ void SrsHlsFmp4Muxer::dispose()
         srs_freep(current_);
     }
 
+    // Never serve the playlist of disposed stream from cache.
+    segment_cache_->remove(m3u8_);
+
     SrsUniquePtr<SrsPath> path(app_factory_->create_path());
     if (path->exists(m3u8_)) {
-        if ((err = path->unlink(m3u8_)) != srs_success) {
+        if ((err = async_io_->unlink(m3u8_)) != srs_success) {
             srs_warn("dispose: ignore remove m3u8 failed, %s", srs_error_desc(err).c_str());
             srs_freep(err);
         }
@@ -594,6 +608,10 @@ srs_error_t SrsHlsFmp4Muxer::write_init_mp4(SrsFormat *format, bool has_video, b
         return srs_error_wrap(err, "rename hls init.mp4");
     }
 
+    if (cache_writer_) {
+        cache_writer_->on_reap(init_mp4->fullpath());
+    }
+
     // the ts url, relative or absolute url.
     // TODO: FIXME: Use url and path manager.
     std::string mp4_path = init_mp4->fullpath();
@@ -743,8 +761,15 @@ srs_error_t SrsHlsFmp4Muxer::update_config(ISrsRequest *r)
         return srs_error_wrap(err, "create dir");
     }
 
+    srs_freep(writer_);
     writer_ = app_factory_->create_file_writer();
 
+    // Copy the init.mp4 and segments to cache, for the HTTP static server.
+    cache_writer_ = NULL;
+    if (segment_cache_->enabled(vhost)) {
+        writer_ = cache_writer_ = new SrsSegmentCacheWriter(vhost, writer_);
+    }
+
     return err;
 }
 
@@ -956,6 +981,10 @@ srs_error_t SrsHlsFmp4Muxer::do_segment_close()
         return srs_error_wrap(err, "reap segment");
     }
 
+    if (cache_writer_) {
+        cache_writer_->on_reap(current_->fullpath());
+    }
+
     // use async to call the http hooks, for it will cause thread switch.
     if ((err = async_->execute(new SrsDvrAsyncCallOnHls(_srs_context->get_id(), req_, current_->fullpath(),
                                                         current_->uri_, m3u8_, m3u8_url_, current_->sequence_no_, current_->duration()))) != srs_success) {
@@ -1035,8 +1064,8 @@ srs_error_t SrsHlsFmp4Muxer::refresh_m3u8()
 
     std::string temp_m3u8 = m3u8_ + ".temp";
     if ((err = do_refresh_m3u8(temp_m3u8)) == srs_success) {
-        if (rename(temp_m3u8.c_str(), m3u8_.c_str()) < 0) {
-            err = srs_error_new(ERROR_HLS_WRITE_FAILED, "hls: rename m3u8 file failed. %s => %s", temp_m3u8.c_str(), m3u8_.c_str());
+        if ((err = async_io_->rename(temp_m3u8, m3u8_)) != srs_success) {
+            err = srs_error_wrap(err, "hls: rename m3u8 file failed. %s => %s", temp_m3u8.c_str(), m3u8_.c_str());
         }
     }
 
@@ -1115,6 +1144,11 @@ srs_error_t SrsHlsFmp4Muxer::do_refresh_m3u8(std::string m3u8_file)
         return srs_error_wrap(err, "hls: write m3u8");
     }
 
+    // The m3u8 is renamed to m3u8_ later.
+    if (segment_cache_->enabled(req_->vhost_)) {
+        segment_cache_->put(req_->vhost_, m3u8_, m3u8);
+    }
+
     return err;
 }
 
@@ -1185,6 +1219,8 @@ SrsHlsMuxer::SrsHlsMuxer()
     current_ = NULL;
     hls_keys_ = false;
     hls_fragments_per_key_ = 0;
+    hls_persist_ = true;
+    cache_writer_ = NULL;
     async_ = new SrsAsyncCallWorker();
     context_ = new SrsTsContext();
     segments_ = new SrsFragmentWindow();
@@ -1196,6 +1232,9 @@ SrsHlsMuxer::SrsHlsMuxer()
 
     config_ = _srs_config;
     app_factory_ = _srs_app_factory;
+    async_io_ = _srs_async_io;
+    hls_ll_ = _srs_hls_ll;
+    segment_cache_ = _srs_segment_cache;
 }
 
 SrsHlsMuxer::~SrsHlsMuxer()
@@ -1209,6 +1248,9 @@ SrsHlsMuxer::~SrsHlsMuxer()
 
     config_ = NULL;
     app_factory_ = NULL;
+    async_io_ = NULL;
+    hls_ll_ = NULL;
+    segment_cache_ = NULL;
 }
 
 // LCOV_EXCL_START
@@ -1216,6 +1258,12 @@ void SrsHlsMuxer::dispose()
 {
     srs_error_t err = srs_success;
 
+    // No file to remove, for LL-HLS is served from memory.
+    if (!hls_persist_) {
+        srs_freep(current_);
+        return;
+    }
+
     segments_->dispose();
 
     if (current_) {
@@ -1226,9 +1274,12 @@ void SrsHlsMuxer::dispose()
         srs_freep(current_);
     }
 
+    // Never serve the playlist of disposed stream from cache.
+    segment_cache_->remove(m3u8_);
+
     SrsUniquePtr<SrsPath> path(app_factory_->create_path());
     if (path->exists(m3u8_)) {
-        if ((err = path->unlink(m3u8_)) != srs_success) {
+        if ((err = async_io_->unlink(m3u8_)) != srs_success) {
             srs_warn("dispose: ignore remove m3u8 failed, %s", srs_error_desc(err).c_str());
             srs_freep(err);
         }
@@ -1328,6 +1379,13 @@ srs_error_t SrsHlsMuxer::on_publish(ISrsRequest *req)
 srs_error_t SrsHlsMuxer::on_unpublish()
 {
     async_->stop();
+
+    // Wakeup the blocking requests of LL-HLS, and remove the stream.
+    if (ll_.get()) {
+        hls_ll_->unpublish("/" + m3u8_url_);
+        ll_ = SrsSharedPtr<SrsHlsLowLatency>(NULL);
+    }
+
     return srs_success;
 }
 
@@ -1367,16 +1425,40 @@ srs_error_t SrsHlsMuxer::update_config(ISrsRequest *r, string entry_prefix,
     // when update config, reset the history target duration.
     max_td_ = fragment * config_->get_hls_td_ratio(r->vhost_);
 
-    if ((err = create_directories()) != srs_success) {
+    // The LL-HLS is not supported for encrypted HLS, for the parts are not aligned to AES blocks.
+    bool hls_ll = config_->get_hls_ll(r->vhost_) && !hls_keys_;
+    hls_persist_ = !hls_ll || config_->get_hls_ll_persist(r->vhost_);
+
+    if (hls_persist_ && (err = create_directories()) != srs_success) {
         return srs_error_wrap(err, "create dir");
     }
 
+    srs_freep(writer_);
     if (hls_keys_) {
         writer_ = app_factory_->create_enc_file_writer();
     } else {
         writer_ = app_factory_->create_file_writer();
     }
 
+    // Copy the segments to cache, for the HTTP static server. The encrypted segments are not
+    // cached, for the data is encrypted by the underlayer writer.
+    cache_writer_ = NULL;
+    if (hls_persist_ && !hls_keys_ && segment_cache_->enabled(r->vhost_)) {
+        writer_ = cache_writer_ = new SrsSegmentCacheWriter(r->vhost_, writer_);
+    }
+
+    // Write the TS to LL-HLS stream in memory, and to disk if persist.
+    if (hls_ll) {
+        ll_ = hls_ll_->publish("/" + m3u8_url_, config_->get_hls_part(r->vhost_));
+        ll_->set_target_duration(max_td_);
+
+        ISrsFileWriter *writer = writer_;
+        if (!hls_persist_) {
+            srs_freep(writer);
+        }
+        writer_ = new SrsHlsLowLatencyWriter(ll_, writer);
+    }
+
     return err;
 }
 
@@ -1589,6 +1671,10 @@ srs_error_t SrsHlsMuxer::segment_open()
     current_ = new SrsHlsSegment(context_, default_acodec, default_vcodec, writer_);
     current_->sequence_no_ = sequence_no_++;
 
+    if (ll_.get()) {
+        ll_->on_segment_open(current_->sequence_no_);
+    }
+
     if ((err = write_hls_key()) != srs_success) {
         return srs_error_wrap(err, "write hls key");
     }
@@ -1620,7 +1706,7 @@ srs_error_t SrsHlsMuxer::segment_open()
     current_->uri_ += ts_url;
 
     // create dir recursively for hls.
-    if ((err = current_->create_dir()) != srs_success) {
+    if (hls_persist_ && (err = current_->create_dir()) != srs_success) {
         return srs_error_wrap(err, "create dir");
     }
 
@@ -1629,6 +1715,9 @@ srs_error_t SrsHlsMuxer::segment_open()
     if ((err = current_->writer_->open(tmp_file)) != srs_success) {
         return srs_error_wrap(err, "open hls muxer");
     }
+    if ((err = current_->writer_->set_iobuf_size(SRS_HLS_FWRITE_CACHE_SIZE)) != srs_success) {
+        return srs_error_wrap(err, "set iobuf size");
+    }
 
     // reset the context for a new ts start.
     context_->reset();
@@ -1701,6 +1790,10 @@ srs_error_t SrsHlsMuxer::on_sequence_header()
     // when close the segement, it will write a discontinuity to m3u8 file.
     current_->set_sequence_header(true);
 
+    if (ll_.get()) {
+        ll_->on_discontinuity();
+    }
+
     return err;
 }
 
@@ -1773,6 +1866,11 @@ srs_error_t SrsHlsMuxer::flush_audio(SrsTsMessageCache *cache)
     // update the duration of segment.
     update_duration(cache->audio_->dts_);
 
+    // The part starts with audio is independent for pure audio.
+    if (ll_.get()) {
+        ll_->on_frame(cache->audio_->dts_ / 90, pure_audio());
+    }
+
     if ((err = current_->tscw_->write_audio(cache->audio_)) != srs_success) {
         return srs_error_wrap(err, "hls: write audio");
     }
@@ -1802,6 +1900,11 @@ srs_error_t SrsHlsMuxer::flush_video(SrsTsMessageCache *cache)
     // update the duration of segment.
     update_duration(cache->video_->dts_);
 
+    // The part starts with keyframe is independent.
+    if (ll_.get()) {
+        ll_->on_frame(cache->video_->dts_ / 90, cache->video_->write_pcr_);
+    }
+
     if ((err = current_->tscw_->write_video(cache->video_)) != srs_success) {
         return srs_error_wrap(err, "hls: write video");
     }
@@ -1847,11 +1950,19 @@ srs_error_t SrsHlsMuxer::do_segment_close()
     // shrink the segments.
     segments_->shrink(hls_window_);
 
+    // The LL-HLS keeps the same window as m3u8.
+    if (ll_.get() && !segments_->empty()) {
+        SrsHlsSegment *first = dynamic_cast<SrsHlsSegment *>(segments_->first());
+        ll_->shrink(first->sequence_no_);
+    }
+
     // refresh the m3u8, donot contains the removed ts
-    err = refresh_m3u8();
+    if (hls_persist_) {
+        err = refresh_m3u8();
+    }
 
     // remove the ts file.
-    segments_->clear_expired(hls_cleanup_);
+    segments_->clear_expired(hls_cleanup_ && hls_persist_);
 
     // check ret of refresh m3u8
     if (err != srs_success) {
@@ -1877,14 +1988,23 @@ srs_error_t SrsHlsMuxer::do_segment_close2()
     // when too small, it maybe not enough data to play.
     // when too large, it maybe timestamp corrupt.
     // make the segment more acceptable, when in [min, max_td * 3], it's ok.
+    // For LL-HLS, the parts of segment are already served, so never drop it or reuse the sequence.
     bool matchMinDuration = current_->duration() >= SRS_HLS_SEGMENT_MIN_DURATION;
     bool matchMaxDuration = current_->duration() <= max_td_ * 3 * 1000;
-    if (matchMinDuration && matchMaxDuration) {
+    if (ll_.get() || (matchMinDuration && matchMaxDuration)) {
+        if (ll_.get()) {
+            ll_->on_segment_close(current_->duration());
+        }
+
         // rename from tmp to real path
-        if ((err = current_->rename()) != srs_success) {
+        if (hls_persist_ && (err = current_->rename()) != srs_success) {
             return srs_error_wrap(err, "rename");
         }
 
+        if (cache_writer_) {
+            cache_writer_->on_reap(current_->fullpath());
+        }
+
         // use async to call the http hooks, for it will cause thread switch.
         if ((err = async_->execute(new SrsDvrAsyncCallOnHls(_srs_context->get_id(), req_, current_->fullpath(),
                                                             current_->uri_, m3u8_, m3u8_url_, current_->sequence_no_, current_->duration()))) != srs_success) {
@@ -1965,8 +2085,8 @@ srs_error_t SrsHlsMuxer::refresh_m3u8()
 
     std::string temp_m3u8 = m3u8_ + ".temp";
     if ((err = do_refresh_m3u8(temp_m3u8)) == srs_success) {
-        if (rename(temp_m3u8.c_str(), m3u8_.c_str()) < 0) {
-            err = srs_error_new(ERROR_HLS_WRITE_FAILED, "hls: rename m3u8 file failed. %s => %s", temp_m3u8.c_str(), m3u8_.c_str());
+        if ((err = async_io_->rename(temp_m3u8, m3u8_)) != srs_success) {
+            err = srs_error_wrap(err, "hls: rename m3u8 file failed. %s => %s", temp_m3u8.c_str(), m3u8_.c_str());
         }
     }
 
@@ -2044,6 +2164,11 @@ srs_error_t SrsHlsMuxer::do_refresh_m3u8(string m3u8_file)
         return srs_error_wrap(err, "hls: write m3u8");
     }
 
+    // The m3u8 is renamed to m3u8_ later.
+    if (segment_cache_->enabled(req_->vhost_)) {
+        segment_cache_->put(req_->vhost_, m3u8_, m3u8);
+    }
+
     return err;
 }
 
@@ -15,6 +15,7 @@
 
 #include <srs_app_async_call.hpp>
 #include <srs_app_fragment.hpp>
+#include <srs_core_autofree.hpp>
 #include <srs_kernel_codec.hpp>
 #include <srs_kernel_file.hpp>
 #include <srs_kernel_mp4.hpp>
@@ -41,6 +42,11 @@ class SrsFmp4SegmentEncoder;
 class ISrsHttpHooks;
 class ISrsAppConfig;
 class ISrsAppFactory;
+class ISrsAsyncIo;
+class SrsHlsLowLatency;
+class ISrsSegmentCache;
+class SrsSegmentCacheWriter;
+class SrsHlsLowLatencyManager;
 
 // The wrapper of m3u8 segment from specification:
 //
@@ -244,6 +250,9 @@ class SrsHlsMuxer : public ISrsHlsMuxer
 SRS_DECLARE_PRIVATE: // clang-format on
     ISrsAppConfig *config_;
     ISrsAppFactory *app_factory_;
+    ISrsAsyncIo *async_io_;
+    SrsHlsLowLatencyManager *hls_ll_;
+    ISrsSegmentCache *segment_cache_;
 
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
@@ -291,6 +300,9 @@ SRS_DECLARE_PRIVATE: // clang-format on
     unsigned char iv_[16];
     // The underlayer file writer.
     ISrsFileWriter *writer_;
+    // The writer which copies the segment to cache, NULL if disabled. It's the writer_ or
+    // the underlayer of writer_.
+    SrsSegmentCacheWriter *cache_writer_;
 
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
@@ -308,6 +320,13 @@ SRS_DECLARE_PRIVATE: // clang-format on
     // The ts context, to keep cc continous between ts.
     SrsTsContext *context_;
 
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // The LL-HLS stream, which serves the segments and parts from memory, NULL if disabled.
+    SrsSharedPtr<SrsHlsLowLatency> ll_;
+    // Whether write the segments and m3u8 to disk, always true if not LL-HLS.
+    bool hls_persist_;
+
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
     // Latest audio codec, parsed from stream.
@@ -412,6 +431,8 @@ class SrsHlsFmp4Muxer
 SRS_DECLARE_PRIVATE: // clang-format on
     ISrsAppConfig *config_;
     ISrsAppFactory *app_factory_;
+    ISrsAsyncIo *async_io_;
+    ISrsSegmentCache *segment_cache_;
 
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
@@ -470,6 +491,8 @@ SRS_DECLARE_PRIVATE: // clang-format on
     unsigned char iv_[16];
     // The underlayer file writer.
     ISrsFileWriter *writer_;
+    // The writer which copies the segment to cache, NULL if disabled, which is the writer_.
+    SrsSegmentCacheWriter *cache_writer_;
 
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
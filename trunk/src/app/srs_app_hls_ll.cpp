@@ -0,0 +1,714 @@
+//
+// Copyright (c) 2013-2025 The SRS Authors
+//
+// SPDX-License-Identifier: MIT
+//
+
+#include <srs_app_hls_ll.hpp>
+
+#include <math.h>
+#include <stdlib.h>
+using namespace std;
+
+#include <srs_app_st.hpp>
+#include <srs_kernel_buffer.hpp>
+#include <srs_kernel_consts.hpp>
+#include <srs_kernel_error.hpp>
+#include <srs_kernel_log.hpp>
+#include <srs_kernel_stream.hpp>
+#include <srs_kernel_utility.hpp>
+#include <srs_protocol_http_stack.hpp>
+
+// The max duration to block the playlist reload, in target duration.
+#define SRS_HLS_LL_BLOCK_RATIO 3
+// The number of latest completed segments which have EXT-X-PART in playlist.
+#define SRS_HLS_LL_PARTS_SEGMENTS 2
+
+SrsHlsLowLatencyManager *_srs_hls_ll = NULL;
+
+SrsHlsPart::SrsHlsPart()
+{
+    index_ = 0;
+    duration_ = 0;
+    independent_ = false;
+}
+
+SrsHlsPart::~SrsHlsPart()
+{
+}
+
+SrsHlsPartialSegment::SrsHlsPartialSegment(int msn)
+{
+    msn_ = msn;
+    duration_ = 0;
+    discontinuity_ = false;
+    completed_ = false;
+}
+
+SrsHlsPartialSegment::~SrsHlsPartialSegment()
+{
+    std::vector<SrsHlsPart *>::iterator it;
+    for (it = parts_.begin(); it != parts_.end(); ++it) {
+        SrsHlsPart *part = *it;
+        srs_freep(part);
+    }
+    parts_.clear();
+}
+
+SrsHlsPart *SrsHlsPartialSegment::at(int index)
+{
+    if (index < 0 || index >= (int)parts_.size()) {
+        return NULL;
+    }
+    return parts_[index];
+}
+
+SrsHlsLowLatency::SrsHlsLowLatency(string base, srs_utime_t part_target)
+{
+    base_ = base;
+    part_target_ = part_target;
+    target_duration_ = 0;
+    eof_ = false;
+    cond_ = new SrsCond();
+
+    current_ = NULL;
+    part_ = new SrsSimpleStream();
+    part_start_ = -1;
+    previous_dts_ = -1;
+    part_independent_ = false;
+}
+
+SrsHlsLowLatency::~SrsHlsLowLatency()
+{
+    std::deque<SrsHlsPartialSegment *>::iterator it;
+    for (it = segments_.begin(); it != segments_.end(); ++it) {
+        SrsHlsPartialSegment *segment = *it;
+        srs_freep(segment);
+    }
+    segments_.clear();
+
+    srs_freep(current_);
+    srs_freep(part_);
+    srs_freep(cond_);
+}
+
+void SrsHlsLowLatency::set_target_duration(srs_utime_t v)
+{
+    target_duration_ = v;
+}
+
+void SrsHlsLowLatency::on_segment_open(int msn)
+{
+    // Drop the segment which is not closed, should never happen.
+    srs_freep(current_);
+
+    current_ = new SrsHlsPartialSegment(msn);
+    part_->erase(part_->length());
+    part_start_ = previous_dts_ = -1;
+
+    notify();
+}
+
+void SrsHlsLowLatency::on_discontinuity()
+{
+    if (current_) {
+        current_->discontinuity_ = true;
+    }
+}
+
+void SrsHlsLowLatency::on_frame(int64_t dts, bool independent)
+{
+    if (!current_) {
+        return;
+    }
+
+    // The first frame of part.
+    if (part_start_ < 0) {
+        part_start_ = previous_dts_ = dts;
+        part_independent_ = independent;
+        return;
+    }
+
+    // Finish the part before the frame, if the part with this frame is going to exceed the part target,
+    // which is predicted by the interval of frames, because the duration of part should never exceed it.
+    int64_t duration = dts - part_start_;
+    int64_t interval = srs_max(0, dts - previous_dts_);
+    previous_dts_ = dts;
+
+    if (part_->length() <= 0 || duration <= 0) {
+        return;
+    }
+
+    if ((duration + interval) * SRS_UTIME_MILLISECONDS > part_target_) {
+        finish_part(duration * SRS_UTIME_MILLISECONDS);
+
+        part_start_ = dts;
+        part_independent_ = independent;
+    }
+}
+
+srs_error_t SrsHlsLowLatency::write(void *buf, size_t size)
+{
+    if (current_) {
+        part_->append((const char *)buf, (int)size);
+    }
+    return srs_success;
+}
+
+void SrsHlsLowLatency::on_segment_close(srs_utime_t duration)
+{
+    if (!current_) {
+        return;
+    }
+
+    // The last part is the rest of segment.
+    if (part_->length() > 0) {
+        srs_utime_t parts = 0;
+        for (int i = 0; i < (int)current_->parts_.size(); i++) {
+            parts += current_->parts_[i]->duration_;
+        }
+        finish_part(srs_max(0, duration - parts));
+    }
+
+    current_->duration_ = duration;
+    current_->completed_ = true;
+    segments_.push_back(current_);
+    current_ = NULL;
+    part_start_ = previous_dts_ = -1;
+
+    notify();
+}
+
+void SrsHlsLowLatency::shrink(int msn)
+{
+    while (!segments_.empty() && segments_.front()->msn_ < msn) {
+        SrsHlsPartialSegment *segment = segments_.front();
+        segments_.pop_front();
+        srs_freep(segment);
+    }
+
+    playlist_.clear();
+}
+
+void SrsHlsLowLatency::on_unpublish()
+{
+    eof_ = true;
+    notify();
+}
+
+bool SrsHlsLowLatency::eof()
+{
+    return eof_;
+}
+
+srs_utime_t SrsHlsLowLatency::target_duration()
+{
+    return target_duration_;
+}
+
+int SrsHlsLowLatency::last_msn()
+{
+    if (current_) {
+        return current_->msn_;
+    }
+    return segments_.empty() ? -1 : segments_.back()->msn_;
+}
+
+bool SrsHlsLowLatency::has(int msn, int part)
+{
+    int last = last_msn();
+    if (last < 0) {
+        return false;
+    }
+
+    // Expired or later segment, the playlist is newer than requested.
+    SrsHlsPartialSegment *segment = find(msn);
+    if (!segment) {
+        return msn < last;
+    }
+
+    if (part < 0) {
+        return segment->completed_;
+    }
+
+    if (part < (int)segment->parts_.size()) {
+        return true;
+    }
+
+    // The part exceeds the completed segment, it's the first part of next segment.
+    return segment->completed_ && has(msn + 1, 0);
+}
+
+void SrsHlsLowLatency::wait(int msn, int part, srs_utime_t timeout)
+{
+    srs_utime_t deadline = srs_time_now_realtime() + timeout;
+
+    while (!eof_ && !has(msn, part)) {
+        srs_utime_t now = srs_time_now_realtime();
+        if (now >= deadline) {
+            break;
+        }
+
+        cond_->timedwait(deadline - now);
+    }
+}
+
+bool SrsHlsLowLatency::fetch(int msn, int part, std::vector<SrsSharedPtr<SrsMemoryBlock> > &blocks)
+{
+    SrsHlsPartialSegment *segment = find(msn);
+    if (!segment) {
+        return false;
+    }
+
+    if (part >= 0) {
+        SrsHlsPart *p = segment->at(part);
+        if (!p) {
+            return false;
+        }
+
+        blocks.push_back(p->data_);
+        return true;
+    }
+
+    if (!segment->completed_) {
+        return false;
+    }
+
+    for (int i = 0; i < (int)segment->parts_.size(); i++) {
+        blocks.push_back(segment->parts_[i]->data_);
+    }
+
+    return true;
+}
+
+string SrsHlsLowLatency::playlist()
+{
+    if (!playlist_.empty()) {
+        return playlist_;
+    }
+
+    if (segments_.empty() && (!current_ || current_->parts_.empty())) {
+        return playlist_;
+    }
+
+    std::stringstream ss;
+    ss.precision(3);
+    ss.setf(std::ios::fixed, std::ios::floatfield);
+
+    ss << "#EXTM3U" << SRS_CONSTS_LF;
+    ss << "#EXT-X-VERSION:6" << SRS_CONSTS_LF;
+
+    srs_utime_t max_duration = target_duration_;
+    for (int i = 0; i < (int)segments_.size(); i++) {
+        max_duration = srs_max(max_duration, segments_[i]->duration_);
+    }
+    ss << "#EXT-X-TARGETDURATION:" << (int)ceil(srsu2msi(max_duration) / 1000.0) << SRS_CONSTS_LF;
+
+    // The PART-HOLD-BACK must be at least three times the PART-TARGET.
+    ss << "#EXT-X-SERVER-CONTROL:CAN-BLOCK-RELOAD=YES,PART-HOLD-BACK=" << 3 * srsu2msi(part_target_) / 1000.0 << SRS_CONSTS_LF;
+    ss << "#EXT-X-PART-INF:PART-TARGET=" << srsu2msi(part_target_) / 1000.0 << SRS_CONSTS_LF;
+
+    int first = segments_.empty() ? current_->msn_ : segments_.front()->msn_;
+    ss << "#EXT-X-MEDIA-SEQUENCE:" << first << SRS_CONSTS_LF;
+
+    for (int i = 0; i < (int)segments_.size(); i++) {
+        SrsHlsPartialSegment *segment = segments_[i];
+
+        if (segment->discontinuity_) {
+            ss << "#EXT-X-DISCONTINUITY" << SRS_CONSTS_LF;
+        }
+
+        // Only the latest segments have parts, for the parts are only for the live edge.
+        if (i >= (int)segments_.size() - SRS_HLS_LL_PARTS_SEGMENTS) {
+            dump_parts(segment, ss);
+        }
+
+        ss << "#EXTINF:" << srsu2msi(segment->duration_) / 1000.0 << ", no desc" << SRS_CONSTS_LF;
+        ss << base_ << "." << segment->msn_ << ".ts" << SRS_CONSTS_LF;
+    }
+
+    // The parts of current segment, and the hint for next part, so players are able to request it
+    // before it's ready, and we hold the request until the part is done.
+    if (current_) {
+        if (current_->discontinuity_) {
+            ss << "#EXT-X-DISCONTINUITY" << SRS_CONSTS_LF;
+        }
+
+        dump_parts(current_, ss);
+
+        ss << "#EXT-X-PRELOAD-HINT:TYPE=PART,URI=\"" << base_ << "." << current_->msn_ << "." << current_->parts_.size() << ".ts\"" << SRS_CONSTS_LF;
+    }
+
+    playlist_ = ss.str();
+    return playlist_;
+}
+
+void SrsHlsLowLatency::finish_part(srs_utime_t duration)
+{
+    SrsHlsPart *part = new SrsHlsPart();
+    part->index_ = (int)current_->parts_.size();
+    part->duration_ = duration;
+    part->independent_ = part_independent_;
+
+    SrsMemoryBlock *data = new SrsMemoryBlock();
+    data->create(part_->bytes(), part_->length());
+    part->data_ = SrsSharedPtr<SrsMemoryBlock>(data);
+
+    current_->parts_.push_back(part);
+    part_->erase(part_->length());
+
+    notify();
+}
+
+SrsHlsPartialSegment *SrsHlsLowLatency::find(int msn)
+{
+    if (current_ && current_->msn_ == msn) {
+        return current_;
+    }
+
+    std::deque<SrsHlsPartialSegment *>::iterator it;
+    for (it = segments_.begin(); it != segments_.end(); ++it) {
+        SrsHlsPartialSegment *segment = *it;
+        if (segment->msn_ == msn) {
+            return segment;
+        }
+    }
+
+    return NULL;
+}
+
+void SrsHlsLowLatency::dump_parts(SrsHlsPartialSegment *segment, std::stringstream &ss)
+{
+    for (int i = 0; i < (int)segment->parts_.size(); i++) {
+        SrsHlsPart *part = segment->parts_[i];
+
+        ss << "#EXT-X-PART:DURATION=" << srsu2msi(part->duration_) / 1000.0;
+        ss << ",URI=\"" << base_ << "." << segment->msn_ << "." << part->index_ << ".ts\"";
+        if (part->independent_) {
+            ss << ",INDEPENDENT=YES";
+        }
+        ss << SRS_CONSTS_LF;
+    }
+}
+
+void SrsHlsLowLatency::notify()
+{
+    playlist_.clear();
+    cond_->broadcast();
+}
+
+SrsHlsLowLatencyWriter::SrsHlsLowLatencyWriter(SrsSharedPtr<SrsHlsLowLatency> stream, ISrsFileWriter *writer)
+{
+    stream_ = stream;
+    writer_ = writer;
+    opened_ = false;
+    position_ = 0;
+}
+
+SrsHlsLowLatencyWriter::~SrsHlsLowLatencyWriter()
+{
+    srs_freep(writer_);
+}
+
+srs_error_t SrsHlsLowLatencyWriter::set_iobuf_size(int size)
+{
+    return writer_ ? writer_->set_iobuf_size(size) : srs_success;
+}
+
+srs_error_t SrsHlsLowLatencyWriter::open(string p)
+{
+    opened_ = true;
+    position_ = 0;
+    return writer_ ? writer_->open(p) : srs_success;
+}
+
+void SrsHlsLowLatencyWriter::close()
+{
+    opened_ = false;
+    if (writer_) {
+        writer_->close();
+    }
+}
+
+bool SrsHlsLowLatencyWriter::is_open()
+{
+    return opened_;
+}
+
+void SrsHlsLowLatencyWriter::seek2(int64_t offset)
+{
+    position_ = offset;
+    if (writer_) {
+        writer_->seek2(offset);
+    }
+}
+
+int64_t SrsHlsLowLatencyWriter::tellg()
+{
+    return position_;
+}
+
+srs_error_t SrsHlsLowLatencyWriter::write(void *buf, size_t count, ssize_t *pnwrite)
+{
+    srs_error_t err = srs_success;
+
+    if ((err = stream_->write(buf, count)) != srs_success) {
+        return srs_error_wrap(err, "write part");
+    }
+
+    if (writer_ && (err = writer_->write(buf, count, NULL)) != srs_success) {
+        return srs_error_wrap(err, "write file");
+    }
+
+    position_ += count;
+    if (pnwrite) {
+        *pnwrite = count;
+    }
+
+    return err;
+}
+
+srs_error_t SrsHlsLowLatencyWriter::writev(const iovec *iov, int iovcnt, ssize_t *pnwrite)
+{
+    srs_error_t err = srs_success;
+
+    ssize_t nwrite = 0;
+    for (int i = 0; i < iovcnt; i++) {
+        const iovec *piov = iov + i;
+
+        ssize_t this_nwrite = 0;
+        if ((err = write(piov->iov_base, piov->iov_len, &this_nwrite)) != srs_success) {
+            return srs_error_wrap(err, "write %d iov", i);
+        }
+        nwrite += this_nwrite;
+    }
+
+    if (pnwrite) {
+        *pnwrite = nwrite;
+    }
+
+    return err;
+}
+
+srs_error_t SrsHlsLowLatencyWriter::lseek(off_t offset, int whence, off_t *seeked)
+{
+    srs_error_t err = srs_success;
+
+    if (writer_ && (err = writer_->lseek(offset, whence, seeked)) != srs_success) {
+        return srs_error_wrap(err, "seek file");
+    }
+
+    if (whence == SEEK_SET) {
+        position_ = offset;
+    } else if (whence == SEEK_CUR) {
+        position_ += offset;
+    }
+
+    if (seeked) {
+        *seeked = position_;
+    }
+
+    return err;
+}
+
+SrsHlsLowLatencyManager::SrsHlsLowLatencyManager()
+{
+}
+
+SrsHlsLowLatencyManager::~SrsHlsLowLatencyManager()
+{
+    streams_.clear();
+}
+
+SrsSharedPtr<SrsHlsLowLatency> SrsHlsLowLatencyManager::publish(string m3u8, srs_utime_t part_target)
+{
+    // Notify the previous stream to quit, for example, the encoder republish.
+    unpublish(m3u8);
+
+    SrsPath path;
+    string base = path.filepath_filename(path.filepath_base(m3u8));
+
+    SrsSharedPtr<SrsHlsLowLatency> stream(new SrsHlsLowLatency(base, part_target));
+    streams_[m3u8] = stream;
+
+    srs_trace("LL-HLS: publish %s, part=%dms", m3u8.c_str(), srsu2msi(part_target));
+    return stream;
+}
+
+void SrsHlsLowLatencyManager::unpublish(string m3u8)
+{
+    std::map<std::string, SrsSharedPtr<SrsHlsLowLatency> >::iterator it = streams_.find(m3u8);
+    if (it == streams_.end()) {
+        return;
+    }
+
+    // The coroutines which are blocking on stream hold the reference, so it's safe to remove it.
+    SrsSharedPtr<SrsHlsLowLatency> stream = it->second;
+    streams_.erase(it);
+
+    stream->on_unpublish();
+}
+
+srs_error_t SrsHlsLowLatencyManager::serve_http(ISrsHttpResponseWriter *w, ISrsHttpMessage *r, bool *served)
+{
+    *served = false;
+
+    if (streams_.empty()) {
+        return srs_success;
+    }
+
+    string upath = r->path();
+    if (srs_strings_ends_with(upath, ".m3u8")) {
+        SrsSharedPtr<SrsHlsLowLatency> stream = find(upath);
+        if (!stream.get()) {
+            return srs_success;
+        }
+
+        *served = true;
+        return serve_playlist(stream, w, r);
+    }
+
+    string m3u8;
+    int msn = -1, part = -1;
+    if (!srs_hls_ll_parse_uri(upath, m3u8, msn, part)) {
+        return srs_success;
+    }
+
+    SrsSharedPtr<SrsHlsLowLatency> stream = find(m3u8);
+    if (!stream.get()) {
+        return srs_success;
+    }
+
+    *served = true;
+    return serve_media(stream, msn, part, w, r);
+}
+
+srs_error_t SrsHlsLowLatencyManager::serve_playlist(SrsSharedPtr<SrsHlsLowLatency> stream, ISrsHttpResponseWriter *w, ISrsHttpMessage *r)
+{
+    srs_error_t err = srs_success;
+
+    // The blocking playlist reload, hold the request until the playlist contains the segment or part.
+    string hls_msn = r->query_get("_HLS_msn");
+    if (!hls_msn.empty()) {
+        string hls_part = r->query_get("_HLS_part");
+        int msn = ::atoi(hls_msn.c_str());
+        int part = hls_part.empty() ? -1 : ::atoi(hls_part.c_str());
+
+        if (msn > stream->last_msn() + 2) {
+            return srs_go_http_error(w, SRS_CONSTS_HTTP_BadRequest, srs_fmt_sprintf("_HLS_msn=%d too far", msn));
+        }
+
+        stream->wait(msn, part, SRS_HLS_LL_BLOCK_RATIO * stream->target_duration());
+
+        if (!stream->eof() && !stream->has(msn, part)) {
+            return srs_go_http_error(w, SRS_CONSTS_HTTP_ServiceUnavailable, srs_fmt_sprintf("_HLS_msn=%d, _HLS_part=%d timeout", msn, part));
+        }
+    }
+
+    string playlist = stream->playlist();
+    if (playlist.empty()) {
+        return srs_go_http_error(w, SRS_CONSTS_HTTP_NotFound);
+    }
+
+    w->header()->set_content_type("application/vnd.apple.mpegurl");
+    w->header()->set_content_length(playlist.length());
+    w->write_header(SRS_CONSTS_HTTP_OK);
+
+    if ((err = w->write((char *)playlist.data(), (int)playlist.length())) != srs_success) {
+        return srs_error_wrap(err, "write playlist");
+    }
+
+    if ((err = w->final_request()) != srs_success) {
+        return srs_error_wrap(err, "final request");
+    }
+
+    return err;
+}
+
+srs_error_t SrsHlsLowLatencyManager::serve_media(SrsSharedPtr<SrsHlsLowLatency> stream, int msn, int part, ISrsHttpResponseWriter *w, ISrsHttpMessage *r)
+{
+    srs_error_t err = srs_success;
+
+    // Hold the request of the preload hint part, until the part is ready.
+    std::vector<SrsSharedPtr<SrsMemoryBlock> > blocks;
+    if (!stream->fetch(msn, part, blocks) && msn <= stream->last_msn() + 1) {
+        stream->wait(msn, part, SRS_HLS_LL_BLOCK_RATIO * stream->target_duration());
+        stream->fetch(msn, part, blocks);
+    }
+
+    if (blocks.empty()) {
+        return srs_go_http_error(w, SRS_CONSTS_HTTP_NotFound);
+    }
+
+    int64_t size = 0;
+    for (int i = 0; i < (int)blocks.size(); i++) {
+        size += blocks[i]->size();
+    }
+
+    w->header()->set_content_type("video/mp2t");
+    w->header()->set_content_length(size);
+    w->write_header(SRS_CONSTS_HTTP_OK);
+
+    for (int i = 0; i < (int)blocks.size(); i++) {
+        SrsMemoryBlock *block = blocks[i].get();
+        if (block->size() <= 0) {
+            continue;
+        }
+
+        if ((err = w->write(block->payload(), block->size())) != srs_success) {
+            return srs_error_wrap(err, "write msn=%d, part=%d", msn, part);
+        }
+    }
+
+    if ((err = w->final_request()) != srs_success) {
+        return srs_error_wrap(err, "final request");
+    }
+
+    return err;
+}
+
+SrsSharedPtr<SrsHlsLowLatency> SrsHlsLowLatencyManager::find(string m3u8)
+{
+    std::map<std::string, SrsSharedPtr<SrsHlsLowLatency> >::iterator it = streams_.find(m3u8);
+    if (it == streams_.end()) {
+        return SrsSharedPtr<SrsHlsLowLatency>(NULL);
+    }
+    return it->second;
+}
+
+bool srs_hls_ll_parse_uri(string uri, string &m3u8, int &msn, int &part)
+{
+    if (!srs_strings_ends_with(uri, ".ts")) {
+        return false;
+    }
+
+    // For example, /live/livestream.10.2 or /live/livestream.10
+    string name = uri.substr(0, uri.length() - 3);
+
+    size_t pos = name.rfind(".");
+    if (pos == string::npos || !srs_is_digit_number(name.substr(pos + 1))) {
+        return false;
+    }
+
+    int last = ::atoi(name.substr(pos + 1).c_str());
+    name = name.substr(0, pos);
+
+    // Try to parse the msn of part.
+    pos = name.rfind(".");
+    if (pos != string::npos && srs_is_digit_number(name.substr(pos + 1))) {
+        msn = ::atoi(name.substr(pos + 1).c_str());
+        part = last;
+        name = name.substr(0, pos);
+    } else {
+        msn = last;
+        part = -1;
+    }
+
+    // The base name should never be empty or a directory.
+    if (name.empty() || srs_strings_ends_with(name, "/")) {
+        return false;
+    }
+
+    m3u8 = name + ".m3u8";
+    return true;
+}
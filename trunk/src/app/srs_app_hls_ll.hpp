@@ -0,0 +1,210 @@
+//
+// Copyright (c) 2013-2025 The SRS Authors
+//
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef SRS_APP_HLS_LL_HPP
+#define SRS_APP_HLS_LL_HPP
+
+#include <srs_core.hpp>
+
+#include <deque>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <srs_core_autofree.hpp>
+#include <srs_kernel_file.hpp>
+
+class ISrsCond;
+class ISrsHttpResponseWriter;
+class ISrsHttpMessage;
+class SrsMemoryBlock;
+class SrsSimpleStream;
+
+// The partial segment of LL-HLS, which is served from memory.
+class SrsHlsPart
+{
+public:
+    // The index of part in segment, starts from 0.
+    int index_;
+    srs_utime_t duration_;
+    // Whether the part starts with a keyframe, so it's able to decode independently.
+    bool independent_;
+    // The TS data of part.
+    SrsSharedPtr<SrsMemoryBlock> data_;
+
+public:
+    SrsHlsPart();
+    virtual ~SrsHlsPart();
+};
+
+// The media segment of LL-HLS, consists of parts, which is served from memory.
+class SrsHlsPartialSegment
+{
+public:
+    // The media sequence number.
+    int msn_;
+    srs_utime_t duration_;
+    // Whether insert the EXT-X-DISCONTINUITY before segment.
+    bool discontinuity_;
+    std::vector<SrsHlsPart *> parts_;
+    // Whether all parts are done, the segment is served by all parts.
+    bool completed_;
+
+public:
+    SrsHlsPartialSegment(int msn);
+    virtual ~SrsHlsPartialSegment();
+
+public:
+    // Get the part by index, NULL if not found.
+    SrsHlsPart *at(int index);
+};
+
+// The LL-HLS stream, holds the recent segments and parts in memory, generates the playlist with
+// EXT-X-PART and EXT-X-PRELOAD-HINT, and wakes up the blocking playlist reloads when a new part is
+// ready. The muxer writes TS to it, and the HTTP server reads from it.
+class SrsHlsLowLatency
+{
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // The basename of playlist, to build the uri of parts and segments, for example, livestream
+    // for livestream.m3u8, then livestream.10.ts for segment 10 and livestream.10.2.ts for part 2.
+    std::string base_;
+    srs_utime_t part_target_;
+    srs_utime_t target_duration_;
+    // Whether stream is unpublished.
+    bool eof_;
+    // The coroutines which wait for the next part.
+    ISrsCond *cond_;
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // The completed segments in window.
+    std::deque<SrsHlsPartialSegment *> segments_;
+    // The current writing segment, NULL if not open.
+    SrsHlsPartialSegment *current_;
+    // The data of current writing part.
+    SrsSimpleStream *part_;
+    // The dts in ms of the first frame of current part, and the previous frame, -1 if no frame.
+    int64_t part_start_;
+    int64_t previous_dts_;
+    bool part_independent_;
+    // The cached playlist, regenerated when changed.
+    std::string playlist_;
+
+public:
+    SrsHlsLowLatency(std::string base, srs_utime_t part_target);
+    virtual ~SrsHlsLowLatency();
+
+    // For the HLS muxer.
+public:
+    // Set the EXT-X-TARGETDURATION, which should never change.
+    virtual void set_target_duration(srs_utime_t v);
+    virtual void on_segment_open(int msn);
+    virtual void on_discontinuity();
+    // Before writing a frame, which might finish the current part.
+    virtual void on_frame(int64_t dts, bool independent);
+    // Write the TS data of current part.
+    virtual srs_error_t write(void *buf, size_t size);
+    // Finish the last part and the segment.
+    virtual void on_segment_close(srs_utime_t duration);
+    // Remove the segments before msn, which are expired.
+    virtual void shrink(int msn);
+    virtual void on_unpublish();
+
+    // For the HTTP server.
+public:
+    virtual bool eof();
+    virtual srs_utime_t target_duration();
+    // The msn of last segment in playlist, including the writing segment, -1 if empty.
+    virtual int last_msn();
+    // Whether the playlist contains segment msn, or the part of segment if part is not negative.
+    virtual bool has(int msn, int part);
+    // Wait until the playlist contains the segment or part, or timeout, or unpublished.
+    virtual void wait(int msn, int part, srs_utime_t timeout);
+    // Get the data of completed segment, which is all parts, or the part if part is not negative.
+    // @return Whether found the segment or part.
+    virtual bool fetch(int msn, int part, std::vector<SrsSharedPtr<SrsMemoryBlock> > &blocks);
+    // Get the playlist, empty if no segment or part.
+    virtual std::string playlist();
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // Finish the current part, with the duration of part.
+    void finish_part(srs_utime_t duration);
+    SrsHlsPartialSegment *find(int msn);
+    void dump_parts(SrsHlsPartialSegment *segment, std::stringstream &ss);
+    // The content changed, refresh the playlist and wakeup the waiting coroutines.
+    void notify();
+};
+
+// The file writer for LL-HLS, which writes TS to the LL-HLS stream in memory, and optionally to
+// disk by the underlayer writer for persistence.
+class SrsHlsLowLatencyWriter : public ISrsFileWriter
+{
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    SrsSharedPtr<SrsHlsLowLatency> stream_;
+    // The underlayer writer to disk, NULL if not persistence.
+    ISrsFileWriter *writer_;
+    bool opened_;
+    int64_t position_;
+
+public:
+    SrsHlsLowLatencyWriter(SrsSharedPtr<SrsHlsLowLatency> stream, ISrsFileWriter *writer);
+    virtual ~SrsHlsLowLatencyWriter();
+
+public:
+    virtual srs_error_t set_iobuf_size(int size);
+    virtual srs_error_t open(std::string p);
+    virtual void close();
+
+public:
+    virtual bool is_open();
+    virtual void seek2(int64_t offset);
+    virtual int64_t tellg();
+    // Interface ISrsWriteSeeker
+public:
+    virtual srs_error_t write(void *buf, size_t count, ssize_t *pnwrite);
+    virtual srs_error_t writev(const iovec *iov, int iovcnt, ssize_t *pnwrite);
+    virtual srs_error_t lseek(off_t offset, int whence, off_t *seeked);
+};
+
+// The LL-HLS streams of server, which serves the playlist, parts and segments from memory.
+class SrsHlsLowLatencyManager
+{
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // The streams, key is the playlist path, for example, /live/livestream.m3u8
+    std::map<std::string, SrsSharedPtr<SrsHlsLowLatency> > streams_;
+
+public:
+    SrsHlsLowLatencyManager();
+    virtual ~SrsHlsLowLatencyManager();
+
+public:
+    // Create the LL-HLS stream for playlist path, when publishing.
+    virtual SrsSharedPtr<SrsHlsLowLatency> publish(std::string m3u8, srs_utime_t part_target);
+    virtual void unpublish(std::string m3u8);
+    // Serve the HTTP request for the playlist, parts and segments, ignore if not LL-HLS stream.
+    virtual srs_error_t serve_http(ISrsHttpResponseWriter *w, ISrsHttpMessage *r, bool *served);
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    virtual srs_error_t serve_playlist(SrsSharedPtr<SrsHlsLowLatency> stream, ISrsHttpResponseWriter *w, ISrsHttpMessage *r);
+    virtual srs_error_t serve_media(SrsSharedPtr<SrsHlsLowLatency> stream, int msn, int part, ISrsHttpResponseWriter *w, ISrsHttpMessage *r);
+    SrsSharedPtr<SrsHlsLowLatency> find(std::string m3u8);
+};
+
+// Parse the uri of LL-HLS part or segment, for example, /live/livestream.10.2.ts is the part 2 of
+// segment 10 of /live/livestream.m3u8, and /live/livestream.10.ts is the segment 10.
+// @return Whether the uri is a part or segment, the part is -1 for segment.
+extern bool srs_hls_ll_parse_uri(std::string uri, std::string &m3u8, int &msn, int &part);
+
+// The global LL-HLS streams.
+extern SrsHlsLowLatencyManager *_srs_hls_ll;
+
+#endif
@@ -6,6 +6,8 @@
 
 #include <srs_app_http_hooks.hpp>
 
+#include <errno.h>
+#include <set>
 #include <sstream>
 using namespace std;
 
@@ -34,6 +36,16 @@ using namespace std;
 // the timeout for hls notify, in srs_utime_t.
 #define SRS_HLS_NOTIFY_TIMEOUT (10 * SRS_UTIME_SECONDS)
 
+// The max retries and interval for the notification hooks delivered in background.
+#define SRS_HOOKS_NOTIFY_RETRIES 3
+#define SRS_HOOKS_NOTIFY_RETRY_INTERVAL (3 * SRS_UTIME_SECONDS)
+// The max time to flush the notifications of stream, before the validation hook.
+#define SRS_HOOKS_FLUSH_TIMEOUT (30 * SRS_UTIME_SECONDS)
+// The max time to wait for a free slot, when exceed the concurrency.
+#define SRS_HOOKS_SLOT_TIMEOUT (30 * SRS_UTIME_SECONDS)
+// The max size of on_play cache, the expired or the oldest ones are removed when full.
+#define SRS_HOOKS_PLAY_CACHE_SIZE 1024
+
 // Global HTTP hooks instance
 ISrsHttpHooks *_srs_hooks = NULL;
 
@@ -45,15 +57,64 @@ ISrsHttpHooks::~ISrsHttpHooks()
 {
 }
 
+SrsHttpHookUpstream::SrsHttpHookUpstream()
+{
+    inflight_ = 0;
+    slot_ = srs_cond_new();
+}
+
+SrsHttpHookUpstream::~SrsHttpHookUpstream()
+{
+    for (int i = 0; i < (int)idle_.size(); i++) {
+        ISrsHttpClient *hc = idle_.at(i);
+        srs_freep(hc);
+    }
+    idle_.clear();
+
+    srs_cond_destroy(slot_);
+}
+
+SrsHttpHookNotification::SrsHttpHookNotification()
+{
+    retries_ = 0;
+    deliver_at_ = 0;
+}
+
+SrsHttpHookNotification::~SrsHttpHookNotification()
+{
+}
+
 SrsHttpHooks::SrsHttpHooks()
 {
     factory_ = _srs_app_factory;
     stat_ = _srs_stat;
     config_ = _srs_config;
+
+    trd_ = NULL;
+    notify_ = srs_cond_new();
+    flushed_ = srs_cond_new();
 }
 
 SrsHttpHooks::~SrsHttpHooks()
 {
+    srs_freep(trd_);
+    srs_cond_destroy(notify_);
+    srs_cond_destroy(flushed_);
+
+    std::list<SrsHttpHookNotification *>::iterator it;
+    for (it = notifications_.begin(); it != notifications_.end(); ++it) {
+        SrsHttpHookNotification *n = *it;
+        srs_freep(n);
+    }
+    notifications_.clear();
+
+    std::map<std::string, SrsHttpHookUpstream *>::iterator itu;
+    for (itu = upstreams_.begin(); itu != upstreams_.end(); ++itu) {
+        SrsHttpHookUpstream *upstream = itu->second;
+        srs_freep(upstream);
+    }
+    upstreams_.clear();
+
     factory_ = NULL;
     stat_ = NULL;
     config_ = NULL;
@@ -83,8 +144,7 @@ srs_error_t SrsHttpHooks::on_connect(string url, ISrsRequest *req)
     std::string res;
     int status_code;
 
-    SrsUniquePtr<ISrsHttpClient> http(factory_->create_http_client());
-    if ((err = do_post(http.get(), url, data, status_code, res)) != srs_success) {
+    if ((err = post(url, data, status_code, res)) != srs_success) {
         return srs_error_wrap(err, "http: on_connect failed, client_id=%s, url=%s, request=%s, response=%s, code=%d",
                               cid.c_str(), url.c_str(), data.c_str(), res.c_str(), status_code);
     }
@@ -117,8 +177,12 @@ void SrsHttpHooks::on_close(string url, ISrsRequest *req, int64_t send_bytes, in
     std::string res;
     int status_code;
 
-    SrsUniquePtr<ISrsHttpClient> http(factory_->create_http_client());
-    if ((err = do_post(http.get(), url, data, status_code, res)) != srs_success) {
+    // Deliver in background, never wait for the hook server.
+    if (async_notify(cid, "on_close", req->get_stream_url(), url, data)) {
+        return;
+    }
+
+    if ((err = post(url, data, status_code, res)) != srs_success) {
         int ret = srs_error_code(err);
         srs_freep(err);
         srs_warn("http: ignore on_close failed, client_id=%s, url=%s, request=%s, response=%s, code=%d, ret=%d",
@@ -161,8 +225,10 @@ srs_error_t SrsHttpHooks::on_publish(string url, ISrsRequest *req)
     std::string res;
     int status_code;
 
-    SrsUniquePtr<ISrsHttpClient> http(factory_->create_http_client());
-    if ((err = do_post(http.get(), url, data, status_code, res)) != srs_success) {
+    // Deliver the queued notifications of stream first, such as the on_unpublish of last publish.
+    flush(req->get_stream_url());
+
+    if ((err = post(url, data, status_code, res)) != srs_success) {
         return srs_error_wrap(err, "http: on_publish failed, client_id=%s, url=%s, request=%s, response=%s, code=%d",
                               cid.c_str(), url.c_str(), data.c_str(), res.c_str(), status_code);
     }
@@ -202,8 +268,12 @@ void SrsHttpHooks::on_unpublish(string url, ISrsRequest *req)
     std::string res;
     int status_code;
 
-    SrsUniquePtr<ISrsHttpClient> http(factory_->create_http_client());
-    if ((err = do_post(http.get(), url, data, status_code, res)) != srs_success) {
+    // Deliver in background, never wait for the hook server.
+    if (async_notify(cid, "on_unpublish", req->get_stream_url(), url, data)) {
+        return;
+    }
+
+    if ((err = post(url, data, status_code, res)) != srs_success) {
         int ret = srs_error_code(err);
         srs_freep(err);
         srs_warn("http: ignore on_unpublish failed, client_id=%s, url=%s, request=%s, response=%s, status=%d, ret=%d",
@@ -248,8 +318,21 @@ srs_error_t SrsHttpHooks::on_play(string url, ISrsRequest *req)
     std::string res;
     int status_code;
 
-    SrsUniquePtr<ISrsHttpClient> http(factory_->create_http_client());
-    if ((err = do_post(http.get(), url, data, status_code, res)) != srs_success) {
+    // The play is allowed if cached, for the same stream and token.
+    srs_utime_t ttl = config_->get_hooks_play_cache_ttl();
+    string cache_key = url + " " + req->get_stream_url() + req->param_;
+    if (ttl > 0) {
+        std::map<std::string, srs_utime_t>::iterator it = play_cache_.find(cache_key);
+        if (it != play_cache_.end() && it->second > srs_time_now_cached()) {
+            srs_trace("http: on_play cached, client_id=%s, url=%s, stream=%s", cid.c_str(), url.c_str(), req->get_stream_url().c_str());
+            return err;
+        }
+    }
+
+    // Deliver the queued notifications of stream first, such as the on_stop of last play.
+    flush(req->get_stream_url());
+
+    if ((err = post(url, data, status_code, res)) != srs_success) {
         return srs_error_wrap(err, "http: on_play failed, client_id=%s, url=%s, request=%s, response=%s, status=%d",
                               cid.c_str(), url.c_str(), data.c_str(), res.c_str(), status_code);
     }
@@ -257,6 +340,10 @@ srs_error_t SrsHttpHooks::on_play(string url, ISrsRequest *req)
     srs_trace("http: on_play ok, client_id=%s, url=%s, request=%s, response=%s",
               cid.c_str(), url.c_str(), data.c_str(), res.c_str());
 
+    if (ttl > 0) {
+        cache_play(cache_key, ttl);
+    }
+
     return err;
 }
 
@@ -290,8 +377,12 @@ void SrsHttpHooks::on_stop(string url, ISrsRequest *req)
     std::string res;
     int status_code;
 
-    SrsUniquePtr<ISrsHttpClient> http(factory_->create_http_client());
-    if ((err = do_post(http.get(), url, data, status_code, res)) != srs_success) {
+    // Deliver in background, never wait for the hook server.
+    if (async_notify(cid, "on_stop", req->get_stream_url(), url, data)) {
+        return;
+    }
+
+    if ((err = post(url, data, status_code, res)) != srs_success) {
         int ret = srs_error_code(err);
         srs_freep(err);
         srs_warn("http: ignore on_stop failed, client_id=%s, url=%s, request=%s, response=%s, code=%d, ret=%d",
@@ -338,8 +429,12 @@ srs_error_t SrsHttpHooks::on_dvr(SrsContextId c, string url, ISrsRequest *req, s
     std::string res;
     int status_code;
 
-    SrsUniquePtr<ISrsHttpClient> http(factory_->create_http_client());
-    if ((err = do_post(http.get(), url, data, status_code, res)) != srs_success) {
+    // Deliver in background, never wait for the hook server.
+    if (async_notify(cid, "on_dvr", req->get_stream_url(), url, data)) {
+        return err;
+    }
+
+    if ((err = post(url, data, status_code, res)) != srs_success) {
         return srs_error_wrap(err, "http post on_dvr uri failed, client_id=%s, url=%s, request=%s, response=%s, code=%d",
                               cid.c_str(), url.c_str(), data.c_str(), res.c_str(), status_code);
     }
@@ -395,8 +490,12 @@ srs_error_t SrsHttpHooks::on_hls(SrsContextId c, string url, ISrsRequest *req, s
     std::string res;
     int status_code;
 
-    SrsUniquePtr<ISrsHttpClient> http(factory_->create_http_client());
-    if ((err = do_post(http.get(), url, data, status_code, res)) != srs_success) {
+    // Deliver in background, never wait for the hook server.
+    if (async_notify(cid, "on_hls", req->get_stream_url(), url, data)) {
+        return err;
+    }
+
+    if ((err = post(url, data, status_code, res)) != srs_success) {
         return srs_error_wrap(err, "http: post %s with %s, status=%d, res=%s", url.c_str(), data.c_str(), status_code, res.c_str());
     }
 
@@ -483,8 +582,7 @@ srs_error_t SrsHttpHooks::discover_co_workers(string url, string &host, int &por
     std::string res;
     int status_code;
 
-    SrsUniquePtr<ISrsHttpClient> http(factory_->create_http_client());
-    if ((err = do_post(http.get(), url, "", status_code, res)) != srs_success) {
+    if ((err = post(url, "", status_code, res)) != srs_success) {
         return srs_error_wrap(err, "http: post %s, status=%d, res=%s", url.c_str(), status_code, res.c_str());
     }
 
@@ -554,8 +652,7 @@ srs_error_t SrsHttpHooks::on_forward_backend(string url, ISrsRequest *req, std::
     std::string res;
     int status_code;
 
-    SrsUniquePtr<ISrsHttpClient> http(factory_->create_http_client());
-    if ((err = do_post(http.get(), url, data, status_code, res)) != srs_success) {
+    if ((err = post(url, data, status_code, res)) != srs_success) {
         return srs_error_wrap(err, "http: on_forward_backend failed, client_id=%s, url=%s, request=%s, response=%s, code=%d",
                               cid.c_str(), url.c_str(), data.c_str(), res.c_str(), status_code);
     }
@@ -598,16 +695,271 @@ srs_error_t SrsHttpHooks::on_forward_backend(string url, ISrsRequest *req, std::
     return err;
 }
 
-srs_error_t SrsHttpHooks::do_post(ISrsHttpClient *hc, std::string url, std::string req, int &code, string &res)
+srs_error_t SrsHttpHooks::cycle()
 {
     srs_error_t err = srs_success;
 
+    while (true) {
+        if ((err = trd_->pull()) != srs_success) {
+            return srs_error_wrap(err, "hooks");
+        }
+
+        if (notifications_.empty()) {
+            srs_cond_wait(notify_);
+            continue;
+        }
+
+        // Pick the first notification to deliver. The failed one waits for a while to retry, and
+        // blocks the later ones of the same stream, so they're delivered in order.
+        srs_utime_t now = srs_time_now_cached();
+        srs_utime_t wait = SRS_HOOKS_NOTIFY_RETRY_INTERVAL;
+        std::set<std::string> blocked;
+        SrsHttpHookNotification *n = NULL;
+        std::list<SrsHttpHookNotification *>::iterator it;
+        for (it = notifications_.begin(); it != notifications_.end(); ++it) {
+            SrsHttpHookNotification *v = *it;
+            if (blocked.find(v->stream_) != blocked.end()) {
+                continue;
+            }
+            if (v->deliver_at_ <= now) {
+                n = v;
+                break;
+            }
+            blocked.insert(v->stream_);
+            wait = srs_min(wait, v->deliver_at_ - now);
+        }
+
+        if (!n) {
+            srs_cond_timedwait(notify_, wait);
+            continue;
+        }
+
+        deliver(n);
+    }
+
+    return err;
+}
+
+srs_error_t SrsHttpHooks::post(string url, string req, int &code, string &res)
+{
+    srs_error_t err = srs_success;
+
+    int keepalive = config_->get_hooks_keepalive();
+    int concurrency = config_->get_hooks_concurrency();
+
+    // Use a new client for each hook, if no keep-alive and no limit.
+    if (keepalive <= 0 && concurrency <= 0) {
+        SrsUniquePtr<ISrsHttpClient> http(factory_->create_http_client());
+        return do_post(http.get(), url, req, code, res);
+    }
+
+    SrsHttpUri uri;
+    if ((err = uri.initialize(url)) != srs_success) {
+        return srs_error_wrap(err, "http: post failed. url=%s", url.c_str());
+    }
+
+    string key = uri.get_schema() + "://" + uri.get_host() + ":" + srs_strconv_format_int(uri.get_port());
+    SrsHttpHookUpstream *upstream = NULL;
+    std::map<std::string, SrsHttpHookUpstream *>::iterator it = upstreams_.find(key);
+    if (it != upstreams_.end()) {
+        upstream = it->second;
+    } else {
+        upstreams_[key] = upstream = new SrsHttpHookUpstream();
+    }
+
+    // Wait for a free slot, to protect the hook server. Quit if the coroutine is interrupted, for
+    // example, the connection is closed, or wait for too long.
+    srs_utime_t starttime = srs_time_now_realtime();
+    while (concurrency > 0 && upstream->inflight_ >= concurrency) {
+        if (srs_cond_timedwait(upstream->slot_, SRS_HOOKS_SLOT_TIMEOUT) != 0 && errno == EINTR) {
+            return srs_error_new(ERROR_THREAD_INTERRUPED, "http: wait slot interrupted, url=%s", url.c_str());
+        }
+        if (upstream->inflight_ >= concurrency && srs_time_now_realtime() - starttime >= SRS_HOOKS_SLOT_TIMEOUT) {
+            return srs_error_new(ERROR_SOCKET_TIMEOUT, "http: wait slot timeout, url=%s, inflight=%d", url.c_str(), upstream->inflight_);
+        }
+    }
+    upstream->inflight_++;
+
+    // Reuse the keep-alive client, which might be closed by server, so retry by a new client if
+    // failed without response.
+    ISrsHttpClient *hc = NULL;
+    if (!upstream->idle_.empty()) {
+        hc = upstream->idle_.back();
+        upstream->idle_.pop_back();
+
+        if ((err = do_post(hc, url, req, code, res, true)) != srs_success && code == 0) {
+            srs_freep(err);
+            srs_freep(hc);
+        }
+    }
+
+    if (!hc) {
+        hc = factory_->create_http_client();
+        err = do_post(hc, url, req, code, res);
+    }
+
+    // Keep the client alive for next hook, if succeed.
+    if (err == srs_success && keepalive > 0 && (int)upstream->idle_.size() < keepalive) {
+        upstream->idle_.push_back(hc);
+    } else {
+        srs_freep(hc);
+    }
+
+    upstream->inflight_--;
+    srs_cond_signal(upstream->slot_);
+
+    return err;
+}
+
+bool SrsHttpHooks::async_notify(SrsContextId cid, string action, string stream, string url, string data)
+{
+    if (!config_->get_hooks_async_notify()) {
+        return false;
+    }
+
+    // Drop the notification if queue is full, to protect the memory when hook server is down.
+    int max_queue = config_->get_hooks_retry_queue();
+    if ((int)notifications_.size() >= max_queue) {
+        srs_warn("http: drop %s for queue full, client_id=%s, url=%s, queue=%d, request=%s",
+                 action.c_str(), cid.c_str(), url.c_str(), (int)notifications_.size(), data.c_str());
+        return true;
+    }
+
+    SrsHttpHookNotification *n = new SrsHttpHookNotification();
+    n->cid_ = cid;
+    n->action_ = action;
+    n->stream_ = stream;
+    n->url_ = url;
+    n->data_ = data;
+    notifications_.push_back(n);
+
+    // Start the coroutine when used.
+    if (!trd_) {
+        trd_ = factory_->create_coroutine("hooks", this, _srs_context->generate_id());
+
+        srs_error_t err = srs_success;
+        if ((err = trd_->start()) != srs_success) {
+            srs_warn("http: start hooks coroutine, %s", srs_error_desc(err).c_str());
+            srs_freep(err);
+        }
+    }
+
+    srs_cond_signal(notify_);
+    return true;
+}
+
+void SrsHttpHooks::flush(string stream)
+{
+    srs_utime_t starttime = srs_time_now_realtime();
+
+    while (true) {
+        // The queued ones are delivered now, never wait for the retry interval.
+        bool pending = false;
+        std::list<SrsHttpHookNotification *>::iterator it;
+        for (it = notifications_.begin(); it != notifications_.end(); ++it) {
+            SrsHttpHookNotification *n = *it;
+            if (n->stream_ == stream) {
+                n->deliver_at_ = 0;
+                pending = true;
+            }
+        }
+
+        if (!pending) {
+            return;
+        }
+
+        if (srs_time_now_realtime() - starttime >= SRS_HOOKS_FLUSH_TIMEOUT) {
+            srs_warn("http: flush notifications timeout, stream=%s, queue=%d", stream.c_str(), (int)notifications_.size());
+            return;
+        }
+
+        srs_cond_signal(notify_);
+        if (srs_cond_timedwait(flushed_, SRS_HOOKS_NOTIFY_RETRY_INTERVAL) != 0 && errno == EINTR) {
+            return;
+        }
+    }
+}
+
+void SrsHttpHooks::deliver(SrsHttpHookNotification *n)
+{
+    srs_error_t err = srs_success;
+
+    std::string res;
+    int status_code = 0;
+    if ((err = post(n->url_, n->data_, status_code, res)) == srs_success) {
+        srs_trace("http: %s ok, client_id=%s, url=%s, request=%s, response=%s, retries=%d",
+                  n->action_.c_str(), n->cid_.c_str(), n->url_.c_str(), n->data_.c_str(), res.c_str(), n->retries_);
+        notifications_.remove(n);
+        srs_freep(n);
+        srs_cond_broadcast(flushed_);
+        return;
+    }
+
+    int ret = srs_error_code(err);
+    srs_freep(err);
+
+    // Retry later in place, if not exceed the max retries, so the later ones of stream wait for it.
+    if (n->retries_ < SRS_HOOKS_NOTIFY_RETRIES) {
+        srs_warn("http: retry %s failed, client_id=%s, url=%s, request=%s, response=%s, status=%d, ret=%d, retries=%d",
+                 n->action_.c_str(), n->cid_.c_str(), n->url_.c_str(), n->data_.c_str(), res.c_str(), status_code, ret, n->retries_);
+
+        n->retries_++;
+        n->deliver_at_ = srs_time_now_cached() + SRS_HOOKS_NOTIFY_RETRY_INTERVAL;
+        return;
+    }
+
+    srs_warn("http: ignore %s failed, client_id=%s, url=%s, request=%s, response=%s, status=%d, ret=%d, retries=%d",
+             n->action_.c_str(), n->cid_.c_str(), n->url_.c_str(), n->data_.c_str(), res.c_str(), status_code, ret, n->retries_);
+    notifications_.remove(n);
+    srs_freep(n);
+    srs_cond_broadcast(flushed_);
+}
+
+void SrsHttpHooks::cache_play(string key, srs_utime_t ttl)
+{
+    srs_utime_t now = srs_time_now_cached();
+
+    // Remove the expired ones, when cache is large.
+    if (play_cache_.size() >= SRS_HOOKS_PLAY_CACHE_SIZE) {
+        std::map<std::string, srs_utime_t>::iterator it;
+        for (it = play_cache_.begin(); it != play_cache_.end();) {
+            if (it->second <= now) {
+                play_cache_.erase(it++);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    // Remove the oldest one which expires first, if still full.
+    if (play_cache_.size() >= SRS_HOOKS_PLAY_CACHE_SIZE && play_cache_.find(key) == play_cache_.end()) {
+        std::map<std::string, srs_utime_t>::iterator oldest = play_cache_.begin();
+        std::map<std::string, srs_utime_t>::iterator it;
+        for (it = play_cache_.begin(); it != play_cache_.end(); ++it) {
+            if (it->second < oldest->second) {
+                oldest = it;
+            }
+        }
+        play_cache_.erase(oldest);
+    }
+
+    play_cache_[key] = now + ttl;
+}
+
+srs_error_t SrsHttpHooks::do_post(ISrsHttpClient *hc, std::string url, std::string req, int &code, string &res, bool reuse)
+{
+    srs_error_t err = srs_success;
+
+    // The status is set only when got response.
+    code = 0;
+
     SrsHttpUri uri;
     if ((err = uri.initialize(url)) != srs_success) {
         return srs_error_wrap(err, "http: post failed. url=%s", url.c_str());
     }
 
-    if ((err = hc->initialize(uri.get_schema(), uri.get_host(), uri.get_port())) != srs_success) {
+    // The reused client is connected, never initialize it, which disconnects the transport.
+    if (!reuse && (err = hc->initialize(uri.get_schema(), uri.get_host(), uri.get_port())) != srs_success) {
         return srs_error_wrap(err, "http: init client");
     }
 
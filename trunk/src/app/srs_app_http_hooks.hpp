@@ -9,9 +9,13 @@
 
 #include <srs_core.hpp>
 
+#include <list>
+#include <map>
 #include <string>
 #include <vector>
 
+#include <srs_app_st.hpp>
+
 class SrsHttpUri;
 class SrsStSocket;
 class ISrsRequest;
@@ -151,7 +155,44 @@ public:
     virtual void on_close(std::string url, ISrsRequest *req, int64_t send_bytes, int64_t recv_bytes) = 0;
 };
 
-class SrsHttpHooks : public ISrsHttpHooks
+// The upstream server of hooks, with the keep-alive clients to reuse.
+class SrsHttpHookUpstream
+{
+public:
+    // The idle clients which are connected, for next hook.
+    std::vector<ISrsHttpClient *> idle_;
+    // The number of hooks in flight, and the coroutines wait for a free slot.
+    int inflight_;
+    srs_cond_t slot_;
+
+public:
+    SrsHttpHookUpstream();
+    virtual ~SrsHttpHookUpstream();
+};
+
+// The notification hook to deliver in background, which is retried if failed.
+class SrsHttpHookNotification
+{
+public:
+    SrsContextId cid_;
+    std::string action_;
+    // The stream url, the notifications of a stream are delivered in order.
+    std::string stream_;
+    std::string url_;
+    std::string data_;
+    // The number of retries, and the time to deliver it.
+    int retries_;
+    srs_utime_t deliver_at_;
+
+public:
+    SrsHttpHookNotification();
+    virtual ~SrsHttpHookNotification();
+};
+
+// The HTTP hooks, which posts to the hook server by keep-alive clients for each upstream, and limits
+// the number of hooks in flight. The notification hooks, such as on_stop and on_hls, are delivered
+// by a coroutine in background if async, so the connection never waits for the hook server.
+class SrsHttpHooks : public ISrsHttpHooks, public ISrsCoroutineHandler
 {
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
@@ -159,6 +200,20 @@ SRS_DECLARE_PRIVATE: // clang-format on
     ISrsStatistic *stat_;
     ISrsAppConfig *config_;
 
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // The upstreams by schema, host and port.
+    std::map<std::string, SrsHttpHookUpstream *> upstreams_;
+    // The expire time of allowed on_play, by url, stream and param which includes the token.
+    std::map<std::string, srs_utime_t> play_cache_;
+    // The notifications to deliver in background, and the coroutine to deliver them. The notification
+    // is kept in queue until done, so the failed one is retried before the later ones of stream.
+    std::list<SrsHttpHookNotification *> notifications_;
+    ISrsCoroutine *trd_;
+    srs_cond_t notify_;
+    // Signaled when a notification is done, for the coroutines to flush the stream.
+    srs_cond_t flushed_;
+
 public:
     SrsHttpHooks();
     virtual ~SrsHttpHooks();
@@ -176,10 +231,25 @@ public:
     srs_error_t on_hls_notify(SrsContextId cid, std::string url, ISrsRequest *req, std::string ts_url, int nb_notify);
     srs_error_t discover_co_workers(std::string url, std::string &host, int &port);
     srs_error_t on_forward_backend(std::string url, ISrsRequest *req, std::vector<std::string> &rtmp_urls);
+    // Interface ISrsCoroutineHandler
+public:
+    virtual srs_error_t cycle();
 
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
-    srs_error_t do_post(ISrsHttpClient *hc, std::string url, std::string req, int &code, std::string &res);
+    // Post to url by the keep-alive client of upstream, wait for a slot if exceed the concurrency.
+    srs_error_t post(std::string url, std::string req, int &code, std::string &res);
+    // Queue the notification to deliver in background, return false if not async.
+    bool async_notify(SrsContextId cid, std::string action, std::string stream, std::string url, std::string data);
+    // Wait for the queued notifications of stream, before the validation hook of the same stream,
+    // for example, the on_unpublish is delivered before the on_publish of the republish.
+    void flush(std::string stream);
+    // Deliver the notification in queue, which is removed when done, or retried later if failed.
+    void deliver(SrsHttpHookNotification *n);
+    // Cache the allowed on_play, and remove the expired or the oldest ones when cache is full.
+    void cache_play(std::string key, srs_utime_t ttl);
+    // Post by client, which is initialized unless it's reused.
+    srs_error_t do_post(ISrsHttpClient *hc, std::string url, std::string req, int &code, std::string &res, bool reuse = false);
 };
 
 // Global HTTP hooks instance
@@ -15,13 +15,17 @@
 using namespace std;
 
 #include <srs_app_config.hpp>
+#include <srs_app_hls_ll.hpp>
 #include <srs_app_http_hooks.hpp>
+#include <srs_app_mp4_index.hpp>
 #include <srs_app_rtmp_source.hpp>
+#include <srs_app_segment_cache.hpp>
 #include <srs_app_server.hpp>
 #include <srs_app_st.hpp>
 #include <srs_app_statistic.hpp>
 #include <srs_core_autofree.hpp>
 #include <srs_kernel_aac.hpp>
+#include <srs_kernel_buffer.hpp>
 #include <srs_kernel_error.hpp>
 #include <srs_kernel_file.hpp>
 #include <srs_kernel_flv.hpp>
@@ -433,10 +437,70 @@ bool SrsHlsStream::is_interrupt(std::string id)
 
 SrsVodStream::SrsVodStream(string root_dir) : SrsHttpFileServer(root_dir)
 {
+    hls_ll_ = _srs_hls_ll;
+    segment_cache_ = _srs_segment_cache;
+    mp4_index_ = _srs_mp4_index_cache;
 }
 
 SrsVodStream::~SrsVodStream()
 {
+    hls_ll_ = NULL;
+    segment_cache_ = NULL;
+    mp4_index_ = NULL;
+}
+
+srs_error_t SrsVodStream::serve_http(ISrsHttpResponseWriter *w, ISrsHttpMessage *r)
+{
+    srs_error_t err = srs_success;
+
+    // The LL-HLS playlist and parts are in memory, which might not exist on disk.
+    bool served = false;
+    if (hls_ll_ && (err = hls_ll_->serve_http(w, r, &served)) != srs_success) {
+        return srs_error_wrap(err, "serve ll-hls");
+    }
+
+    if (served) {
+        return err;
+    }
+
+    return SrsHttpFileServer::serve_http(w, r);
+}
+
+srs_error_t SrsVodStream::serve_file(ISrsHttpResponseWriter *w, ISrsHttpMessage *r, string fullpath)
+{
+    srs_error_t err = srs_success;
+
+    // Only the segments and playlists of live streams are cached.
+    bool cacheable = srs_strings_ends_with(fullpath, ".ts", ".m4s", ".m3u8", ".mpd") || srs_strings_ends_with(fullpath, ".mp4");
+
+    SrsSharedPtr<SrsMemoryBlock> data(NULL);
+    string etag;
+    if (!cacheable || !segment_cache_->fetch(fullpath, data, etag)) {
+        return SrsHttpFileServer::serve_file(w, r, fullpath);
+    }
+
+    w->header()->set("ETag", etag);
+    w->header()->set_content_type(srs_http_fs_content_type(fullpath));
+
+    // The content is not changed, for example, the player reloads the m3u8.
+    if (r->header()->get("If-None-Match") == etag) {
+        w->header()->set_content_length(0);
+        w->write_header(SRS_CONSTS_HTTP_NotModified);
+        return w->final_request();
+    }
+
+    w->header()->set_content_length(data->size());
+    w->write_header(SRS_CONSTS_HTTP_OK);
+
+    if ((err = w->write(data->payload(), data->size())) != srs_success) {
+        return srs_error_wrap(err, "write cached file=%s size=%d", fullpath.c_str(), data->size());
+    }
+
+    if ((err = w->final_request()) != srs_success) {
+        return srs_error_wrap(err, "final request");
+    }
+
+    return err;
 }
 
 srs_error_t SrsVodStream::serve_flv_stream(ISrsHttpResponseWriter *w, ISrsHttpMessage *r, string fullpath, int64_t offset)
@@ -566,6 +630,51 @@ srs_error_t SrsVodStream::serve_mp4_stream(ISrsHttpResponseWriter *w, ISrsHttpMe
     return err;
 }
 
+srs_error_t SrsVodStream::serve_mp4_seek(ISrsHttpResponseWriter *w, ISrsHttpMessage *r, string fullpath, srs_utime_t start)
+{
+    srs_error_t err = srs_success;
+
+    // Resolve the time to samples by the index, which is built once for each file, then generate
+    // the moov for the samples to play, because the mdat without moov is not playable.
+    SrsMp4SampleIndex *index = NULL;
+    string header;
+    int64_t begin = 0, end = 0;
+    if (!mp4_index_ || (err = mp4_index_->fetch(fullpath, &index)) != srs_success || (err = index->rewrite(start, header, &begin, &end)) != srs_success) {
+        srs_warn("mp4 seek %s to %dms ignored, err %s", fullpath.c_str(), srsu2msi(start), srs_error_desc(err).c_str());
+        srs_freep(err);
+        return serve_file(w, r, fullpath);
+    }
+
+    SrsUniquePtr<SrsFileReader> fs(fs_factory->create_file_reader());
+    if ((err = fs->open(fullpath)) != srs_success) {
+        return srs_error_wrap(err, "open file");
+    }
+
+    // The file is changed after the index is fetched.
+    if (end > fs->filesize()) {
+        return srs_error_new(ERROR_HTTP_REMUX_OFFSET_OVERFLOW, "http mp4 seek %s overflow. size=%" PRId64 ", end=%" PRId64,
+                             fullpath.c_str(), fs->filesize(), end);
+    }
+
+    int64_t left = end - begin;
+    w->header()->set_content_length((int64_t)header.size() + left);
+    w->header()->set_content_type("video/mp4");
+    w->write_header(SRS_CONSTS_HTTP_OK);
+
+    // Write the ftyp, moov and the header of mdat.
+    if ((err = w->write((char *)header.data(), (int)header.size())) != srs_success) {
+        return srs_error_wrap(err, "write mp4 header");
+    }
+
+    // Write the samples in mdat, since the seek point.
+    fs->seek2(begin);
+    if ((err = copy(w, fs.get(), r, left)) != srs_success) {
+        return srs_error_wrap(err, "read mp4=%s size=%" PRId64, fullpath.c_str(), left);
+    }
+
+    return err;
+}
+
 srs_error_t SrsVodStream::serve_m3u8_ctx(ISrsHttpResponseWriter *w, ISrsHttpMessage *r, std::string fullpath)
 {
     srs_error_t err = srs_success;
@@ -14,6 +14,9 @@
 class ISrsFileReaderFactory;
 class ISrsCommonHttpHandler;
 class ISrsHttpServeMux;
+class SrsHlsLowLatencyManager;
+class ISrsSegmentCache;
+class ISrsMp4IndexCache;
 
 // HLS virtual connection, build on query string ctx of hls stream.
 class SrsHlsVirtualConn : public ISrsExpire
@@ -71,6 +74,12 @@ SRS_DECLARE_PRIVATE: // clang-format on
 // The Vod streaming, like FLV, MP4 or HLS streaming.
 class SrsVodStream : public SrsHttpFileServer
 {
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    SrsHlsLowLatencyManager *hls_ll_;
+    ISrsSegmentCache *segment_cache_;
+    ISrsMp4IndexCache *mp4_index_;
+
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
     SrsHlsStream hls_;
@@ -79,8 +88,14 @@ public:
     SrsVodStream(std::string root_dir);
     virtual ~SrsVodStream();
 
+public:
+    // Serve the LL-HLS from memory if the stream is LL-HLS, or serve the file.
+    virtual srs_error_t serve_http(ISrsHttpResponseWriter *w, ISrsHttpMessage *r);
+
 // clang-format off
 SRS_DECLARE_PROTECTED: // clang-format on
+    // Serve the HLS/DASH segments and playlists from segment cache if hit, with ETag.
+    virtual srs_error_t serve_file(ISrsHttpResponseWriter *w, ISrsHttpMessage *r, std::string fullpath);
     // The flv vod stream supports flv?start=offset-bytes.
     // For example, http://server/file.flv?start=10240
     // server will write flv header and sequence header,
@@ -88,6 +103,9 @@ SRS_DECLARE_PROTECTED: // clang-format on
     virtual srs_error_t serve_flv_stream(ISrsHttpResponseWriter *w, ISrsHttpMessage *r, std::string fullpath, int64_t offset);
     // Support mp4 with start and offset in query string.
     virtual srs_error_t serve_mp4_stream(ISrsHttpResponseWriter *w, ISrsHttpMessage *r, std::string fullpath, int64_t start, int64_t end);
+    // Support mp4 seek by time, serve the moov generated by the cached sample index and the samples
+    // since the keyframe before the time.
+    virtual srs_error_t serve_mp4_seek(ISrsHttpResponseWriter *w, ISrsHttpMessage *r, std::string fullpath, srs_utime_t start);
     // Support HLS streaming with pseudo session id.
     virtual srs_error_t serve_m3u8_ctx(ISrsHttpResponseWriter *w, ISrsHttpMessage *r, std::string fullpath);
     // the ts file including: .ts .m4s init.mp4
@@ -0,0 +1,492 @@
+//
+// Copyright (c) 2013-2025 The SRS Authors
+//
+// SPDX-License-Identifier: MIT
+//
+
+#include <srs_app_ingest_thread.hpp>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#ifdef __linux__
+#include <sys/eventfd.h>
+#endif
+
+using namespace std;
+
+#include <srs_app_config.hpp>
+#include <srs_kernel_error.hpp>
+#include <srs_kernel_log.hpp>
+#include <srs_kernel_utility.hpp>
+
+SrsIngestThreads *_srs_ingest_threads = NULL;
+
+// The task in rings, with the key to track pending tasks.
+struct SrsIngestEntry {
+    ISrsIngestTask *task_;
+    uint64_t key_;
+};
+
+// Open the notify fds, which is an eventfd for both read and write, or a pipe if not linux.
+int srs_ingest_notify_open(int fds[2])
+{
+#ifdef __linux__
+    int fd = ::eventfd(0, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    fds[0] = fds[1] = fd;
+#else
+    if (::pipe(fds) < 0) {
+        return -1;
+    }
+
+    // The writer should never block, the reader will be notified anyway when pipe is full.
+    int flags = fcntl(fds[1], F_GETFL, 0);
+    if (flags == -1 || fcntl(fds[1], F_SETFL, flags | O_NONBLOCK) == -1) {
+        return -1;
+    }
+#endif
+    return 0;
+}
+
+void srs_ingest_notify_write(int fds[2])
+{
+    uint64_t v = 1;
+    ssize_t nn = ::write(fds[1], &v, sizeof(v));
+    (void)nn;
+}
+
+void srs_ingest_notify_close(int fds[2])
+{
+    if (fds[1] >= 0 && fds[1] != fds[0]) {
+        ::close(fds[1]);
+    }
+    if (fds[0] >= 0) {
+        ::close(fds[0]);
+    }
+    fds[0] = fds[1] = -1;
+}
+
+SrsSpscRing::SrsSpscRing(int capacity)
+{
+    capacity_ = 1;
+    while ((int)capacity_ < capacity) {
+        capacity_ <<= 1;
+    }
+    mask_ = capacity_ - 1;
+
+    items_ = new void *[capacity_];
+    head_ = tail_ = 0;
+}
+
+SrsSpscRing::~SrsSpscRing()
+{
+    srs_freepa(items_);
+}
+
+bool SrsSpscRing::push(void *item)
+{
+    uint32_t tail = __atomic_load_n(&tail_, __ATOMIC_RELAXED);
+    uint32_t head = __atomic_load_n(&head_, __ATOMIC_ACQUIRE);
+    if (tail - head >= capacity_) {
+        return false;
+    }
+
+    items_[tail & mask_] = item;
+    __atomic_store_n(&tail_, tail + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+void *SrsSpscRing::pop()
+{
+    uint32_t head = __atomic_load_n(&head_, __ATOMIC_RELAXED);
+    uint32_t tail = __atomic_load_n(&tail_, __ATOMIC_ACQUIRE);
+    if (head == tail) {
+        return NULL;
+    }
+
+    void *item = items_[head & mask_];
+    __atomic_store_n(&head_, head + 1, __ATOMIC_RELEASE);
+    return item;
+}
+
+bool SrsSpscRing::empty()
+{
+    return size() == 0;
+}
+
+int SrsSpscRing::size()
+{
+    uint32_t tail = __atomic_load_n(&tail_, __ATOMIC_ACQUIRE);
+    uint32_t head = __atomic_load_n(&head_, __ATOMIC_ACQUIRE);
+    return (int)(tail - head);
+}
+
+int SrsSpscRing::capacity()
+{
+    return (int)capacity_;
+}
+
+ISrsIngestTask::ISrsIngestTask()
+{
+}
+
+ISrsIngestTask::~ISrsIngestTask()
+{
+}
+
+ISrsIngestThreads::ISrsIngestThreads()
+{
+}
+
+ISrsIngestThreads::~ISrsIngestThreads()
+{
+}
+
+SrsIngestThread::SrsIngestThread(SrsIngestThreads *owner, int capacity)
+{
+    owner_ = owner;
+    inputs_ = new SrsSpscRing(capacity);
+    outputs_ = new SrsSpscRing(capacity);
+    nn_inflight_ = 0;
+    notify_[0] = notify_[1] = -1;
+    waiting_ = 0;
+    quit_ = 0;
+}
+
+SrsIngestThread::~SrsIngestThread()
+{
+    srs_ingest_notify_close(notify_);
+    srs_freep(inputs_);
+    srs_freep(outputs_);
+}
+
+SrsIngestThreads::SrsIngestThreads()
+{
+    trd_ = new SrsDummyCoroutine();
+    started_ = false;
+    notify_[0] = notify_[1] = -1;
+    stfd_ = NULL;
+    waiting_ = 0;
+
+    max_queue_ = 0;
+    slot_ = srs_cond_new();
+    drained_ = srs_cond_new();
+    nn_tasks_ = 0;
+    nn_full_ = 0;
+
+    config_ = _srs_config;
+}
+
+SrsIngestThreads::~SrsIngestThreads()
+{
+    stop();
+
+    srs_freep(trd_);
+    srs_cond_destroy(slot_);
+    srs_cond_destroy(drained_);
+
+    config_ = NULL;
+}
+
+srs_error_t SrsIngestThreads::start()
+{
+    srs_error_t err = srs_success;
+
+    if (started_ || !config_->get_ingest_thread_enabled()) {
+        return err;
+    }
+
+    int nn_threads = config_->get_ingest_threads();
+    int queue = config_->get_ingest_thread_queue();
+
+    if (srs_ingest_notify_open(notify_) < 0) {
+        return srs_error_new(ERROR_SYSTEM_INGEST_THREAD, "open notify");
+    }
+
+    if ((stfd_ = srs_netfd_open(notify_[0])) == NULL) {
+        return srs_error_new(ERROR_SYSTEM_INGEST_THREAD, "open notify fd=%d", notify_[0]);
+    }
+
+    for (int i = 0; i < nn_threads; i++) {
+        SrsIngestThread *thread = new SrsIngestThread(this, queue);
+        // The rings never overflow, because the tasks in flight are limited by capacity.
+        max_queue_ = thread->inputs_->capacity();
+
+        if (srs_ingest_notify_open(thread->notify_) < 0) {
+            srs_freep(thread);
+            return srs_error_new(ERROR_SYSTEM_INGEST_THREAD, "open notify of thread");
+        }
+
+        int r0 = pthread_create(&thread->trd_, NULL, ingest_thread, thread);
+        if (r0 != 0) {
+            srs_freep(thread);
+            return srs_error_new(ERROR_SYSTEM_INGEST_THREAD, "create thread, r0=%d", r0);
+        }
+
+        threads_.push_back(thread);
+    }
+
+    srs_freep(trd_);
+    trd_ = new SrsSTCoroutine("ingest", this, _srs_context->get_id());
+    if ((err = trd_->start()) != srs_success) {
+        return srs_error_wrap(err, "start dispatcher");
+    }
+
+    started_ = true;
+    srs_trace("Ingest threads: start threads=%d, queue=%d", nn_threads, max_queue_);
+
+    return err;
+}
+
+void SrsIngestThreads::stop()
+{
+    if (threads_.empty() && notify_[0] < 0) {
+        return;
+    }
+
+    started_ = false;
+
+    // The ingest threads quit after all pending tasks are executed.
+    for (int i = 0; i < (int)threads_.size(); i++) {
+        SrsIngestThread *thread = threads_[i];
+        __atomic_store_n(&thread->quit_, 1, __ATOMIC_SEQ_CST);
+        srs_ingest_notify_write(thread->notify_);
+    }
+
+    for (int i = 0; i < (int)threads_.size(); i++) {
+        pthread_join(threads_[i]->trd_, NULL);
+    }
+
+    trd_->stop();
+
+    // Finish the executed tasks, and wakeup the coroutines which wait for them.
+    on_completed();
+
+    for (int i = 0; i < (int)threads_.size(); i++) {
+        SrsIngestThread *thread = threads_[i];
+        srs_freep(thread);
+    }
+    threads_.clear();
+
+    if (stfd_) {
+        srs_close_stfd(stfd_);
+        if (notify_[1] == notify_[0]) {
+            notify_[1] = -1;
+        }
+        notify_[0] = -1;
+    }
+    srs_ingest_notify_close(notify_);
+
+    srs_trace("Ingest threads: stopped, tasks=%" PRId64 ", full=%" PRId64, nn_tasks_, nn_full_);
+}
+
+bool SrsIngestThreads::enabled()
+{
+    return started_;
+}
+
+void SrsIngestThreads::submit(ISrsIngestTask *task, uint64_t key)
+{
+    // Backpressure, wait for the ingest thread to catch up.
+    while (started_ && thread_of(key)->nn_inflight_ >= max_queue_) {
+        if ((nn_full_++ % 100) == 0) {
+            srs_warn("Ingest threads: queue full, queue=%d, full=%" PRId64, max_queue_, nn_full_);
+        }
+        srs_cond_wait(slot_);
+    }
+
+    // Execute in place, for the ingest threads are not started, or stopped.
+    if (!started_) {
+        task->execute();
+        do_finish(task, key);
+        return;
+    }
+
+    nn_tasks_++;
+    pending_[key]++;
+
+    SrsIngestThread *thread = thread_of(key);
+    thread->nn_inflight_++;
+
+    SrsIngestEntry *entry = new SrsIngestEntry();
+    entry->task_ = task;
+    entry->key_ = key;
+
+    // Never fail, because the tasks in flight never exceed the capacity.
+    bool ok = thread->inputs_->push(entry);
+    srs_assert(ok);
+
+    // Wakeup the thread only when it's waiting, the thread checks the ring again after set the flag.
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&thread->waiting_, __ATOMIC_SEQ_CST)) {
+        srs_ingest_notify_write(thread->notify_);
+    }
+}
+
+void SrsIngestThreads::drain(uint64_t key)
+{
+    while (true) {
+        std::map<uint64_t, int>::iterator it = pending_.find(key);
+        if (it == pending_.end()) {
+            return;
+        }
+        srs_cond_wait(drained_);
+    }
+}
+
+// LCOV_EXCL_START
+srs_error_t SrsIngestThreads::cycle()
+{
+    srs_error_t err = srs_success;
+
+    char buf[128];
+    while (true) {
+        if ((err = trd_->pull()) != srs_success) {
+            return srs_error_wrap(err, "ingest threads");
+        }
+
+        // Yield to other coroutines if busy, or wait for the ingest threads to notify.
+        if (on_completed() > 0) {
+            srs_thread_yield();
+            continue;
+        }
+
+        // Check the rings again after set the flag, so we never miss a task.
+        __atomic_store_n(&waiting_, 1, __ATOMIC_SEQ_CST);
+        bool busy = false;
+        for (int i = 0; i < (int)threads_.size() && !busy; i++) {
+            busy = !threads_[i]->outputs_->empty();
+        }
+        if (busy) {
+            __atomic_store_n(&waiting_, 0, __ATOMIC_SEQ_CST);
+            continue;
+        }
+
+        ssize_t nn = srs_read(stfd_, buf, sizeof(buf), SRS_UTIME_NO_TIMEOUT);
+        __atomic_store_n(&waiting_, 0, __ATOMIC_SEQ_CST);
+        if (nn <= 0) {
+            if ((err = trd_->pull()) != srs_success) {
+                return srs_error_wrap(err, "ingest threads");
+            }
+            return srs_error_new(ERROR_SYSTEM_INGEST_THREAD, "read notify, nn=%d", (int)nn);
+        }
+    }
+
+    return err;
+}
+// LCOV_EXCL_STOP
+
+SrsIngestThread *SrsIngestThreads::thread_of(uint64_t key)
+{
+    // The key is generally a pointer, which is aligned, so mix all bits by the finalizer of murmur3.
+    uint32_t h = (uint32_t)(key ^ (key >> 32));
+    h ^= h >> 16;
+    h *= 0x85ebca6b;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35;
+    h ^= h >> 16;
+
+    return threads_.at(h % threads_.size());
+}
+
+int SrsIngestThreads::on_completed()
+{
+    int nn = 0;
+
+    for (int i = 0; i < (int)threads_.size(); i++) {
+        SrsIngestThread *thread = threads_[i];
+
+        // Only finish the tasks in ring now, the new tasks are left to next round.
+        for (int j = thread->outputs_->size(); j > 0; j--) {
+            SrsIngestEntry *entry = (SrsIngestEntry *)thread->outputs_->pop();
+            ISrsIngestTask *task = entry->task_;
+            uint64_t key = entry->key_;
+            srs_freep(entry);
+
+            thread->nn_inflight_--;
+            nn++;
+
+            std::map<uint64_t, int>::iterator it = pending_.find(key);
+            if (it != pending_.end() && --it->second <= 0) {
+                pending_.erase(it);
+            }
+
+            do_finish(task, key);
+        }
+    }
+
+    if (nn > 0) {
+        srs_cond_broadcast(slot_);
+        srs_cond_broadcast(drained_);
+    }
+
+    return nn;
+}
+
+void SrsIngestThreads::do_finish(ISrsIngestTask *task, uint64_t key)
+{
+    srs_error_t err = task->finish();
+    if (err != srs_success) {
+        srs_warn("Ingest threads: ignore err %s", srs_error_desc(err).c_str());
+        srs_freep(err);
+    }
+    srs_freep(task);
+}
+
+// LCOV_EXCL_START
+void *SrsIngestThreads::ingest_thread(void *arg)
+{
+    SrsIngestThread *thread = (SrsIngestThread *)arg;
+
+    // The signals are handled by ST thread.
+    sigset_t mask;
+    sigfillset(&mask);
+    pthread_sigmask(SIG_BLOCK, &mask, NULL);
+
+    thread->owner_->ingest_cycle(thread);
+    return NULL;
+}
+// LCOV_EXCL_STOP
+
+void SrsIngestThreads::ingest_cycle(SrsIngestThread *thread)
+{
+    char buf[128];
+    while (true) {
+        SrsIngestEntry *entry = (SrsIngestEntry *)thread->inputs_->pop();
+        if (entry) {
+            entry->task_->execute();
+
+            // Never fail, because the tasks in flight never exceed the capacity.
+            thread->outputs_->push(entry);
+
+            // Wakeup the dispatcher only when it's waiting.
+            __atomic_thread_fence(__ATOMIC_SEQ_CST);
+            if (__atomic_load_n(&waiting_, __ATOMIC_SEQ_CST)) {
+                srs_ingest_notify_write(notify_);
+            }
+            continue;
+        }
+
+        // Quit when all tasks are executed.
+        if (__atomic_load_n(&thread->quit_, __ATOMIC_SEQ_CST)) {
+            break;
+        }
+
+        // Check the ring again after set the flag, so we never miss a task.
+        __atomic_store_n(&thread->waiting_, 1, __ATOMIC_SEQ_CST);
+        if (!thread->inputs_->empty() || __atomic_load_n(&thread->quit_, __ATOMIC_SEQ_CST)) {
+            __atomic_store_n(&thread->waiting_, 0, __ATOMIC_SEQ_CST);
+            continue;
+        }
+
+        ssize_t nn = ::read(thread->notify_[0], buf, sizeof(buf));
+        __atomic_store_n(&thread->waiting_, 0, __ATOMIC_SEQ_CST);
+        if (nn < 0 && errno != EINTR && errno != EAGAIN) {
+            usleep(1000);
+        }
+    }
+}
@@ -0,0 +1,180 @@
+//
+// Copyright (c) 2013-2025 The SRS Authors
+//
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef SRS_APP_INGEST_THREAD_HPP
+#define SRS_APP_INGEST_THREAD_HPP
+
+#include <srs_core.hpp>
+
+#include <pthread.h>
+
+#include <map>
+#include <vector>
+
+#include <srs_app_st.hpp>
+
+class ISrsAppConfig;
+class SrsIngestThreads;
+
+// The lock-free ring for single producer and single consumer, which are different OS threads. The
+// producer only writes the tail, the consumer only writes the head, and the items are published by
+// the release store of tail, and freed by the release store of head.
+class SrsSpscRing
+{
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    void **items_;
+    // The capacity is power of 2, so the index is masked.
+    uint32_t capacity_;
+    uint32_t mask_;
+    char pad0_[SRS_CACHE_LINE_SIZE];
+    // The position to pop, written by consumer.
+    uint32_t head_;
+    char pad1_[SRS_CACHE_LINE_SIZE];
+    // The position to push, written by producer.
+    uint32_t tail_;
+    char pad2_[SRS_CACHE_LINE_SIZE];
+
+public:
+    // The capacity is rounded up to power of 2.
+    SrsSpscRing(int capacity);
+    virtual ~SrsSpscRing();
+
+public:
+    // Push item by producer, return false if full.
+    bool push(void *item);
+    // Pop item by consumer, return NULL if empty.
+    void *pop();
+    // Whether empty, by consumer.
+    bool empty();
+    int size();
+    int capacity();
+};
+
+// The task to execute in ingest thread, such as demux the packets of a stream.
+class ISrsIngestTask
+{
+public:
+    ISrsIngestTask();
+    virtual ~ISrsIngestTask();
+
+public:
+    // Execute the task in ingest thread.
+    // @remark Never touch the ST, such as coroutine, cond and netfd, or any shared object.
+    virtual void execute() = 0;
+    // Finish the task in ST thread, for example, deliver the demuxed messages.
+    virtual srs_error_t finish() = 0;
+};
+
+// The interface for ingest threads.
+class ISrsIngestThreads
+{
+public:
+    ISrsIngestThreads();
+    virtual ~ISrsIngestThreads();
+
+public:
+    // Start the ingest threads if enabled, should be called in the process which serves streams.
+    virtual srs_error_t start() = 0;
+    // Finish the pending tasks and stop the ingest threads.
+    virtual void stop() = 0;
+    // Whether the ingest threads are running, or the task is executed in place by ST thread.
+    virtual bool enabled() = 0;
+    // Submit the task, which is freed after finished. The tasks of the same key, for example, the
+    // same stream, are executed by the same thread and finished in order.
+    // @remark The task is executed and finished in place if not enabled.
+    virtual void submit(ISrsIngestTask *task, uint64_t key) = 0;
+    // Wait for all pending tasks of key to finish, for example, before the stream is freed.
+    virtual void drain(uint64_t key) = 0;
+};
+
+// The ingest thread, which has a pair of SPSC rings to ST thread.
+class SrsIngestThread
+{
+public:
+    SrsIngestThreads *owner_;
+    pthread_t trd_;
+    // The tasks from ST thread to ingest thread.
+    SrsSpscRing *inputs_;
+    // The tasks from ingest thread to ST thread, when executed.
+    SrsSpscRing *outputs_;
+    // The number of tasks in rings, only accessed by ST thread.
+    int nn_inflight_;
+    // The eventfd to wakeup the ingest thread, only written when the thread is waiting.
+    int notify_[2];
+    int waiting_;
+    int quit_;
+
+public:
+    SrsIngestThread(SrsIngestThreads *owner, int capacity);
+    virtual ~SrsIngestThread();
+};
+
+// The ingest threads, which demux the packets of ingest streams out of ST thread. The ST thread
+// hands off tasks by lock-free SPSC rings, without any lock or syscall in the hot path, and the
+// executed tasks are returned by another ring to a dispatcher coroutine. The eventfd is written
+// only when the peer is waiting, to wakeup it.
+class SrsIngestThreads : public ISrsIngestThreads, public ISrsCoroutineHandler
+{
+    friend class SrsIngestThread;
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    ISrsAppConfig *config_;
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    ISrsCoroutine *trd_;
+    bool started_;
+    std::vector<SrsIngestThread *> threads_;
+    // The eventfd to wakeup the dispatcher, written by ingest threads when it's waiting.
+    int notify_[2];
+    srs_netfd_t stfd_;
+    int waiting_;
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // The max number of tasks in flight for each thread, for backpressure.
+    int max_queue_;
+    // The coroutines wait for a free slot of queue.
+    srs_cond_t slot_;
+    // The number of pending tasks of each key, and the coroutines wait for them.
+    std::map<uint64_t, int> pending_;
+    srs_cond_t drained_;
+    // The total number of tasks, and the times that queue is full.
+    int64_t nn_tasks_;
+    int64_t nn_full_;
+
+public:
+    SrsIngestThreads();
+    virtual ~SrsIngestThreads();
+
+public:
+    virtual srs_error_t start();
+    virtual void stop();
+    virtual bool enabled();
+    virtual void submit(ISrsIngestTask *task, uint64_t key);
+    virtual void drain(uint64_t key);
+    // Interface ISrsCoroutineHandler
+public:
+    virtual srs_error_t cycle();
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // Get the thread of key, the tasks of the same key always go to the same thread.
+    virtual SrsIngestThread *thread_of(uint64_t key);
+    // Finish the executed tasks of all threads, return the number of tasks.
+    virtual int on_completed();
+    // Finish the task and free it.
+    virtual void do_finish(ISrsIngestTask *task, uint64_t key);
+    static void *ingest_thread(void *arg);
+    virtual void ingest_cycle(SrsIngestThread *thread);
+};
+
+// The global ingest threads.
+extern SrsIngestThreads *_srs_ingest_threads;
+
+#endif
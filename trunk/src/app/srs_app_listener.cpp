@@ -9,8 +9,10 @@
 #include <arpa/inet.h>
 #include <fcntl.h>
 #include <netdb.h>
+#include <netinet/udp.h>
 #include <signal.h>
 #include <stdlib.h>
+#include <string.h>
 #include <sys/socket.h>
 #include <sys/stat.h>
 #include <sys/types.h>
@@ -29,14 +31,38 @@ using namespace std;
 #include <srs_kernel_utility.hpp>
 
 SrsPps *_srs_pps_rpkts = NULL;
+SrsPps *_srs_pps_rmmsgs = NULL;
 SrsPps *_srs_pps_addrs = NULL;
 SrsPps *_srs_pps_fast_addrs = NULL;
 
 SrsPps *_srs_pps_spkts = NULL;
+SrsPps *_srs_pps_smmsgs = NULL;
 
 // set the max packet size.
 #define SRS_UDP_MAX_PACKET_SIZE 65535
 
+// For UDP GSO, the max segments in a packet, see UDP_MAX_SEGMENTS of linux kernel.
+#define SRS_UDP_MAX_GSO_SEGMENTS 64
+// For UDP GSO, the max payload size of a packet.
+#define SRS_UDP_MAX_GSO_SIZE 65000
+
+// The UDP GSO is supported by linux 4.18+, see https://lwn.net/Articles/752956/
+#if defined(__linux__)
+#define SRS_UDP_GSO
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103
+#endif
+#endif
+
+#ifdef SRS_UDP_GSO
+// When the kernel or NIC does not support GSO, fallback to sendmmsg and retry GSO after a while.
+#define SRS_UDP_GSO_BACKOFF (30 * SRS_UTIME_SECONDS)
+// The time to retry the UDP GSO, it's available when now is after it.
+static srs_utime_t _srs_udp_gso_retry_at = 0;
+// Only warn once, because the GSO is generally not supported by the kernel or NIC for ever.
+static bool _srs_udp_gso_warned = false;
+#endif
+
 // sleep in srs_utime_t for udp recv packet.
 #define SrsUdpPacketRecvCycleInterval 0
 
@@ -465,30 +491,131 @@ SrsUdpMuxSocket::SrsUdpMuxSocket(srs_netfd_t fd)
     fast_id_ = 0;
     address_changed_ = false;
     cache_buffer_ = new SrsBuffer(buf_, nb_buf_);
+
+    nn_mmsgs_ = 0;
+    mmsg_bufs_ = NULL;
+    mmsgs_ = NULL;
+    mmsg_iovs_ = NULL;
+    mmsg_addrs_ = NULL;
+    mmsg_buffers_ = NULL;
+
+    data_ = buf_;
+    data_buffer_ = cache_buffer_;
 }
 
 SrsUdpMuxSocket::~SrsUdpMuxSocket()
 {
     srs_freepa(buf_);
     srs_freep(cache_buffer_);
+
+    for (int i = 0; i < nn_mmsgs_; i++) {
+        srs_freep(mmsg_buffers_[i]);
+    }
+    srs_freepa(mmsg_buffers_);
+    srs_freepa(mmsg_bufs_);
+    srs_freepa(mmsgs_);
+    srs_freepa(mmsg_iovs_);
+    srs_freepa(mmsg_addrs_);
 }
 
 int SrsUdpMuxSocket::recvfrom(srs_utime_t timeout)
 {
+    data_ = buf_;
+    data_buffer_ = cache_buffer_;
+
     fromlen_ = sizeof(from_);
     nread_ = srs_recvfrom(lfd_, buf_, nb_buf_, (sockaddr *)&from_, &fromlen_, timeout);
     if (nread_ <= 0) {
         return nread_;
     }
 
+    return on_recvfrom();
+}
+
+void SrsUdpMuxSocket::set_recvmmsg(int vlen)
+{
+    vlen = srs_min(vlen, SRS_UDP_MAX_MMSG);
+    if (vlen <= nn_mmsgs_) {
+        return;
+    }
+
+    for (int i = 0; i < nn_mmsgs_; i++) {
+        srs_freep(mmsg_buffers_[i]);
+    }
+    srs_freepa(mmsg_buffers_);
+    srs_freepa(mmsg_bufs_);
+    srs_freepa(mmsgs_);
+    srs_freepa(mmsg_iovs_);
+    srs_freepa(mmsg_addrs_);
+
+    nn_mmsgs_ = vlen;
+    mmsg_bufs_ = new char[nn_mmsgs_ * nb_buf_];
+    mmsgs_ = new mmsghdr[nn_mmsgs_];
+    mmsg_iovs_ = new iovec[nn_mmsgs_];
+    mmsg_addrs_ = new sockaddr_storage[nn_mmsgs_];
+    mmsg_buffers_ = new SrsBuffer *[nn_mmsgs_];
+
+    for (int i = 0; i < nn_mmsgs_; i++) {
+        char *p = mmsg_bufs_ + i * nb_buf_;
+        mmsg_buffers_[i] = new SrsBuffer(p, nb_buf_);
+
+        mmsg_iovs_[i].iov_base = p;
+        mmsg_iovs_[i].iov_len = nb_buf_;
+
+        memset(mmsgs_ + i, 0, sizeof(mmsghdr));
+        mmsgs_[i].msg_hdr.msg_iov = mmsg_iovs_ + i;
+        mmsgs_[i].msg_hdr.msg_iovlen = 1;
+        mmsgs_[i].msg_hdr.msg_name = mmsg_addrs_ + i;
+    }
+}
+
+int SrsUdpMuxSocket::recvmmsg(srs_utime_t timeout)
+{
+    // The kernel updates the address length and flags, so we must reset them for each batch.
+    for (int i = 0; i < nn_mmsgs_; i++) {
+        mmsgs_[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+        mmsgs_[i].msg_hdr.msg_flags = 0;
+        mmsgs_[i].msg_len = 0;
+    }
+
+    int r0 = srs_recvmmsg(lfd_, mmsgs_, nn_mmsgs_, 0, timeout);
+    if (r0 > 0) {
+        ++_srs_pps_rmmsgs->sugar_;
+    }
+
+    return r0;
+}
+
+int SrsUdpMuxSocket::load_mmsg(int index)
+{
+    srs_assert(index >= 0 && index < nn_mmsgs_);
+
+    mmsghdr *p = mmsgs_ + index;
+    data_ = (char *)mmsg_iovs_[index].iov_base;
+    data_buffer_ = mmsg_buffers_[index];
+    nread_ = (int)p->msg_len;
+
+    // Copy the address, which is used to reply to the peer.
+    fromlen_ = (int)p->msg_hdr.msg_namelen;
+    memcpy(&from_, mmsg_addrs_ + index, fromlen_);
+
+    if (nread_ <= 0) {
+        return nread_;
+    }
+
+    return on_recvfrom();
+}
+
+int SrsUdpMuxSocket::on_recvfrom()
+{
     // Reset the fast cache buffer size.
-    cache_buffer_->set_size(nread_);
-    cache_buffer_->skip(-1 * cache_buffer_->pos());
+    data_buffer_->set_size(nread_);
+    data_buffer_->skip(-1 * data_buffer_->pos());
 
     // Drop UDP health check packet of Aliyun SLB.
     //      Healthcheck udp check
     // @see https://help.aliyun.com/document_detail/27595.html
-    if (nread_ == 21 && buf_[0] == 0x48 && buf_[1] == 0x65 && buf_[2] == 0x61 && buf_[3] == 0x6c && buf_[19] == 0x63 && buf_[20] == 0x6b) {
+    if (nread_ == 21 && data_[0] == 0x48 && data_[1] == 0x65 && data_[2] == 0x61 && data_[3] == 0x6c && data_[19] == 0x63 && data_[20] == 0x6b) {
         return 0;
     }
 
@@ -533,6 +660,143 @@ srs_error_t SrsUdpMuxSocket::sendto(void *data, int size, srs_utime_t timeout)
     return err;
 }
 
+srs_error_t SrsUdpMuxSocket::sendmmsg(iovec *iovs, int nn_iovs, int gso_size, srs_utime_t timeout)
+{
+    srs_error_t err = srs_success;
+
+    if (nn_iovs <= 0) {
+        return err;
+    }
+
+    _srs_pps_spkts->sugar_ += nn_iovs;
+
+    bool sent = false;
+#ifdef SRS_UDP_GSO
+    if (gso_size > 0 && nn_iovs > 1 && srs_time_now_cached() >= _srs_udp_gso_retry_at) {
+        if ((err = do_sendgso(iovs, nn_iovs, gso_size, timeout, &sent)) != srs_success) {
+            return srs_error_wrap(err, "gso");
+        }
+    }
+#endif
+
+    if (!sent && (err = do_sendmmsg(iovs, nn_iovs, timeout)) != srs_success) {
+        return srs_error_wrap(err, "sendmmsg");
+    }
+
+    // Yield to another coroutines.
+    // @see https://github.com/ossrs/srs/issues/2194#issuecomment-777542162
+    nn_msgs_for_yield_ += nn_iovs;
+    if (nn_msgs_for_yield_ > 20) {
+        nn_msgs_for_yield_ = 0;
+        srs_thread_yield();
+    }
+
+    return err;
+}
+
+srs_error_t SrsUdpMuxSocket::do_sendmmsg(iovec *iovs, int nn_iovs, srs_utime_t timeout)
+{
+    srs_error_t err = srs_success;
+
+    mmsghdr mmsgs[SRS_UDP_MAX_MMSG];
+
+    for (int sent = 0; sent < nn_iovs;) {
+        int nn = srs_min(nn_iovs - sent, SRS_UDP_MAX_MMSG);
+
+        for (int i = 0; i < nn; i++) {
+            mmsghdr *p = mmsgs + i;
+            memset(p, 0, sizeof(mmsghdr));
+
+            p->msg_hdr.msg_name = (sockaddr *)&from_;
+            p->msg_hdr.msg_namelen = (socklen_t)fromlen_;
+            p->msg_hdr.msg_iov = iovs + sent + i;
+            p->msg_hdr.msg_iovlen = 1;
+        }
+
+        int r0 = srs_sendmmsg(lfd_, mmsgs, nn, 0, timeout);
+        if (r0 <= 0) {
+            if (r0 < 0 && errno == ETIME) {
+                return srs_error_new(ERROR_SOCKET_TIMEOUT, "sendmmsg timeout %d ms", srsu2msi(timeout));
+            }
+
+            return srs_error_new(ERROR_SOCKET_WRITE, "sendmmsg %d/%d", sent, nn_iovs);
+        }
+
+        sent += r0;
+        ++_srs_pps_smmsgs->sugar_;
+    }
+
+    return err;
+}
+
+srs_error_t SrsUdpMuxSocket::do_sendgso(iovec *iovs, int nn_iovs, int gso_size, srs_utime_t timeout, bool *psent)
+{
+    srs_error_t err = srs_success;
+
+    *psent = false;
+
+#ifdef SRS_UDP_GSO
+    // Each GSO packet should not exceed the max UDP payload or max segments, so fallback to sendmmsg
+    // for this batch of large packets.
+    int max_segments = srs_min(SRS_UDP_MAX_GSO_SEGMENTS, SRS_UDP_MAX_GSO_SIZE / gso_size);
+    if (max_segments <= 1) {
+        return err;
+    }
+
+    char control[CMSG_SPACE(sizeof(uint16_t))];
+
+    for (int sent = 0; sent < nn_iovs;) {
+        int nn = srs_min(nn_iovs - sent, max_segments);
+
+        msghdr msg;
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_name = (sockaddr *)&from_;
+        msg.msg_namelen = (socklen_t)fromlen_;
+        msg.msg_iov = iovs + sent;
+        msg.msg_iovlen = nn;
+
+        // Only use GSO for multiple segments, the last segment might be smaller than others.
+        if (nn > 1) {
+            memset(control, 0, sizeof(control));
+            msg.msg_control = control;
+            msg.msg_controllen = sizeof(control);
+
+            cmsghdr *cm = CMSG_FIRSTHDR(&msg);
+            cm->cmsg_level = SOL_UDP;
+            cm->cmsg_type = UDP_SEGMENT;
+            cm->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+            *((uint16_t *)CMSG_DATA(cm)) = (uint16_t)gso_size;
+        }
+
+        int r0 = srs_sendmsg(lfd_, &msg, 0, timeout);
+        if (r0 < 0 && nn > 1 && !sent && (errno == EINVAL || errno == EIO || errno == ENOPROTOOPT)) {
+            // The kernel or NIC does not support GSO, fallback to sendmmsg and retry GSO later.
+            _srs_udp_gso_retry_at = srs_time_now_cached() + SRS_UDP_GSO_BACKOFF;
+            if (!_srs_udp_gso_warned) {
+                _srs_udp_gso_warned = true;
+                srs_warn("UDP: Fallback to sendmmsg for GSO size=%d, nn=%d, errno=%d, retry in %dms", gso_size, nn, errno, srsu2msi(SRS_UDP_GSO_BACKOFF));
+            }
+            return err;
+        }
+
+        if (r0 <= 0) {
+            if (r0 < 0 && errno == ETIME) {
+                return srs_error_new(ERROR_SOCKET_TIMEOUT, "sendmsg timeout %d ms", srsu2msi(timeout));
+            }
+
+            return srs_error_new(ERROR_SOCKET_WRITE, "sendmsg gso %d/%d, size=%d", sent, nn_iovs, gso_size);
+        }
+
+        sent += nn;
+        ++_srs_pps_smmsgs->sugar_;
+    }
+
+    *psent = true;
+#endif
+
+    return err;
+}
+
 srs_netfd_t SrsUdpMuxSocket::stfd()
 {
     return lfd_;
@@ -550,7 +814,7 @@ socklen_t SrsUdpMuxSocket::peer_addrlen()
 
 char *SrsUdpMuxSocket::data()
 {
-    return buf_;
+    return data_;
 }
 
 int SrsUdpMuxSocket::size()
@@ -629,7 +893,7 @@ uint64_t SrsUdpMuxSocket::fast_id()
 
 SrsBuffer *SrsUdpMuxSocket::buffer()
 {
-    return cache_buffer_;
+    return data_buffer_;
 }
 
 // LCOV_EXCL_START
@@ -639,6 +903,7 @@ ISrsUdpMuxSocket *SrsUdpMuxSocket::copy_sendonly()
 
     // Don't copy buffer
     srs_freepa(sendonly->buf_);
+    sendonly->data_ = NULL;
     sendonly->nb_buf_ = 0;
     sendonly->nread_ = 0;
     sendonly->lfd_ = lfd_;
@@ -666,6 +931,7 @@ SrsUdpMuxListener::SrsUdpMuxListener(ISrsUdpMuxHandler *h, std::string i, int p)
 
     nb_buf_ = SRS_UDP_MAX_PACKET_SIZE;
     buf_ = new char[nb_buf_];
+    nn_mmsgs_ = 1;
 
     trd_ = new SrsDummyCoroutine();
     cid_ = _srs_context->generate_id();
@@ -692,6 +958,11 @@ srs_netfd_t SrsUdpMuxListener::stfd()
     return lfd_;
 }
 
+void SrsUdpMuxListener::set_recvmmsg(int v)
+{
+    nn_mmsgs_ = v;
+}
+
 srs_error_t SrsUdpMuxListener::listen()
 {
     srs_error_t err = srs_success;
@@ -775,6 +1046,13 @@ srs_error_t SrsUdpMuxListener::cycle()
     SrsUniquePtr<SrsUdpMuxSocket> skt_ptr(new SrsUdpMuxSocket(lfd_));
     ISrsUdpMuxSocket *skt = skt_ptr.get();
 
+    // Receive a batch of datagrams by recvmmsg for each wakeup, to reduce the syscalls
+    // and context switches when there are lots of packets.
+    bool use_mmsg = nn_mmsgs_ > 1;
+    if (use_mmsg) {
+        skt_ptr->set_recvmmsg(nn_mmsgs_);
+    }
+
     // How many messages to run a yield.
     uint32_t nn_msgs_for_yield = 0;
 
@@ -785,33 +1063,42 @@ srs_error_t SrsUdpMuxListener::cycle()
 
         nn_loop++;
 
-        int nread = skt->recvfrom(SRS_UTIME_NO_TIMEOUT);
-        if (nread <= 0) {
-            if (nread < 0) {
-                srs_warn("udp recv error nn=%d", nread);
-            }
+        int nn_batch = 1;
+        if (use_mmsg && (nn_batch = skt_ptr->recvmmsg(SRS_UTIME_NO_TIMEOUT)) <= 0) {
+            srs_warn("udp recvmmsg error nn=%d", nn_batch);
             // remux udp never return
             continue;
         }
 
-        nn_msgs++;
-        nn_msgs_stage++;
+        for (int i = 0; i < nn_batch; i++) {
+            int nread = use_mmsg ? skt_ptr->load_mmsg(i) : skt->recvfrom(SRS_UTIME_NO_TIMEOUT);
+            if (nread <= 0) {
+                if (nread < 0) {
+                    srs_warn("udp recv error nn=%d", nread);
+                }
+                // remux udp never return
+                continue;
+            }
+
+            nn_msgs++;
+            nn_msgs_stage++;
 
-        // Handle the UDP packet.
-        err = handler_->on_udp_packet(skt);
+            // Handle the UDP packet.
+            err = handler_->on_udp_packet(skt);
 
-        // Use pithy print to show more smart information.
-        if (err != srs_success) {
-            uint32_t nn = 0;
-            if (pp_pkt_handler_err->can_print(err, &nn)) {
-                // For performance, only restore context when output log.
-                _srs_context->set_id(cid_);
+            // Use pithy print to show more smart information.
+            if (err != srs_success) {
+                uint32_t nn = 0;
+                if (pp_pkt_handler_err->can_print(err, &nn)) {
+                    // For performance, only restore context when output log.
+                    _srs_context->set_id(cid_);
 
-                // Append more information.
-                err = srs_error_wrap(err, "size=%u, data=[%s]", skt->size(), srs_strings_dumps_hex(skt->data(), skt->size(), 8).c_str());
-                srs_warn("handle udp pkt, count=%u/%u, err: %s", pp_pkt_handler_err->nn_count_, nn, srs_error_desc(err).c_str());
+                    // Append more information.
+                    err = srs_error_wrap(err, "size=%u, data=[%s]", skt->size(), srs_strings_dumps_hex(skt->data(), skt->size(), 8).c_str());
+                    srs_warn("handle udp pkt, count=%u/%u, err: %s", pp_pkt_handler_err->nn_count_, nn, srs_error_desc(err).c_str());
+                }
+                srs_freep(err);
             }
-            srs_freep(err);
         }
 
         pprint->elapse();
@@ -859,7 +1146,8 @@ srs_error_t SrsUdpMuxListener::cycle()
 
         // Yield to another coroutines.
         // @see https://github.com/ossrs/srs/issues/2194#issuecomment-777485531
-        if (++nn_msgs_for_yield > 10) {
+        nn_msgs_for_yield += nn_batch;
+        if (nn_msgs_for_yield > 10) {
             nn_msgs_for_yield = 0;
             srs_thread_yield();
         }
@@ -18,6 +18,9 @@
 
 #include <srs_app_st.hpp>
 
+// The max number of messages for each sendmmsg or recvmmsg, which also limits the batch of RTC player.
+#define SRS_UDP_MAX_MMSG 64
+
 struct sockaddr;
 
 class SrsBuffer;
@@ -223,6 +226,9 @@ public:
 
 public:
     virtual srs_error_t sendto(void *data, int size, srs_utime_t timeout) = 0;
+    // Send a batch of packets to peer, each iovec is a UDP packet. If gso_size is not zero, all packets
+    // except the last one must be gso_size bytes, and we try to send them in one syscall by UDP GSO.
+    virtual srs_error_t sendmmsg(iovec *iovs, int nn_iovs, int gso_size, srs_utime_t timeout) = 0;
     virtual std::string get_peer_ip() const = 0;
     virtual int get_peer_port() const = 0;
     virtual std::string peer_id() = 0;
@@ -266,13 +272,35 @@ SRS_DECLARE_PRIVATE: // clang-format on
     // For IPv4 client, we use 8 bytes int id to find it fastly.
     uint64_t fast_id_;
 
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // For recvmmsg, the ring of preallocated buffers, each buffer is for a datagram.
+    int nn_mmsgs_;
+    char *mmsg_bufs_;
+    mmsghdr *mmsgs_;
+    iovec *mmsg_iovs_;
+    sockaddr_storage *mmsg_addrs_;
+    SrsBuffer **mmsg_buffers_;
+    // The current datagram, points to buf_ for recvfrom, or a buffer of the ring for recvmmsg.
+    char *data_;
+    SrsBuffer *data_buffer_;
+
 public:
     SrsUdpMuxSocket(srs_netfd_t fd);
     virtual ~SrsUdpMuxSocket();
 
 public:
     int recvfrom(srs_utime_t timeout);
+    // Enable recvmmsg to receive up to vlen datagrams in one syscall, by allocating the ring of buffers.
+    void set_recvmmsg(int vlen);
+    // Receive a batch of datagrams to the ring, return the number of datagrams, or -1 for error.
+    // @remark User should call load_mmsg to use each datagram as the current packet.
+    int recvmmsg(srs_utime_t timeout);
+    // Load the index-th datagram of the last batch as the current packet, so that the data(), size()
+    // and peer address are about this datagram. Return the size of datagram, or 0 if should ignore it.
+    int load_mmsg(int index);
     srs_error_t sendto(void *data, int size, srs_utime_t timeout);
+    srs_error_t sendmmsg(iovec *iovs, int nn_iovs, int gso_size, srs_utime_t timeout);
     srs_netfd_t stfd();
     sockaddr_in *peer_addr();
     socklen_t peer_addrlen();
@@ -284,6 +312,14 @@ public:
     uint64_t fast_id();
     SrsBuffer *buffer();
     ISrsUdpMuxSocket *copy_sendonly();
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // Parse the received datagram in data_ of nread_ bytes.
+    int on_recvfrom();
+    srs_error_t do_sendmmsg(iovec *iovs, int nn_iovs, srs_utime_t timeout);
+    // Send the batch by UDP GSO, the psent is false if fallback to sendmmsg.
+    srs_error_t do_sendgso(iovec *iovs, int nn_iovs, int gso_size, srs_utime_t timeout, bool *psent);
 };
 
 class SrsUdpMuxListener : public ISrsCoroutineHandler
@@ -302,6 +338,8 @@ SRS_DECLARE_PRIVATE: // clang-format on
 SRS_DECLARE_PRIVATE: // clang-format on
     char *buf_;
     int nb_buf_;
+    // The max number of datagrams to receive by recvmmsg, use recvfrom if not greater than 1.
+    int nn_mmsgs_;
 
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
@@ -316,6 +354,8 @@ public:
 public:
     virtual int fd();
     virtual srs_netfd_t stfd();
+    // Set the max number of datagrams to receive in a batch, should be called before listen.
+    void set_recvmmsg(int v);
 
 public:
     virtual srs_error_t listen();
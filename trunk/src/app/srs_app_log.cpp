@@ -10,12 +10,14 @@
 #include <sys/time.h>
 
 #include <fcntl.h>
+#include <signal.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
 
 #include <srs_app_config.hpp>
 #include <srs_app_utility.hpp>
+#include <srs_core_autofree.hpp>
 #include <srs_kernel_error.hpp>
 #include <srs_kernel_utility.hpp>
 
@@ -27,6 +29,87 @@
 // reserved for the end of log data, it must be strlen(LOG_TAIL)
 #define LOG_TAIL_SIZE 1
 
+SrsLogRing::SrsLogRing(int capacity)
+{
+    capacity_ = 1;
+    while ((int)capacity_ < capacity) {
+        capacity_ <<= 1;
+    }
+    mask_ = capacity_ - 1;
+
+    data_ = new char[capacity_];
+    head_ = tail_ = 0;
+}
+
+SrsLogRing::~SrsLogRing()
+{
+    srs_freepa(data_);
+}
+
+bool SrsLogRing::write(const char *data, int size)
+{
+    uint32_t tail = __atomic_load_n(&tail_, __ATOMIC_RELAXED);
+    uint32_t head = __atomic_load_n(&head_, __ATOMIC_ACQUIRE);
+    if (capacity_ - (tail - head) < (uint32_t)size) {
+        return false;
+    }
+
+    // Copy in two parts if wrap around.
+    uint32_t pos = tail & mask_;
+    uint32_t first = srs_min(capacity_ - pos, (uint32_t)size);
+    memcpy(data_ + pos, data, first);
+    if (first < (uint32_t)size) {
+        memcpy(data_, data + first, size - first);
+    }
+
+    __atomic_store_n(&tail_, tail + size, __ATOMIC_RELEASE);
+    return true;
+}
+
+int SrsLogRing::peek(iovec *iovs, int *piovcnt)
+{
+    uint32_t head = __atomic_load_n(&head_, __ATOMIC_RELAXED);
+    uint32_t tail = __atomic_load_n(&tail_, __ATOMIC_ACQUIRE);
+    uint32_t size = tail - head;
+
+    *piovcnt = 0;
+    if (!size) {
+        return 0;
+    }
+
+    uint32_t pos = head & mask_;
+    uint32_t first = srs_min(capacity_ - pos, size);
+    iovs[0].iov_base = data_ + pos;
+    iovs[0].iov_len = first;
+    *piovcnt = 1;
+
+    if (first < size) {
+        iovs[1].iov_base = data_;
+        iovs[1].iov_len = size - first;
+        *piovcnt = 2;
+    }
+
+    return (int)size;
+}
+
+void SrsLogRing::consume(int size)
+{
+    uint32_t head = __atomic_load_n(&head_, __ATOMIC_RELAXED);
+    __atomic_store_n(&head_, head + size, __ATOMIC_RELEASE);
+}
+
+int SrsLogRing::size()
+{
+    uint32_t head = __atomic_load_n(&head_, __ATOMIC_ACQUIRE);
+    uint32_t tail = __atomic_load_n(&tail_, __ATOMIC_ACQUIRE);
+    return (int)(tail - head);
+}
+
+int SrsLogRing::capacity()
+{
+    return (int)capacity_;
+}
+
 SrsFileLog::SrsFileLog()
 {
     level_ = SrsLogLevelTrace;
@@ -35,12 +118,30 @@ SrsFileLog::SrsFileLog()
     fd_ = -1;
     log_to_file_tank_ = false;
     utc_ = false;
+
+    limit_ = 0;
+    limit_second_ = 0;
+    memset(nn_lines_, 0, sizeof(nn_lines_));
+    nn_dropped_ = 0;
+    nn_reported_ = 0;
+
+    ring_ = NULL;
+    block_ = false;
+    quit_ = 0;
+    reopen_ = 0;
+    waiting_ = 0;
+    pthread_mutex_init(&lock_, NULL);
+    pthread_cond_init(&cond_, NULL);
 }
 
 SrsFileLog::~SrsFileLog()
 {
+    stop_async();
     srs_freepa(log_data_);
 
+    pthread_cond_destroy(&cond_);
+    pthread_mutex_destroy(&lock_);
+
     if (fd_ > 0) {
         ::close(fd_);
         fd_ = -1;
@@ -63,13 +164,50 @@ srs_error_t SrsFileLog::initialize()
         std::string level = _srs_config->get_log_level();
         std::string level_v2 = _srs_config->get_log_level_v2();
         level_ = level_v2.empty() ? srs_get_log_level(level) : srs_get_log_level_v2(level_v2);
+
+        limit_ = _srs_config->get_log_limit();
     }
 
     return srs_success;
 }
 
+srs_error_t SrsFileLog::start_async()
+{
+    srs_error_t err = srs_success;
+
+    if (ring_ || !_srs_config || !log_to_file_tank_ || !_srs_config->get_log_async_enabled()) {
+        return err;
+    }
+
+    filename_ = _srs_config->get_log_file();
+    block_ = _srs_config->get_log_async_overflow() == "block";
+    if ((err = start_flusher(_srs_config->get_log_async_buffer())) != srs_success) {
+        return srs_error_wrap(err, "start flusher");
+    }
+
+    srs_trace("log: async log to %s, ring=%d, overflow=%s, limit=%d",
+              filename_.c_str(), ring_->capacity(), block_ ? "block" : "drop", limit_);
+
+    return err;
+}
+
+void SrsFileLog::stop_async()
+{
+    if (!ring_) {
+        return;
+    }
+
+    stop_flusher();
+}
+
 void SrsFileLog::reopen()
 {
+    // The flusher thread reopens its fd, for the ring.
+    if (ring_) {
+        __atomic_store_n(&reopen_, 1, __ATOMIC_RELEASE);
+        wakeup_flusher();
+    }
+
     if (fd_ > 0) {
         ::close(fd_);
     }
@@ -87,15 +225,31 @@ void SrsFileLog::log(SrsLogLevel level, const char *tag, const SrsContextId &con
         return;
     }
 
+    // The ingest threads never share the buffer, the limit and the ring of ST thread.
+    bool in_st = srs_thread_self() != NULL;
+    if (in_st && is_limited(level)) {
+        return;
+    }
+
+    // The buffer is per thread for the ingest threads, like the buffer of error.
+    char *log_data = log_data_;
+    if (!in_st) {
+        static __thread char *thread_data = NULL;
+        if (!thread_data) {
+            thread_data = new char[LOG_MAX_SIZE];
+        }
+        log_data = thread_data;
+    }
+
     int size = 0;
     bool header_ok = srs_log_header(
-        log_data_, LOG_MAX_SIZE, utc_, level >= SrsLogLevelWarn, tag, context_id, srs_log_level_strings[level], &size);
+        log_data, LOG_MAX_SIZE, utc_, level >= SrsLogLevelWarn, tag, context_id, srs_log_level_strings[level], &size);
     if (!header_ok) {
         return;
     }
 
     // Something not expected, drop the log.
-    int r0 = vsnprintf(log_data_ + size, LOG_MAX_SIZE - size, fmt, args);
+    int r0 = vsnprintf(log_data + size, LOG_MAX_SIZE - size, fmt, args);
     if (r0 <= 0 || r0 >= LOG_MAX_SIZE - size) {
         return;
     }
@@ -103,7 +257,7 @@ void SrsFileLog::log(SrsLogLevel level, const char *tag, const SrsContextId &con
 
     // Add errno and strerror() if error. Check size to avoid security issue https://github.com/ossrs/srs/issues/1229
     if (level == SrsLogLevelError && errno != 0 && size < LOG_MAX_SIZE) {
-        r0 = snprintf(log_data_ + size, LOG_MAX_SIZE - size, "(%s)", strerror(errno));
+        r0 = snprintf(log_data + size, LOG_MAX_SIZE - size, "(%s)", strerror(errno));
 
         // Something not expected, drop the log.
         if (r0 <= 0 || r0 >= LOG_MAX_SIZE - size) {
@@ -112,7 +266,62 @@ void SrsFileLog::log(SrsLogLevel level, const char *tag, const SrsContextId &con
         size += r0;
     }
 
-    write_log(fd_, log_data_, size, level);
+    // Report the dropped lines before this line.
+    if (in_st && nn_dropped_ > nn_reported_) {
+        char tips[128];
+        int nn = snprintf(tips, sizeof(tips), "[%" PRId64 " logs dropped]", nn_dropped_ - nn_reported_);
+        nn_reported_ = nn_dropped_;
+
+        if (ring_) {
+            tips[nn++] = LOG_TAIL;
+            ring_->write(tips, nn);
+        } else {
+            write_log(fd_, tips, nn, SrsLogLevelWarn);
+        }
+    }
+
+    if (in_st && ring_) {
+        write_ring(log_data, size);
+        return;
+    }
+
+    write_log(fd_, log_data, size, level);
+}
+
+int64_t SrsFileLog::dropped()
+{
+    return nn_dropped_;
+}
+
+// Get the index of level for the number of lines, the level is bit flag from verbose to error.
+static int srs_log_level_index(SrsLogLevel level)
+{
+    int index = 0;
+    for (int v = (int)level >> 1; v > 0; v >>= 1) {
+        index++;
+    }
+    return srs_min(index, SRS_LOG_LEVELS - 1);
+}
+
+bool SrsFileLog::is_limited(SrsLogLevel level)
+{
+    if (limit_ <= 0) {
+        return false;
+    }
+
+    // Reset the number of lines for each second.
+    int64_t second = srs_time_now_cached() / SRS_UTIME_SECONDS;
+    if (second != limit_second_) {
+        limit_second_ = second;
+        memset(nn_lines_, 0, sizeof(nn_lines_));
+    }
+
+    if (nn_lines_[srs_log_level_index(level)]++ < limit_) {
+        return false;
+    }
+
+    nn_dropped_++;
+    return true;
 }
 
 void SrsFileLog::write_log(int &fd, char *str_log, int size, int level)
@@ -155,6 +364,34 @@ void SrsFileLog::write_log(int &fd, char *str_log, int size, int level)
     }
 }
 
+void SrsFileLog::write_ring(char *str_log, int size)
+{
+    size = srs_min(LOG_MAX_SIZE - 1 - LOG_TAIL_SIZE, size);
+    str_log[size++] = LOG_TAIL;
+
+    if (ring_->write(str_log, size)) {
+        wakeup_flusher();
+        return;
+    }
+
+    // Drop the log when ring is full, or never fit in the ring.
+    if (!block_) {
+        nn_dropped_++;
+        return;
+    }
+
+    // Write the log to file directly, which blocks the ST thread like synchronous log, but never
+    // waits for the flusher. Note that it might be written before the logs in ring.
+    if (fd_ < 0) {
+        open_log_file();
+    }
+
+    if (fd_ > 0) {
+        ssize_t nn = ::write(fd_, str_log, size);
+        (void)nn;
+    }
+}
+
 void SrsFileLog::open_log_file()
 {
     if (!_srs_config) {
@@ -172,3 +409,122 @@ void SrsFileLog::open_log_file()
                  S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH);
 }
 // LCOV_EXCL_STOP
+
+srs_error_t SrsFileLog::start_flusher(int capacity)
+{
+    srs_error_t err = srs_success;
+
+    ring_ = new SrsLogRing(capacity);
+    quit_ = reopen_ = 0;
+
+    int r0 = pthread_create(&flusher_, NULL, SrsFileLog::flusher, this);
+    if (r0 != 0) {
+        srs_freep(ring_);
+        return srs_error_new(ERROR_SYSTEM_LOG_FLUSHER, "create flusher, r0=%d", r0);
+    }
+
+    return err;
+}
+
+void SrsFileLog::stop_flusher()
+{
+    // The flusher writes all logs in ring before quit.
+    __atomic_store_n(&quit_, 1, __ATOMIC_RELEASE);
+    wakeup_flusher();
+    pthread_join(flusher_, NULL);
+
+    srs_freep(ring_);
+}
+
+// LCOV_EXCL_START
+void *SrsFileLog::flusher(void *arg)
+{
+    SrsFileLog *log = (SrsFileLog *)arg;
+
+    // The signals are handled by ST thread.
+    sigset_t mask;
+    sigfillset(&mask);
+    pthread_sigmask(SIG_BLOCK, &mask, NULL);
+
+    log->flush_cycle();
+    return NULL;
+}
+// LCOV_EXCL_STOP
+
+void SrsFileLog::flush_cycle()
+{
+    int fd = -1;
+    if (!filename_.empty()) {
+        fd = ::open(filename_.c_str(), O_RDWR | O_CREAT | O_APPEND, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH);
+    }
+
+    while (true) {
+        // Reopen the file, for example, after the log is rotated.
+        if (__atomic_load_n(&reopen_, __ATOMIC_ACQUIRE)) {
+            __atomic_store_n(&reopen_, 0, __ATOMIC_RELEASE);
+            if (fd > 0) {
+                ::close(fd);
+            }
+            fd = ::open(filename_.c_str(), O_RDWR | O_CREAT | O_APPEND, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH);
+        }
+
+        // Write out all logs in ring by one writev, then wait for more logs.
+        if (flush_ring(fd) > 0) {
+            continue;
+        }
+
+        if (__atomic_load_n(&quit_, __ATOMIC_ACQUIRE)) {
+            break;
+        }
+
+        // Wait for more logs, the ST thread signals the cond when it sees the flag.
+        pthread_mutex_lock(&lock_);
+        __atomic_store_n(&waiting_, 1, __ATOMIC_RELAXED);
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        while (!ring_->size() && !__atomic_load_n(&quit_, __ATOMIC_ACQUIRE) && !__atomic_load_n(&reopen_, __ATOMIC_ACQUIRE)) {
+            pthread_cond_wait(&cond_, &lock_);
+        }
+        __atomic_store_n(&waiting_, 0, __ATOMIC_RELAXED);
+        pthread_mutex_unlock(&lock_);
+    }
+
+    // Write the logs by ST thread when quit.
+    flush_ring(fd);
+
+    if (fd > 0) {
+        ::close(fd);
+    }
+}
+
+void SrsFileLog::wakeup_flusher()
+{
+    // Order the write of ring or flags before the load of waiting, against the fence of flusher, so
+    // either the flusher sees the logs, or we see it's waiting.
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (!__atomic_load_n(&waiting_, __ATOMIC_RELAXED)) {
+        return;
+    }
+
+    pthread_mutex_lock(&lock_);
+    pthread_cond_signal(&cond_);
+    pthread_mutex_unlock(&lock_);
+}
+
+int SrsFileLog::flush_ring(int fd)
+{
+    iovec iovs[2];
+    int iovcnt = 0;
+    int size = ring_->peek(iovs, &iovcnt);
+    if (size <= 0) {
+        return 0;
+    }
+
+    // Drop the logs if failed to open the file, like writing log synchronously.
+    if (fd > 0) {
+        ssize_t nn = ::writev(fd, iovs, iovcnt);
+        (void)nn;
+    }
+
+    ring_->consume(size);
+    return size;
+}
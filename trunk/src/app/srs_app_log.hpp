@@ -9,12 +9,54 @@
 
 #include <srs_core.hpp>
 
+#include <pthread.h>
 #include <string.h>
+#include <sys/uio.h>
+
 #include <string>
 
 #include <srs_app_reload.hpp>
 #include <srs_protocol_log.hpp>
 
+// The lock-free ring of bytes for log, written by ST thread and read by the flusher thread. The
+// producer only writes the tail, the consumer only writes the head, and the bytes are published by
+// the release store of tail, and freed by the release store of head.
+class SrsLogRing
+{
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    char *data_;
+    // The capacity is power of 2, so the position is masked.
+    uint32_t capacity_;
+    uint32_t mask_;
+    char pad0_[SRS_CACHE_LINE_SIZE];
+    // The position to read, written by consumer.
+    uint32_t head_;
+    char pad1_[SRS_CACHE_LINE_SIZE];
+    // The position to write, written by producer.
+    uint32_t tail_;
+    char pad2_[SRS_CACHE_LINE_SIZE];
+
+public:
+    // The capacity is rounded up to power of 2.
+    SrsLogRing(int capacity);
+    virtual ~SrsLogRing();
+
+public:
+    // Write bytes by producer, return false if no space for all bytes.
+    bool write(const char *data, int size);
+    // Get the readable bytes by consumer, in at most 2 iovecs for wrap around, return the size.
+    int peek(iovec *iovs, int *piovcnt);
+    // Consume size of bytes by consumer, after written out.
+    void consume(int size);
+    // Get the size of readable bytes.
+    int size();
+    int capacity();
+};
+
+// The number of log levels, from verbose to error.
+#define SRS_LOG_LEVELS 5
+
 // Use memory/disk cache and donot flush when write log.
 // it's ok to use it without config, which will log to console, and default trace level.
 // when you want to use different level, override this classs, set the protected _level.
@@ -35,6 +77,35 @@ SRS_DECLARE_PRIVATE: // clang-format on
     // Whether use utc time.
     bool utc_;
 
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // The max number of lines per second for each level, 0 for no limit.
+    int limit_;
+    // The second and number of lines in it, for each level.
+    int64_t limit_second_;
+    int nn_lines_[SRS_LOG_LEVELS];
+    // The number of lines dropped, by limit or when ring is full.
+    int64_t nn_dropped_;
+    // The number of dropped lines which is reported to log.
+    int64_t nn_reported_;
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // The ring for asynchronous log to file, NULL for synchronous log.
+    SrsLogRing *ring_;
+    // Whether write the log to file directly when ring is full, or drop the log.
+    bool block_;
+    // The flusher thread, which writes the ring to file with its own fd.
+    pthread_t flusher_;
+    std::string filename_;
+    int quit_;
+    // Whether reopen the log file, set by ST thread and reset by flusher.
+    int reopen_;
+    // The flusher waits on the cond when ring is empty, and it's signaled when waiting.
+    pthread_mutex_t lock_;
+    pthread_cond_t cond_;
+    int waiting_;
+
 public:
     SrsFileLog();
     virtual ~SrsFileLog();
@@ -44,10 +115,34 @@ public:
     virtual void reopen();
     virtual void log(SrsLogLevel level, const char *tag, const SrsContextId &context_id, const char *fmt, va_list args);
 
+public:
+    // Start the flusher thread for asynchronous log if enabled, should be called after forked.
+    virtual srs_error_t start_async();
+    // Write out all logs in ring, and stop the flusher thread.
+    virtual void stop_async();
+    // Get the number of dropped lines.
+    virtual int64_t dropped();
+
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
+    // Whether exceed the limit of level, in ST thread.
+    virtual bool is_limited(SrsLogLevel level);
     virtual void write_log(int &fd, char *str_log, int size, int level);
+    // Write log to ring, in ST thread.
+    virtual void write_ring(char *str_log, int size);
     virtual void open_log_file();
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // Start and stop the flusher thread for asynchronous log.
+    virtual srs_error_t start_flusher(int capacity);
+    virtual void stop_flusher();
+    static void *flusher(void *arg);
+    virtual void flush_cycle();
+    // Wakeup the flusher if it's waiting for logs.
+    virtual void wakeup_flusher();
+    // Write all bytes in ring to fd, return the number of bytes.
+    virtual int flush_ring(int fd);
 };
 
 #endif
@@ -0,0 +1,676 @@
+//
+// Copyright (c) 2013-2025 The SRS Authors
+//
+// SPDX-License-Identifier: MIT
+//
+
+#include <srs_app_mp4_index.hpp>
+
+#include <stdio.h>
+using namespace std;
+
+#include <srs_app_async_io.hpp>
+#include <srs_core_autofree.hpp>
+#include <srs_kernel_buffer.hpp>
+#include <srs_kernel_error.hpp>
+#include <srs_kernel_file.hpp>
+#include <srs_kernel_log.hpp>
+#include <srs_kernel_mp4.hpp>
+#include <srs_kernel_stream.hpp>
+#include <srs_kernel_utility.hpp>
+#include <srs_protocol_json.hpp>
+
+// The magic of sidecar index file, 'SRSI'.
+#define SRS_MP4_INDEX_MAGIC 0x53525349
+#define SRS_MP4_INDEX_VERSION 2
+// The bytes of header, and each sample.
+#define SRS_MP4_INDEX_HEADER_SIZE 44
+#define SRS_MP4_INDEX_SAMPLE_SIZE 25
+// The max number of indexes in cache.
+#define SRS_MP4_INDEX_CACHE_ENTRIES 1024
+
+SrsMp4IndexCache *_srs_mp4_index_cache = NULL;
+
+SrsMp4SampleIndex::SrsMp4SampleIndex()
+{
+    file_size_ = 0;
+    file_mtime_ = 0;
+    video_tbn_ = 0;
+    audio_tbn_ = 0;
+}
+
+SrsMp4SampleIndex::~SrsMp4SampleIndex()
+{
+}
+
+srs_error_t SrsMp4SampleIndex::build(ISrsReadSeeker *rs)
+{
+    srs_error_t err = srs_success;
+
+    SrsMp4BoxReader br;
+    if ((err = br.initialize(rs)) != srs_success) {
+        return srs_error_wrap(err, "init box reader");
+    }
+
+    // Load boxes until the moov, only decode the ftyp and moov, and the header of mdat to skip it.
+    SrsSimpleStream stream;
+    while (true) {
+        SrsMp4Box *box_raw = NULL;
+        if ((err = br.read(&stream, &box_raw)) != srs_success) {
+            return srs_error_wrap(err, "read box");
+        }
+        SrsUniquePtr<SrsMp4Box> box(box_raw);
+
+        if (box->is_ftyp() || box->is_moov() || box->is_mdat()) {
+            SrsBuffer buffer(stream.bytes(), stream.length());
+            if ((err = box->decode(&buffer)) != srs_success) {
+                return srs_error_wrap(err, "decode box");
+            }
+        }
+
+        if (box->is_ftyp()) {
+            ftyp_.assign(stream.bytes(), (int)box->sz());
+        } else if (box->is_moov()) {
+            if (ftyp_.empty()) {
+                return srs_error_new(ERROR_MP4_BOX_ILLEGAL_SCHEMA, "missing ftyp");
+            }
+
+            SrsMp4MovieBox *moov = dynamic_cast<SrsMp4MovieBox *>(box.get());
+            if ((err = parse_moov(moov)) != srs_success) {
+                return srs_error_wrap(err, "parse moov");
+            }
+            break;
+        }
+
+        if ((err = br.skip(box.get(), &stream)) != srs_success) {
+            return srs_error_wrap(err, "skip box");
+        }
+    }
+
+    build_seek_points();
+
+    return err;
+}
+
+void SrsMp4SampleIndex::encode(string &data)
+{
+    int nn = (int)offsets_.size();
+    int size = SRS_MP4_INDEX_HEADER_SIZE + (int)ftyp_.size() + (int)moov_.size() + nn * SRS_MP4_INDEX_SAMPLE_SIZE;
+
+    SrsUniquePtr<char[]> buf(new char[size]);
+    SrsBuffer b(buf.get(), size);
+
+    b.write_4bytes(SRS_MP4_INDEX_MAGIC);
+    b.write_4bytes(SRS_MP4_INDEX_VERSION);
+    b.write_8bytes(file_size_);
+    b.write_8bytes(file_mtime_);
+    b.write_4bytes((int32_t)video_tbn_);
+    b.write_4bytes((int32_t)audio_tbn_);
+    b.write_4bytes((int32_t)ftyp_.size());
+    b.write_4bytes((int32_t)moov_.size());
+    b.write_4bytes(nn);
+    b.write_string(ftyp_);
+    b.write_string(moov_);
+
+    for (int i = 0; i < nn; i++) {
+        b.write_8bytes((int64_t)offsets_[i]);
+    }
+    for (int i = 0; i < nn; i++) {
+        b.write_4bytes((int32_t)sizes_[i]);
+    }
+    for (int i = 0; i < nn; i++) {
+        b.write_8bytes((int64_t)dts_[i]);
+    }
+    for (int i = 0; i < nn; i++) {
+        b.write_4bytes(cts_[i]);
+    }
+    for (int i = 0; i < nn; i++) {
+        b.write_1bytes((int8_t)flags_[i]);
+    }
+
+    data.assign(buf.get(), size);
+}
+
+srs_error_t SrsMp4SampleIndex::decode(const char *data, int size)
+{
+    srs_error_t err = srs_success;
+
+    SrsBuffer b((char *)data, size);
+    if (!b.require(SRS_MP4_INDEX_HEADER_SIZE)) {
+        return srs_error_new(ERROR_MP4_ILLEGAL_INDEX, "requires %d only %d bytes", SRS_MP4_INDEX_HEADER_SIZE, size);
+    }
+
+    uint32_t magic = (uint32_t)b.read_4bytes();
+    uint32_t version = (uint32_t)b.read_4bytes();
+    if (magic != SRS_MP4_INDEX_MAGIC || version != SRS_MP4_INDEX_VERSION) {
+        return srs_error_new(ERROR_MP4_ILLEGAL_INDEX, "magic=%#x, version=%d", magic, version);
+    }
+
+    file_size_ = b.read_8bytes();
+    file_mtime_ = b.read_8bytes();
+    video_tbn_ = (uint32_t)b.read_4bytes();
+    audio_tbn_ = (uint32_t)b.read_4bytes();
+
+    int nb_ftyp = b.read_4bytes();
+    int nb_moov = b.read_4bytes();
+    int nn = b.read_4bytes();
+    if (nb_ftyp <= 0 || nb_moov <= 0 || nn < 0) {
+        return srs_error_new(ERROR_MP4_ILLEGAL_INDEX, "ftyp=%d, moov=%d, samples=%d", nb_ftyp, nb_moov, nn);
+    }
+    if (!b.require(nb_ftyp + nb_moov) || (b.left() - nb_ftyp - nb_moov) / SRS_MP4_INDEX_SAMPLE_SIZE < nn) {
+        return srs_error_new(ERROR_MP4_ILLEGAL_INDEX, "ftyp=%d, moov=%d, samples=%d, left %d bytes", nb_ftyp, nb_moov, nn, b.left());
+    }
+
+    ftyp_ = b.read_string(nb_ftyp);
+    moov_ = b.read_string(nb_moov);
+
+    offsets_.resize(nn);
+    sizes_.resize(nn);
+    dts_.resize(nn);
+    cts_.resize(nn);
+    flags_.resize(nn);
+
+    for (int i = 0; i < nn; i++) {
+        offsets_[i] = (uint64_t)b.read_8bytes();
+    }
+    for (int i = 0; i < nn; i++) {
+        sizes_[i] = (uint32_t)b.read_4bytes();
+    }
+    for (int i = 0; i < nn; i++) {
+        dts_[i] = (uint64_t)b.read_8bytes();
+    }
+    for (int i = 0; i < nn; i++) {
+        cts_[i] = b.read_4bytes();
+    }
+    for (int i = 0; i < nn; i++) {
+        flags_[i] = (uint8_t)b.read_1bytes();
+    }
+
+    build_seek_points();
+
+    return err;
+}
+
+int64_t SrsMp4SampleIndex::seek(srs_utime_t time)
+{
+    int pos = seek_point(time);
+    return (pos < 0) ? -1 : (int64_t)offsets_[pos];
+}
+
+srs_error_t SrsMp4SampleIndex::rewrite(srs_utime_t time, string &header, int64_t *pstart, int64_t *pend)
+{
+    srs_error_t err = srs_success;
+
+    int pos = seek_point(time);
+    if (pos < 0) {
+        return srs_error_new(ERROR_MP4_ILLEGAL_INDEX, "no sample");
+    }
+
+    // Keep the samples of track since the seek point, and the audio samples not before the video
+    // keyframe. The samples of a track are ordered by both offset and dts.
+    bool video = (flags_[pos] & SRS_MP4_INDEX_FLAG_VIDEO) != 0;
+    uint32_t start_ms = dts_ms(pos);
+
+    vector<int> samples;
+    uint64_t start = offsets_[pos], end = 0;
+    for (int i = 0; i < (int)offsets_.size(); i++) {
+        bool is_video = (flags_[i] & SRS_MP4_INDEX_FLAG_VIDEO) != 0;
+        if ((video && !is_video) ? dts_ms(i) < start_ms : offsets_[i] < offsets_[pos]) {
+            continue;
+        }
+
+        samples.push_back(i);
+        start = srs_min(start, offsets_[i]);
+        end = srs_max(end, offsets_[i] + sizes_[i]);
+    }
+
+    // Decode the moov without sample tables, which is encoded when built.
+    SrsMp4Box *box_raw = NULL;
+    if (true) {
+        SrsBuffer b((char *)moov_.data(), (int)moov_.size());
+        if ((err = SrsMp4Box::discovery(&b, &box_raw)) != srs_success) {
+            return srs_error_wrap(err, "discovery moov");
+        }
+    }
+    SrsUniquePtr<SrsMp4Box> box(box_raw);
+
+    SrsBuffer b((char *)moov_.data(), (int)moov_.size());
+    if ((err = box->decode(&b)) != srs_success) {
+        return srs_error_wrap(err, "decode moov");
+    }
+
+    SrsMp4MovieBox *moov = dynamic_cast<SrsMp4MovieBox *>(box.get());
+    if (!moov) {
+        return srs_error_new(ERROR_MP4_ILLEGAL_INDEX, "invalid moov");
+    }
+
+    trim(moov, samples);
+
+    // The offsets of samples depend on the size of moov, while the moov is larger when the offsets
+    // exceed 32 bits, so write the sample tables until the size is stable.
+    uint64_t nb_data = end - start;
+    int nb_mdat_header = (nb_data + 8 > UINT32_MAX) ? 16 : 8;
+    uint64_t nb_moov = 0;
+    for (int i = 0; i < 3; i++) {
+        int64_t shift = (int64_t)(ftyp_.size() + nb_moov + nb_mdat_header) - (int64_t)start;
+        if ((err = write_samples(moov, samples, shift)) != srs_success) {
+            return srs_error_wrap(err, "write samples");
+        }
+
+        if (moov->nb_bytes() == nb_moov) {
+            break;
+        }
+        nb_moov = moov->nb_bytes();
+    }
+
+    if (moov->nb_bytes() != nb_moov) {
+        return srs_error_new(ERROR_MP4_ILLEGAL_INDEX, "unstable moov size %d", (int)moov->nb_bytes());
+    }
+
+    int size = (int)(ftyp_.size() + nb_moov + nb_mdat_header);
+    SrsUniquePtr<char[]> buf(new char[size]);
+    SrsBuffer hb(buf.get(), size);
+
+    hb.write_string(ftyp_);
+    if ((err = moov->encode(&hb)) != srs_success) {
+        return srs_error_wrap(err, "encode moov");
+    }
+
+    if (nb_mdat_header == 8) {
+        hb.write_4bytes((int32_t)(nb_data + 8));
+        hb.write_4bytes(SrsMp4BoxTypeMDAT);
+    } else {
+        hb.write_4bytes(1);
+        hb.write_4bytes(SrsMp4BoxTypeMDAT);
+        hb.write_8bytes((int64_t)(nb_data + 16));
+    }
+
+    header.assign(buf.get(), size);
+    *pstart = (int64_t)start;
+    *pend = (int64_t)end;
+
+    return err;
+}
+
+int SrsMp4SampleIndex::nn_samples()
+{
+    return (int)offsets_.size();
+}
+
+uint32_t SrsMp4SampleIndex::dts_ms(int i)
+{
+    uint32_t tbn = (flags_[i] & SRS_MP4_INDEX_FLAG_VIDEO) ? video_tbn_ : audio_tbn_;
+    return tbn ? (uint32_t)(dts_[i] * 1000 / tbn) : 0;
+}
+
+void SrsMp4SampleIndex::build_seek_points()
+{
+    seek_points_.clear();
+
+    bool has_video = false;
+    for (int i = 0; i < (int)flags_.size() && !has_video; i++) {
+        has_video = (flags_[i] & SRS_MP4_INDEX_FLAG_VIDEO) != 0;
+    }
+
+    // The samples of a track are ordered by both offset and dts, so the seek points are ordered.
+    for (int i = 0; i < (int)flags_.size(); i++) {
+        uint8_t flags = flags_[i];
+        if (!has_video || ((flags & SRS_MP4_INDEX_FLAG_VIDEO) && (flags & SRS_MP4_INDEX_FLAG_KEYFRAME))) {
+            seek_points_.push_back(i);
+        }
+    }
+}
+
+int SrsMp4SampleIndex::seek_point(srs_utime_t time)
+{
+    if (seek_points_.empty()) {
+        return -1;
+    }
+
+    // Binary search the first seek point after the time.
+    uint32_t ms = (uint32_t)srsu2ms(time);
+    int left = 0, right = (int)seek_points_.size();
+    while (left < right) {
+        int mid = left + (right - left) / 2;
+        if (dts_ms(seek_points_[mid]) <= ms) {
+            left = mid + 1;
+        } else {
+            right = mid;
+        }
+    }
+
+    // Start from the last seek point not after the time, or the first one.
+    return seek_points_[srs_max(0, left - 1)];
+}
+
+srs_error_t SrsMp4SampleIndex::parse_moov(SrsMp4MovieBox *moov)
+{
+    srs_error_t err = srs_success;
+
+    SrsMp4TrackBox *vide = moov->video();
+    SrsMp4TrackBox *soun = moov->audio();
+    if (!vide && !soun) {
+        return srs_error_new(ERROR_MP4_ILLEGAL_MOOV, "missing audio and video track");
+    }
+
+    // The fragmented MP4, or the tracks which we can't rewrite, are not supported.
+    if (moov->mvex() || moov->nb_vide_tracks() > 1 || moov->nb_soun_tracks() > 1) {
+        return srs_error_new(ERROR_MP4_ILLEGAL_MOOV, "unsupported tracks, video=%d, audio=%d", moov->nb_vide_tracks(), moov->nb_soun_tracks());
+    }
+
+    SrsMp4TrackBox *traks[] = {vide, soun};
+    for (int i = 0; i < 2; i++) {
+        SrsMp4TrackBox *trak = traks[i];
+        if (trak && (!trak->mdhd() || !trak->tkhd() || !trak->stbl())) {
+            return srs_error_new(ERROR_MP4_ILLEGAL_MOOV, "missing mdhd, tkhd or stbl");
+        }
+    }
+
+    video_tbn_ = vide ? vide->mdhd()->timescale_ : 0;
+    audio_tbn_ = soun ? soun->mdhd()->timescale_ : 0;
+
+    SrsMp4SampleManager sm;
+    if ((err = sm.load(moov)) != srs_success) {
+        return srs_error_wrap(err, "load samples");
+    }
+
+    for (int i = 0; i < (int)sm.samples_.size(); i++) {
+        SrsMp4Sample *sample = sm.samples_[i];
+
+        uint8_t flags = 0;
+        if (sample->type_ == SrsFrameTypeVideo) {
+            flags |= SRS_MP4_INDEX_FLAG_VIDEO;
+            if (sample->frame_type_ == SrsVideoAvcFrameTypeKeyFrame) {
+                flags |= SRS_MP4_INDEX_FLAG_KEYFRAME;
+            }
+        }
+
+        offsets_.push_back((uint64_t)sample->offset_);
+        sizes_.push_back(sample->nb_data_);
+        dts_.push_back(sample->dts_);
+        cts_.push_back((int32_t)(sample->pts_ - sample->dts_));
+        flags_.push_back(flags);
+    }
+
+    // Remove the sample tables, which are written for the samples to play when seeking.
+    for (int i = 0; i < 2; i++) {
+        SrsMp4SampleTableBox *stbl = traks[i] ? traks[i]->stbl() : NULL;
+        if (stbl) {
+            stbl->remove(SrsMp4BoxTypeSTTS);
+            stbl->remove(SrsMp4BoxTypeCTTS);
+            stbl->remove(SrsMp4BoxTypeSTSS);
+            stbl->remove(SrsMp4BoxTypeSTSC);
+            stbl->remove(SrsMp4BoxTypeSTSZ);
+            stbl->remove(SrsMp4BoxTypeSTCO);
+            stbl->remove(SrsMp4BoxTypeCO64);
+        }
+    }
+
+    int nb_moov = (int)moov->nb_bytes();
+    SrsUniquePtr<char[]> buf(new char[nb_moov]);
+    SrsBuffer b(buf.get(), nb_moov);
+    if ((err = moov->encode(&b)) != srs_success) {
+        return srs_error_wrap(err, "encode moov");
+    }
+    moov_.assign(buf.get(), nb_moov);
+
+    return err;
+}
+
+void SrsMp4SampleIndex::trim(SrsMp4MovieBox *moov, vector<int> &samples)
+{
+    SrsMp4MovieHeaderBox *mvhd = moov->mvhd();
+    SrsMp4TrackBox *traks[] = {moov->video(), moov->audio()};
+
+    uint64_t duration = 0;
+    for (int i = 0; i < 2; i++) {
+        SrsMp4TrackBox *trak = traks[i];
+        if (!trak) {
+            continue;
+        }
+
+        // The first sample of track, to trim the duration before it.
+        bool is_video = (trak == moov->video());
+        int first = -1;
+        for (int j = 0; j < (int)samples.size() && first < 0; j++) {
+            if (((flags_[samples[j]] & SRS_MP4_INDEX_FLAG_VIDEO) != 0) == is_video) {
+                first = samples[j];
+            }
+        }
+
+        SrsMp4MediaHeaderBox *mdhd = trak->mdhd();
+        if (first < 0 || mdhd->duration_ < dts_[first]) {
+            mdhd->duration_ = 0;
+        } else {
+            mdhd->duration_ -= dts_[first];
+        }
+
+        SrsMp4TrackHeaderBox *tkhd = trak->tkhd();
+        tkhd->duration_ = mdhd->timescale_ ? mdhd->duration_ * mvhd->timescale_ / mdhd->timescale_ : 0;
+        duration = srs_max(duration, tkhd->duration_);
+
+        // The edit list maps the whole track, so update the duration, or remove the complex one.
+        SrsMp4Box *edts = trak->get(SrsMp4BoxTypeEDTS);
+        SrsMp4EditListBox *elst = edts ? dynamic_cast<SrsMp4EditListBox *>(edts->get(SrsMp4BoxTypeELST)) : NULL;
+        if (elst && elst->entries_.size() == 1 && elst->entries_[0].media_time_ >= 0) {
+            elst->entries_[0].segment_duration_ = tkhd->duration_;
+        } else if (edts) {
+            trak->remove(SrsMp4BoxTypeEDTS);
+        }
+    }
+
+    mvhd->duration_in_tbn_ = duration;
+}
+
+srs_error_t SrsMp4SampleIndex::write_samples(SrsMp4MovieBox *moov, vector<int> &samples, int64_t shift)
+{
+    srs_error_t err = srs_success;
+
+    // The manager only replaces the box of the same type, so remove the optional tables.
+    SrsMp4TrackBox *traks[] = {moov->video(), moov->audio()};
+    for (int i = 0; i < 2; i++) {
+        SrsMp4SampleTableBox *stbl = traks[i] ? traks[i]->stbl() : NULL;
+        if (stbl) {
+            stbl->remove(SrsMp4BoxTypeCTTS);
+            stbl->remove(SrsMp4BoxTypeSTCO);
+            stbl->remove(SrsMp4BoxTypeCO64);
+        }
+    }
+
+    SrsMp4SampleManager sm;
+    uint32_t nn_video = 0, nn_audio = 0;
+    for (int i = 0; i < (int)samples.size(); i++) {
+        int pos = samples[i];
+        bool is_video = (flags_[pos] & SRS_MP4_INDEX_FLAG_VIDEO) != 0;
+
+        SrsMp4Sample *sample = new SrsMp4Sample();
+        sample->type_ = is_video ? SrsFrameTypeVideo : SrsFrameTypeAudio;
+        sample->offset_ = (off_t)((int64_t)offsets_[pos] + shift);
+        sample->index_ = is_video ? nn_video++ : nn_audio++;
+        sample->tbn_ = is_video ? video_tbn_ : audio_tbn_;
+        sample->dts_ = dts_[pos];
+        sample->pts_ = dts_[pos] + cts_[pos];
+        sample->nb_data_ = sizes_[pos];
+        if (is_video) {
+            bool keyframe = (flags_[pos] & SRS_MP4_INDEX_FLAG_KEYFRAME) != 0;
+            sample->frame_type_ = keyframe ? SrsVideoAvcFrameTypeKeyFrame : SrsVideoAvcFrameTypeInterFrame;
+        }
+
+        // Never use append, which adjusts the dts for A/V sync of DVR.
+        sm.samples_.push_back(sample);
+    }
+
+    if ((err = sm.write(moov)) != srs_success) {
+        return srs_error_wrap(err, "write moov");
+    }
+
+    return err;
+}
+
+ISrsMp4IndexCache::ISrsMp4IndexCache()
+{
+}
+
+ISrsMp4IndexCache::~ISrsMp4IndexCache()
+{
+}
+
+SrsMp4IndexCache::SrsMp4IndexCache()
+{
+    max_entries_ = SRS_MP4_INDEX_CACHE_ENTRIES;
+
+    nn_hits_ = 0;
+    nn_loads_ = 0;
+    nn_builds_ = 0;
+    nn_evicts_ = 0;
+
+    async_io_ = _srs_async_io;
+}
+
+SrsMp4IndexCache::~SrsMp4IndexCache()
+{
+    std::map<std::string, SrsMp4SampleIndex *>::iterator it;
+    for (it = indexes_.begin(); it != indexes_.end(); ++it) {
+        SrsMp4SampleIndex *index = it->second;
+        srs_freep(index);
+    }
+    indexes_.clear();
+    positions_.clear();
+    lru_.clear();
+
+    async_io_ = NULL;
+}
+
+srs_error_t SrsMp4IndexCache::fetch(string path, SrsMp4SampleIndex **pindex)
+{
+    srs_error_t err = srs_success;
+
+    // Open by async I/O, to get the size and modify time of file.
+    SrsAsyncFileReader fr;
+    if ((err = fr.open(path)) != srs_success) {
+        return srs_error_wrap(err, "open %s", path.c_str());
+    }
+
+    std::map<std::string, SrsMp4SampleIndex *>::iterator it = indexes_.find(path);
+    if (it != indexes_.end()) {
+        SrsMp4SampleIndex *index = it->second;
+        if (index->file_size_ == fr.filesize() && index->file_mtime_ == fr.mtime()) {
+            nn_hits_++;
+            touch(path);
+            *pindex = index;
+            return err;
+        }
+
+        // The file is changed, for example, DVR to the same path again.
+        remove(path);
+    }
+
+    SrsMp4SampleIndex *index = NULL;
+    if ((err = load(path, &fr, &index)) != srs_success) {
+        return srs_error_wrap(err, "load index of %s", path.c_str());
+    }
+
+    // The other coroutine might load the same file, when we wait for the I/O.
+    remove(path);
+
+    indexes_[path] = index;
+    lru_.push_front(path);
+    positions_[path] = lru_.begin();
+
+    while ((int)lru_.size() > max_entries_) {
+        remove(lru_.back());
+        nn_evicts_++;
+    }
+
+    *pindex = index;
+    return err;
+}
+
+void SrsMp4IndexCache::dumps(SrsJsonObject *obj)
+{
+    obj->set("entries", SrsJsonAny::integer((int64_t)indexes_.size()));
+    obj->set("hits", SrsJsonAny::integer(nn_hits_));
+    obj->set("loads", SrsJsonAny::integer(nn_loads_));
+    obj->set("builds", SrsJsonAny::integer(nn_builds_));
+    obj->set("evicts", SrsJsonAny::integer(nn_evicts_));
+}
+
+srs_error_t SrsMp4IndexCache::load(string path, SrsAsyncFileReader *fr, SrsMp4SampleIndex **pindex)
+{
+    srs_error_t err = srs_success;
+
+    int64_t size = fr->filesize();
+    int64_t mtime = fr->mtime();
+    string idx_path = path + ".idx";
+
+    // Load from the sidecar file, which is ignored if corrupt or stale.
+    if (true) {
+        SrsAsyncFileReader ir;
+        string data;
+        SrsMp4SampleIndex *index = new SrsMp4SampleIndex();
+        if ((err = ir.open(idx_path)) == srs_success && (err = srs_io_readall(&ir, data)) == srs_success && (err = index->decode(data.data(), (int)data.size())) == srs_success) {
+            if (index->file_size_ == size && index->file_mtime_ == mtime) {
+                nn_loads_++;
+                *pindex = index;
+                return err;
+            }
+        }
+        srs_freep(index);
+        srs_freep(err);
+    }
+
+    // Build the index by parsing the moov of MP4 file.
+    SrsMp4SampleIndex *index = new SrsMp4SampleIndex();
+    if ((err = index->build(fr)) != srs_success) {
+        srs_freep(index);
+        return srs_error_wrap(err, "build index");
+    }
+    index->file_size_ = size;
+    index->file_mtime_ = mtime;
+
+    // Use different temporary file, for the same file might be built by other coroutine.
+    string tmp_path = srs_fmt_sprintf("%s.%" PRId64 ".tmp", idx_path.c_str(), nn_builds_++);
+
+    // Persist the sidecar file, ignore the error because the dir might be read-only.
+    string data;
+    index->encode(data);
+
+    SrsAsyncFileWriter fw;
+    if ((err = fw.open(tmp_path)) == srs_success && (err = fw.write((void *)data.data(), data.size(), NULL)) == srs_success) {
+        fw.close();
+        err = async_io_->rename(tmp_path, idx_path);
+    }
+    if (err != srs_success) {
+        srs_warn("ignore mp4 index file %s, err %s", idx_path.c_str(), srs_error_desc(err).c_str());
+        srs_freep(err);
+    }
+
+    srs_trace("mp4 index %s, samples=%d, size=%" PRId64, path.c_str(), index->nn_samples(), size);
+
+    *pindex = index;
+    return err;
+}
+
+void SrsMp4IndexCache::touch(string path)
+{
+    std::map<std::string, std::list<std::string>::iterator>::iterator it = positions_.find(path);
+    if (it != positions_.end()) {
+        lru_.splice(lru_.begin(), lru_, it->second);
+    }
+}
+
+void SrsMp4IndexCache::remove(string path)
+{
+    std::map<std::string, SrsMp4SampleIndex *>::iterator it = indexes_.find(path);
+    if (it != indexes_.end()) {
+        SrsMp4SampleIndex *index = it->second;
+        srs_freep(index);
+        indexes_.erase(it);
+    }
+
+    std::map<std::string, std::list<std::string>::iterator>::iterator pos = positions_.find(path);
+    if (pos != positions_.end()) {
+        lru_.erase(pos->second);
+        positions_.erase(pos);
+    }
+}
@@ -0,0 +1,165 @@
+//
+// Copyright (c) 2013-2025 The SRS Authors
+//
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef SRS_APP_MP4_INDEX_HPP
+#define SRS_APP_MP4_INDEX_HPP
+
+#include <srs_core.hpp>
+
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+
+class ISrsReadSeeker;
+class ISrsAsyncIo;
+class SrsAsyncFileReader;
+class SrsJsonObject;
+class SrsMp4MovieBox;
+
+// The flags of sample in index.
+#define SRS_MP4_INDEX_FLAG_VIDEO 0x01
+#define SRS_MP4_INDEX_FLAG_KEYFRAME 0x02
+
+// The sample index of MP4 file, to seek by time without parsing the moov. The samples are kept in
+// arrays ordered by offset, with the ftyp and the moov without sample tables, which is also the
+// layout of the sidecar index file:
+//      magic(4B, "SRSI"), version(4B), file size(8B), file mtime(8B), video tbn(4B), audio tbn(4B),
+//      ftyp size(4B), moov size(4B), count(4B), ftyp, moov,
+//      offsets(8B*count), sizes(4B*count), dts(8B*count), cts(4B*count), flags(1B*count)
+class SrsMp4SampleIndex
+{
+public:
+    // The size and modify time of MP4 file, the index is stale if changed.
+    int64_t file_size_;
+    int64_t file_mtime_;
+    // The timebase of video and audio track, 0 if no track.
+    uint32_t video_tbn_;
+    uint32_t audio_tbn_;
+    // The ftyp box, and the moov box without sample tables, to generate the header for seeking.
+    std::string ftyp_;
+    std::string moov_;
+    // The offset and size of samples in file.
+    std::vector<uint64_t> offsets_;
+    std::vector<uint32_t> sizes_;
+    // The dts in tbn of track, and the cts which is pts minus dts.
+    std::vector<uint64_t> dts_;
+    std::vector<int32_t> cts_;
+    // The flags of samples, see SRS_MP4_INDEX_FLAG_XXX.
+    std::vector<uint8_t> flags_;
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // The samples to start playing, ordered by dts, which are the video keyframes, or the audio
+    // samples if no video. It's built from the arrays, not stored in sidecar file.
+    std::vector<uint32_t> seek_points_;
+
+public:
+    SrsMp4SampleIndex();
+    virtual ~SrsMp4SampleIndex();
+
+public:
+    // Build the index by parsing the ftyp and moov of MP4, only for the MP4 with at most one video
+    // and one audio track.
+    virtual srs_error_t build(ISrsReadSeeker *rs);
+    // Encode the index to data of sidecar file.
+    virtual void encode(std::string &data);
+    // Decode the index from data of sidecar file.
+    virtual srs_error_t decode(const char *data, int size);
+    // Get the offset of sample to start playing at time, which is the last seek point not after
+    // the time. Return -1 if no sample.
+    virtual int64_t seek(srs_utime_t time);
+    // Generate the MP4 to start playing at time, which is the header and the [start, end) of the
+    // file. The header is the ftyp, the moov with sample tables of the samples from the seek point,
+    // and the header of mdat. The offsets of samples are shifted to the data after the header.
+    // @remark The audio samples before the seek point are dropped, so the audio might start a bit
+    //      later than the video, at most the duration of an audio frame.
+    virtual srs_error_t rewrite(srs_utime_t time, std::string &header, int64_t *pstart, int64_t *pend);
+    virtual int nn_samples();
+    // Get the dts in milliseconds of sample.
+    virtual uint32_t dts_ms(int i);
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    void build_seek_points();
+    // Get the position in arrays of the seek point for time, -1 if no sample.
+    int seek_point(srs_utime_t time);
+    srs_error_t parse_moov(SrsMp4MovieBox *moov);
+    // Update the durations of moov, for the samples at the positions in arrays.
+    void trim(SrsMp4MovieBox *moov, std::vector<int> &samples);
+    // Write the sample tables of moov, for the samples at the positions in arrays, whose offsets
+    // are shifted by the shift.
+    srs_error_t write_samples(SrsMp4MovieBox *moov, std::vector<int> &samples, int64_t shift);
+};
+
+// The interface for MP4 index cache.
+class ISrsMp4IndexCache
+{
+public:
+    ISrsMp4IndexCache();
+    virtual ~ISrsMp4IndexCache();
+
+public:
+    // Fetch the index of MP4 file, which is loaded from sidecar file or built by parsing the moov
+    // if not cached or file changed.
+    // @remark The index is owned by the cache, user should never free it, and it's only valid
+    //      before the coroutine yields, because the other coroutines might evict it.
+    virtual srs_error_t fetch(std::string path, SrsMp4SampleIndex **pindex) = 0;
+};
+
+// The LRU cache of MP4 sample index, so the time seeking of VOD MP4 is resolved by binary search,
+// without parsing the moov for each request. The index is also persisted in sidecar file, which
+// is the path of MP4 with .idx, so it's only built once for each file. The files are read and
+// written by async I/O, so a slow disk never blocks the ST thread.
+class SrsMp4IndexCache : public ISrsMp4IndexCache
+{
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    ISrsAsyncIo *async_io_;
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // The indexes, key is the fullpath of MP4 file.
+    std::map<std::string, SrsMp4SampleIndex *> indexes_;
+    // The LRU list of path, the most recently used is at front.
+    std::list<std::string> lru_;
+    // The position in LRU list of path, to move or remove it in O(1).
+    std::map<std::string, std::list<std::string>::iterator> positions_;
+    // The max number of indexes in cache.
+    int max_entries_;
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // The metrics for API.
+    int64_t nn_hits_;
+    // The indexes loaded from sidecar file.
+    int64_t nn_loads_;
+    // The indexes built by parsing the moov.
+    int64_t nn_builds_;
+    int64_t nn_evicts_;
+
+public:
+    SrsMp4IndexCache();
+    virtual ~SrsMp4IndexCache();
+
+public:
+    virtual srs_error_t fetch(std::string path, SrsMp4SampleIndex **pindex);
+
+public:
+    // Dump the metrics to json object.
+    virtual void dumps(SrsJsonObject *obj);
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    srs_error_t load(std::string path, SrsAsyncFileReader *fr, SrsMp4SampleIndex **pindex);
+    void touch(std::string path);
+    void remove(std::string path);
+};
+
+// The global MP4 index cache.
+extern SrsMp4IndexCache *_srs_mp4_index_cache;
+
+#endif
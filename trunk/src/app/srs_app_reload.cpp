@@ -23,4 +23,9 @@ srs_error_t ISrsReloadHandler::on_reload_vhost_chunk_size(string /*vhost*/)
 {
     return srs_success;
 }
+
+srs_error_t ISrsReloadHandler::on_reload_vhost_segment_cache(string /*vhost*/)
+{
+    return srs_success;
+}
 // LCOV_EXCL_STOP
@@ -21,6 +21,7 @@ public:
 
 public:
     virtual srs_error_t on_reload_vhost_chunk_size(std::string vhost);
+    virtual srs_error_t on_reload_vhost_segment_cache(std::string vhost);
 };
 
 #endif
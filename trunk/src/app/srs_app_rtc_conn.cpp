@@ -24,6 +24,7 @@ using namespace std;
 #include <srs_app_factory.hpp>
 #include <srs_app_http_api.hpp>
 #include <srs_app_http_hooks.hpp>
+#include <srs_app_listener.hpp>
 #include <srs_app_log.hpp>
 #include <srs_app_rtc_network.hpp>
 #include <srs_app_rtc_server.hpp>
@@ -34,6 +35,7 @@ using namespace std;
 #include <srs_app_statistic.hpp>
 #include <srs_app_stream_token.hpp>
 #include <srs_app_utility.hpp>
+#include <srs_app_workers.hpp>
 #include <srs_core_autofree.hpp>
 #include <srs_kernel_buffer.hpp>
 #include <srs_kernel_error.hpp>
@@ -189,6 +191,11 @@ srs_error_t SrsSecurityTransport::protect_rtp(void *packet, int *nb_cipher)
     return srtp_->protect_rtp(packet, nb_cipher);
 }
 
+srs_error_t SrsSecurityTransport::protect_rtps(iovec *iovs, int nn_iovs)
+{
+    return srtp_->protect_rtps(iovs, nn_iovs);
+}
+
 srs_error_t SrsSecurityTransport::protect_rtcp(void *packet, int *nb_cipher)
 {
     return srtp_->protect_rtcp(packet, nb_cipher);
@@ -217,6 +224,11 @@ srs_error_t SrsSemiSecurityTransport::protect_rtp(void *packet, int *nb_cipher)
     return srs_success;
 }
 
+srs_error_t SrsSemiSecurityTransport::protect_rtps(iovec *iovs, int nn_iovs)
+{
+    return srs_success;
+}
+
 srs_error_t SrsSemiSecurityTransport::protect_rtcp(void *packet, int *nb_cipher)
 {
     return srs_success;
@@ -282,6 +294,11 @@ srs_error_t SrsPlaintextTransport::protect_rtp(void *packet, int *nb_cipher)
     return srs_success;
 }
 
+srs_error_t SrsPlaintextTransport::protect_rtps(iovec *iovs, int nn_iovs)
+{
+    return srs_success;
+}
+
 srs_error_t SrsPlaintextTransport::protect_rtcp(void *packet, int *nb_cipher)
 {
     return srs_success;
@@ -717,19 +734,44 @@ srs_error_t SrsRtcPlayStream::cycle()
             continue;
         }
 
-        // Send-out the RTP packet and do cleanup
-        // @remark Note that the pkt might be set to NULL.
-        if ((err = send_packet(pkt)) != srs_success) {
+        // Drain a burst of packets from consumer, which are protected to the batch of
+        // connection, then sent out in as few syscalls as possible.
+        sender_->start_batch();
+
+        int nn_pkts = 0;
+        while (pkt) {
+            // Send-out the RTP packet and do cleanup
+            // @remark Note that the pkt might be set to NULL.
+            if ((err = send_packet(pkt)) != srs_success) {
+                uint32_t nn = 0;
+                if (epp->can_print(err, &nn)) {
+                    srs_warn("play send packets=%u, nn=%u/%u, err: %s", nn_pkts + 1, epp->nn_count_, nn, srs_error_desc(err).c_str());
+                }
+                srs_freep(err);
+            }
+
+            // Free the packet.
+            // @remark Note that the pkt might be set to NULL.
+            srs_freep(pkt);
+
+            nn_pkts++;
+
+            // Stop draining when thread is quit, and the pull of loop returns the error.
+            if ((err = trd_->pull()) != srs_success) {
+                srs_freep(err);
+                break;
+            }
+
+            consumer->dump_packet(&pkt);
+        }
+
+        if ((err = sender_->flush_batch()) != srs_success) {
             uint32_t nn = 0;
             if (epp->can_print(err, &nn)) {
-                srs_warn("play send packets=%u, nn=%u/%u, err: %s", 1, epp->nn_count_, nn, srs_error_desc(err).c_str());
+                srs_warn("play flush packets=%u, nn=%u/%u, err: %s", nn_pkts, epp->nn_count_, nn, srs_error_desc(err).c_str());
             }
             srs_freep(err);
         }
-
-        // Free the packet.
-        // @remark Note that the pkt might be set to NULL.
-        srs_freep(pkt);
     }
 }
 
@@ -998,15 +1040,17 @@ ISrsRtcPublishRtcpTimer::~ISrsRtcPublishRtcpTimer()
 SrsRtcPublishRtcpTimer::SrsRtcPublishRtcpTimer(ISrsRtcRtcpSender *sender) : sender_(sender)
 {
     lock_ = srs_mutex_new();
+    handle_ = new SrsTimerHandle(this);
 
     shared_timer_ = _srs_shared_timer;
 }
 
 SrsRtcPublishRtcpTimer::~SrsRtcPublishRtcpTimer()
 {
-    if (shared_timer_) {
+    // Free the handle to cancel the timer, after the running timer is done.
+    if (handle_) {
         SrsLocker(&lock_);
-        shared_timer_->timer1s()->unsubscribe(this);
+        srs_freep(handle_);
     }
     srs_mutex_destroy(lock_);
 
@@ -1015,7 +1059,7 @@ SrsRtcPublishRtcpTimer::~SrsRtcPublishRtcpTimer()
 
 srs_error_t SrsRtcPublishRtcpTimer::initialize()
 {
-    shared_timer_->timer1s()->subscribe(this);
+    shared_timer_->wheel()->schedule(handle_, 1 * SRS_UTIME_SECONDS);
 
     return srs_success;
 }
@@ -1063,6 +1107,7 @@ ISrsRtcPublishTwccTimer::~ISrsRtcPublishTwccTimer()
 SrsRtcPublishTwccTimer::SrsRtcPublishTwccTimer(ISrsRtcRtcpSender *sender) : sender_(sender)
 {
     lock_ = srs_mutex_new();
+    handle_ = new SrsTimerHandle(this);
 
     circuit_breaker_ = _srs_circuit_breaker;
     shared_timer_ = _srs_shared_timer;
@@ -1070,9 +1115,10 @@ SrsRtcPublishTwccTimer::SrsRtcPublishTwccTimer(ISrsRtcRtcpSender *sender) : send
 
 SrsRtcPublishTwccTimer::~SrsRtcPublishTwccTimer()
 {
-    if (shared_timer_) {
+    // Free the handle to cancel the timer, after the running timer is done.
+    if (handle_) {
         SrsLocker(&lock_);
-        shared_timer_->timer100ms()->unsubscribe(this);
+        srs_freep(handle_);
     }
     srs_mutex_destroy(lock_);
 
@@ -1082,7 +1128,7 @@ SrsRtcPublishTwccTimer::~SrsRtcPublishTwccTimer()
 
 srs_error_t SrsRtcPublishTwccTimer::initialize()
 {
-    shared_timer_->timer100ms()->subscribe(this);
+    shared_timer_->wheel()->schedule(handle_, 100 * SRS_UTIME_MILLISECONDS);
 
     return srs_success;
 }
@@ -2028,6 +2074,7 @@ ISrsRtcConnectionNackTimer::~ISrsRtcConnectionNackTimer()
 SrsRtcConnectionNackTimer::SrsRtcConnectionNackTimer(ISrsRtcConnectionNackTimerHandler *handler) : handler_(handler)
 {
     lock_ = srs_mutex_new();
+    handle_ = new SrsTimerHandle(this);
 
     shared_timer_ = _srs_shared_timer;
     circuit_breaker_ = _srs_circuit_breaker;
@@ -2035,9 +2082,10 @@ SrsRtcConnectionNackTimer::SrsRtcConnectionNackTimer(ISrsRtcConnectionNackTimerH
 
 SrsRtcConnectionNackTimer::~SrsRtcConnectionNackTimer()
 {
-    if (true) {
+    // Free the handle to cancel the timer, after the running timer is done.
+    if (handle_) {
         SrsLocker(&lock_);
-        shared_timer_->timer20ms()->unsubscribe(this);
+        srs_freep(handle_);
     }
     srs_mutex_destroy(lock_);
 
@@ -2047,7 +2095,7 @@ SrsRtcConnectionNackTimer::~SrsRtcConnectionNackTimer()
 
 srs_error_t SrsRtcConnectionNackTimer::initialize()
 {
-    shared_timer_->timer20ms()->subscribe(this);
+    shared_timer_->wheel()->schedule(handle_, 20 * SRS_UTIME_MILLISECONDS);
     return srs_success;
 }
 
@@ -2085,6 +2133,14 @@ SrsRtcConnection::SrsRtcConnection(ISrsExecRtcAsyncTask *exec, const SrsContextI
     cache_iov_->iov_len = kRtpPacketSize;
     cache_buffer_ = new SrsBuffer((char *)cache_iov_->iov_base, kRtpPacketSize);
 
+    batch_max_ = 0;
+    batch_gso_ = false;
+    batch_arena_ = NULL;
+    batch_iovs_ = NULL;
+    nn_batch_iovs_ = 0;
+    batching_ = false;
+    flushing_ = false;
+
     last_stun_time_ = 0;
     session_timeout_ = 0;
     disposing_ = false;
@@ -2102,6 +2158,7 @@ SrsRtcConnection::SrsRtcConnection(ISrsExecRtcAsyncTask *exec, const SrsContextI
     config_ = _srs_config;
     dtls_certificate_ = _srs_rtc_dtls_certificate;
     app_factory_ = _srs_app_factory;
+    workers_ = _srs_workers;
 }
 
 void SrsRtcConnection::assemble()
@@ -2143,6 +2200,9 @@ SrsRtcConnection::~SrsRtcConnection()
     }
     srs_freep(cache_buffer_);
 
+    srs_freepa(batch_arena_);
+    srs_freepa(batch_iovs_);
+
     srs_freep(req_);
     srs_freep(pli_epp_);
 
@@ -2154,6 +2214,7 @@ SrsRtcConnection::~SrsRtcConnection()
     config_ = NULL;
     dtls_certificate_ = NULL;
     app_factory_ = NULL;
+    workers_ = NULL;
 }
 
 void SrsRtcConnection::on_before_dispose(ISrsResource *c)
@@ -2368,6 +2429,9 @@ srs_error_t SrsRtcConnection::generate_local_sdp(SrsRtcUserConfig *ruc, SrsSdp &
             string udp_host;
             string udp_hostport = config_->get_rtc_server_listens().at(0);
             srs_net_split_for_listener(udp_hostport, udp_host, udp_port);
+
+            // For workers mode, the UDP port is exclusive for the worker which serves the session.
+            udp_port = workers_->exclusive_port(udp_port);
         }
 
         int tcp_port = 0;
@@ -2444,13 +2508,17 @@ srs_error_t SrsRtcConnection::initialize(ISrsRequest *r, bool dtls, bool srtp, s
 
     nack_enabled_ = config_->get_rtc_nack_enabled(req_->vhost_);
 
+    // The arena is allocated when start batch, only for players, so limit the size of it.
+    batch_max_ = srs_max(1, srs_min(SRS_UDP_MAX_MMSG, config_->get_rtc_server_sendmmsg()));
+    batch_gso_ = config_->get_rtc_server_gso();
+
     if ((err = timer_nack_->initialize()) != srs_success) {
         return srs_error_wrap(err, "initialize timer nack");
     }
 
-    srs_trace("RTC init session, user=%s, url=%s, encrypt=%u/%u, DTLS(role=%s, version=%s), timeout=%dms, nack=%d",
+    srs_trace("RTC init session, user=%s, url=%s, encrypt=%u/%u, DTLS(role=%s, version=%s), timeout=%dms, nack=%d, sendmmsg=%d, gso=%d",
               username.c_str(), r->get_stream_url().c_str(), dtls, srtp, cfg->dtls_role_.c_str(), cfg->dtls_version_.c_str(),
-              srsu2msi(session_timeout_), nack_enabled_);
+              srsu2msi(session_timeout_), nack_enabled_, batch_max_, batch_gso_);
 
     return err;
 }
@@ -2928,21 +2996,34 @@ srs_error_t SrsRtcConnection::do_send_packet(SrsRtpPacket *pkt)
 {
     srs_error_t err = srs_success;
 
-    // For this message, select the first iovec.
-    iovec *iov = cache_iov_;
+    // Protect the packet to the arena when batching. If the arena is being sent, for example, the
+    // NACK of another coroutine retransmits packets, we send the packet directly.
+    bool batch = batching_ && !flushing_ && batch_arena_;
+
+    // Send out the arena when it is full.
+    if (batch && nn_batch_iovs_ >= batch_max_) {
+        if ((err = do_flush_batch()) != srs_success) {
+            return srs_error_wrap(err, "flush batch");
+        }
+    }
+
+    // For this message, select the iovec in arena, or the first iovec.
+    iovec *iov = batch ? batch_iovs_ + nn_batch_iovs_ : cache_iov_;
+    SrsBuffer slot((char *)iov->iov_base, kRtpPacketSize);
+    SrsBuffer *buf = batch ? &slot : cache_buffer_;
     iov->iov_len = kRtpPacketSize;
-    cache_buffer_->skip(-1 * cache_buffer_->pos());
+    buf->skip(-1 * buf->pos());
 
     // Marshal packet to bytes in iovec.
     if (true) {
-        if ((err = pkt->encode(cache_buffer_)) != srs_success) {
+        if ((err = pkt->encode(buf)) != srs_success) {
             return srs_error_wrap(err, "encode packet");
         }
-        iov->iov_len = cache_buffer_->pos();
+        iov->iov_len = buf->pos();
     }
 
-    // Cipher RTP to SRTP packet.
-    if (true) {
+    // Cipher RTP to SRTP packet. When batching, the packets are ciphered by flush in one call.
+    if (!batch) {
         int nn_encrypt = (int)iov->iov_len;
         if ((err = networks_->available()->protect_rtp(iov->iov_base, &nn_encrypt)) != srs_success) {
             return srs_error_wrap(err, "srtp protect");
@@ -2959,6 +3040,12 @@ srs_error_t SrsRtcConnection::do_send_packet(SrsRtpPacket *pkt)
 
     ++_srs_pps_srtps->sugar_;
 
+    // The packet is sent by flush.
+    if (batch) {
+        nn_batch_iovs_++;
+        return err;
+    }
+
     if ((err = networks_->available()->write(iov->iov_base, iov->iov_len, NULL)) != srs_success) {
         srs_warn("RTC: Write %d bytes err %s", iov->iov_len, srs_error_desc(err).c_str());
         srs_freep(err);
@@ -2972,6 +3059,82 @@ srs_error_t SrsRtcConnection::do_send_packet(SrsRtpPacket *pkt)
     return err;
 }
 
+void SrsRtcConnection::start_batch()
+{
+    if (batch_max_ <= 1) {
+        return;
+    }
+
+    // Lazy allocate the arena, for only players need it.
+    if (!batch_arena_) {
+        batch_arena_ = new char[batch_max_ * kRtpPacketSize];
+        batch_iovs_ = new iovec[batch_max_];
+        for (int i = 0; i < batch_max_; i++) {
+            batch_iovs_[i].iov_base = batch_arena_ + i * kRtpPacketSize;
+            batch_iovs_[i].iov_len = 0;
+        }
+    }
+
+    batching_ = true;
+}
+
+srs_error_t SrsRtcConnection::flush_batch()
+{
+    srs_error_t err = srs_success;
+
+    // Ignore if arena is being sent by other coroutine, which stops batching when done.
+    if (flushing_) {
+        return err;
+    }
+
+    err = do_flush_batch();
+    batching_ = false;
+
+    return err;
+}
+
+srs_error_t SrsRtcConnection::do_flush_batch()
+{
+    srs_error_t err = srs_success;
+
+    int nn_iovs = nn_batch_iovs_;
+    if (!nn_iovs) {
+        return err;
+    }
+
+    // Cipher the burst of RTP packets to SRTP packets in one call.
+    if ((err = networks_->available()->protect_rtps(batch_iovs_, nn_iovs)) != srs_success) {
+        nn_batch_iovs_ = 0;
+        return srs_error_wrap(err, "srtp protect %d packets", nn_iovs);
+    }
+
+    // Use GSO only if all packets are in the same size, except the last one which might be smaller.
+    int gso_size = 0;
+    if (batch_gso_ && nn_iovs > 1) {
+        gso_size = (int)batch_iovs_[0].iov_len;
+        for (int i = 1; i < nn_iovs - 1 && gso_size; i++) {
+            if ((int)batch_iovs_[i].iov_len != gso_size) {
+                gso_size = 0;
+            }
+        }
+        if ((int)batch_iovs_[nn_iovs - 1].iov_len > gso_size) {
+            gso_size = 0;
+        }
+    }
+
+    // Note that the network might yield, so the arena is locked until sent.
+    flushing_ = true;
+    err = networks_->available()->sendmmsg(batch_iovs_, nn_iovs, gso_size);
+    flushing_ = false;
+    nn_batch_iovs_ = 0;
+
+    if (err != srs_success) {
+        return srs_error_wrap(err, "write %d packets", nn_iovs);
+    }
+
+    return err;
+}
+
 void SrsRtcConnection::set_all_tracks_status(std::string stream_uri, bool is_publish, bool status)
 {
     // For publishers.
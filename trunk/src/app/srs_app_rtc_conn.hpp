@@ -70,6 +70,7 @@ class ISrsRtcPublisherNegotiator;
 class SrsRtcPlayerNegotiator;
 class ISrsRtcPlayerNegotiator;
 class ISrsAppFactory;
+class ISrsWorkerManager;
 class ISrsCoroutine;
 class ISrsDtlsCertificate;
 class SrsRtcRecvTrack;
@@ -104,6 +105,9 @@ public:
     // Encrypt the packet(paintext) to cipher, which is aso the packet ptr.
     // The nb_cipher should be initialized to the size of cipher, with some paddings.
     virtual srs_error_t protect_rtp(void *packet, int *nb_cipher) = 0;
+    // Encrypt a batch of packets in place, each iovec is a packet, the iov_len is updated to the
+    // size of cipher, and each iovec should be large enough for the paddings.
+    virtual srs_error_t protect_rtps(iovec *iovs, int nn_iovs) = 0;
     virtual srs_error_t protect_rtcp(void *packet, int *nb_cipher) = 0;
     // Decrypt the packet(cipher) to plaintext, which is also the packet ptr.
     // The nb_plaintext should be initialized to the size of cipher.
@@ -135,6 +139,7 @@ public:
     // Encrypt the packet(paintext) to cipher, which is aso the packet ptr.
     // The nb_cipher should be initialized to the size of cipher, with some paddings.
     srs_error_t protect_rtp(void *packet, int *nb_cipher);
+    srs_error_t protect_rtps(iovec *iovs, int nn_iovs);
     srs_error_t protect_rtcp(void *packet, int *nb_cipher);
     // Decrypt the packet(cipher) to plaintext, which is also the packet ptr.
     // The nb_plaintext should be initialized to the size of cipher.
@@ -160,6 +165,7 @@ public:
 
 public:
     srs_error_t protect_rtp(void *packet, int *nb_cipher);
+    srs_error_t protect_rtps(iovec *iovs, int nn_iovs);
     srs_error_t protect_rtcp(void *packet, int *nb_cipher);
     srs_error_t unprotect_rtp(void *packet, int *nb_plaintext);
     srs_error_t unprotect_rtcp(void *packet, int *nb_plaintext);
@@ -187,6 +193,7 @@ public:
 
 public:
     srs_error_t protect_rtp(void *packet, int *nb_cipher);
+    srs_error_t protect_rtps(iovec *iovs, int nn_iovs);
     srs_error_t protect_rtcp(void *packet, int *nb_cipher);
     srs_error_t unprotect_rtp(void *packet, int *nb_plaintext);
     srs_error_t unprotect_rtcp(void *packet, int *nb_plaintext);
@@ -418,6 +425,8 @@ SRS_DECLARE_PRIVATE: // clang-format on
 SRS_DECLARE_PRIVATE: // clang-format on
     ISrsRtcRtcpSender *sender_;
     srs_mutex_t lock_;
+    // The handle in timing wheel of shared timer.
+    SrsTimerHandle *handle_;
 
 public:
     SrsRtcPublishRtcpTimer(ISrsRtcRtcpSender *sender);
@@ -455,6 +464,8 @@ SRS_DECLARE_PRIVATE: // clang-format on
 SRS_DECLARE_PRIVATE: // clang-format on
     ISrsRtcRtcpSender *sender_;
     srs_mutex_t lock_;
+    // The handle in timing wheel of shared timer.
+    SrsTimerHandle *handle_;
 
 public:
     SrsRtcPublishTwccTimer(ISrsRtcRtcpSender *sender);
@@ -696,6 +707,8 @@ SRS_DECLARE_PRIVATE: // clang-format on
 SRS_DECLARE_PRIVATE: // clang-format on
     ISrsRtcConnectionNackTimerHandler *handler_;
     srs_mutex_t lock_;
+    // The handle in timing wheel of shared timer.
+    SrsTimerHandle *handle_;
 
 public:
     SrsRtcConnectionNackTimer(ISrsRtcConnectionNackTimerHandler *handler);
@@ -787,6 +800,7 @@ SRS_DECLARE_PRIVATE: // clang-format on
     ISrsAppConfig *config_;
     ISrsDtlsCertificate *dtls_certificate_;
     ISrsAppFactory *app_factory_;
+    ISrsWorkerManager *workers_;
 
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
@@ -803,6 +817,20 @@ SRS_DECLARE_PRIVATE: // clang-format on
     iovec *cache_iov_;
     SrsBuffer *cache_buffer_;
 
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // The max packets to send in a batch, disable batch if not larger than 1.
+    int batch_max_;
+    // Whether send the batch by UDP GSO, when all packets are in the same size.
+    bool batch_gso_;
+    // The arena to store the protected packets, each packet is in a slot of kRtpPacketSize bytes.
+    char *batch_arena_;
+    iovec *batch_iovs_;
+    int nn_batch_iovs_;
+    // Whether batching the packets, and whether the arena is being sent.
+    bool batching_;
+    bool flushing_;
+
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
     // key: stream id
@@ -947,6 +975,8 @@ public:
     void simulate_nack_drop(int nn);
     void simulate_player_drop_packet(SrsRtpHeader *h, int nn_bytes);
     srs_error_t do_send_packet(SrsRtpPacket *pkt);
+    void start_batch();
+    srs_error_t flush_batch();
     // Directly set the status of play track, generally for init to set the default value.
     void set_all_tracks_status(std::string stream_uri, bool is_publish, bool status);
 
@@ -958,6 +988,7 @@ public:
 SRS_DECLARE_PRIVATE: // clang-format on
     srs_error_t create_player(ISrsRequest *request, std::map<uint32_t, SrsRtcTrackDescription *> sub_relations);
     srs_error_t create_publisher(ISrsRequest *request, SrsRtcSourceDescription *stream_desc);
+    srs_error_t do_flush_batch();
 };
 
 // Publisher negotiator interface.
@@ -115,6 +115,37 @@ void ssl_on_info(const SSL *dtls, int where, int ret)
 
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+bool srs_srtp_gcm_supported()
+{
+    static int supported = -1;
+    if (supported >= 0) {
+        return supported == 1;
+    }
+
+#ifdef SRTP_AEAD_AES_128_GCM
+    // The GCM cipher is only registered when libsrtp is built with OpenSSL, so we try to create it.
+    srtp_policy_t policy;
+    bzero(&policy, sizeof(policy));
+    srtp_crypto_policy_set_aes_gcm_128_16_auth(&policy.rtp);
+    srtp_crypto_policy_set_aes_gcm_128_16_auth(&policy.rtcp);
+    policy.ssrc.type = ssrc_any_outbound;
+    policy.window_size = 8192;
+
+    uint8_t key[SRTP_AES_GCM_128_KEY_LEN_WSALT] = {0};
+    policy.key = key;
+
+    srtp_t ctx = NULL;
+    supported = (srtp_create(&ctx, &policy) == srtp_err_status_ok) ? 1 : 0;
+    if (ctx) {
+        srtp_dealloc(ctx);
+    }
+#else
+    supported = 0;
+#endif
+
+    return supported == 1;
+}
+
 SSL_CTX *srs_build_dtls_ctx(SrsDtlsVersion version, std::string role)
 {
     SSL_CTX *dtls_ctx;
@@ -180,11 +211,16 @@ SSL_CTX *srs_build_dtls_ctx(SrsDtlsVersion version, std::string role)
         // @see https://www.openssl.org/docs/man1.0.2/man3/SSL_CTX_set_read_ahead.html
         SSL_CTX_set_read_ahead(dtls_ctx, 1);
 
-        // TODO: Maybe we can use SRTP-GCM in future.
+        // Prefer SRTP-GCM, which is AEAD by AES-NI of OpenSSL, much faster than AES-CM with HMAC-SHA1,
+        // because the DTLS server selects the first profile in its list that the client offers.
         // @see https://bugs.chromium.org/p/chromium/issues/detail?id=713701
         // @see https://groups.google.com/forum/#!topic/discuss-webrtc/PvCbWSetVAQ
-        // @remark Only support SRTP_AES128_CM_SHA1_80, please read ssl/d1_srtp.c
-        srs_assert(SSL_CTX_set_tlsext_use_srtp(dtls_ctx, "SRTP_AES128_CM_SHA1_80") == 0);
+        // @remark The GCM is only available when libsrtp is built with OpenSSL, please read ssl/d1_srtp.c
+        const char *profiles = "SRTP_AES128_CM_SHA1_80";
+        if (srs_srtp_gcm_supported()) {
+            profiles = "SRTP_AEAD_AES_128_GCM:SRTP_AES128_CM_SHA1_80";
+        }
+        srs_assert(SSL_CTX_set_tlsext_use_srtp(dtls_ctx, profiles) == 0);
     }
 
     return dtls_ctx;
@@ -677,9 +713,19 @@ srs_error_t SrsDtlsImpl::get_srtp_key(std::string &recv_key, std::string &send_k
 {
     srs_error_t err = srs_success;
 
+    // The salt of AEAD_AES_128_GCM is 12 bytes, see https://datatracker.ietf.org/doc/html/rfc7714#section-12
+    int salt_len = SRTP_MASTER_KEY_SALT_LEN;
+#ifdef SRTP_AEAD_AES_128_GCM
+    SRTP_PROTECTION_PROFILE *profile = SSL_get_selected_srtp_profile(dtls_);
+    if (profile && profile->id == SRTP_AEAD_AES_128_GCM) {
+        salt_len = SRTP_AEAD_SALT_LEN;
+    }
+#endif
+
     unsigned char material[SRTP_MASTER_KEY_LEN * 2] = {0}; // client(SRTP_MASTER_KEY_KEY_LEN + SRTP_MASTER_KEY_SALT_LEN) + server
+    int nn_material = (SRTP_MASTER_KEY_KEY_LEN + salt_len) * 2;
     static const string dtls_srtp_lable = "EXTRACTOR-dtls_srtp";
-    if (!SSL_export_keying_material(dtls_, material, sizeof(material), dtls_srtp_lable.c_str(), dtls_srtp_lable.size(), NULL, 0, 0)) {
+    if (!SSL_export_keying_material(dtls_, material, nn_material, dtls_srtp_lable.c_str(), dtls_srtp_lable.size(), NULL, 0, 0)) {
         return srs_error_new(ERROR_RTC_SRTP_INIT, "SSL export key r0=%lu", ERR_get_error());
     }
 
@@ -689,9 +735,9 @@ srs_error_t SrsDtlsImpl::get_srtp_key(std::string &recv_key, std::string &send_k
     offset += SRTP_MASTER_KEY_KEY_LEN;
     std::string server_master_key(reinterpret_cast<char *>(material + offset), SRTP_MASTER_KEY_KEY_LEN);
     offset += SRTP_MASTER_KEY_KEY_LEN;
-    std::string client_master_salt(reinterpret_cast<char *>(material + offset), SRTP_MASTER_KEY_SALT_LEN);
-    offset += SRTP_MASTER_KEY_SALT_LEN;
-    std::string server_master_salt(reinterpret_cast<char *>(material + offset), SRTP_MASTER_KEY_SALT_LEN);
+    std::string client_master_salt(reinterpret_cast<char *>(material + offset), salt_len);
+    offset += salt_len;
+    std::string server_master_salt(reinterpret_cast<char *>(material + offset), salt_len);
 
     if (is_dtls_client()) {
         recv_key = server_master_key + server_master_salt;
@@ -1025,11 +1071,15 @@ srs_error_t SrsSRTP::initialize(string recv_key, std::string send_key)
     srtp_policy_t policy;
     bzero(&policy, sizeof(policy));
 
-    // TODO: Maybe we can use SRTP-GCM in future.
-    // @see https://bugs.chromium.org/p/chromium/issues/detail?id=713701
-    // @see https://groups.google.com/forum/#!topic/discuss-webrtc/PvCbWSetVAQ
-    srtp_crypto_policy_set_aes_cm_128_hmac_sha1_80(&policy.rtp);
-    srtp_crypto_policy_set_aes_cm_128_hmac_sha1_80(&policy.rtcp);
+    // The profile negotiated by DTLS is identified by the length of master key and salt, which is 30
+    // bytes for SRTP_AES128_CM_SHA1_80, or 28 bytes for SRTP_AEAD_AES_128_GCM.
+    if (send_key.size() == SRTP_AES_GCM_128_KEY_LEN_WSALT) {
+        srtp_crypto_policy_set_aes_gcm_128_16_auth(&policy.rtp);
+        srtp_crypto_policy_set_aes_gcm_128_16_auth(&policy.rtcp);
+    } else {
+        srtp_crypto_policy_set_aes_cm_128_hmac_sha1_80(&policy.rtp);
+        srtp_crypto_policy_set_aes_cm_128_hmac_sha1_80(&policy.rtcp);
+    }
 
     policy.ssrc.value = 0;
     // TODO: adjust window_size
@@ -1078,6 +1128,29 @@ srs_error_t SrsSRTP::protect_rtp(void *packet, int *nb_cipher)
     return err;
 }
 
+srs_error_t SrsSRTP::protect_rtps(iovec *iovs, int nn_iovs)
+{
+    srs_error_t err = srs_success;
+
+    // If DTLS/SRTP is not ready, fail.
+    if (!send_ctx_) {
+        return srs_error_new(ERROR_RTC_SRTP_PROTECT, "not ready");
+    }
+
+    for (int i = 0; i < nn_iovs; i++) {
+        iovec *iov = iovs + i;
+
+        int nb_cipher = (int)iov->iov_len;
+        srtp_err_status_t r0 = srtp_err_status_ok;
+        if ((r0 = srtp_protect(send_ctx_, iov->iov_base, &nb_cipher)) != srtp_err_status_ok) {
+            return srs_error_new(ERROR_RTC_SRTP_PROTECT, "rtp protect %d/%d r0=%u", i, nn_iovs, r0);
+        }
+        iov->iov_len = (size_t)nb_cipher;
+    }
+
+    return err;
+}
+
 srs_error_t SrsSRTP::protect_rtcp(void *packet, int *nb_cipher)
 {
     srs_error_t err = srs_success;
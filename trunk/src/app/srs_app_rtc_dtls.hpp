@@ -12,6 +12,8 @@
 #include <string>
 #include <vector>
 
+#include <sys/uio.h>
+
 #include <openssl/ssl.h>
 #include <srtp2/srtp.h>
 
@@ -274,6 +276,9 @@ public:
 public:
     virtual srs_error_t initialize(std::string recv_key, std::string send_key) = 0;
     virtual srs_error_t protect_rtp(void *packet, int *nb_cipher) = 0;
+    // Protect a batch of RTP packets in place, each iovec is a packet, and the iov_len is updated
+    // to the size of cipher, so the packets of a burst are encrypted in one call.
+    virtual srs_error_t protect_rtps(iovec *iovs, int nn_iovs) = 0;
     virtual srs_error_t protect_rtcp(void *packet, int *nb_cipher) = 0;
     virtual srs_error_t unprotect_rtp(void *packet, int *nb_plaintext) = 0;
     virtual srs_error_t unprotect_rtcp(void *packet, int *nb_plaintext) = 0;
@@ -297,9 +302,14 @@ public:
 
 public:
     srs_error_t protect_rtp(void *packet, int *nb_cipher);
+    srs_error_t protect_rtps(iovec *iovs, int nn_iovs);
     srs_error_t protect_rtcp(void *packet, int *nb_cipher);
     srs_error_t unprotect_rtp(void *packet, int *nb_plaintext);
     srs_error_t unprotect_rtcp(void *packet, int *nb_plaintext);
 };
 
+// Whether libsrtp supports the SRTP_AEAD_AES_128_GCM, which requires libsrtp built with OpenSSL.
+// @remark Must be called after srtp_init.
+extern bool srs_srtp_gcm_supported();
+
 #endif
@@ -139,6 +139,11 @@ bool SrsRtcDummyNetwork::is_establelished()
     return true;
 }
 
+srs_error_t SrsRtcDummyNetwork::sendmmsg(iovec *iovs, int nn_iovs, int gso_size)
+{
+    return srs_success;
+}
+
 srs_error_t SrsRtcDummyNetwork::on_dtls_handshake_done()
 {
     return srs_success;
@@ -159,6 +164,11 @@ srs_error_t SrsRtcDummyNetwork::protect_rtp(void *packet, int *nb_cipher)
     return srs_success;
 }
 
+srs_error_t SrsRtcDummyNetwork::protect_rtps(iovec *iovs, int nn_iovs)
+{
+    return srs_success;
+}
+
 srs_error_t SrsRtcDummyNetwork::protect_rtcp(void *packet, int *nb_cipher)
 {
     return srs_success;
@@ -269,6 +279,11 @@ srs_error_t SrsRtcUdpNetwork::protect_rtp(void *packet, int *nb_cipher)
     return transport_->protect_rtp(packet, nb_cipher);
 }
 
+srs_error_t SrsRtcUdpNetwork::protect_rtps(iovec *iovs, int nn_iovs)
+{
+    return transport_->protect_rtps(iovs, nn_iovs);
+}
+
 srs_error_t SrsRtcUdpNetwork::protect_rtcp(void *packet, int *nb_cipher)
 {
     return transport_->protect_rtcp(packet, nb_cipher);
@@ -368,6 +383,18 @@ int SrsRtcUdpNetwork::get_peer_port()
     return sendonly_skt_->get_peer_port();
 }
 
+srs_error_t SrsRtcUdpNetwork::sendmmsg(iovec *iovs, int nn_iovs, int gso_size)
+{
+    // Update stat when we sending data.
+    int64_t nn_bytes = 0;
+    for (int i = 0; i < nn_iovs; i++) {
+        nn_bytes += iovs[i].iov_len;
+    }
+    delta_->add_delta(0, nn_bytes);
+
+    return sendonly_skt_->sendmmsg(iovs, nn_iovs, gso_size, SRS_UTIME_NO_TIMEOUT);
+}
+
 void SrsRtcUdpNetwork::update_sendonly_socket(ISrsUdpMuxSocket *skt)
 {
     // TODO: FIXME: Refine performance.
@@ -540,6 +567,11 @@ srs_error_t SrsRtcTcpNetwork::protect_rtp(void *packet, int *nb_cipher)
     return transport_->protect_rtp(packet, nb_cipher);
 }
 
+srs_error_t SrsRtcTcpNetwork::protect_rtps(iovec *iovs, int nn_iovs)
+{
+    return transport_->protect_rtps(iovs, nn_iovs);
+}
+
 srs_error_t SrsRtcTcpNetwork::protect_rtcp(void *packet, int *nb_cipher)
 {
     return transport_->protect_rtcp(packet, nb_cipher);
@@ -716,6 +748,21 @@ int SrsRtcTcpNetwork::get_peer_port()
     return peer_port_;
 }
 
+srs_error_t SrsRtcTcpNetwork::sendmmsg(iovec *iovs, int nn_iovs, int gso_size)
+{
+    srs_error_t err = srs_success;
+
+    // For TCP, each packet is framed by its size, so we send them one by one.
+    for (int i = 0; i < nn_iovs; i++) {
+        iovec *iov = iovs + i;
+        if ((err = write(iov->iov_base, iov->iov_len, NULL)) != srs_success) {
+            return srs_error_wrap(err, "write %d/%d", i, nn_iovs);
+        }
+    }
+
+    return err;
+}
+
 srs_error_t SrsRtcTcpNetwork::write(void *buf, size_t size, ssize_t *nwrite)
 {
     srs_error_t err = srs_success;
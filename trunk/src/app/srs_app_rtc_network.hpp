@@ -130,6 +130,8 @@ public:
 public:
     // Protect RTP packet by SRTP context.
     virtual srs_error_t protect_rtp(void *packet, int *nb_cipher) = 0;
+    // Protect a batch of RTP packets by SRTP context, each iovec is a packet.
+    virtual srs_error_t protect_rtps(iovec *iovs, int nn_iovs) = 0;
     // Protect RTCP packet by SRTP context.
     virtual srs_error_t protect_rtcp(void *packet, int *nb_cipher) = 0;
 
@@ -143,6 +145,11 @@ public:
 
 public:
     virtual bool is_establelished() = 0;
+
+public:
+    // Send a batch of packets, each iovec is a packet. For UDP, send by sendmmsg or GSO if gso_size is
+    // not zero, which requires all packets except the last one are gso_size bytes.
+    virtual srs_error_t sendmmsg(iovec *iovs, int nn_iovs, int gso_size) = 0;
 };
 
 // Dummy networks
@@ -162,6 +169,7 @@ public:
 
 public:
     virtual srs_error_t protect_rtp(void *packet, int *nb_cipher);
+    virtual srs_error_t protect_rtps(iovec *iovs, int nn_iovs);
     virtual srs_error_t protect_rtcp(void *packet, int *nb_cipher);
 
 public:
@@ -171,6 +179,7 @@ public:
 
 public:
     virtual bool is_establelished();
+    virtual srs_error_t sendmmsg(iovec *iovs, int nn_iovs, int gso_size);
     // Interface ISrsStreamWriter.
 public:
     virtual srs_error_t write(void *buf, size_t size, ssize_t *nwrite);
@@ -222,6 +231,7 @@ public:
     virtual srs_error_t on_dtls_alert(std::string type, std::string desc);
     srs_error_t on_dtls_handshake_done();
     srs_error_t protect_rtp(void *packet, int *nb_cipher);
+    srs_error_t protect_rtps(iovec *iovs, int nn_iovs);
     srs_error_t protect_rtcp(void *packet, int *nb_cipher);
     // When got data from socket.
 public:
@@ -235,6 +245,7 @@ public:
     // ICE reflexive address functions.
     std::string get_peer_ip();
     int get_peer_port();
+    virtual srs_error_t sendmmsg(iovec *iovs, int nn_iovs, int gso_size);
     // Interface ISrsStreamWriter.
 public:
     virtual srs_error_t write(void *buf, size_t size, ssize_t *nwrite);
@@ -276,6 +287,7 @@ public:
     virtual srs_error_t on_dtls_alert(std::string type, std::string desc);
     // Protect RTP packet by SRTP context.
     virtual srs_error_t protect_rtp(void *packet, int *nb_cipher);
+    virtual srs_error_t protect_rtps(iovec *iovs, int nn_iovs);
     // Protect RTCP packet by SRTP context.
     virtual srs_error_t protect_rtcp(void *packet, int *nb_cipher);
 
@@ -301,6 +313,7 @@ public:
     // ICE reflexive address functions.
     std::string get_peer_ip();
     int get_peer_port();
+    virtual srs_error_t sendmmsg(iovec *iovs, int nn_iovs, int gso_size);
     // Interface ISrsStreamWriter.
 public:
     virtual srs_error_t write(void *buf, size_t size, ssize_t *nwrite);
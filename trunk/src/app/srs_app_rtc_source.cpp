@@ -792,6 +792,8 @@ srs_error_t SrsRtcSource::on_rtp(SrsRtpPacket *pkt)
         return err;
     }
 
+    // Each consumer gets its own header to rewrite, while the payload and buffer are shared by
+    // all consumers without copy, see SrsRtpPacket::copy().
     for (int i = 0; i < (int)consumers_.size(); i++) {
         ISrsRtcConsumer *consumer = consumers_.at(i);
         if ((err = consumer->enqueue(pkt->copy())) != srs_success) {
@@ -1048,6 +1048,13 @@ public:
 
 public:
     virtual srs_error_t do_send_packet(SrsRtpPacket *pkt) = 0;
+
+public:
+    // Start to batch the packets, the do_send_packet only protects packets to a batch, which is
+    // sent out in as few syscalls as possible when flush_batch.
+    virtual void start_batch() = 0;
+    // Send out the batched packets and stop batching.
+    virtual srs_error_t flush_batch() = 0;
 };
 
 class SrsRtcSendTrack
@@ -234,6 +234,7 @@ SrsRtmpConn::SrsRtmpConn(ISrsRtmpTransport *transport, string cip, int cport)
     send_min_interval_ = 0;
     tcp_nodelay_ = false;
     info_ = new SrsClientInfo();
+    vconf_ = NULL;
 
     publish_1stpkt_timeout_ = 0;
     publish_normal_timeout_ = 0;
@@ -535,8 +536,8 @@ srs_error_t SrsRtmpConn::stream_service_cycle()
     // do token traverse before serve it.
     // @see https://github.com/ossrs/srs/pull/239
     if (true) {
-        info_->edge_ = config_->get_vhost_is_edge(req->vhost_);
-        bool edge_traverse = config_->get_vhost_edge_token_traverse(req->vhost_);
+        info_->edge_ = vhost_config()->is_edge_;
+        bool edge_traverse = vhost_config()->edge_token_traverse_;
 
         // LCOV_EXCL_START
         if (info_->edge_ && edge_traverse) {
@@ -580,8 +581,8 @@ srs_error_t SrsRtmpConn::stream_service_cycle()
     }
     srs_assert(live_source.get() != NULL);
 
-    bool enabled_cache = config_->get_gop_cache(req->vhost_);
-    int gcmf = config_->get_gop_cache_max_frames(req->vhost_);
+    bool enabled_cache = vhost_config()->gop_cache_;
+    int gcmf = vhost_config()->gop_cache_max_frames_;
     srs_trace("source url=%s, ip=%s, cache=%d/%d, is_edge=%d, source_id=%s/%s",
               req->get_stream_url().c_str(), ip_.c_str(), enabled_cache, gcmf, info_->edge_, live_source->source_id().c_str(),
               live_source->pre_source_id().c_str());
@@ -662,7 +663,11 @@ srs_error_t SrsRtmpConn::check_vhost(bool try_default_vhost)
         req->vhost_ = vhost->arg0();
     }
 
-    if (config_->get_refer_enabled(req->vhost_)) {
+    // Hold the compiled config of the resolved vhost, for the getters of this connection.
+    snapshot_ = config_->snapshot();
+    vconf_ = snapshot_->vhost(req->vhost_);
+
+    if (vhost_config()->refer_enabled_) {
         if ((err = refer_->check(req->pageUrl_, config_->get_refer_all(req->vhost_))) != srs_success) {
             return srs_error_wrap(err, "rtmp: referer check");
         }
@@ -675,6 +680,16 @@ srs_error_t SrsRtmpConn::check_vhost(bool try_default_vhost)
     return err;
 }
 
+SrsVhostSnapshot *SrsRtmpConn::vhost_config()
+{
+    if (!vconf_) {
+        snapshot_ = config_->snapshot();
+        vconf_ = snapshot_->vhost(info_->req_->vhost_);
+    }
+
+    return vconf_;
+}
+
 srs_error_t SrsRtmpConn::playing(SrsSharedPtr<SrsLiveSource> source)
 {
     srs_error_t err = srs_success;
@@ -686,7 +701,7 @@ srs_error_t SrsRtmpConn::playing(SrsSharedPtr<SrsLiveSource> source)
 
     // Check page referer of player.
     ISrsRequest *req = info_->req_;
-    if (config_->get_refer_enabled(req->vhost_)) {
+    if (vhost_config()->refer_enabled_) {
         if ((err = refer_->check(req->pageUrl_, config_->get_refer_play(req->vhost_))) != srs_success) {
             return srs_error_wrap(err, "rtmp: referer check");
         }
@@ -795,14 +810,14 @@ srs_error_t SrsRtmpConn::do_playing(SrsSharedPtr<SrsLiveSource> source, SrsLiveC
     int64_t starttime = -1;
 
     // setup the realtime.
-    realtime_ = config_->get_realtime_enabled(req->vhost_, false);
+    realtime_ = vhost_config()->realtime_enabled_;
     // setup the mw config.
     // when mw_sleep changed, resize the socket send buffer.
     mw_msgs_ = config_->get_mw_msgs(req->vhost_, realtime_, false);
     mw_sleep_ = config_->get_mw_sleep(req->vhost_);
     transport_->set_socket_buffer(mw_sleep_);
     // initialize the send_min_interval
-    send_min_interval_ = config_->get_send_min_interval(req->vhost_);
+    send_min_interval_ = vhost_config()->send_min_interval_;
 
     srs_trace("start play smi=%dms, mw_sleep=%d, mw_msgs=%d, realtime=%d, tcp_nodelay=%d",
               srsu2msi(send_min_interval_), srsu2msi(mw_sleep_), mw_msgs_, realtime_, tcp_nodelay_);
@@ -916,7 +931,7 @@ srs_error_t SrsRtmpConn::publishing(SrsSharedPtr<SrsLiveSource> source)
 
     ISrsRequest *req = info_->req_;
 
-    if (config_->get_refer_enabled(req->vhost_)) {
+    if (vhost_config()->refer_enabled_) {
         if ((err = refer_->check(req->pageUrl_, config_->get_refer_publish(req->vhost_))) != srs_success) {
             return srs_error_wrap(err, "rtmp: referer check");
         }
@@ -968,16 +983,16 @@ srs_error_t SrsRtmpConn::do_publishing(SrsSharedPtr<SrsLiveSource> source, SrsPu
     }
 
     // initialize the publish timeout.
-    publish_1stpkt_timeout_ = config_->get_publish_1stpkt_timeout(req->vhost_);
-    publish_normal_timeout_ = config_->get_publish_normal_timeout(req->vhost_);
-    srs_utime_t publish_kickoff_for_idle = config_->get_publish_kickoff_for_idle(req->vhost_);
+    publish_1stpkt_timeout_ = vhost_config()->publish_1stpkt_timeout_;
+    publish_normal_timeout_ = vhost_config()->publish_normal_timeout_;
+    srs_utime_t publish_kickoff_for_idle = vhost_config()->publish_kickoff_for_idle_;
 
     // set the sock options.
     set_sock_options();
 
     if (true) {
-        bool mr = config_->get_mr_enabled(req->vhost_);
-        srs_utime_t mr_sleep = config_->get_mr_sleep(req->vhost_);
+        bool mr = vhost_config()->mr_enabled_;
+        srs_utime_t mr_sleep = vhost_config()->mr_sleep_;
         srs_trace("start publish mr=%d/%d, p1stpt=%d, pnt=%d, tcp_nodelay=%d", mr, srsu2msi(mr_sleep), srsu2msi(publish_1stpkt_timeout_), srsu2msi(publish_normal_timeout_), tcp_nodelay_);
     }
 
@@ -1039,8 +1054,8 @@ srs_error_t SrsRtmpConn::do_publishing(SrsSharedPtr<SrsLiveSource> source, SrsPu
         // reportable
         if (pprint->can_print()) {
             kbps_->sample();
-            bool mr = config_->get_mr_enabled(req->vhost_);
-            srs_utime_t mr_sleep = config_->get_mr_sleep(req->vhost_);
+            bool mr = vhost_config()->mr_enabled_;
+            srs_utime_t mr_sleep = vhost_config()->mr_sleep_;
             srs_trace("<- " SRS_CONSTS_LOG_CLIENT_PUBLISH " time=%d, okbps=%d,%d,%d, ikbps=%d,%d,%d, mr=%d/%d, p1stpt=%d, pnt=%d",
                       (int)pprint->age(), kbps_->get_send_kbps(), kbps_->get_send_kbps_30s(), kbps_->get_send_kbps_5m(),
                       kbps_->get_recv_kbps(), kbps_->get_recv_kbps_30s(), kbps_->get_recv_kbps_5m(), mr, srsu2msi(mr_sleep),
@@ -1066,8 +1081,8 @@ srs_error_t SrsRtmpConn::acquire_publish(SrsSharedPtr<SrsLiveSource> source)
     // Check whether RTC stream is busy.
     SrsSharedPtr<SrsRtcSource> rtc;
     bool rtc_server_enabled = config_->get_rtc_server_enabled();
-    bool rtc_enabled = config_->get_rtc_enabled(req->vhost_);
-    bool edge = config_->get_vhost_is_edge(req->vhost_);
+    bool rtc_enabled = vhost_config()->rtc_enabled_;
+    bool edge = vhost_config()->is_edge_;
 
     if (rtc_enabled && edge) {
         rtc_enabled = false;
@@ -1086,7 +1101,7 @@ srs_error_t SrsRtmpConn::acquire_publish(SrsSharedPtr<SrsLiveSource> source)
 
     // Check whether SRT stream is busy.
     bool srt_server_enabled = config_->get_srt_enabled();
-    bool srt_enabled = config_->get_srt_enabled(req->vhost_);
+    bool srt_enabled = vhost_config()->srt_enabled_;
     if (srt_server_enabled && srt_enabled && !info_->edge_) {
         SrsSharedPtr<SrsSrtSource> srt;
         if ((err = srt_sources_->fetch_or_create(req, srt)) != srs_success) {
@@ -1102,7 +1117,7 @@ srs_error_t SrsRtmpConn::acquire_publish(SrsSharedPtr<SrsLiveSource> source)
     // RTSP only support viewer, so we don't need to check it.
     SrsSharedPtr<SrsRtspSource> rtsp;
     bool rtsp_server_enabled = config_->get_rtsp_server_enabled();
-    bool rtsp_enabled = config_->get_rtsp_enabled(req->vhost_);
+    bool rtsp_enabled = vhost_config()->rtsp_enabled_;
     if (rtsp_server_enabled && rtsp_enabled && !info_->edge_) {
         if ((err = rtsp_sources_->fetch_or_create(req, rtsp)) != srs_success) {
             return srs_error_wrap(err, "create source");
@@ -1115,7 +1130,7 @@ srs_error_t SrsRtmpConn::acquire_publish(SrsSharedPtr<SrsLiveSource> source)
     SrsRtmpBridge *bridge = new SrsRtmpBridge(app_factory_);
 
 #if defined(SRS_FFMPEG_FIT)
-    bool rtmp_to_rtc = config_->get_rtc_from_rtmp(req->vhost_);
+    bool rtmp_to_rtc = vhost_config()->rtc_from_rtmp_;
     if (rtmp_to_rtc && edge) {
         rtmp_to_rtc = false;
         srs_warn("disable RTMP to WebRTC for edge vhost=%s", req->vhost_.c_str());
@@ -1127,7 +1142,7 @@ srs_error_t SrsRtmpConn::acquire_publish(SrsSharedPtr<SrsLiveSource> source)
 #endif
 
 #ifdef SRS_RTSP
-    if (rtsp.get() && config_->get_rtsp_from_rtmp(req->vhost_)) {
+    if (rtsp.get() && vhost_config()->rtsp_from_rtmp_) {
         bridge->enable_rtmp2rtsp(rtsp);
     }
 #endif
@@ -1329,7 +1344,7 @@ void SrsRtmpConn::set_sock_options()
 {
     ISrsRequest *req = info_->req_;
 
-    bool nvalue = config_->get_tcp_nodelay(req->vhost_);
+    bool nvalue = vhost_config()->tcp_nodelay_;
     if (nvalue != tcp_nodelay_) {
         tcp_nodelay_ = nvalue;
 
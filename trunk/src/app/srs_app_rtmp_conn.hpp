@@ -39,6 +39,8 @@ class ISrsWakable;
 class SrsRtmpCommonMessage;
 class SrsRtmpCommand;
 class SrsNetworkDelta;
+class SrsConfigSnapshot;
+class SrsVhostSnapshot;
 class ISrsNetworkDelta;
 class ISrsAppConfig;
 class SrsSslConnection;
@@ -216,6 +218,9 @@ SRS_DECLARE_PRIVATE: // clang-format on
     bool tcp_nodelay_;
     // About the rtmp client.
     SrsClientInfo *info_;
+    // The compiled config and the vhost of it, held by connection, so it's consistent even if reloaded.
+    SrsSharedPtr<SrsConfigSnapshot> snapshot_;
+    SrsVhostSnapshot *vconf_;
 
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
@@ -255,6 +260,8 @@ SRS_DECLARE_PRIVATE: // clang-format on
     // The stream(play/publish) service cycle, identify client first.
     virtual srs_error_t stream_service_cycle();
     virtual srs_error_t check_vhost(bool try_default_vhost);
+    // Get the compiled config of vhost, load it from config if not checked.
+    virtual SrsVhostSnapshot *vhost_config();
     virtual srs_error_t playing(SrsSharedPtr<SrsLiveSource> source);
 
 // clang-format off
@@ -24,6 +24,7 @@ using namespace std;
 #include <srs_app_rtc_source.hpp>
 #include <srs_app_server.hpp>
 #include <srs_app_statistic.hpp>
+#include <srs_app_workers.hpp>
 #include <srs_core_autofree.hpp>
 #include <srs_kernel_buffer.hpp>
 #include <srs_kernel_codec.hpp>
@@ -32,6 +33,7 @@ using namespace std;
 #include <srs_kernel_utility.hpp>
 #include <srs_protocol_amf0.hpp>
 #include <srs_protocol_format.hpp>
+#include <srs_protocol_json.hpp>
 #include <srs_protocol_rtmp_msg_array.hpp>
 #include <srs_protocol_rtmp_stack.hpp>
 #include <srs_protocol_utility.hpp>
@@ -224,6 +226,37 @@ void SrsFastVector::free()
 }
 #endif
 
+// Get the mark of a new round of memory accounting, never be 0 which is the initial mark of block.
+static uint32_t srs_next_memory_mark()
+{
+    static uint32_t mark = 0;
+    if (++mark == 0) {
+        ++mark;
+    }
+    return mark;
+}
+
+// Get the bytes of payload if it's not held by others in the round of mark, because the payload is
+// shared by the copies of message, for example, in gop cache and queues of consumers.
+static int64_t srs_hold_payload_bytes(uint32_t mark, SrsMediaPacket *msg)
+{
+    SrsMemoryBlock *block = msg->payload_.get();
+    if (!block || !block->hold(mark)) {
+        return 0;
+    }
+    return block->size();
+}
+
+// Get the bytes of payload if it's not held by others any more in the round of mark.
+static int64_t srs_unhold_payload_bytes(uint32_t mark, SrsMediaPacket *msg)
+{
+    SrsMemoryBlock *block = msg->payload_.get();
+    if (!block || !block->unhold(mark)) {
+        return 0;
+    }
+    return block->size();
+}
+
 ISrsMessageQueue::ISrsMessageQueue()
 {
 }
@@ -237,6 +270,7 @@ SrsMessageQueue::SrsMessageQueue(bool ignore_shrink)
     _ignore_shrink = ignore_shrink;
     max_queue_size_ = 0;
     av_start_time_ = av_end_time_ = -1;
+    bytes_ = 0;
 }
 
 SrsMessageQueue::~SrsMessageQueue()
@@ -254,6 +288,29 @@ srs_utime_t SrsMessageQueue::duration()
     return (av_end_time_ - av_start_time_);
 }
 
+int64_t SrsMessageQueue::bytes()
+{
+    return bytes_;
+}
+
+int64_t SrsMessageQueue::hold(uint32_t mark)
+{
+    int64_t size = 0;
+    for (int i = 0; i < (int)msgs_.size(); i++) {
+        size += srs_hold_payload_bytes(mark, msgs_.at(i));
+    }
+    return size;
+}
+
+int64_t SrsMessageQueue::unhold(uint32_t mark)
+{
+    int64_t size = 0;
+    for (int i = 0; i < (int)msgs_.size(); i++) {
+        size += srs_unhold_payload_bytes(mark, msgs_.at(i));
+    }
+    return size;
+}
+
 void SrsMessageQueue::set_queue_size(srs_utime_t queue_size)
 {
     max_queue_size_ = queue_size;
@@ -264,6 +321,7 @@ srs_error_t SrsMessageQueue::enqueue(SrsMediaPacket *msg, bool *is_overflow)
     srs_error_t err = srs_success;
 
     msgs_.push_back(msg);
+    bytes_ += msg->size();
 
     // If jitter is off, the timestamp of first sequence header is zero, which wll cause SRS to shrink and drop the
     // keyframes even if there is not overflow packets in queue, so we must ignore the zero timestamps, please
@@ -307,6 +365,10 @@ srs_error_t SrsMessageQueue::dump_packets(int max_count, SrsMediaPacket **pmsgs,
     SrsMediaPacket **omsgs = msgs_.data();
     memcpy(pmsgs, omsgs, count * sizeof(SrsMediaPacket *));
 
+    for (int i = 0; i < count; i++) {
+        bytes_ -= omsgs[i]->size();
+    }
+
     SrsMediaPacket *last = omsgs[count - 1];
     av_start_time_ = srs_utime_t(last->timestamp_ * SRS_UTIME_MILLISECONDS);
 
@@ -370,15 +432,18 @@ void SrsMessageQueue::shrink()
 
     // Update av_start_time_, the start time of queue.
     av_start_time_ = av_end_time_;
+    bytes_ = 0;
 
     // Push back sequence headers and update their timestamps.
     if (video_sh) {
         video_sh->timestamp_ = srsu2ms(av_end_time_);
         msgs_.push_back(video_sh);
+        bytes_ += video_sh->size();
     }
     if (audio_sh) {
         audio_sh->timestamp_ = srsu2ms(av_end_time_);
         msgs_.push_back(audio_sh);
+        bytes_ += audio_sh->size();
     }
 
     if (!_ignore_shrink) {
@@ -386,6 +451,11 @@ void SrsMessageQueue::shrink()
     }
 }
 
+void SrsMessageQueue::shed()
+{
+    shrink();
+}
+
 void SrsMessageQueue::clear()
 {
 #ifndef SRS_PERF_QUEUE_FAST_VECTOR
@@ -402,6 +472,7 @@ void SrsMessageQueue::clear()
     msgs_.clear();
 
     av_start_time_ = av_end_time_ = -1;
+    bytes_ = 0;
 }
 
 ISrsWakable::ISrsWakable()
@@ -575,6 +646,26 @@ srs_error_t SrsLiveConsumer::on_play_client_pause(bool is_pause)
     return err;
 }
 
+int64_t SrsLiveConsumer::bytes()
+{
+    return queue_->bytes();
+}
+
+int64_t SrsLiveConsumer::hold(uint32_t mark)
+{
+    return queue_->hold(mark);
+}
+
+int64_t SrsLiveConsumer::unhold(uint32_t mark)
+{
+    return queue_->unhold(mark);
+}
+
+void SrsLiveConsumer::shed()
+{
+    queue_->shed();
+}
+
 void SrsLiveConsumer::wakeup()
 {
 #ifdef SRS_PERF_QUEUE_COND_WAIT
@@ -591,6 +682,7 @@ SrsGopCache::SrsGopCache()
     enable_gop_cache_ = true;
     audio_after_last_video_count_ = 0;
     gop_cache_max_frames_ = 0;
+    bytes_ = 0;
 }
 
 SrsGopCache::~SrsGopCache()
@@ -673,6 +765,7 @@ srs_error_t SrsGopCache::cache(SrsMediaPacket *shared_msg)
 
     // cache the frame.
     gop_cache_.push_back(msg->copy());
+    bytes_ += msg->size();
 
     // Clear gop cache if exceed the max frames.
     if (gop_cache_max_frames_ > 0 && gop_cache_.size() > (size_t)gop_cache_max_frames_) {
@@ -692,6 +785,7 @@ void SrsGopCache::clear()
         srs_freep(msg);
     }
     gop_cache_.clear();
+    bytes_ = 0;
 
     cached_video_count_ = 0;
     audio_after_last_video_count_ = 0;
@@ -737,6 +831,29 @@ bool SrsGopCache::pure_audio()
     return cached_video_count_ == 0;
 }
 
+int64_t SrsGopCache::bytes()
+{
+    return bytes_;
+}
+
+int64_t SrsGopCache::hold(uint32_t mark)
+{
+    int64_t size = 0;
+    for (int i = 0; i < (int)gop_cache_.size(); i++) {
+        size += srs_hold_payload_bytes(mark, gop_cache_.at(i));
+    }
+    return size;
+}
+
+int64_t SrsGopCache::unhold(uint32_t mark)
+{
+    int64_t size = 0;
+    for (int i = 0; i < (int)gop_cache_.size(); i++) {
+        size += srs_unhold_payload_bytes(mark, gop_cache_.at(i));
+    }
+    return size;
+}
+
 ISrsLiveSourceHandler::ISrsLiveSourceHandler()
 {
 }
@@ -1506,6 +1623,20 @@ srs_error_t SrsMetaCache::dumps(ISrsLiveConsumer *consumer, bool atc, SrsRtmpJit
     return err;
 }
 
+int64_t SrsMetaCache::hold(uint32_t mark)
+{
+    int64_t size = 0;
+
+    SrsMediaPacket *msgs[] = {meta_, video_, previous_video_, audio_, previous_audio_};
+    for (int i = 0; i < (int)(sizeof(msgs) / sizeof(msgs[0])); i++) {
+        if (msgs[i]) {
+            size += srs_hold_payload_bytes(mark, msgs[i]);
+        }
+    }
+
+    return size;
+}
+
 SrsMediaPacket *SrsMetaCache::previous_vsh()
 {
     return previous_video_;
@@ -1623,7 +1754,12 @@ SrsLiveSourceManager::SrsLiveSourceManager()
     lock_ = srs_mutex_new();
     timer_ = new SrsHourGlass("sources", this, 1 * SRS_UTIME_SECONDS);
 
+    memory_ = 0;
+    nn_gop_evicts_ = 0;
+    nn_consumer_sheds_ = 0;
+
     app_factory_ = _srs_app_factory;
+    config_ = _srs_config;
 }
 
 SrsLiveSourceManager::~SrsLiveSourceManager()
@@ -1632,6 +1768,7 @@ SrsLiveSourceManager::~SrsLiveSourceManager()
     srs_freep(timer_);
 
     app_factory_ = NULL;
+    config_ = NULL;
 }
 
 srs_error_t SrsLiveSourceManager::initialize()
@@ -1721,6 +1858,10 @@ srs_error_t SrsLiveSourceManager::setup_ticks()
         return srs_error_wrap(err, "tick");
     }
 
+    if ((err = timer_->tick(2, 1 * SRS_UTIME_SECONDS)) != srs_success) {
+        return srs_error_wrap(err, "tick");
+    }
+
     if ((err = timer_->start()) != srs_success) {
         return srs_error_wrap(err, "timer");
     }
@@ -1732,6 +1873,11 @@ srs_error_t SrsLiveSourceManager::notify(int event, srs_utime_t interval, srs_ut
 {
     srs_error_t err = srs_success;
 
+    if (event == 2) {
+        check_memory_budget();
+        return err;
+    }
+
     std::map<std::string, SrsSharedPtr<SrsLiveSource> >::iterator it;
     for (it = pool_.begin(); it != pool_.end();) {
         SrsSharedPtr<SrsLiveSource> &source = it->second;
@@ -1760,6 +1906,95 @@ srs_error_t SrsLiveSourceManager::notify(int event, srs_utime_t interval, srs_ut
     return err;
 }
 
+// Sort the sources by the number of consumers, the least watched first.
+static bool srs_source_less_watched(const std::pair<int, SrsLiveSource *> &a, const std::pair<int, SrsLiveSource *> &b)
+{
+    return a.first < b.first;
+}
+
+// Sort the consumers by the bytes in queue, the slowest first.
+static bool srs_consumer_slower(const std::pair<int64_t, SrsLiveConsumer *> &a, const std::pair<int64_t, SrsLiveConsumer *> &b)
+{
+    return a.first > b.first;
+}
+
+void SrsLiveSourceManager::check_memory_budget()
+{
+    memory_ = 0;
+
+    // All sources are accounted in the same round, so the payload shared by sources is counted once.
+    uint32_t mark = srs_next_memory_mark();
+
+    std::vector<std::pair<int, SrsLiveSource *> > sources;
+    std::map<std::string, SrsSharedPtr<SrsLiveSource> >::iterator it;
+    for (it = pool_.begin(); it != pool_.end(); ++it) {
+        SrsLiveSource *source = it->second.get();
+        memory_ += source->hold(mark);
+        sources.push_back(std::make_pair((int)source->consumers().size(), source));
+    }
+
+    int64_t budget = config_->get_media_memory_budget();
+    if (budget <= 0 || memory_ <= budget) {
+        return;
+    }
+
+    int64_t memory = memory_;
+    int nn_evicts = 0, nn_sheds = 0;
+
+    // Evict the gop caches of the least watched streams first, they are filled again by the next keyframe.
+    std::stable_sort(sources.begin(), sources.end(), srs_source_less_watched);
+    for (int i = 0; i < (int)sources.size() && memory > budget; i++) {
+        SrsLiveSource *source = sources[i].second;
+
+        if (source->gop_cache_bytes() <= 0) {
+            continue;
+        }
+
+        // The payload in gop cache might be still held by consumers, so it's not always freed.
+        memory -= source->unhold_gop_cache(mark);
+        source->clear_gop_cache();
+        nn_evicts++;
+    }
+
+    // Shed the slowest consumers, which hold the most bytes in queue.
+    if (memory > budget) {
+        std::vector<std::pair<int64_t, SrsLiveConsumer *> > consumers;
+        for (int i = 0; i < (int)sources.size(); i++) {
+            std::vector<SrsLiveConsumer *> arr = sources[i].second->consumers();
+            for (int j = 0; j < (int)arr.size(); j++) {
+                consumers.push_back(std::make_pair(arr[j]->bytes(), arr[j]));
+            }
+        }
+
+        std::stable_sort(consumers.begin(), consumers.end(), srs_consumer_slower);
+        for (int i = 0; i < (int)consumers.size() && memory > budget; i++) {
+            SrsLiveConsumer *consumer = consumers[i].second;
+
+            // The payload in queue might be still held by other consumers, so it's not always freed.
+            // The sequence headers are kept by shed, so hold them again.
+            memory -= consumer->unhold(mark);
+            consumer->shed();
+            memory += consumer->hold(mark);
+            nn_sheds++;
+        }
+    }
+
+    nn_gop_evicts_ += nn_evicts;
+    nn_consumer_sheds_ += nn_sheds;
+
+    srs_warn("Live: media memory %dKB exceed budget %dKB, evict %d gop caches, shed %d consumers, now %dKB",
+             (int)(memory_ / 1024), (int)(budget / 1024), nn_evicts, nn_sheds, (int)(memory / 1024));
+    memory_ = memory;
+}
+
+void SrsLiveSourceManager::dumps(SrsJsonObject *obj)
+{
+    obj->set("bytes", SrsJsonAny::integer(memory_));
+    obj->set("budget", SrsJsonAny::integer(config_->get_media_memory_budget()));
+    obj->set("gop_evicts", SrsJsonAny::integer(nn_gop_evicts_));
+    obj->set("consumer_sheds", SrsJsonAny::integer(nn_consumer_sheds_));
+}
+
 void SrsLiveSourceManager::destroy()
 {
     pool_.clear();
@@ -1781,6 +2016,7 @@ SrsLiveSource::SrsLiveSource()
     mix_queue_ = new SrsMixQueue();
 
     can_publish_ = true;
+    relayed_ = false;
     // Initialize stream_die_at_ to current time to prevent newly created sources
     // from being immediately considered dead by stream_is_dead() check.
     // @see https://github.com/ossrs/srs/issues/4449
@@ -1805,6 +2041,7 @@ SrsLiveSource::SrsLiveSource()
     stat_ = _srs_stat;
     handler_ = _srs_server;
     app_factory_ = _srs_app_factory;
+    workers_ = _srs_workers;
 }
 
 void SrsLiveSource::assemble()
@@ -1841,6 +2078,7 @@ SrsLiveSource::~SrsLiveSource()
     stat_ = NULL;
     handler_ = NULL;
     app_factory_ = NULL;
+    workers_ = NULL;
 }
 
 void SrsLiveSource::dispose()
@@ -2076,7 +2314,7 @@ srs_error_t SrsLiveSource::on_meta_data(SrsRtmpCommonMessage *msg, SrsOnMetaData
     }
 
     // Copy to hub to all utilities.
-    if (hub_ && (err = hub_->on_meta_data(meta_->data(), metadata)) != srs_success) {
+    if (hub_ && !relayed_ && (err = hub_->on_meta_data(meta_->data(), metadata)) != srs_success) {
         return srs_error_wrap(err, "hub consume metadata");
     }
 
@@ -2164,7 +2402,7 @@ srs_error_t SrsLiveSource::on_audio_imp(SrsMediaPacket *msg)
     }
 
     // Copy to hub to all utilities.
-    if (hub_ && (err = hub_->on_audio(msg)) != srs_success) {
+    if (hub_ && !relayed_ && (err = hub_->on_audio(msg)) != srs_success) {
         return srs_error_wrap(err, "consume audio");
     }
 
@@ -2285,7 +2523,7 @@ srs_error_t SrsLiveSource::on_video_imp(SrsMediaPacket *msg)
     }
 
     // Copy to hub to all utilities.
-    if (hub_ && (err = hub_->on_video(msg, is_sequence_header)) != srs_success) {
+    if (hub_ && !relayed_ && (err = hub_->on_video(msg, is_sequence_header)) != srs_success) {
         return srs_error_wrap(err, "hub consume video");
     }
 
@@ -2421,6 +2659,13 @@ srs_error_t SrsLiveSource::on_publish()
     // update the request object.
     srs_assert(req_);
 
+    // For workers mode, the publisher on current worker takes over the stream relayed from another worker,
+    // so stop pulling from the relay, and deliver to the hub for HLS, DVR and forward.
+    if (relayed_) {
+        play_edge_->on_all_client_stop();
+        relayed_ = false;
+    }
+
     can_publish_ = false;
 
     // whatever, the publish thread is the source or edge source,
@@ -2440,8 +2685,9 @@ srs_error_t SrsLiveSource::on_publish()
     is_monotonically_increase_ = true;
     last_packet_time_ = 0;
 
-    // Notify the hub about the publish event.
-    if (hub_ && (err = hub_->on_publish()) != srs_success) {
+    // Notify the hub about the publish event, the stream relayed from another worker is delivered only,
+    // because the worker which owns the publisher will do the HLS, DVR and forward.
+    if (hub_ && !relayed_ && (err = hub_->on_publish()) != srs_success) {
         return srs_error_wrap(err, "hub publish");
     }
 
@@ -2473,7 +2719,7 @@ void SrsLiveSource::on_unpublish()
     }
 
     // Notify the hub about the unpublish event.
-    if (hub_) {
+    if (hub_ && !relayed_) {
         hub_->on_unpublish();
     }
 
@@ -2520,8 +2766,13 @@ srs_error_t SrsLiveSource::create_consumer(SrsLiveConsumer *&consumer)
 {
     srs_error_t err = srs_success;
 
+    // For workers mode, pull stream like edge if published by another worker.
+    if (!relayed_ && can_publish_ && !workers_->relay_of(req_->get_stream_url()).empty()) {
+        relayed_ = true;
+    }
+
     // for edge, when play edge stream, check the state
-    if (config_->get_vhost_is_edge(req_->vhost_)) {
+    if (relayed_ || config_->get_vhost_is_edge(req_->vhost_)) {
         // notice edge to start for the first client.
         if ((err = play_edge_->on_client_play()) != srs_success) {
             return srs_error_wrap(err, "play edge");
@@ -2600,9 +2851,10 @@ void SrsLiveSource::on_consumer_destroy(SrsLiveConsumer *consumer)
 
         // For edge server, the stream die when the last player quit, because the edge stream is created by player
         // activities, so it should die when all players quit.
-        if (config_->get_vhost_is_edge(req_->vhost_)) {
+        if (relayed_ || config_->get_vhost_is_edge(req_->vhost_)) {
             stream_die_at_ = srs_time_now_cached();
         }
+        relayed_ = false;
 
         // When no players, the publisher is idle now.
         publisher_idle_at_ = srs_time_now_cached();
@@ -2624,7 +2876,45 @@ SrsRtmpJitterAlgorithm SrsLiveSource::jitter()
 {
     return jitter_algorithm_;
 }
+// LCOV_EXCL_STOP
+
+int64_t SrsLiveSource::gop_cache_bytes()
+{
+    return gop_cache_->bytes();
+}
+
+void SrsLiveSource::clear_gop_cache()
+{
+    gop_cache_->clear();
+}
+
+int64_t SrsLiveSource::hold(uint32_t mark)
+{
+    int64_t size = gop_cache_->hold(mark) + meta_->hold(mark);
+
+    for (int i = 0; i < (int)consumers_.size(); i++) {
+        size += consumers_.at(i)->hold(mark);
+    }
 
+    return size;
+}
+
+int64_t SrsLiveSource::unhold_gop_cache(uint32_t mark)
+{
+    return gop_cache_->unhold(mark);
+}
+
+int64_t SrsLiveSource::memory()
+{
+    return hold(srs_next_memory_mark());
+}
+
+std::vector<SrsLiveConsumer *> SrsLiveSource::consumers()
+{
+    return consumers_;
+}
+
+// LCOV_EXCL_START
 srs_error_t SrsLiveSource::on_edge_start_publish()
 {
     return publish_edge_->on_client_publish();
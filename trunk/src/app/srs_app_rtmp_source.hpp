@@ -30,6 +30,7 @@ class SrsLiveSource;
 class SrsRtmpCommonMessage;
 class SrsOnMetaDataPacket;
 class SrsMediaPacket;
+class SrsMemoryBlock;
 class SrsForwarder;
 class ISrsRequest;
 class SrsStSocket;
@@ -44,6 +45,7 @@ class SrsDvr;
 class SrsDash;
 class SrsEncoder;
 class SrsBuffer;
+class SrsJsonObject;
 #ifdef SRS_HDS
 class SrsHds;
 #endif
@@ -61,6 +63,7 @@ class ISrsHds;
 class ISrsNgExec;
 class ISrsForwarder;
 class ISrsAppFactory;
+class ISrsWorkerManager;
 class ISrsLiveConsumer;
 
 // The time jitter algorithm:
@@ -154,6 +157,8 @@ SRS_DECLARE_PRIVATE: // clang-format on
     bool _ignore_shrink;
     // The max queue size, shrink if exceed it.
     srs_utime_t max_queue_size_;
+    // The bytes of payload of messages in queue.
+    int64_t bytes_;
 #ifdef SRS_PERF_QUEUE_FAST_VECTOR
     SrsFastVector msgs_;
 #else
@@ -168,6 +173,13 @@ public:
     virtual int size();
     // Get the duration of queue.
     virtual srs_utime_t duration();
+    // Get the bytes of payload in queue.
+    virtual int64_t bytes();
+    // Hold the payload in queue in the accounting round of mark, return the bytes of payload which
+    // is not held by others. See SrsMemoryBlock::hold.
+    virtual int64_t hold(uint32_t mark);
+    // Unhold the payload in queue, return the bytes of payload which is not held by others.
+    virtual int64_t unhold(uint32_t mark);
     // Set the queue size
     // @param queue_size the queue size in srs_utime_t.
     virtual void set_queue_size(srs_utime_t queue_size);
@@ -185,6 +197,8 @@ public:
     // Dumps packets to consumer, use specified args.
     // @remark the atc/tba/tbv/ag are same to SrsLiveConsumer.enqueue().
     virtual srs_error_t dump_packets(ISrsLiveConsumer *consumer, bool atc, SrsRtmpJitterAlgorithm ag);
+    // Drop the messages except the sequence headers, to free the memory.
+    virtual void shed();
 
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
@@ -279,6 +293,13 @@ public:
 #endif
     // when client send the pause message.
     virtual srs_error_t on_play_client_pause(bool is_pause);
+    // Get the bytes of payload in queue, which is large for slow consumer.
+    virtual int64_t bytes();
+    // Hold or unhold the payload in queue in the accounting round of mark, see SrsMessageQueue::hold.
+    virtual int64_t hold(uint32_t mark);
+    virtual int64_t unhold(uint32_t mark);
+    // Drop the messages in queue except the sequence headers, to free the memory.
+    virtual void shed();
     // Interface ISrsWakable
 public:
     // when the consumer(for player) got msg from recv thread,
@@ -317,6 +338,8 @@ SRS_DECLARE_PRIVATE: // clang-format on
     int audio_after_last_video_count_;
     // cached gop.
     std::vector<SrsMediaPacket *> gop_cache_;
+    // The bytes of payload in cache.
+    int64_t bytes_;
 
 public:
     SrsGopCache();
@@ -347,6 +370,11 @@ public:
     // whether current stream is pure audio,
     // when no video in gop cache, the stream is pure audio right now.
     virtual bool pure_audio();
+    // Get the bytes of payload in cache.
+    virtual int64_t bytes();
+    // Hold or unhold the payload in cache in the accounting round of mark, see SrsMessageQueue::hold.
+    virtual int64_t hold(uint32_t mark);
+    virtual int64_t unhold(uint32_t mark);
 };
 
 // The handler to handle the event of srs source.
@@ -549,6 +577,9 @@ public:
     // @param dm Whether dumps the metadata.
     // @param ds Whether dumps the sequence header.
     virtual srs_error_t dumps(ISrsLiveConsumer *consumer, bool atc, SrsRtmpJitterAlgorithm ag, bool dm, bool ds);
+    // Hold the payload of cached metadata and sequence headers in the accounting round of mark, see
+    // SrsMessageQueue::hold.
+    virtual int64_t hold(uint32_t mark);
 
 public:
     // Previous exists sequence header.
@@ -594,6 +625,7 @@ class SrsLiveSourceManager : public ISrsHourGlassHandler, public ISrsLiveSourceM
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
     ISrsAppFactory *app_factory_;
+    ISrsAppConfig *config_;
 
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
@@ -601,6 +633,14 @@ SRS_DECLARE_PRIVATE: // clang-format on
     std::map<std::string, SrsSharedPtr<SrsLiveSource> > pool_;
     ISrsHourGlass *timer_;
 
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // The media memory of all sources, updated when checking the budget.
+    int64_t memory_;
+    // The times that gop cache is cleared, and consumer is shed, for the memory budget.
+    int64_t nn_gop_evicts_;
+    int64_t nn_consumer_sheds_;
+
 public:
     SrsLiveSourceManager();
     virtual ~SrsLiveSourceManager();
@@ -626,6 +666,13 @@ SRS_DECLARE_PRIVATE: // clang-format on
     virtual srs_error_t setup_ticks();
     virtual srs_error_t notify(int event, srs_utime_t interval, srs_utime_t tick);
 
+public:
+    // Check the media memory of all sources, evict the gop caches of the least watched streams
+    // and shed the slowest consumers, when exceed the memory budget.
+    virtual void check_memory_budget();
+    // Dump the media memory to json object.
+    virtual void dumps(SrsJsonObject *obj);
+
 public:
     // when system exit, destroy th`e sources,
     // For gmc to analysis mem leaks.
@@ -669,6 +716,7 @@ SRS_DECLARE_PRIVATE: // clang-format on
     ISrsStatistic *stat_;
     ISrsLiveSourceHandler *handler_;
     ISrsAppFactory *app_factory_;
+    ISrsWorkerManager *workers_;
 
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
@@ -716,6 +764,8 @@ SRS_DECLARE_PRIVATE: // clang-format on
 SRS_DECLARE_PRIVATE: // clang-format on
     // Whether source is avaiable for publishing.
     bool can_publish_;
+    // For workers mode, whether pull stream from the worker which owns the publisher, like edge.
+    bool relayed_;
     // The last die time, while die means neither publishers nor players.
     srs_utime_t stream_die_at_;
     // The last idle time, while idle means no players.
@@ -797,6 +847,22 @@ public:
     virtual void set_gop_cache_max_frames(int v);
     virtual SrsRtmpJitterAlgorithm jitter();
 
+public:
+    // The media memory held by source, for the memory budget of server.
+    // Get the bytes of payload in gop cache.
+    virtual int64_t gop_cache_bytes();
+    // Clear the gop cache to free memory, it's filled again by next keyframe.
+    virtual void clear_gop_cache();
+    // Hold the payload in gop cache, meta cache and consumer queues in the accounting round of mark,
+    // return the bytes not held by others. The payload is shared by the copies of message, so it's
+    // counted only once, even by many sources in the same round.
+    virtual int64_t hold(uint32_t mark);
+    // Unhold the payload in gop cache, return the bytes which are freed by clear it.
+    virtual int64_t unhold_gop_cache(uint32_t mark);
+    // Get the bytes of payload in gop cache, meta cache and consumer queues, in a new round.
+    virtual int64_t memory();
+    virtual std::vector<SrsLiveConsumer *> consumers();
+
 public:
     // For edge, when publish edge stream, check the state
     virtual srs_error_t on_edge_start_publish();
@@ -0,0 +1,351 @@
+//
+// Copyright (c) 2013-2025 The SRS Authors
+//
+// SPDX-License-Identifier: MIT
+//
+
+#include <srs_app_segment_cache.hpp>
+
+#include <string.h>
+using namespace std;
+
+#include <srs_app_config.hpp>
+#include <srs_kernel_buffer.hpp>
+#include <srs_kernel_error.hpp>
+#include <srs_kernel_log.hpp>
+#include <srs_kernel_stream.hpp>
+#include <srs_kernel_utility.hpp>
+#include <srs_protocol_json.hpp>
+#include <srs_protocol_rtc_stun.hpp>
+
+SrsSegmentCache *_srs_segment_cache = NULL;
+
+SrsSegmentCacheEntry::SrsSegmentCacheEntry()
+{
+}
+
+SrsSegmentCacheEntry::~SrsSegmentCacheEntry()
+{
+}
+
+SrsSegmentCacheVhost::SrsSegmentCacheVhost()
+{
+    size_ = 0;
+}
+
+SrsSegmentCacheVhost::~SrsSegmentCacheVhost()
+{
+}
+
+ISrsSegmentCache::ISrsSegmentCache()
+{
+}
+
+ISrsSegmentCache::~ISrsSegmentCache()
+{
+}
+
+SrsSegmentCache::SrsSegmentCache()
+{
+    nn_hits_ = 0;
+    nn_misses_ = 0;
+    nn_evicts_ = 0;
+    hit_bytes_ = 0;
+
+    config_ = _srs_config;
+}
+
+SrsSegmentCache::~SrsSegmentCache()
+{
+    std::map<std::string, SrsSegmentCacheEntry *>::iterator it;
+    for (it = entries_.begin(); it != entries_.end(); ++it) {
+        SrsSegmentCacheEntry *entry = it->second;
+        srs_freep(entry);
+    }
+    entries_.clear();
+
+    std::map<std::string, SrsSegmentCacheVhost *>::iterator it2;
+    for (it2 = vhosts_.begin(); it2 != vhosts_.end(); ++it2) {
+        SrsSegmentCacheVhost *vhost = it2->second;
+        srs_freep(vhost);
+    }
+    vhosts_.clear();
+
+    if (config_) {
+        config_->unsubscribe(this);
+    }
+    config_ = NULL;
+}
+
+void SrsSegmentCache::assemble()
+{
+    config_->subscribe(this);
+}
+
+bool SrsSegmentCache::enabled(string vhost)
+{
+    return config_->get_vhost_http_segment_cache(vhost) > 0;
+}
+
+void SrsSegmentCache::put(string vhost, string path, SrsSharedPtr<SrsMemoryBlock> data)
+{
+    // Remove the previous content, for example, the playlist is refreshed.
+    std::map<std::string, SrsSegmentCacheEntry *>::iterator it = entries_.find(path);
+    if (it != entries_.end()) {
+        do_remove(it->second);
+    }
+
+    // Ignore the file which is larger than the budget, which might evict all entries.
+    int64_t max_size = config_->get_vhost_http_segment_cache(vhost);
+    if (!data.get() || data->size() > max_size) {
+        return;
+    }
+
+    SrsSegmentCacheVhost *cache = fetch_vhost(vhost);
+
+    // Evict the least recently used entries of vhost.
+    evict(cache, max_size - data->size());
+
+    SrsSegmentCacheEntry *entry = new SrsSegmentCacheEntry();
+    entry->path_ = path;
+    entry->vhost_ = vhost;
+    entry->data_ = data;
+    entry->etag_ = srs_fmt_sprintf("\"%x-%x\"", srs_crc32_ieee(data->payload(), data->size()), data->size());
+
+    cache->lru_.push_front(entry);
+    entry->lru_ = cache->lru_.begin();
+    cache->size_ += data->size();
+
+    entries_[path] = entry;
+}
+
+void SrsSegmentCache::put(string vhost, string path, const string &content)
+{
+    SrsMemoryBlock *data = new SrsMemoryBlock();
+    data->create((char *)content.data(), (int)content.length());
+    put(vhost, path, SrsSharedPtr<SrsMemoryBlock>(data));
+}
+
+void SrsSegmentCache::remove(string path)
+{
+    std::map<std::string, SrsSegmentCacheEntry *>::iterator it = entries_.find(path);
+    if (it != entries_.end()) {
+        do_remove(it->second);
+    }
+}
+
+bool SrsSegmentCache::fetch(string path, SrsSharedPtr<SrsMemoryBlock> &data, string &etag)
+{
+    std::map<std::string, SrsSegmentCacheEntry *>::iterator it = entries_.find(path);
+    if (it == entries_.end()) {
+        nn_misses_++;
+        return false;
+    }
+
+    SrsSegmentCacheEntry *entry = it->second;
+    data = entry->data_;
+    etag = entry->etag_;
+
+    // Move to the front of LRU list.
+    SrsSegmentCacheVhost *cache = fetch_vhost(entry->vhost_);
+    cache->lru_.splice(cache->lru_.begin(), cache->lru_, entry->lru_);
+
+    nn_hits_++;
+    hit_bytes_ += data->size();
+
+    return true;
+}
+
+void SrsSegmentCache::dumps(SrsJsonObject *obj)
+{
+    int64_t size = 0;
+    std::map<std::string, SrsSegmentCacheVhost *>::iterator it;
+    for (it = vhosts_.begin(); it != vhosts_.end(); ++it) {
+        size += it->second->size_;
+    }
+
+    obj->set("entries", SrsJsonAny::integer((int64_t)entries_.size()));
+    obj->set("bytes", SrsJsonAny::integer(size));
+    obj->set("hits", SrsJsonAny::integer(nn_hits_));
+    obj->set("misses", SrsJsonAny::integer(nn_misses_));
+    obj->set("evicts", SrsJsonAny::integer(nn_evicts_));
+    obj->set("hit_bytes", SrsJsonAny::integer(hit_bytes_));
+}
+
+srs_error_t SrsSegmentCache::on_reload_vhost_segment_cache(string vhost)
+{
+    std::map<std::string, SrsSegmentCacheVhost *>::iterator it = vhosts_.find(vhost);
+    if (it == vhosts_.end()) {
+        return srs_success;
+    }
+
+    // Apply the new budget, which might be smaller or disabled.
+    SrsSegmentCacheVhost *cache = it->second;
+    int64_t max_size = config_->get_vhost_http_segment_cache(vhost);
+    evict(cache, srs_max(0, max_size));
+
+    return srs_success;
+}
+
+SrsSegmentCacheVhost *SrsSegmentCache::fetch_vhost(string vhost)
+{
+    std::map<std::string, SrsSegmentCacheVhost *>::iterator it = vhosts_.find(vhost);
+    if (it != vhosts_.end()) {
+        return it->second;
+    }
+
+    SrsSegmentCacheVhost *cache = new SrsSegmentCacheVhost();
+    vhosts_[vhost] = cache;
+    return cache;
+}
+
+void SrsSegmentCache::evict(SrsSegmentCacheVhost *cache, int64_t max_size)
+{
+    while (!cache->lru_.empty() && cache->size_ > max_size) {
+        do_remove(cache->lru_.back());
+        nn_evicts_++;
+    }
+}
+
+void SrsSegmentCache::do_remove(SrsSegmentCacheEntry *entry)
+{
+    SrsSegmentCacheVhost *cache = fetch_vhost(entry->vhost_);
+    cache->lru_.erase(entry->lru_);
+    cache->size_ -= entry->data_->size();
+
+    entries_.erase(entry->path_);
+    srs_freep(entry);
+}
+
+SrsSegmentCacheWriter::SrsSegmentCacheWriter(string vhost, ISrsFileWriter *writer)
+{
+    vhost_ = vhost;
+    writer_ = writer;
+    data_ = new SrsSimpleStream();
+    position_ = 0;
+    broken_ = false;
+
+    cache_ = _srs_segment_cache;
+}
+
+SrsSegmentCacheWriter::~SrsSegmentCacheWriter()
+{
+    srs_freep(writer_);
+    srs_freep(data_);
+
+    cache_ = NULL;
+}
+
+void SrsSegmentCacheWriter::on_reap(string fullpath)
+{
+    if (!broken_ && data_->length() > 0) {
+        SrsMemoryBlock *data = new SrsMemoryBlock();
+        data->create(data_->bytes(), data_->length());
+        cache_->put(vhost_, fullpath, SrsSharedPtr<SrsMemoryBlock>(data));
+    }
+
+    data_->erase(data_->length());
+}
+
+srs_error_t SrsSegmentCacheWriter::set_iobuf_size(int size)
+{
+    return writer_->set_iobuf_size(size);
+}
+
+srs_error_t SrsSegmentCacheWriter::open(string p)
+{
+    data_->erase(data_->length());
+    position_ = 0;
+    broken_ = false;
+
+    return writer_->open(p);
+}
+
+void SrsSegmentCacheWriter::close()
+{
+    writer_->close();
+}
+
+bool SrsSegmentCacheWriter::is_open()
+{
+    return writer_->is_open();
+}
+
+void SrsSegmentCacheWriter::seek2(int64_t offset)
+{
+    writer_->seek2(offset);
+
+    position_ = offset;
+    broken_ = broken_ || position_ > data_->length();
+}
+
+int64_t SrsSegmentCacheWriter::tellg()
+{
+    return writer_->tellg();
+}
+
+srs_error_t SrsSegmentCacheWriter::write(void *buf, size_t count, ssize_t *pnwrite)
+{
+    srs_error_t err = srs_success;
+
+    if ((err = writer_->write(buf, count, pnwrite)) != srs_success) {
+        return srs_error_wrap(err, "write");
+    }
+
+    copy((const char *)buf, (int)count);
+
+    return err;
+}
+
+srs_error_t SrsSegmentCacheWriter::writev(const iovec *iov, int iovcnt, ssize_t *pnwrite)
+{
+    srs_error_t err = srs_success;
+
+    if ((err = writer_->writev(iov, iovcnt, pnwrite)) != srs_success) {
+        return srs_error_wrap(err, "writev");
+    }
+
+    for (int i = 0; i < iovcnt; i++) {
+        copy((const char *)iov[i].iov_base, (int)iov[i].iov_len);
+    }
+
+    return err;
+}
+
+srs_error_t SrsSegmentCacheWriter::lseek(off_t offset, int whence, off_t *seeked)
+{
+    srs_error_t err = srs_success;
+
+    off_t pos = 0;
+    if ((err = writer_->lseek(offset, whence, &pos)) != srs_success) {
+        return srs_error_wrap(err, "seek");
+    }
+
+    position_ = pos;
+    broken_ = broken_ || position_ > data_->length();
+
+    if (seeked) {
+        *seeked = pos;
+    }
+
+    return err;
+}
+
+void SrsSegmentCacheWriter::copy(const char *buf, int size)
+{
+    if (broken_ || size <= 0) {
+        return;
+    }
+
+    // Overwrite the data, for example, the size of box which is updated by seek back.
+    int overwrite = srs_min(size, (int)(data_->length() - position_));
+    if (overwrite > 0) {
+        memcpy(data_->bytes() + position_, buf, overwrite);
+    }
+
+    if (size > overwrite) {
+        data_->append(buf + overwrite, size - overwrite);
+    }
+
+    position_ += size;
+}
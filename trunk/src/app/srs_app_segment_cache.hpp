@@ -0,0 +1,182 @@
+//
+// Copyright (c) 2013-2025 The SRS Authors
+//
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef SRS_APP_SEGMENT_CACHE_HPP
+#define SRS_APP_SEGMENT_CACHE_HPP
+
+#include <srs_core.hpp>
+
+#include <list>
+#include <map>
+#include <string>
+
+#include <srs_app_reload.hpp>
+#include <srs_core_autofree.hpp>
+#include <srs_kernel_file.hpp>
+
+class ISrsAppConfig;
+class SrsJsonObject;
+class SrsMemoryBlock;
+class SrsSimpleStream;
+
+// The cached segment or playlist, which is the content of file on disk.
+class SrsSegmentCacheEntry
+{
+public:
+    // The fullpath of file on disk, for example, ./objs/nginx/html/live/livestream-10.ts
+    std::string path_;
+    std::string vhost_;
+    SrsSharedPtr<SrsMemoryBlock> data_;
+    // The strong ETag of content, for If-None-Match.
+    std::string etag_;
+    // The position in LRU list of vhost.
+    std::list<SrsSegmentCacheEntry *>::iterator lru_;
+
+public:
+    SrsSegmentCacheEntry();
+    virtual ~SrsSegmentCacheEntry();
+};
+
+// The cached entries of vhost, which has its own memory budget.
+class SrsSegmentCacheVhost
+{
+public:
+    // The LRU list, the most recently used entry is at front.
+    std::list<SrsSegmentCacheEntry *> lru_;
+    // The total bytes of entries.
+    int64_t size_;
+
+public:
+    SrsSegmentCacheVhost();
+    virtual ~SrsSegmentCacheVhost();
+};
+
+// The interface for segment cache.
+class ISrsSegmentCache
+{
+public:
+    ISrsSegmentCache();
+    virtual ~ISrsSegmentCache();
+
+public:
+    // Whether the cache is enabled for vhost.
+    virtual bool enabled(std::string vhost) = 0;
+    // Put the content of file to cache, which replaces the previous one of the same path.
+    virtual void put(std::string vhost, std::string path, SrsSharedPtr<SrsMemoryBlock> data) = 0;
+    virtual void put(std::string vhost, std::string path, const std::string &content) = 0;
+    // Remove the file from cache, for example, the segment is expired and removed from disk.
+    virtual void remove(std::string path) = 0;
+    // Fetch the content of file from cache.
+    // @return Whether hit the cache.
+    virtual bool fetch(std::string path, SrsSharedPtr<SrsMemoryBlock> &data, std::string &etag) = 0;
+};
+
+// The bounded LRU cache of HLS/DASH segments and playlists, populated by the muxers when reaping
+// the segment or refreshing the playlist, so the HTTP static server never reads the hot files of
+// live streams from disk. Each vhost has its own memory budget.
+class SrsSegmentCache : public ISrsSegmentCache, public ISrsReloadHandler
+{
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    ISrsAppConfig *config_;
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // The entries, key is the fullpath of file.
+    std::map<std::string, SrsSegmentCacheEntry *> entries_;
+    std::map<std::string, SrsSegmentCacheVhost *> vhosts_;
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // The metrics for API.
+    int64_t nn_hits_;
+    int64_t nn_misses_;
+    int64_t nn_evicts_;
+    // The bytes served from cache.
+    int64_t hit_bytes_;
+
+public:
+    SrsSegmentCache();
+    virtual ~SrsSegmentCache();
+
+public:
+    // Subscribe to config reload, to apply the new budget.
+    virtual void assemble();
+
+public:
+    virtual bool enabled(std::string vhost);
+    virtual void put(std::string vhost, std::string path, SrsSharedPtr<SrsMemoryBlock> data);
+    virtual void put(std::string vhost, std::string path, const std::string &content);
+    virtual void remove(std::string path);
+    virtual bool fetch(std::string path, SrsSharedPtr<SrsMemoryBlock> &data, std::string &etag);
+
+public:
+    // Dump the metrics to json object.
+    virtual void dumps(SrsJsonObject *obj);
+    // Interface ISrsReloadHandler
+public:
+    virtual srs_error_t on_reload_vhost_segment_cache(std::string vhost);
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    SrsSegmentCacheVhost *fetch_vhost(std::string vhost);
+    // Evict the least recently used entries of vhost, until the size is not larger than max_size.
+    void evict(SrsSegmentCacheVhost *cache, int64_t max_size);
+    void do_remove(SrsSegmentCacheEntry *entry);
+};
+
+// The file writer which keeps a copy of data written to file, and puts the data to segment cache
+// when the file is reaped, so the cache is populated without reading the file from disk.
+class SrsSegmentCacheWriter : public ISrsFileWriter
+{
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    ISrsSegmentCache *cache_;
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    std::string vhost_;
+    // The underlayer writer to disk, owned by this writer.
+    ISrsFileWriter *writer_;
+    // The copy of data written since open.
+    SrsSimpleStream *data_;
+    int64_t position_;
+    // Whether the copy is broken, for example, seek beyond the end, so it's not cached.
+    bool broken_;
+
+public:
+    SrsSegmentCacheWriter(std::string vhost, ISrsFileWriter *writer);
+    virtual ~SrsSegmentCacheWriter();
+
+public:
+    // When the file is reaped to the fullpath, put the data to cache.
+    virtual void on_reap(std::string fullpath);
+
+public:
+    virtual srs_error_t set_iobuf_size(int size);
+    virtual srs_error_t open(std::string p);
+    virtual void close();
+
+public:
+    virtual bool is_open();
+    virtual void seek2(int64_t offset);
+    virtual int64_t tellg();
+    // Interface ISrsWriteSeeker
+public:
+    virtual srs_error_t write(void *buf, size_t count, ssize_t *pnwrite);
+    virtual srs_error_t writev(const iovec *iov, int iovcnt, ssize_t *pnwrite);
+    virtual srs_error_t lseek(off_t offset, int whence, off_t *seeked);
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // Copy the data at current position.
+    void copy(const char *buf, int size);
+};
+
+// The global segment cache.
+extern SrsSegmentCache *_srs_segment_cache;
+
+#endif
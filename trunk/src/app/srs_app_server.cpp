@@ -18,17 +18,21 @@
 using namespace std;
 
 #include <srs_app_async_call.hpp>
+#include <srs_app_async_io.hpp>
 #include <srs_app_caster_flv.hpp>
 #include <srs_app_circuit_breaker.hpp>
 #include <srs_app_config.hpp>
 #include <srs_app_coworkers.hpp>
 #include <srs_app_heartbeat.hpp>
+#include <srs_app_hls_ll.hpp>
 #include <srs_app_http_api.hpp>
 #include <srs_app_http_conn.hpp>
 #include <srs_app_http_hooks.hpp>
 #include <srs_app_ingest.hpp>
+#include <srs_app_ingest_thread.hpp>
 #include <srs_app_latest_version.hpp>
 #include <srs_app_log.hpp>
+#include <srs_app_mp4_index.hpp>
 #include <srs_app_mpegts_udp.hpp>
 #include <srs_app_reload.hpp>
 #include <srs_app_rtc_api.hpp>
@@ -38,15 +42,18 @@ using namespace std;
 #include <srs_app_rtc_source.hpp>
 #include <srs_app_rtmp_conn.hpp>
 #include <srs_app_rtmp_source.hpp>
+#include <srs_app_segment_cache.hpp>
 #include <srs_app_statistic.hpp>
 #include <srs_app_stream_token.hpp>
 #include <srs_app_utility.hpp>
+#include <srs_app_workers.hpp>
 #include <srs_kernel_consts.hpp>
 #include <srs_kernel_error.hpp>
 #include <srs_kernel_hourglass.hpp>
 #include <srs_kernel_kbps.hpp>
 #include <srs_kernel_log.hpp>
 #include <srs_kernel_pithy_print.hpp>
+#include <srs_kernel_pool.hpp>
 #include <srs_kernel_utility.hpp>
 #include <srs_protocol_conn.hpp>
 #include <srs_protocol_log.hpp>
@@ -115,7 +122,12 @@ srs_error_t srs_global_initialize()
     _srs_rtc_sources = new SrsRtcSourceManager();
     _srs_blackhole = new SrsRtcBlackhole();
 
-    // Initialize stream publish token manager
+    // The workers manager is created before forking workers, or disabled if not.
+    if (!_srs_workers) {
+        _srs_workers = new SrsWorkerManager();
+    }
+
+    // Initialize stream publish token manager, which depends on workers manager.
     _srs_stream_publish_tokens = new SrsStreamPublishTokenManager();
 
     _srs_conn_manager = new SrsResourceManager("RTC", true);
@@ -131,6 +143,22 @@ srs_error_t srs_global_initialize()
     // Create global async worker for DVR.
     _srs_dvr_async = new SrsAsyncCallWorker();
 
+    // Create global async disk I/O, the I/O threads are started by server.
+    _srs_async_io = new SrsAsyncIo();
+
+    // Create global ingest threads, the threads are started by server.
+    _srs_ingest_threads = new SrsIngestThreads();
+
+    // Create global LL-HLS streams, served from memory.
+    _srs_hls_ll = new SrsHlsLowLatencyManager();
+
+    // Create global HLS/DASH segment cache, populated by muxers and served by HTTP static server.
+    _srs_segment_cache = new SrsSegmentCache();
+    _srs_segment_cache->assemble();
+
+    // Create global MP4 sample index cache, for VOD MP4 to seek by time.
+    _srs_mp4_index_cache = new SrsMp4IndexCache();
+
     _srs_reload_err = srs_success;
     _srs_reload_state = SrsReloadStateInit;
     SrsRand rand;
@@ -184,6 +212,7 @@ SrsServer::SrsServer()
 
     rtmp_listener_ = new SrsMultipleTcpListeners(this);
     rtmps_listener_ = new SrsMultipleTcpListeners(this);
+    relay_listener_ = new SrsTcpListener(this);
     api_listener_ = new SrsMultipleTcpListeners(this);
     apis_listener_ = new SrsMultipleTcpListeners(this);
     http_listener_ = new SrsMultipleTcpListeners(this);
@@ -215,6 +244,8 @@ SrsServer::SrsServer()
     conn_manager_ = _srs_conn_manager;
     rtc_dtls_certificate_ = _srs_rtc_dtls_certificate;
     dvr_async_ = _srs_dvr_async;
+    async_io_ = _srs_async_io;
+    ingest_threads_ = _srs_ingest_threads;
     circuit_breaker_ = _srs_circuit_breaker;
     srt_sources_ = _srs_srt_sources;
     rtc_sources_ = _srs_rtc_sources;
@@ -227,6 +258,7 @@ SrsServer::SrsServer()
     log_ = _srs_log;
     stat_ = _srs_stat;
     app_factory_ = _srs_app_factory;
+    workers_ = _srs_workers;
 }
 
 SrsServer::~SrsServer()
@@ -250,6 +282,7 @@ SrsServer::~SrsServer()
     srs_freep(latest_version_);
     srs_freep(rtmp_listener_);
     srs_freep(rtmps_listener_);
+    srs_freep(relay_listener_);
     srs_freep(api_listener_);
     srs_freep(apis_listener_);
     srs_freep(http_listener_);
@@ -283,6 +316,8 @@ SrsServer::~SrsServer()
     conn_manager_ = NULL;
     rtc_dtls_certificate_ = NULL;
     dvr_async_ = NULL;
+    async_io_ = NULL;
+    ingest_threads_ = NULL;
     circuit_breaker_ = NULL;
     srt_sources_ = NULL;
     rtc_sources_ = NULL;
@@ -295,6 +330,7 @@ SrsServer::~SrsServer()
     log_ = NULL;
     stat_ = NULL;
     app_factory_ = NULL;
+    workers_ = NULL;
 }
 
 void SrsServer::dispose()
@@ -302,6 +338,7 @@ void SrsServer::dispose()
     // Destroy all listeners.
     rtmp_listener_->close();
     rtmps_listener_->close();
+    relay_listener_->close();
     api_listener_->close();
     apis_listener_->close();
     http_listener_->close();
@@ -321,9 +358,15 @@ void SrsServer::dispose()
     // Fast stop to notify FFMPEG to quit, wait for a while then fast kill.
     ingester_->dispose();
 
+    // Finish the pending demux of ingest streams.
+    ingest_threads_->stop();
+
     // dispose the source for hls and dvr.
     live_sources_->dispose();
 
+    // Wait for the pending disk I/O of hls and dvr.
+    async_io_->stop();
+
     // @remark don't dispose all connections, for too slow.
 }
 
@@ -337,6 +380,7 @@ void SrsServer::gracefully_dispose()
     // Destroy all listeners.
     rtmp_listener_->close();
     rtmps_listener_->close();
+    relay_listener_->close();
     api_listener_->close();
     apis_listener_->close();
     http_listener_->close();
@@ -370,10 +414,18 @@ void SrsServer::gracefully_dispose()
         srs_trace("wait for %d conns to quit", (int)conn_manager_->size());
     }
 
+    // Finish the pending demux of ingest streams.
+    ingest_threads_->stop();
+    srs_trace("ingest threads stopped");
+
     // dispose the source for hls and dvr.
     live_sources_->dispose();
     srs_trace("source disposed");
 
+    // Wait for the pending disk I/O of hls and dvr.
+    async_io_->stop();
+    srs_trace("async io stopped");
+
     srs_usleep(config_->get_grace_final_wait());
     srs_trace("final wait for %dms", srsu2msi(config_->get_grace_final_wait()));
 }
@@ -388,10 +440,14 @@ srs_error_t SrsServer::initialize()
 {
     srs_error_t err = srs_success;
 
-    srs_trace("SRS server initialized in single thread mode");
+    if (workers_->enabled()) {
+        srs_trace("SRS server initialized in worker=%d mode", workers_->worker_id());
+    } else {
+        srs_trace("SRS server initialized in single thread mode");
+    }
 
-    // Initialize the server.
-    if ((err = pid_file_locker_->acquire()) != srs_success) {
+    // Initialize the server, the pid file is held by master for workers mode.
+    if (!workers_->enabled() && (err = pid_file_locker_->acquire()) != srs_success) {
         return srs_error_wrap(err, "init server");
     }
 
@@ -419,6 +475,16 @@ srs_error_t SrsServer::initialize()
         return srs_error_wrap(err, "dvr async");
     }
 
+    // Start the I/O threads for HLS, DASH and DVR, after workers are forked.
+    if ((err = async_io_->start()) != srs_success) {
+        return srs_error_wrap(err, "async io");
+    }
+
+    // Start the ingest threads to demux SRT, after workers are forked.
+    if ((err = ingest_threads_->start()) != srs_success) {
+        return srs_error_wrap(err, "ingest threads");
+    }
+
     bool stream = config_->get_http_stream_enabled();
     vector<string> http_listens = config_->get_http_stream_listens();
     vector<string> https_listens = config_->get_https_stream_listens();
@@ -587,6 +653,15 @@ srs_error_t SrsServer::listen()
         return srs_error_wrap(err, "rtmp listen");
     }
 
+    // Create RTMP relay listener on loopback, for other workers to pull streams.
+    if (workers_->enabled()) {
+        relay_listener_->set_label("RTMP-Relay");
+        relay_listener_->set_endpoint(workers_->relay_listen());
+        if ((err = relay_listener_->listen()) != srs_success) {
+            return srs_error_wrap(err, "relay listen");
+        }
+    }
+
     // Create RTMPS listeners.
     if (config_->get_rtmps_enabled()) {
         rtmps_listener_->add(config_->get_rtmps_listen())->set_label("RTMPS");
@@ -1132,6 +1207,11 @@ srs_error_t SrsServer::setup_ticks()
         }
     }
 
+    // Trim the object pools, to free the memory when load goes down.
+    if ((err = timer_->tick(13, 10 * SRS_UTIME_SECONDS)) != srs_success) {
+        return srs_error_wrap(err, "tick");
+    }
+
     if (config_->get_heartbeat_enabled()) {
         if ((err = timer_->tick(9, config_->get_heartbeat_interval())) != srs_success) {
             return srs_error_wrap(err, "tick");
@@ -1180,6 +1260,9 @@ srs_error_t SrsServer::notify(int event, srs_utime_t interval, srs_utime_t tick)
     case 12:
         srs_update_server_statistics();
         break;
+    case 13:
+        srs_object_pools_trim();
+        break;
     }
 
     return err;
@@ -1379,8 +1462,13 @@ srs_error_t SrsServer::listen_rtc_udp()
             return srs_error_new(ERROR_RTC_PORT, "invalid port=%d", port);
         }
 
+        // Each worker listens at its exclusive port, because the session is created by the worker which
+        // serves the SDP, so the UDP packets must be received by that worker.
+        port = workers_->exclusive_port(port);
+
         for (int i = 0; i < nn_listeners; i++) {
             SrsUdpMuxListener *listener = new SrsUdpMuxListener(this, ip, port);
+            listener->set_recvmmsg(config_->get_rtc_server_recvmmsg());
 
             if ((err = listener->listen()) != srs_success) {
                 srs_freep(listener);
@@ -1573,7 +1661,7 @@ srs_error_t SrsServer::do_on_tcp_client(ISrsListener *listener, srs_netfd_t &stf
 
     // Create resource by normal listeners.
     if (!resource) {
-        if (listener == rtmp_listener_) {
+        if (listener == rtmp_listener_ || listener == relay_listener_) {
             SrsRtmpTransport *transport = new SrsRtmpTransport(stfd2);
             SrsRtmpConn *conn = new SrsRtmpConn(transport, ip, port);
             conn->assemble();
@@ -61,6 +61,8 @@ class ISrsLiveSourceManager;
 class ISrsResourceManager;
 class ISrsDtlsCertificate;
 class ISrsAsyncCallWorker;
+class ISrsAsyncIo;
+class ISrsIngestThreads;
 class ISrsCircuitBreaker;
 class ISrsSrtSourceManager;
 class ISrsRtcSourceManager;
@@ -69,6 +71,7 @@ class ISrsLog;
 class ISrsStatistic;
 class ISrsHourGlass;
 class ISrsAppFactory;
+class ISrsWorkerManager;
 class ISrsUdpMuxSocket;
 class ISrsRtcConnection;
 
@@ -128,6 +131,8 @@ SRS_DECLARE_PRIVATE: // clang-format on
     ISrsResourceManager *conn_manager_;
     ISrsDtlsCertificate *rtc_dtls_certificate_;
     ISrsAsyncCallWorker *dvr_async_;
+    ISrsAsyncIo *async_io_;
+    ISrsIngestThreads *ingest_threads_;
     ISrsCircuitBreaker *circuit_breaker_;
     ISrsSrtSourceManager *srt_sources_;
     ISrsRtcSourceManager *rtc_sources_;
@@ -140,6 +145,7 @@ SRS_DECLARE_PRIVATE: // clang-format on
     ISrsLog *log_;
     ISrsStatistic *stat_;
     ISrsAppFactory *app_factory_;
+    ISrsWorkerManager *workers_;
 
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
@@ -167,6 +173,8 @@ SRS_DECLARE_PRIVATE: // clang-format on
     SrsMultipleTcpListeners *rtmp_listener_;
     // RTMPS stream listeners, over TCP.
     SrsMultipleTcpListeners *rtmps_listener_;
+    // RTMP relay listener for workers mode, over TCP on loopback, to serve streams to other workers.
+    SrsTcpListener *relay_listener_;
     // HTTP API listener, over TCP. Please note that it might reuse with stream listener.
     SrsMultipleTcpListeners *api_listener_;
     // HTTPS API listener, over TCP. Please note that it might reuse with stream listener.
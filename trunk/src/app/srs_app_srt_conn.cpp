@@ -21,6 +21,7 @@ using namespace std;
 #include <srs_kernel_buffer.hpp>
 #include <srs_kernel_flv.hpp>
 #include <srs_kernel_pithy_print.hpp>
+#include <srs_kernel_pool.hpp>
 #include <srs_kernel_stream.hpp>
 #include <srs_kernel_utility.hpp>
 #include <srs_protocol_rtmp_stack.hpp>
@@ -66,6 +67,11 @@ srs_error_t SrsSrtConnection::get_stats(SrsSrtStat &stat)
     return stat.fetch(srt_fd_, true);
 }
 
+srs_error_t SrsSrtConnection::recvmsgs(iovec *iovs, int nn_iovs, int *nn_msgs)
+{
+    return srt_skt_->recvmsgs(iovs, nn_iovs, nn_msgs);
+}
+
 void SrsSrtConnection::set_recv_timeout(srs_utime_t tm)
 {
     srt_skt_->set_recv_timeout(tm);
@@ -116,6 +122,66 @@ srs_error_t SrsSrtConnection::writev(const iovec *iov, int iov_size, ssize_t *nw
     return srs_error_new(ERROR_SRT_CONN, "unsupport method");
 }
 
+static SrsObjectPool *_srs_pool_srt_recv = NULL;
+
+SrsSrtRecvBuffers::SrsSrtRecvBuffers(int size)
+{
+    // Shared by all SRT publishers, which are served by the ST thread.
+    if (!_srs_pool_srt_recv) {
+        _srs_pool_srt_recv = srs_object_pool_create("srt_recv_buffer", SRS_SRT_MAX_MSG_SIZE);
+    }
+    pool_ = _srs_pool_srt_recv;
+
+    size_ = size;
+    iovs_ = new iovec[size];
+
+    for (int i = 0; i < size_; i++) {
+        iovs_[i].iov_base = pool_->allocate(SRS_SRT_MAX_MSG_SIZE);
+        iovs_[i].iov_len = SRS_SRT_MAX_MSG_SIZE;
+    }
+}
+
+SrsSrtRecvBuffers::~SrsSrtRecvBuffers()
+{
+    for (int i = 0; i < size_; i++) {
+        pool_->deallocate(iovs_[i].iov_base, SRS_SRT_MAX_MSG_SIZE);
+    }
+    srs_freepa(iovs_);
+}
+
+iovec *SrsSrtRecvBuffers::prepare()
+{
+    for (int i = 0; i < size_; i++) {
+        iovs_[i].iov_len = SRS_SRT_MAX_MSG_SIZE;
+    }
+    return iovs_;
+}
+
+int SrsSrtRecvBuffers::size()
+{
+    return size_;
+}
+
+int SrsSrtRecvBuffers::length(int index)
+{
+    return (int)iovs_[index].iov_len;
+}
+
+char *SrsSrtRecvBuffers::detach(int index)
+{
+    char *buf = (char *)iovs_[index].iov_base;
+
+    iovs_[index].iov_base = pool_->allocate(SRS_SRT_MAX_MSG_SIZE);
+    iovs_[index].iov_len = SRS_SRT_MAX_MSG_SIZE;
+
+    return buf;
+}
+
+SrsObjectPool *SrsSrtRecvBuffers::pool()
+{
+    return pool_;
+}
+
 ISrsSrtRecvThread::ISrsSrtRecvThread()
 {
 }
@@ -555,8 +621,8 @@ srs_error_t SrsMpegtsSrtConn::do_publishing()
 
     int nb_packets = 0;
 
-    // Max udp packet size equal to 1500.
-    char buf[1500];
+    // Drain all received messages per wakeup, and attach the buffers to packets without copy.
+    SrsSrtRecvBuffers buffers(SRS_SRT_RECV_BATCH);
     while (true) {
         if ((err = trd_->pull()) != srs_success) {
             return srs_error_wrap(err, "srt: thread quit");
@@ -579,16 +645,29 @@ srs_error_t SrsMpegtsSrtConn::do_publishing()
             nb_packets = 0;
         }
 
-        ssize_t nb = 0;
-        if ((err = srt_conn_->read(buf, sizeof(buf), &nb)) != srs_success) {
+        int nn_msgs = 0;
+        if ((err = srt_conn_->recvmsgs(buffers.prepare(), buffers.size(), &nn_msgs)) != srs_success) {
             return srs_error_wrap(err, "srt: recvmsg");
         }
 
-        ++nb_packets;
+        nb_packets += nn_msgs;
+
+        for (int i = 0; i < nn_msgs; i++) {
+            int nb = buffers.length(i);
+            if (nb <= 0) {
+                continue;
+            }
+
+            SrsUniquePtr<SrsSrtPacket> packet(new SrsSrtPacket());
+            packet->attach(buffers.detach(i), nb, buffers.pool());
 
-        if ((err = on_srt_packet(buf, nb)) != srs_success) {
-            return srs_error_wrap(err, "srt: process packet");
+            if ((err = on_srt_packet(packet.get())) != srs_success) {
+                return srs_error_wrap(err, "srt: process packet");
+            }
         }
+
+        // Demux the packets of this wakeup in batch.
+        srt_source_->flush();
     }
 
     return err;
@@ -675,9 +754,25 @@ srs_error_t SrsMpegtsSrtConn::do_playing()
 }
 
 srs_error_t SrsMpegtsSrtConn::on_srt_packet(char *buf, int nb_buf)
+{
+    // Ignore if invalid length.
+    if (nb_buf <= 0) {
+        return srs_success;
+    }
+
+    SrsUniquePtr<SrsSrtPacket> packet(new SrsSrtPacket());
+    packet->wrap(buf, nb_buf);
+
+    return on_srt_packet(packet.get());
+}
+
+srs_error_t SrsMpegtsSrtConn::on_srt_packet(SrsSrtPacket *packet)
 {
     srs_error_t err = srs_success;
 
+    char *buf = packet->data();
+    int nb_buf = packet->size();
+
     // Ignore if invalid length.
     if (nb_buf <= 0) {
         return err;
@@ -693,10 +788,7 @@ srs_error_t SrsMpegtsSrtConn::on_srt_packet(char *buf, int nb_buf)
         return srs_error_new(ERROR_SRT_CONN, "invalid ts packet first=%#x", (uint8_t)buf[0]);
     }
 
-    SrsUniquePtr<SrsSrtPacket> packet(new SrsSrtPacket());
-    packet->wrap(buf, nb_buf);
-
-    if ((err = srt_source_->on_srt_packet(packet.get())) != srs_success) {
+    if ((err = srt_source_->on_srt_packet(packet)) != srs_success) {
         return srs_error_wrap(err, "on srt packet");
     }
 
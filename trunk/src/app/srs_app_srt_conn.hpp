@@ -35,6 +35,8 @@ class ISrsLiveSourceManager;
 class ISrsRtcSourceManager;
 class ISrsHttpHooks;
 class SrsSrtStat;
+class SrsSrtPacket;
+class SrsObjectPool;
 
 // The SRT connection interface.
 class ISrsSrtConnection : public ISrsProtocolReadWriter
@@ -47,6 +49,8 @@ public:
     virtual srs_srt_t srtfd() = 0;
     virtual srs_error_t get_streamid(std::string &streamid) = 0;
     virtual srs_error_t get_stats(SrsSrtStat &stat) = 0;
+    // Receive messages in batch, see ISrsSrtSocket::recvmsgs.
+    virtual srs_error_t recvmsgs(iovec *iovs, int nn_iovs, int *nn_msgs) = 0;
 };
 
 // The basic connection of SRS, for SRT based protocols,
@@ -66,6 +70,7 @@ public:
     virtual srs_srt_t srtfd();
     virtual srs_error_t get_streamid(std::string &streamid);
     virtual srs_error_t get_stats(SrsSrtStat &stat);
+    virtual srs_error_t recvmsgs(iovec *iovs, int nn_iovs, int *nn_msgs);
 
     // Interface ISrsProtocolReadWriter
 public:
@@ -88,6 +93,38 @@ SRS_DECLARE_PRIVATE: // clang-format on
     ISrsSrtSocket *srt_skt_;
 };
 
+// The max size of SRT message, equals to the max UDP packet size.
+#define SRS_SRT_MAX_MSG_SIZE 1500
+// The max number of SRT messages to receive in a batch.
+#define SRS_SRT_RECV_BATCH 32
+
+// The ring of buffers to receive SRT messages in batch. The buffer of a received message is detached and attached to
+// the SRT packet without copy, then the slot is refilled by a new buffer, while the unused buffers are reused by the
+// next batch. The buffers are allocated from a pool, and released back to it when the packet is freed.
+class SrsSrtRecvBuffers
+{
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    SrsObjectPool *pool_;
+    iovec *iovs_;
+    int size_;
+
+public:
+    SrsSrtRecvBuffers(int size);
+    virtual ~SrsSrtRecvBuffers();
+
+public:
+    // Reset the length of all buffers, and return the iovecs to receive messages.
+    iovec *prepare();
+    int size();
+    // Get the size of received message at index.
+    int length(int index);
+    // Detach the buffer at index, which is owned by caller, and refill the slot with a new buffer.
+    // @remark The buffer is allocated from the pool, which should be released back to it.
+    char *detach(int index);
+    SrsObjectPool *pool();
+};
+
 // The recv thread for SRT connection.
 class ISrsSrtRecvThread : public ISrsCoroutineHandler
 {
@@ -189,6 +226,7 @@ SRS_DECLARE_PRIVATE: // clang-format on
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
     srs_error_t on_srt_packet(char *buf, int nb_buf);
+    srs_error_t on_srt_packet(SrsSrtPacket *packet);
 
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
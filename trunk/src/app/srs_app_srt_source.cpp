@@ -63,6 +63,15 @@ char *SrsSrtPacket::wrap(char *data, int size)
     return buf;
 }
 
+void SrsSrtPacket::attach(char *data, int size, SrsObjectPool *pool)
+{
+    srs_freep(shared_buffer_);
+    shared_buffer_ = new SrsMediaPacket();
+    shared_buffer_->wrap(data, size, pool);
+
+    actual_buffer_size_ = size;
+}
+
 char *SrsSrtPacket::wrap(SrsMediaPacket *msg)
 {
     // Generally, the wrap(msg) is used for RTMP to SRT, where the msg
@@ -309,6 +318,90 @@ void SrsSrtConsumer::wait(int nb_msgs, srs_utime_t timeout)
     srs_cond_timedwait(mw_wait_, timeout);
 }
 
+SrsSrtDemuxTask::SrsSrtDemuxTask(SrsSrtFrameBuilder *builder, SrsTsContext *ctx)
+{
+    builder_ = builder;
+    ts_ctx_ = ctx;
+    data_.reserve(SRS_SRT_DEMUX_BATCH_SIZE);
+}
+
+SrsSrtDemuxTask::~SrsSrtDemuxTask()
+{
+    for (int i = 0; i < (int)msgs_.size(); i++) {
+        SrsTsMessage *msg = msgs_.at(i);
+        srs_freep(msg);
+    }
+    for (int i = 0; i < (int)channels_.size(); i++) {
+        SrsTsChannel *channel = channels_.at(i);
+        srs_freep(channel);
+    }
+    for (int i = 0; i < (int)errs_.size(); i++) {
+        srs_error_t err = errs_.at(i);
+        srs_freep(err);
+    }
+}
+
+void SrsSrtDemuxTask::append(SrsSrtPacket *packet)
+{
+    char *p = packet->data();
+    data_.insert(data_.end(), p, p + packet->size());
+}
+
+int SrsSrtDemuxTask::size()
+{
+    return (int)data_.size();
+}
+
+void SrsSrtDemuxTask::execute()
+{
+    srs_error_t err = srs_success;
+
+    char *data = data_.empty() ? NULL : &data_[0];
+    int nb_packet = (int)data_.size() / SRS_TS_PACKET_SIZE;
+    for (int i = 0; i < nb_packet; i++) {
+        SrsBuffer stream(data + (i * SRS_TS_PACKET_SIZE), SRS_TS_PACKET_SIZE);
+
+        // The error is logged by ST thread, like demux in place.
+        if ((err = ts_ctx_->decode(&stream, this)) != srs_success) {
+            errs_.push_back(err);
+        }
+    }
+}
+
+srs_error_t SrsSrtDemuxTask::finish()
+{
+    srs_error_t err = srs_success;
+
+    for (int i = 0; i < (int)errs_.size(); i++) {
+        srs_warn("parse ts packet err=%s", srs_error_desc(errs_.at(i)).c_str());
+    }
+
+    for (int i = 0; i < (int)msgs_.size(); i++) {
+        if ((err = builder_->on_ts_message(msgs_.at(i))) != srs_success) {
+            srs_warn("parse ts packet err=%s", srs_error_desc(err).c_str());
+            srs_freep(err);
+        }
+    }
+
+    return err;
+}
+
+srs_error_t SrsSrtDemuxTask::on_ts_message(SrsTsMessage *msg)
+{
+    // The channel might be changed by next task, for example, PMT refreshed, so copy it.
+    SrsTsChannel *channel = new SrsTsChannel();
+    channel->pid_ = msg->channel_->pid_;
+    channel->apply_ = msg->channel_->apply_;
+    channel->stream_ = msg->channel_->stream_;
+    channels_.push_back(channel);
+
+    SrsTsMessage *cp = msg->detach();
+    cp->channel_ = channel;
+    msgs_.push_back(cp);
+
+    return srs_success;
+}
+
 SrsSrtFrameBuilder::SrsSrtFrameBuilder(ISrsFrameTarget *target)
 {
     ts_ctx_ = new SrsTsContext();
@@ -319,6 +412,8 @@ SrsSrtFrameBuilder::SrsSrtFrameBuilder(ISrsFrameTarget *target)
 
     req_ = NULL;
     frame_target_ = target;
+    ingest_threads_ = _srs_ingest_threads;
+    batch_ = NULL;
 
     video_streamid_ = 1;
     audio_streamid_ = 2;
@@ -328,6 +423,11 @@ SrsSrtFrameBuilder::SrsSrtFrameBuilder(ISrsFrameTarget *target)
 
 SrsSrtFrameBuilder::~SrsSrtFrameBuilder()
 {
+    // The pending demux tasks, which use the TS context, are drained by on_unpublish, never wait
+    // in destructor.
+    ingest_threads_ = NULL;
+    srs_freep(batch_);
+
     srs_freep(ts_ctx_);
     srs_freep(req_);
 
@@ -346,6 +446,20 @@ srs_error_t SrsSrtFrameBuilder::on_srt_packet(SrsSrtPacket *pkt)
     char *buf = pkt->data();
     int nb_buf = pkt->size();
 
+    // Demux in ingest thread of stream by a batch of packets, which is submitted when flush or full,
+    // and the messages are consumed in ST thread, in order.
+    if (ingest_threads_->enabled()) {
+        if (!batch_) {
+            batch_ = new SrsSrtDemuxTask(this, ts_ctx_);
+        }
+        batch_->append(pkt);
+
+        if (batch_->size() >= SRS_SRT_DEMUX_BATCH_SIZE) {
+            flush();
+        }
+        return err;
+    }
+
     // use stream to parse ts packet.
     int nb_packet = nb_buf / SRS_TS_PACKET_SIZE;
     for (int i = 0; i < nb_packet; i++) {
@@ -364,8 +478,22 @@ srs_error_t SrsSrtFrameBuilder::on_srt_packet(SrsSrtPacket *pkt)
     return err;
 }
 
+void SrsSrtFrameBuilder::flush()
+{
+    if (!batch_) {
+        return;
+    }
+
+    SrsSrtDemuxTask *task = batch_;
+    batch_ = NULL;
+    ingest_threads_->submit(task, (uint64_t)this);
+}
+
 void SrsSrtFrameBuilder::on_unpublish()
 {
+    // Consume the pending messages before unpublish.
+    flush();
+    ingest_threads_->drain((uint64_t)this);
 }
 
 srs_error_t SrsSrtFrameBuilder::initialize(ISrsRequest *req)
@@ -1459,3 +1587,10 @@ srs_error_t SrsSrtSource::on_srt_packet(SrsSrtPacket *packet)
 
     return err;
 }
+
+void SrsSrtSource::flush()
+{
+    if (srt_bridge_) {
+        srt_bridge_->flush();
+    }
+}
@@ -12,6 +12,7 @@
 #include <map>
 #include <vector>
 
+#include <srs_app_ingest_thread.hpp>
 #include <srs_app_stream_bridge.hpp>
 #include <srs_core_autofree.hpp>
 #include <srs_kernel_hourglass.hpp>
@@ -27,6 +28,7 @@ class SrsSrtFrameBuilder;
 class ISrsStatistic;
 class ISrsSrtConsumer;
 class ISrsSrtSource;
+class SrsObjectPool;
 
 // The SRT packet with shared message.
 class SrsSrtPacket
@@ -39,6 +41,9 @@ public:
     // Wrap buffer to shared_message, which is managed by us.
     char *wrap(int size);
     char *wrap(char *data, int size);
+    // Attach the buffer to shared message without copy, the data is allocated from the pool, and released back to
+    // it when the last copy of packet is freed.
+    void attach(char *data, int size, SrsObjectPool *pool);
     // Wrap the shared message, we copy it.
     char *wrap(SrsMediaPacket *msg);
     // Copy the SRT packet.
@@ -197,6 +202,46 @@ SRS_DECLARE_PRIVATE: // clang-format on
     int nn_audio_frames_;
 };
 
+// The max bytes of TS packets in a demux task, for a batch of SRT packets.
+#define SRS_SRT_DEMUX_BATCH_SIZE (32 * 7 * SRS_TS_PACKET_SIZE)
+
+// The task to demux the TS packets of SRT in ingest thread. The messages are detached from the TS
+// context, with a copy of channel, and consumed by the frame builder in ST thread.
+class SrsSrtDemuxTask : public ISrsIngestTask, public ISrsTsHandler
+{
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    SrsSrtFrameBuilder *builder_;
+    // The TS context of builder, only used by the ingest thread of stream.
+    SrsTsContext *ts_ctx_;
+    // The TS packets of a batch of SRT packets, for example, all packets received in one wakeup. The
+    // payload is copied into one buffer, so there is no packet to create or free for each SRT packet.
+    std::vector<char> data_;
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    std::vector<SrsTsMessage *> msgs_;
+    std::vector<SrsTsChannel *> channels_;
+    std::vector<srs_error_t> errs_;
+
+public:
+    SrsSrtDemuxTask(SrsSrtFrameBuilder *builder, SrsTsContext *ctx);
+    virtual ~SrsSrtDemuxTask();
+
+public:
+    // Append the TS packets of SRT packet to the batch.
+    virtual void append(SrsSrtPacket *packet);
+    // The bytes of TS packets in the batch.
+    virtual int size();
+    // Interface ISrsIngestTask
+public:
+    virtual void execute();
+    virtual srs_error_t finish();
+    // Interface ISrsTsHandler
+public:
+    virtual srs_error_t on_ts_message(SrsTsMessage *msg);
+};
+
 // Collect and build SRT TS packet to AV frames.
 class SrsSrtFrameBuilder : public ISrsTsHandler
 {
@@ -210,6 +255,9 @@ public:
 public:
     virtual srs_error_t on_publish();
     virtual srs_error_t on_srt_packet(SrsSrtPacket *pkt);
+    // Submit the batch of packets to ingest thread, for example, after all packets of one wakeup.
+    virtual void flush();
+    // Wait for the pending demux tasks in ingest threads, which must be called before free.
     virtual void on_unpublish();
     // Interface ISrsTsHandler
 public:
@@ -230,6 +278,9 @@ SRS_DECLARE_PRIVATE: // clang-format on
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
     ISrsFrameTarget *frame_target_;
+    ISrsIngestThreads *ingest_threads_;
+    // The batch of packets to demux in ingest thread, submitted when flush or full.
+    SrsSrtDemuxTask *batch_;
 
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
@@ -319,6 +370,8 @@ public:
 
 public:
     srs_error_t on_srt_packet(SrsSrtPacket *packet);
+    // Flush the packets received in one wakeup, for bridge to demux them in batch.
+    virtual void flush();
 
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
@@ -10,6 +10,7 @@
 #include <unistd.h>
 using namespace std;
 
+#include <srs_app_async_io.hpp>
 #include <srs_app_config.hpp>
 #include <srs_protocol_conn.hpp>
 
@@ -140,6 +141,11 @@ srs_error_t SrsStatisticStream::dumps(SrsJsonObject *obj)
         publish->set("cid", SrsJsonAny::str(publisher_id_.c_str()));
     }
 
+    // The pending disk I/O of HLS, DASH and DVR, which are written by the publisher coroutine.
+    if (_srs_async_io && _srs_async_io->enabled() && !publisher_id_.empty()) {
+        publish->set("aio_queue", SrsJsonAny::integer(_srs_async_io->depth(publisher_id_)));
+    }
+
     if (!has_video_) {
         obj->set("video", SrsJsonAny::null());
     } else {
@@ -338,6 +338,11 @@ srs_error_t SrsSrtBridge::on_srt_packet(SrsSrtPacket *pkt)
     return err;
 }
 
+void SrsSrtBridge::flush()
+{
+    frame_builder_->flush();
+}
+
 srs_error_t SrsSrtBridge::on_frame(SrsMediaPacket *frame)
 {
     srs_error_t err = srs_success;
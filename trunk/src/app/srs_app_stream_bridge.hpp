@@ -134,6 +134,8 @@ public:
     virtual srs_error_t initialize(ISrsRequest *r) = 0;
     virtual srs_error_t on_publish() = 0;
     virtual void on_unpublish() = 0;
+    // Flush the packets received in one wakeup.
+    virtual void flush() = 0;
 };
 
 // A SRT bridge to convert SRT stream to different protocols, such as RTMP and RTC.
@@ -172,6 +174,7 @@ public:
     virtual srs_error_t on_publish();
     virtual void on_unpublish();
     virtual srs_error_t on_srt_packet(SrsSrtPacket *pkt);
+    virtual void flush();
     virtual srs_error_t on_frame(SrsMediaPacket *frame);
 };
 
@@ -7,6 +7,7 @@
 #include <srs_app_stream_token.hpp>
 
 #include <srs_app_config.hpp>
+#include <srs_app_workers.hpp>
 #include <srs_kernel_error.hpp>
 #include <srs_kernel_log.hpp>
 #include <srs_protocol_rtmp_stack.hpp>
@@ -75,6 +76,7 @@ ISrsStreamPublishTokenManager::~ISrsStreamPublishTokenManager()
 SrsStreamPublishTokenManager::SrsStreamPublishTokenManager()
 {
     mutex_ = srs_mutex_new();
+    workers_ = _srs_workers;
 }
 
 SrsStreamPublishTokenManager::~SrsStreamPublishTokenManager()
@@ -90,6 +92,7 @@ SrsStreamPublishTokenManager::~SrsStreamPublishTokenManager()
     }
 
     srs_mutex_destroy(mutex_);
+    workers_ = NULL;
     srs_trace("stream publish token manager destroyed");
 }
 
@@ -108,22 +111,29 @@ srs_error_t SrsStreamPublishTokenManager::acquire_token(ISrsRequest *req, SrsStr
     std::map<std::string, SrsStreamPublishToken *>::iterator it = tokens_.find(stream_url);
     if (it != tokens_.end()) {
         stream_token = it->second;
-    } else {
-        stream_token = new SrsStreamPublishToken(stream_url, this);
-        tokens_[stream_url] = stream_token;
     }
 
     // Check if token is already acquired by another publisher
-    if (stream_token->is_acquired()) {
+    if (stream_token && stream_token->is_acquired()) {
         SrsContextId existing_cid = stream_token->publisher_cid();
         return srs_error_new(ERROR_SYSTEM_STREAM_BUSY,
                              "stream %s is busy, acquired by cid=%s, current cid=%s",
                              stream_url.c_str(), existing_cid.c_str(), current_cid.c_str());
-    } else {
-        stream_token->set_acquired(true);
-        stream_token->set_publisher_cid(current_cid);
     }
 
+    // Check if stream is published by another worker.
+    if ((err = workers_->acquire(stream_url)) != srs_success) {
+        return srs_error_wrap(err, "acquire from workers");
+    }
+
+    if (!stream_token) {
+        stream_token = new SrsStreamPublishToken(stream_url, this);
+        tokens_[stream_url] = stream_token;
+    }
+
+    stream_token->set_acquired(true);
+    stream_token->set_publisher_cid(current_cid);
+
     // Return the token from the map (caller will manage its lifetime)
     token = stream_token;
 
@@ -139,6 +149,9 @@ void SrsStreamPublishTokenManager::release_token(const std::string &stream_url)
     srs_assert(it != tokens_.end());
 
     SrsStreamPublishToken *token = it->second;
+    if (token->is_acquired()) {
+        workers_->release(stream_url);
+    }
     token->set_acquired(false);
     srs_trace("stream publish token released and deleted, url=%s", stream_url.c_str());
 
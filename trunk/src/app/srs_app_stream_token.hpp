@@ -19,6 +19,7 @@
 class ISrsRequest;
 class SrsStreamPublishTokenManager;
 class ISrsStreamPublishTokenManager;
+class ISrsWorkerManager;
 
 // The interface for stream publish token
 class ISrsStreamPublishToken
@@ -91,6 +92,8 @@ SRS_DECLARE_PRIVATE: // clang-format on
         tokens_;
     // Mutex to protect the tokens map
     srs_mutex_t mutex_;
+    // For workers mode, the stream is also exclusive cross all workers.
+    ISrsWorkerManager *workers_;
 
 public:
     SrsStreamPublishTokenManager();
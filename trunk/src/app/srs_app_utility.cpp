@@ -24,10 +24,15 @@
 using namespace std;
 
 #include <srs_app_config.hpp>
+#include <srs_app_log.hpp>
+#include <srs_app_mp4_index.hpp>
+#include <srs_app_rtmp_source.hpp>
+#include <srs_app_segment_cache.hpp>
 #include <srs_kernel_buffer.hpp>
 #include <srs_kernel_error.hpp>
 #include <srs_kernel_kbps.hpp>
 #include <srs_kernel_log.hpp>
+#include <srs_kernel_pool.hpp>
 #include <srs_kernel_utility.hpp>
 #include <srs_protocol_amf0.hpp>
 #include <srs_protocol_json.hpp>
@@ -1377,6 +1382,10 @@ void srs_api_dump_summaries(SrsJsonObject *obj)
     self->set("cpu_percent", SrsJsonAny::number(u->percent_));
     self->set("srs_uptime", SrsJsonAny::integer(srs_uptime));
 
+    // The number of log lines dropped by limit or full ring.
+    SrsFileLog *file_log = dynamic_cast<SrsFileLog *>(_srs_log);
+    self->set("log_dropped", SrsJsonAny::integer(file_log ? file_log->dropped() : 0));
+
     // system
     SrsJsonObject *sys = SrsJsonAny::object();
     data->set("system", sys);
@@ -1413,6 +1422,46 @@ void srs_api_dump_summaries(SrsJsonObject *obj)
     sys->set("conn_sys_tw", SrsJsonAny::integer(nrs->nb_conn_sys_tw_));
     sys->set("conn_sys_udp", SrsJsonAny::integer(nrs->nb_conn_sys_udp_));
     sys->set("conn_srs", SrsJsonAny::integer(nrs->nb_conn_srs_));
+
+    // HLS/DASH segment cache of HTTP static server.
+    if (_srs_segment_cache) {
+        SrsJsonObject *cache = SrsJsonAny::object();
+        data->set("segment_cache", cache);
+        _srs_segment_cache->dumps(cache);
+    }
+
+    // The sample index cache of VOD MP4, for seeking by time.
+    if (_srs_mp4_index_cache) {
+        SrsJsonObject *index = SrsJsonAny::object();
+        data->set("mp4_index", index);
+        _srs_mp4_index_cache->dumps(index);
+    }
+
+    // The media memory of live sources, for memory budget.
+    if (_srs_sources) {
+        SrsJsonObject *memory = SrsJsonAny::object();
+        data->set("media_memory", memory);
+        _srs_sources->dumps(memory);
+    }
+
+    // The object pools of packets.
+    SrsJsonObject *pools = SrsJsonAny::object();
+    data->set("pools", pools);
+
+    std::vector<SrsObjectPool *> &objs = srs_object_pools();
+    for (int i = 0; i < (int)objs.size(); i++) {
+        SrsObjectPool *pool = objs[i];
+
+        SrsJsonObject *obj = SrsJsonAny::object();
+        pools->set(pool->name(), obj);
+
+        obj->set("size", SrsJsonAny::integer((int64_t)pool->size()));
+        obj->set("used", SrsJsonAny::integer(pool->nn_used()));
+        obj->set("free", SrsJsonAny::integer(pool->nn_free()));
+        obj->set("allocs", SrsJsonAny::integer(pool->nn_allocs()));
+        obj->set("hits", SrsJsonAny::integer(pool->nn_hits()));
+        obj->set("trims", SrsJsonAny::integer(pool->nn_trims()));
+    }
 }
 
 string srs_getenv(const string &key)
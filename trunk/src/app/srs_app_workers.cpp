@@ -0,0 +1,620 @@
+//
+// Copyright (c) 2013-2025 The SRS Authors
+//
+// SPDX-License-Identifier: MIT
+//
+
+#include <srs_app_workers.hpp>
+
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sys/prctl.h>
+#endif
+using namespace std;
+
+#include <srs_app_config.hpp>
+#include <srs_app_server.hpp>
+#include <srs_kernel_consts.hpp>
+#include <srs_kernel_error.hpp>
+#include <srs_kernel_log.hpp>
+#include <srs_kernel_utility.hpp>
+
+SrsWorkerManager *_srs_workers = NULL;
+
+// The signals received by master, which are forwarded to workers.
+static volatile sig_atomic_t _srs_workers_reload = 0;
+static volatile sig_atomic_t _srs_workers_reopen = 0;
+static volatile sig_atomic_t _srs_workers_upgrade = 0;
+static volatile sig_atomic_t _srs_workers_quit = 0;
+
+// LCOV_EXCL_START
+static void srs_workers_on_signal(int signo)
+{
+    if (signo == SRS_SIGNAL_RELOAD) {
+        _srs_workers_reload = 1;
+    } else if (signo == SRS_SIGNAL_REOPEN_LOG) {
+        _srs_workers_reopen = 1;
+    } else if (signo == SRS_SIGNAL_UPGRADE) {
+        _srs_workers_upgrade = 1;
+    } else if (!_srs_workers_quit) {
+        _srs_workers_quit = signo;
+    }
+}
+// LCOV_EXCL_STOP
+
+// The signals handled by master.
+static int _srs_workers_signos[] = {SRS_SIGNAL_RELOAD, SRS_SIGNAL_REOPEN_LOG, SRS_SIGNAL_UPGRADE,
+                                    SRS_SIGNAL_FAST_QUIT, SRS_SIGNAL_GRACEFULLY_QUIT, SIGINT};
+
+// The index of slot in table, by the FNV-1a hash of stream url.
+static int srs_workers_slot_index(const char *url, int size)
+{
+    uint32_t hash = 2166136261u;
+    for (int i = 0; i < size; i++) {
+        hash ^= (uint8_t)url[i];
+        hash *= 16777619u;
+    }
+    return (int)(hash % SRS_WORKERS_MAX_STREAMS);
+}
+
+// The max times to read the table without lock, then read it with lock.
+#define SRS_WORKERS_MAX_READS 64
+
+ISrsWorkerManager::ISrsWorkerManager()
+{
+}
+
+ISrsWorkerManager::~ISrsWorkerManager()
+{
+}
+
+SrsWorkerManager::SrsWorkerManager()
+{
+    nn_workers_ = 0;
+    worker_id_ = -1;
+    relay_port_ = 0;
+    cpu_affinity_ = false;
+    table_ = NULL;
+    pid_file_locker_ = NULL;
+
+    config_ = _srs_config;
+}
+
+SrsWorkerManager::~SrsWorkerManager()
+{
+    if (table_) {
+        munmap(table_, sizeof(SrsWorkerStreamTable));
+        table_ = NULL;
+    }
+    srs_freep(pid_file_locker_);
+
+    config_ = NULL;
+}
+
+srs_error_t SrsWorkerManager::initialize()
+{
+    srs_error_t err = srs_success;
+
+    if (!config_->get_workers_enabled()) {
+        return err;
+    }
+
+    nn_workers_ = config_->get_workers_count();
+    if (nn_workers_ <= 0) {
+        nn_workers_ = srs_max(1, (int)sysconf(_SC_NPROCESSORS_ONLN));
+    }
+    relay_port_ = config_->get_workers_relay_port();
+    cpu_affinity_ = config_->get_workers_cpu_affinity();
+
+    if (nn_workers_ > SRS_WORKERS_MAX_WORKERS) {
+        return srs_error_new(ERROR_SYSTEM_CONFIG_INVALID, "too many workers=%d, max=%d", nn_workers_, SRS_WORKERS_MAX_WORKERS);
+    }
+
+    if (relay_port_ <= 0 || relay_port_ + nn_workers_ > 65535) {
+        return srs_error_new(ERROR_SYSTEM_CONFIG_INVALID, "invalid relay port=%d for %d workers", relay_port_, nn_workers_);
+    }
+
+    if ((err = create_table()) != srs_success) {
+        return srs_error_wrap(err, "create table");
+    }
+
+    srs_trace("workers: enabled, count=%d, cpu_affinity=%d, relay_port=%d", nn_workers_, cpu_affinity_, relay_port_);
+
+    return err;
+}
+
+// LCOV_EXCL_START
+srs_error_t SrsWorkerManager::spawn()
+{
+    srs_error_t err = srs_success;
+
+    if (nn_workers_ <= 0) {
+        return err;
+    }
+
+    // The master holds the pid file, because fcntl lock is not inherited by workers.
+    pid_file_locker_ = new SrsPidFileLocker();
+    if ((err = pid_file_locker_->acquire()) != srs_success) {
+        return srs_error_wrap(err, "acquire pid file");
+    }
+
+    pids_.resize(nn_workers_, 0);
+
+    bool is_worker = false;
+    for (int i = 0; i < nn_workers_; i++) {
+        if ((err = fork_worker(i, is_worker)) != srs_success) {
+            return srs_error_wrap(err, "fork worker %d", i);
+        }
+
+        if (is_worker) {
+            return err;
+        }
+    }
+
+    if ((err = supervise(is_worker)) != srs_success) {
+        return srs_error_wrap(err, "supervise");
+    }
+
+    return err;
+}
+
+bool SrsWorkerManager::is_master()
+{
+    return nn_workers_ > 0 && worker_id_ < 0;
+}
+// LCOV_EXCL_STOP
+
+bool SrsWorkerManager::enabled()
+{
+    return worker_id_ >= 0;
+}
+
+int SrsWorkerManager::worker_id()
+{
+    return worker_id_;
+}
+
+int SrsWorkerManager::exclusive_port(int port)
+{
+    return enabled() ? port + worker_id_ : port;
+}
+
+std::string SrsWorkerManager::relay_listen()
+{
+    if (!enabled()) {
+        return "";
+    }
+
+    return srs_fmt_sprintf("127.0.0.1:%d", relay_port_ + worker_id_);
+}
+
+srs_error_t SrsWorkerManager::acquire(const std::string &stream_url)
+{
+    srs_error_t err = srs_success;
+
+    if (!enabled() || !table_) {
+        return err;
+    }
+
+    if (stream_url.length() >= SRS_WORKERS_MAX_URL) {
+        return srs_error_new(ERROR_SYSTEM_WORKER_TABLE, "url %s too long", stream_url.c_str());
+    }
+
+    lock();
+
+    SrsWorkerStreamSlot *slot = find_slot(stream_url);
+    if (slot && slot->worker_ != worker_id_ && is_alive(slot)) {
+        int owner = slot->worker_;
+        unlock();
+        return srs_error_new(ERROR_SYSTEM_STREAM_BUSY, "stream %s is busy, published on worker=%d", stream_url.c_str(), owner);
+    }
+
+    // Reuse the free slot, or the slot left by dead worker, in the probe sequence of stream.
+    int index = srs_workers_slot_index(stream_url.data(), (int)stream_url.length());
+    for (int i = 0; !slot && i < SRS_WORKERS_MAX_STREAMS; i++) {
+        SrsWorkerStreamSlot *p = &table_->slots_[(index + i) % SRS_WORKERS_MAX_STREAMS];
+        if (!p->used_ || !is_alive(p)) {
+            slot = p;
+        }
+    }
+
+    if (!slot) {
+        unlock();
+        return srs_error_new(ERROR_SYSTEM_WORKER_TABLE, "full table for %s, max=%d", stream_url.c_str(), SRS_WORKERS_MAX_STREAMS);
+    }
+
+    slot->used_ = 1;
+    slot->worker_ = worker_id_;
+    slot->generation_ = table_->workers_[worker_id_].generation_;
+    memcpy(slot->url_, stream_url.data(), stream_url.length());
+    slot->url_[stream_url.length()] = 0;
+
+    unlock();
+
+    return err;
+}
+
+void SrsWorkerManager::release(const std::string &stream_url)
+{
+    if (!enabled() || !table_) {
+        return;
+    }
+
+    lock();
+
+    SrsWorkerStreamSlot *slot = find_slot(stream_url);
+    if (slot && slot->worker_ == worker_id_) {
+        erase(slot);
+    }
+
+    unlock();
+}
+
+std::string SrsWorkerManager::relay_of(const std::string &stream_url)
+{
+    if (!enabled() || !table_) {
+        return "";
+    }
+
+    // Read the table without lock, it's consistent if the sequence is even and not changed, because the
+    // writers are rare, for example, publish or unpublish a stream.
+    int owner = -1;
+    bool done = false;
+    for (int i = 0; !done && i < SRS_WORKERS_MAX_READS; i++) {
+        uint32_t seq = table_->seq_;
+        __sync_synchronize();
+        if (seq & 0x01) {
+            continue;
+        }
+
+        owner = find_owner(stream_url);
+
+        __sync_synchronize();
+        done = (seq == table_->seq_);
+    }
+
+    // Fall back to read with lock, for the table is busy, or the writer died with the lock.
+    if (!done) {
+        lock();
+        owner = find_owner(stream_url);
+        unlock();
+    }
+
+    if (owner < 0) {
+        return "";
+    }
+
+    return srs_fmt_sprintf("127.0.0.1:%d", relay_port_ + owner);
+}
+
+srs_error_t SrsWorkerManager::create_table()
+{
+    srs_error_t err = srs_success;
+
+    void *p = mmap(NULL, sizeof(SrsWorkerStreamTable), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) {
+        return srs_error_new(ERROR_SYSTEM_WORKER_TABLE, "mmap %d bytes", (int)sizeof(SrsWorkerStreamTable));
+    }
+
+    table_ = (SrsWorkerStreamTable *)p;
+    memset(table_, 0, sizeof(SrsWorkerStreamTable));
+
+    pthread_mutexattr_t attr;
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+#if defined(__linux__)
+    pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST);
+#endif
+    int r0 = pthread_mutex_init(&table_->lock_, &attr);
+    pthread_mutexattr_destroy(&attr);
+    if (r0 != 0) {
+        return srs_error_new(ERROR_SYSTEM_WORKER_TABLE, "init mutex, r0=%d", r0);
+    }
+
+    return err;
+}
+
+// LCOV_EXCL_START
+srs_error_t SrsWorkerManager::fork_worker(int id, bool &is_worker)
+{
+    srs_error_t err = srs_success;
+
+    pid_t pid = fork();
+    if (pid < 0) {
+        return srs_error_new(ERROR_SYSTEM_WORKER_FORK, "fork worker %d", id);
+    }
+
+    // For master, save the pid of worker.
+    if (pid > 0) {
+        pids_[id] = pid;
+        srs_trace("workers: fork worker=%d, pid=%d", id, pid);
+        return err;
+    }
+
+    // For worker, restore the signals handled by master, which are installed later by server.
+    for (int i = 0; i < (int)(sizeof(_srs_workers_signos) / sizeof(int)); i++) {
+        signal(_srs_workers_signos[i], SIG_DFL);
+    }
+
+#if defined(__linux__)
+    // Quit the worker when master is killed.
+    prctl(PR_SET_PDEATHSIG, SRS_SIGNAL_FAST_QUIT);
+#endif
+
+    is_worker = true;
+    worker_id_ = id;
+    pids_.clear();
+    srs_freep(pid_file_locker_);
+
+    if (cpu_affinity_) {
+        pin_cpu(id);
+    }
+
+    return err;
+}
+
+srs_error_t SrsWorkerManager::supervise(bool &is_worker)
+{
+    srs_error_t err = srs_success;
+
+    for (int i = 0; i < (int)(sizeof(_srs_workers_signos) / sizeof(int)); i++) {
+        signal(_srs_workers_signos[i], srs_workers_on_signal);
+    }
+
+    int quit_signo = 0;
+    while (true) {
+        // Forward signals to all workers.
+        vector<int> signos;
+        if (_srs_workers_reload) {
+            _srs_workers_reload = 0;
+            signos.push_back(SRS_SIGNAL_RELOAD);
+        }
+        if (_srs_workers_reopen) {
+            _srs_workers_reopen = 0;
+            signos.push_back(SRS_SIGNAL_REOPEN_LOG);
+        }
+        if (_srs_workers_upgrade) {
+            _srs_workers_upgrade = 0;
+            signos.push_back(SRS_SIGNAL_UPGRADE);
+        }
+        if (_srs_workers_quit && !quit_signo) {
+            quit_signo = _srs_workers_quit;
+            signos.push_back(quit_signo);
+            srs_trace("workers: master quit by signal=%d", quit_signo);
+        }
+        for (int i = 0; i < (int)signos.size(); i++) {
+            for (int j = 0; j < (int)pids_.size(); j++) {
+                if (pids_[j] > 0) {
+                    ::kill(pids_[j], signos[i]);
+                }
+            }
+        }
+
+        // Reap the dead workers, restart them if not quiting.
+        int status = 0;
+        pid_t pid = 0;
+        while ((pid = waitpid(-1, &status, WNOHANG)) > 0) {
+            int id = -1;
+            for (int i = 0; i < (int)pids_.size(); i++) {
+                if (pids_[i] == pid) {
+                    id = i;
+                    pids_[i] = 0;
+                }
+            }
+
+            if (id < 0) {
+                continue;
+            }
+
+            // The streams of dead worker are free, so other workers are able to publish them.
+            reclaim(id);
+
+            if (quit_signo) {
+                continue;
+            }
+
+            srs_warn("workers: worker=%d, pid=%d quit, status=%d, restart it", id, pid, status);
+
+            // Avoid restarting too fast, when worker always crash.
+            sleep(1);
+            if ((err = fork_worker(id, is_worker)) != srs_success) {
+                return srs_error_wrap(err, "restart worker %d", id);
+            }
+
+            if (is_worker) {
+                return err;
+            }
+        }
+
+        // Master quit when all workers quit.
+        if (quit_signo) {
+            bool all_quit = true;
+            for (int i = 0; i < (int)pids_.size(); i++) {
+                all_quit = all_quit && !pids_[i];
+            }
+            if (all_quit) {
+                srs_trace("workers: all workers quit, master done");
+                return err;
+            }
+        }
+
+        usleep(100 * 1000);
+    }
+
+    return err;
+}
+
+void SrsWorkerManager::pin_cpu(int id)
+{
+#if defined(__linux__)
+    int nn_cpus = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (nn_cpus <= 0) {
+        return;
+    }
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(id % nn_cpus, &set);
+    if (sched_setaffinity(0, sizeof(set), &set) == -1) {
+        srs_warn("workers: pin worker=%d to cpu=%d failed, errno=%d", id, id % nn_cpus, errno);
+        return;
+    }
+
+    srs_trace("workers: pin worker=%d to cpu=%d", id, id % nn_cpus);
+#endif
+}
+// LCOV_EXCL_STOP
+
+SrsWorkerStreamSlot *SrsWorkerManager::find_slot(const std::string &stream_url)
+{
+    int size = (int)stream_url.length();
+    if (size >= SRS_WORKERS_MAX_URL) {
+        return NULL;
+    }
+
+    // Probe until a free slot. Note that we compare the url with NUL in the buffer, because the slot might be
+    // changing by writer when read without lock.
+    int index = srs_workers_slot_index(stream_url.data(), size);
+    for (int i = 0; i < SRS_WORKERS_MAX_STREAMS; i++) {
+        SrsWorkerStreamSlot *slot = &table_->slots_[(index + i) % SRS_WORKERS_MAX_STREAMS];
+        if (!slot->used_) {
+            break;
+        }
+        if (memcmp(slot->url_, stream_url.c_str(), size + 1) == 0) {
+            return slot;
+        }
+    }
+
+    return NULL;
+}
+
+int SrsWorkerManager::find_owner(const std::string &stream_url)
+{
+    SrsWorkerStreamSlot *slot = find_slot(stream_url);
+    if (!slot || slot->worker_ == worker_id_ || !is_alive(slot)) {
+        return -1;
+    }
+
+    return slot->worker_;
+}
+
+bool SrsWorkerManager::is_alive(SrsWorkerStreamSlot *slot)
+{
+    int id = slot->worker_;
+    if (!slot->used_ || id < 0 || id >= SRS_WORKERS_MAX_WORKERS) {
+        return false;
+    }
+
+    return slot->generation_ == table_->workers_[id].generation_;
+}
+
+void SrsWorkerManager::erase(SrsWorkerStreamSlot *slot)
+{
+    // Move the following slots back, if the hole is in their probe sequence, so that the probe never stops
+    // at the hole before the slot. See backward shift deletion of linear probing.
+    int i = (int)(slot - table_->slots_);
+    for (int j = (i + 1) % SRS_WORKERS_MAX_STREAMS; j != i; j = (j + 1) % SRS_WORKERS_MAX_STREAMS) {
+        SrsWorkerStreamSlot *p = &table_->slots_[j];
+        if (!p->used_) {
+            break;
+        }
+
+        int k = srs_workers_slot_index(p->url_, (int)strlen(p->url_));
+        bool stay = (i <= j) ? (i < k && k <= j) : (i < k || k <= j);
+        if (!stay) {
+            table_->slots_[i] = *p;
+            i = j;
+        }
+    }
+
+    memset(&table_->slots_[i], 0, sizeof(SrsWorkerStreamSlot));
+}
+
+void SrsWorkerManager::reclaim(int id)
+{
+    if (!table_ || id < 0 || id >= SRS_WORKERS_MAX_WORKERS) {
+        return;
+    }
+
+    lock();
+
+    // The slots of worker are stale immediately, even for the readers without lock.
+    table_->workers_[id].generation_++;
+
+    for (int i = 0; i < SRS_WORKERS_MAX_STREAMS; i++) {
+        SrsWorkerStreamSlot *slot = &table_->slots_[i];
+        while (slot->used_ && slot->worker_ == id) {
+            erase(slot);
+        }
+    }
+
+    unlock();
+}
+
+void SrsWorkerManager::rebuild()
+{
+    vector<SrsWorkerStreamSlot> slots;
+    for (int i = 0; i < SRS_WORKERS_MAX_STREAMS; i++) {
+        SrsWorkerStreamSlot *slot = &table_->slots_[i];
+        slot->url_[SRS_WORKERS_MAX_URL - 1] = 0;
+        if (is_alive(slot)) {
+            slots.push_back(*slot);
+        }
+    }
+
+    memset(table_->slots_, 0, sizeof(table_->slots_));
+
+    for (int i = 0; i < (int)slots.size(); i++) {
+        SrsWorkerStreamSlot &slot = slots[i];
+        if (find_slot(slot.url_)) {
+            continue;
+        }
+
+        int index = srs_workers_slot_index(slot.url_, (int)strlen(slot.url_));
+        for (int j = 0; j < SRS_WORKERS_MAX_STREAMS; j++) {
+            SrsWorkerStreamSlot *p = &table_->slots_[(index + j) % SRS_WORKERS_MAX_STREAMS];
+            if (!p->used_) {
+                *p = slot;
+                break;
+            }
+        }
+    }
+}
+
+void SrsWorkerManager::lock()
+{
+    int r0 = pthread_mutex_lock(&table_->lock_);
+
+#if defined(__linux__)
+    // The owner died with the lock, the table might be partially written, so rebuild it, then mark the lock
+    // consistent to use it again.
+    if (r0 == EOWNERDEAD) {
+        srs_warn("workers: recover the table lock from dead worker");
+        table_->seq_ |= 0x01;
+        __sync_synchronize();
+        rebuild();
+        pthread_mutex_consistent(&table_->lock_);
+        return;
+    }
+#endif
+
+    srs_assert(r0 == 0);
+
+    table_->seq_++;
+    __sync_synchronize();
+}
+
+void SrsWorkerManager::unlock()
+{
+    __sync_synchronize();
+    table_->seq_++;
+
+    pthread_mutex_unlock(&table_->lock_);
+}
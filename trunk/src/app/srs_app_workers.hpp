@@ -0,0 +1,163 @@
+//
+// Copyright (c) 2013-2025 The SRS Authors
+//
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef SRS_APP_WORKERS_HPP
+#define SRS_APP_WORKERS_HPP
+
+#include <srs_core.hpp>
+
+#include <pthread.h>
+#include <sys/types.h>
+
+#include <string>
+#include <vector>
+
+class ISrsAppConfig;
+class SrsPidFileLocker;
+
+// The max number of streams published cross all workers.
+#define SRS_WORKERS_MAX_STREAMS 4096
+// The max length of stream url in the shared table, including the NUL.
+#define SRS_WORKERS_MAX_URL 256
+// The max number of workers.
+#define SRS_WORKERS_MAX_WORKERS 256
+
+// A stream in the shared table, owned by the worker which accepts the publisher.
+struct SrsWorkerStreamSlot {
+    // Whether the slot is used, the slot is free if 0.
+    int used_;
+    // The worker id which owns the stream.
+    int worker_;
+    // The generation of owner worker when publishing, the slot is stale if the worker is dead, that is,
+    // the generation of worker is changed.
+    uint32_t generation_;
+    // The stream url, for example, /live/livestream.
+    char url_[SRS_WORKERS_MAX_URL];
+};
+
+// A worker in the shared table.
+struct SrsWorkerState {
+    // The generation of worker, increased by master when the worker is dead. Note that we never use the
+    // pid to check the worker, because the pid might be reused by another process.
+    uint32_t generation_;
+};
+
+// The shared table of streams, mapped in memory which is shared by master and all workers. The slots are
+// indexed by the hash of stream url, with linear probing.
+struct SrsWorkerStreamTable {
+    // The process-shared mutex to protect the writers, for workers are in different processes. It's
+    // robust, so a worker crashed with the lock never blocks other workers.
+    pthread_mutex_t lock_;
+    // The sequence for readers without lock, which is odd when a writer is changing the table.
+    volatile uint32_t seq_;
+    SrsWorkerState workers_[SRS_WORKERS_MAX_WORKERS];
+    SrsWorkerStreamSlot slots_[SRS_WORKERS_MAX_STREAMS];
+};
+
+// The interface for workers manager.
+class ISrsWorkerManager
+{
+public:
+    ISrsWorkerManager();
+    virtual ~ISrsWorkerManager();
+
+public:
+    // Whether run in workers mode, and this is a worker process.
+    virtual bool enabled() = 0;
+    // Get the id of current worker, -1 if not in workers mode.
+    virtual int worker_id() = 0;
+    // Get the exclusive port of current worker, which is port+id for workers mode.
+    virtual int exclusive_port(int port) = 0;
+    // Get the loopback RTMP relay endpoint of current worker, empty if not in workers mode.
+    virtual std::string relay_listen() = 0;
+    // Register the stream as owned by current worker, fail if owned by another worker.
+    virtual srs_error_t acquire(const std::string &stream_url) = 0;
+    // Unregister the stream owned by current worker.
+    virtual void release(const std::string &stream_url) = 0;
+    // Get the relay endpoint of the worker which owns the stream, empty if not in workers mode,
+    // or stream is not published, or published by current worker.
+    virtual std::string relay_of(const std::string &stream_url) = 0;
+};
+
+// The workers manager, the master process forks workers which run their own ST loop and share
+// listeners by SO_REUSEPORT. Each stream is owned by the worker which accepts the publisher, and
+// the owner is registered in a table shared by all workers, so that players on other workers are
+// able to pull the stream from the owner over its loopback RTMP relay.
+class SrsWorkerManager : public ISrsWorkerManager
+{
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    ISrsAppConfig *config_;
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    int nn_workers_;
+    // The id of current worker, -1 for master or not in workers mode.
+    int worker_id_;
+    int relay_port_;
+    bool cpu_affinity_;
+    // The stream table shared by all workers.
+    SrsWorkerStreamTable *table_;
+    // For master, the pid of workers, indexed by worker id.
+    std::vector<pid_t> pids_;
+    // For master, the pid file is locked by master rather than workers.
+    SrsPidFileLocker *pid_file_locker_;
+
+public:
+    SrsWorkerManager();
+    virtual ~SrsWorkerManager();
+
+public:
+    // Load config, and create the shared table if workers mode is enabled.
+    virtual srs_error_t initialize();
+    // For master, fork the workers then supervise them, return in the forked worker, or in master
+    // after all workers quit, see is_master().
+    // @remark Return immediately if workers mode is disabled.
+    virtual srs_error_t spawn();
+    // Whether current process is the master of workers.
+    virtual bool is_master();
+
+public:
+    virtual bool enabled();
+    virtual int worker_id();
+    virtual int exclusive_port(int port);
+    virtual std::string relay_listen();
+    virtual srs_error_t acquire(const std::string &stream_url);
+    virtual void release(const std::string &stream_url);
+    virtual std::string relay_of(const std::string &stream_url);
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // Create the table by anonymous shared memory, which is inherited by the forked workers.
+    virtual srs_error_t create_table();
+    // Fork the worker with id, set is_worker to true in the forked worker.
+    virtual srs_error_t fork_worker(int id, bool &is_worker);
+    // Supervise workers, forward signals and restart the dead workers. Set is_worker to true
+    // in the restarted worker, or return in master when all workers quit.
+    virtual srs_error_t supervise(bool &is_worker);
+    // Pin current worker to a CPU core.
+    virtual void pin_cpu(int id);
+    // Find the slot of stream, NULL if not found. Should be called with lock, or in a read of sequence.
+    SrsWorkerStreamSlot *find_slot(const std::string &stream_url);
+    // Get the worker which owns the stream, -1 if not found or owned by current worker.
+    int find_owner(const std::string &stream_url);
+    // Whether the slot is owned by an alive worker.
+    bool is_alive(SrsWorkerStreamSlot *slot);
+    // Free the slot, and move the following slots of the probe sequence. Should be called with lock.
+    void erase(SrsWorkerStreamSlot *slot);
+    // For master, the worker is dead, free the slots owned by it.
+    void reclaim(int id);
+    // Rebuild the table without the stale slots, for the writer died with the lock. Should be called with lock.
+    void rebuild();
+    // Lock for writer, which makes the sequence odd until unlock.
+    void lock();
+    void unlock();
+};
+
+// The global workers manager, which is created before forking workers.
+extern SrsWorkerManager *_srs_workers;
+
+#endif
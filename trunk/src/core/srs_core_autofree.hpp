@@ -155,6 +155,49 @@ SRS_DECLARE_PRIVATE: // clang-format on
 #endif
 };
 
+// The object with an intrusive reference count, so SrsSharedPtr never allocates a separate count
+// for it. It's used by the objects shared on the hot path, for example, the payload of each media
+// packet, which otherwise costs two heap allocations.
+//
+// Usage:
+//      class MyClass : public SrsSharedObject
+//      SrsSharedPtr<MyClass> ptr(new MyClass()); // Use the count in MyClass.
+class SrsSharedObject
+{
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // The reference count, managed by SrsSharedPtr.
+    uint32_t shared_count_;
+
+public:
+    SrsSharedObject()
+    {
+        shared_count_ = 0;
+    }
+    // The count belongs to the object, never copy it.
+    SrsSharedObject(const SrsSharedObject & /*cp*/)
+    {
+        shared_count_ = 0;
+    }
+    SrsSharedObject &operator=(const SrsSharedObject & /*cp*/)
+    {
+        return *this;
+    }
+
+    friend uint32_t *srs_shared_count(SrsSharedObject *p);
+};
+
+// Get the intrusive reference count of object, or NULL for other objects, which requires a separate
+// count. Note that the derived-to-base pointer conversion is preferred to the void pointer one.
+inline uint32_t *srs_shared_count(SrsSharedObject *p)
+{
+    return &p->shared_count_;
+}
+inline uint32_t *srs_shared_count(const void * /*p*/)
+{
+    return NULL;
+}
+
 // Shared ptr smart pointer, only support shared ptr, no weak ptr, no shared from this, no inheritance,
 // no comparing, see https://github.com/ossrs/srs/issues/4551
 //
@@ -164,6 +207,9 @@ SRS_DECLARE_PRIVATE: // clang-format on
 //
 //      SrsSharedPtr<MyClass> cp = ptr;
 //      cp->do_something();
+//
+// Note that the count is in the object if it's a SrsSharedObject, or allocated for other objects. No
+// count for NULL object.
 template <class T>
 class SrsSharedPtr
 {
@@ -171,15 +217,29 @@ class SrsSharedPtr
 SRS_DECLARE_PRIVATE: // clang-format on
     // The pointer to the object.
     T *ptr_;
-    // The reference count of the object.
+    // The reference count of the object, NULL if no object.
     uint32_t *ref_count_;
+    // Whether the count is allocated by us, or it's in the object.
+    bool own_count_;
 
 public:
     // Create a shared ptr with the object.
     SrsSharedPtr(T *ptr = NULL)
     {
         ptr_ = ptr;
-        ref_count_ = new uint32_t(1);
+        ref_count_ = NULL;
+        own_count_ = false;
+
+        if (!ptr_) {
+            return;
+        }
+
+        ref_count_ = srs_shared_count(ptr_);
+        if (!ref_count_) {
+            ref_count_ = new uint32_t(0);
+            own_count_ = true;
+        }
+        (*ref_count_)++;
     }
     // Copy the shared ptr.
     SrsSharedPtr(const SrsSharedPtr<T> &cp)
@@ -202,18 +262,23 @@ SRS_DECLARE_PRIVATE: // clang-format on
 
         (*ref_count_)--;
         if (*ref_count_ == 0) {
+            // Free the count before the object, which might contain the count.
+            if (own_count_) {
+                delete ref_count_;
+            }
             delete ptr_;
-            delete ref_count_;
         }
 
         ptr_ = NULL;
         ref_count_ = NULL;
+        own_count_ = false;
     }
     // Copy from other shared ptr.
     void copy(const SrsSharedPtr<T> &cp)
     {
         ptr_ = cp.ptr_;
         ref_count_ = cp.ref_count_;
+        own_count_ = cp.own_count_;
         if (ref_count_)
             (*ref_count_)++;
     }
@@ -222,8 +287,10 @@ SRS_DECLARE_PRIVATE: // clang-format on
     {
         ptr_ = cp.ptr_;
         ref_count_ = cp.ref_count_;
+        own_count_ = cp.own_count_;
         cp.ptr_ = NULL;
         cp.ref_count_ = NULL;
+        cp.own_count_ = false;
     }
 
 public:
@@ -163,6 +163,12 @@
 #undef SRS_PERF_SO_SNDBUF_SIZE
 #endif
 
+/**
+ * The size of cache line, to avoid false sharing between the threads,
+ * for example, the producer and consumer of a lock-free ring.
+ */
+#define SRS_CACHE_LINE_SIZE 64
+
 /**
  * whether ensure glibc memory check.
  */
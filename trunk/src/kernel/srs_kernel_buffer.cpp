@@ -10,6 +10,7 @@ using namespace std;
 
 #include <srs_kernel_error.hpp>
 #include <srs_kernel_log.hpp>
+#include <srs_kernel_pool.hpp>
 #include <srs_kernel_utility.hpp>
 
 ISrsEncoder::ISrsEncoder()
@@ -562,12 +563,23 @@ srs_error_t SrsBitBuffer::read_bits_se(int32_t &v)
 SrsMemoryBlock::SrsMemoryBlock()
 {
     payload_ = NULL;
+    pool_ = NULL;
     size_ = 0;
+
+    for (int i = 0; i < SrsMemoryBlockHeaderMax; i++) {
+        headers_[i] = NULL;
+        header_sizes_[i] = 0;
+        header_keys_[i] = -1;
+    }
+
+    mark_ = 0;
+    holders_ = 0;
 }
 
 SrsMemoryBlock::~SrsMemoryBlock()
 {
-    srs_freepa(payload_);
+    free_payload();
+    reset_header();
 }
 
 void SrsMemoryBlock::create(int size)
@@ -575,7 +587,8 @@ void SrsMemoryBlock::create(int size)
     srs_assert(size >= 0);
 
     // Free existing payload
-    srs_freepa(payload_);
+    free_payload();
+    reset_header();
 
     // Allocate new buffer
     if (size > 0) {
@@ -606,9 +619,85 @@ void SrsMemoryBlock::attach(char *data, int size)
     srs_assert(size >= 0);
 
     // Free existing payload
-    srs_freepa(payload_);
+    free_payload();
+    reset_header();
 
     // Attach new buffer
     payload_ = data;
     size_ = size;
 }
+
+void SrsMemoryBlock::attach(char *data, int size, SrsObjectPool *pool)
+{
+    attach(data, size);
+    pool_ = pool;
+}
+
+void SrsMemoryBlock::free_payload()
+{
+    // The payload is allocated by pool in its size, which might be larger than the data.
+    if (pool_) {
+        pool_->deallocate(payload_, pool_->size());
+        payload_ = NULL;
+        pool_ = NULL;
+        return;
+    }
+
+    srs_freepa(payload_);
+}
+
+char *SrsMemoryBlock::header(SrsMemoryBlockHeader kind, int64_t key, int size)
+{
+    srs_assert(kind >= 0 && kind < SrsMemoryBlockHeaderMax);
+
+    if (!headers_[kind] || header_sizes_[kind] != size || header_keys_[kind] != key) {
+        return NULL;
+    }
+    return headers_[kind];
+}
+
+char *SrsMemoryBlock::create_header(SrsMemoryBlockHeader kind, int64_t key, int size)
+{
+    srs_assert(kind >= 0 && kind < SrsMemoryBlockHeaderMax);
+    srs_assert(size > 0);
+
+    // Never overwrite the header, which might be referenced by the iovecs of other consumers.
+    if (headers_[kind]) {
+        return NULL;
+    }
+
+    headers_[kind] = new char[size];
+    header_sizes_[kind] = size;
+    header_keys_[kind] = key;
+
+    return headers_[kind];
+}
+
+void SrsMemoryBlock::reset_header()
+{
+    for (int i = 0; i < SrsMemoryBlockHeaderMax; i++) {
+        srs_freepa(headers_[i]);
+        header_sizes_[i] = 0;
+        header_keys_[i] = -1;
+    }
+}
+
+bool SrsMemoryBlock::hold(uint32_t mark)
+{
+    // Start a new round of accounting.
+    if (mark_ != mark) {
+        mark_ = mark;
+        holders_ = 0;
+    }
+
+    return holders_++ == 0;
+}
+
+bool SrsMemoryBlock::unhold(uint32_t mark)
+{
+    if (mark_ != mark || holders_ <= 0) {
+        return false;
+    }
+
+    return --holders_ == 0;
+}
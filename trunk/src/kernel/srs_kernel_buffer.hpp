@@ -12,7 +12,10 @@
 #include <string>
 #include <sys/types.h>
 
+#include <srs_core_autofree.hpp>
+
 class SrsBuffer;
+class SrsObjectPool;
 
 // Abstract interface for encoding objects to binary format.
 //
@@ -496,6 +499,15 @@ public:
     srs_error_t read_bits_se(int32_t &v);
 };
 
+// The kind of header serialized for the payload of memory block, each kind has its own cache.
+enum SrsMemoryBlockHeader {
+    // The FLV tag header and previous tag size, for HTTP-FLV.
+    SrsMemoryBlockHeaderFlv = 0,
+    // The RTMP c0 and c3 chunk headers, for RTMP play.
+    SrsMemoryBlockHeaderRtmp,
+    SrsMemoryBlockHeaderMax,
+};
+
 // Memory block for managing shared payload data with automatic lifecycle management.
 //
 // SrsMemoryBlock encapsulates a dynamically allocated memory buffer with size tracking,
@@ -534,7 +546,8 @@ public:
 // @remark Not all payload data can be decoded to structured packets - some data
 //         (like video/audio packets) may remain as raw bytes.
 // @remark The size may be less than the allocated buffer size for chunked data.
-class SrsMemoryBlock
+// @remark The reference count is in the block, so sharing it never allocates a separate count.
+class SrsMemoryBlock : public SrsSharedObject
 {
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
@@ -547,6 +560,26 @@ SRS_DECLARE_PRIVATE: // clang-format on
     // SrsMemoryBlock owns this memory and is responsible for its lifecycle.
     // The buffer contains the actual payload data.
     char *payload_;
+    // The pool which the payload is allocated from, and released back to when freed. NULL if the
+    // payload is allocated by new[].
+    SrsObjectPool *pool_;
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // The headers serialized for the payload, for example, the FLV tag header, which are lazily
+    // created by the first consumer and shared by all consumers of the same payload.
+    char *headers_[SrsMemoryBlockHeaderMax];
+    int header_sizes_[SrsMemoryBlockHeaderMax];
+    // The key the header is serialized for, such as timestamp, because consumers might have
+    // different timestamps after jitter correction.
+    int64_t header_keys_[SrsMemoryBlockHeaderMax];
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // The mark of accounting round and the number of holders in it, to count the payload shared by
+    // many holders only once, for example, the memory budget of live sources.
+    uint32_t mark_;
+    int holders_;
 
 public:
     // Construct an empty memory block.
@@ -593,6 +626,32 @@ public:
     // @remark The provided buffer will be freed with delete[] when this object is destroyed.
     // @remark If data is NULL and size is 0, creates a valid but empty memory block.
     virtual void attach(char *data, int size);
+
+    // Take ownership of an existing buffer allocated from the pool, without copying.
+    // @remark The buffer is released back to the pool when this object is destroyed.
+    virtual void attach(char *data, int size, SrsObjectPool *pool);
+
+public:
+    // Get the cached header of kind serialized for the key.
+    // @return The header of size bytes, or NULL if not cached, or cached for another key.
+    char *header(SrsMemoryBlockHeader kind, int64_t key, int size);
+    // Create the header cache of kind of size bytes for the key, the caller should fill it.
+    // @return The header to fill, or NULL if already cached, so the caller should serialize the
+    //       header itself rather than overwrite the one shared by other consumers.
+    char *create_header(SrsMemoryBlockHeader kind, int64_t key, int size);
+    // Free the cached headers, for example, when payload changed.
+    void reset_header();
+
+public:
+    // Hold the block in the accounting round of mark, return true if it's the first holder.
+    bool hold(uint32_t mark);
+    // Unhold the block in the accounting round of mark, return true if it's the last holder.
+    bool unhold(uint32_t mark);
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // Free the payload, or release it back to the pool.
+    void free_payload();
 };
 
 #endif
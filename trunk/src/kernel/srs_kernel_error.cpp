@@ -295,7 +295,11 @@ SrsCplxError *SrsCplxError::create(const char *func, const char *file, int line,
 
     va_list ap;
     va_start(ap, fmt);
-    static char *buffer = new char[maxLogBuf];
+    // The buffer is per thread, because the error might be created by ingest thread.
+    static __thread char *buffer = NULL;
+    if (!buffer) {
+        buffer = new char[maxLogBuf];
+    }
     int r0 = vsnprintf(buffer, maxLogBuf, fmt, ap);
     va_end(ap);
 
@@ -323,7 +327,11 @@ SrsCplxError *SrsCplxError::wrap(const char *func, const char *file, int line, S
 
     va_list ap;
     va_start(ap, fmt);
-    static char *buffer = new char[maxLogBuf];
+    // The buffer is per thread, because the error might be created by ingest thread.
+    static __thread char *buffer = NULL;
+    if (!buffer) {
+        buffer = new char[maxLogBuf];
+    }
     int r0 = vsnprintf(buffer, maxLogBuf, fmt, ap);
     va_end(ap);
 
@@ -354,7 +362,11 @@ SrsCplxError *SrsCplxError::transform(const char *func, const char *file, int li
 {
     va_list ap;
     va_start(ap, fmt);
-    static char *buffer = new char[maxLogBuf];
+    // The buffer is per thread, because the error might be created by ingest thread.
+    static __thread char *buffer = NULL;
+    if (!buffer) {
+        buffer = new char[maxLogBuf];
+    }
     int r0 = vsnprintf(buffer, maxLogBuf, fmt, ap);
     va_end(ap);
 
@@ -112,7 +112,12 @@
     XX(ERROR_NOT_IMPLEMENTED, 1099, "NotImplemented", "Feature is not implemented")                                    \
     XX(ERROR_NOT_SUPPORTED, 1100, "NotSupported", "Feature is not supported")                                          \
     XX(ERROR_SYSTEM_FILE_UNLINK, 1101, "FileUnlink", "Failed to unlink file")                                          \
-    XX(ERROR_SYSTEM_AUTH, 1102, "SystemAuth", "Failed to authenticate stream")
+    XX(ERROR_SYSTEM_AUTH, 1102, "SystemAuth", "Failed to authenticate stream")                                         \
+    XX(ERROR_SYSTEM_WORKER_FORK, 1103, "WorkerFork", "Failed to fork worker process")                                  \
+    XX(ERROR_SYSTEM_WORKER_TABLE, 1104, "WorkerTable", "Shared stream table of workers is full or invalid")            \
+    XX(ERROR_SYSTEM_ASYNC_IO, 1105, "AsyncIo", "Failed to start threads of async disk I/O")                            \
+    XX(ERROR_SYSTEM_INGEST_THREAD, 1106, "IngestThread", "Failed to start ingest threads")                             \
+    XX(ERROR_SYSTEM_LOG_FLUSHER, 1107, "LogFlusher", "Failed to start flusher thread of asynchronous log")
 
 /**************************************************/
 /* RTMP protocol error. */
@@ -277,7 +282,8 @@
     XX(ERROR_HEVC_DECODE_ERROR, 3099, "HevcDecode", "HEVC decode av stream failed")                         \
     XX(ERROR_MP4_HVCC_CHANGE, 3100, "Mp4HvcCChange", "MP4 does not support video HvcC change")              \
     XX(ERROR_HEVC_API_NO_PREFIXED, 3101, "HevcAnnexbPrefix", "No annexb prefix for HEVC decoder")           \
-    XX(ERROR_NALU_EMPTY, 3102, "NaluEmpty", "NALU is empty")
+    XX(ERROR_NALU_EMPTY, 3102, "NaluEmpty", "NALU is empty")                                                \
+    XX(ERROR_MP4_ILLEGAL_INDEX, 3103, "Mp4Index", "Invalid sample index file for MP4")
 
 /**************************************************/
 /* HTTP/StreamConverter protocol error. */
@@ -263,6 +263,11 @@ bool SrsFileReader::is_open()
     return fd_ > 0;
 }
 
+int SrsFileReader::fd()
+{
+    return fd_;
+}
+
 int64_t SrsFileReader::tellg()
 {
     return (int64_t)_srs_lseek_fn(fd_, 0, SEEK_CUR);
@@ -132,6 +132,8 @@ public:
 public:
     // TODO: FIXME: extract interface.
     virtual bool is_open();
+    // Get the fd of file, -1 if not open, for example, to send file by sendfile(2).
+    virtual int fd();
     virtual int64_t tellg();
     virtual void skip(int64_t size);
     virtual int64_t seek2(int64_t offset);
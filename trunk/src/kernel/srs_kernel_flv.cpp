@@ -63,6 +63,37 @@ int srs_rtmp_write_chunk_header(SrsMediaPacket *msg, char *cache, int nb_cache,
     }
 }
 
+bool srs_rtmp_shared_chunk_header(SrsMediaPacket *msg, char **pc0, int *pnb_c0, char **pc3, int *pnb_c3)
+{
+    SrsMemoryBlock *payload = msg->payload_.get();
+    if (!payload || !msg->is_av()) {
+        return false;
+    }
+
+    // The layout is the size of c0 and c3, then c0 and c3.
+    int size = 2 + SRS_CONSTS_RTMP_MAX_FMT0_HEADER_SIZE + SRS_CONSTS_RTMP_MAX_FMT3_HEADER_SIZE;
+    int64_t key = (int64_t)(((uint64_t)(uint32_t)msg->stream_id_ << 32) | (uint32_t)msg->timestamp_);
+
+    char *cache = payload->header(SrsMemoryBlockHeaderRtmp, key, size);
+    if (!cache) {
+        if ((cache = payload->create_header(SrsMemoryBlockHeaderRtmp, key, size)) == NULL) {
+            return false;
+        }
+
+        char *c0 = cache + 2;
+        char *c3 = c0 + SRS_CONSTS_RTMP_MAX_FMT0_HEADER_SIZE;
+        cache[0] = (char)srs_rtmp_write_chunk_header(msg, c0, SRS_CONSTS_RTMP_MAX_FMT0_HEADER_SIZE, true);
+        cache[1] = (char)srs_rtmp_write_chunk_header(msg, c3, SRS_CONSTS_RTMP_MAX_FMT3_HEADER_SIZE, false);
+    }
+
+    *pc0 = cache + 2;
+    *pnb_c0 = (int)cache[0];
+    *pc3 = cache + 2 + SRS_CONSTS_RTMP_MAX_FMT0_HEADER_SIZE;
+    *pnb_c3 = (int)cache[1];
+
+    return true;
+}
+
 int srs_chunk_header_c0(int prefer_cid, uint32_t timestamp, int32_t payload_length, int8_t message_type, int32_t stream_id, char *cache, int nb_cache)
 {
     // to directly set the field.
@@ -524,28 +555,41 @@ srs_error_t SrsFlvTransmuxer::write_tags(SrsMediaPacket **msgs, int count)
     for (int i = 0; i < count; i++) {
         SrsMediaPacket *msg = msgs[i];
 
-        // Cache FLV packet header.
         if (msg->is_audio()) {
             if (drop_if_not_match_ && !has_audio_)
                 continue; // Ignore audio packets if no audio stream.
-            cache_audio(msg->timestamp_, msg->payload(), msg->size(), cache);
         } else if (msg->is_video()) {
             if (drop_if_not_match_ && !has_video_)
                 continue; // Ignore video packets if no video stream.
-            cache_video(msg->timestamp_, msg->payload(), msg->size(), cache);
-        } else {
-            cache_metadata(SrsFrameTypeScript, msg->payload(), msg->size(), cache);
         }
 
-        // Cache FLV pts.
-        cache_pts(SRS_FLV_TAG_HEADER_SIZE + msg->size(), pts);
+        // Use the FLV tag header and pts shared by all consumers of the payload, which is serialized
+        // once by the first consumer, so the others only write the shared bytes.
+        char *tag = NULL;
+        SrsMemoryBlock *payload = msg->payload_.get();
+        if (payload) {
+            int tag_size = SRS_FLV_TAG_HEADER_SIZE + SRS_FLV_PREVIOUS_TAG_SIZE;
+            if ((tag = payload->header(SrsMemoryBlockHeaderFlv, msg->timestamp_, tag_size)) == NULL) {
+                if ((tag = payload->create_header(SrsMemoryBlockHeaderFlv, msg->timestamp_, tag_size)) != NULL) {
+                    cache_tag(msg, tag, tag + SRS_FLV_TAG_HEADER_SIZE);
+                }
+            }
+        }
+
+        // Serialize to the cache of this transmuxer, if the shared one is for another timestamp.
+        if (tag) {
+            iovs[0].iov_base = tag;
+            iovs[2].iov_base = tag + SRS_FLV_TAG_HEADER_SIZE;
+        } else {
+            cache_tag(msg, cache, pts);
+            iovs[0].iov_base = cache;
+            iovs[2].iov_base = pts;
+        }
 
         // Set cache to iovec.
-        iovs[0].iov_base = cache;
         iovs[0].iov_len = SRS_FLV_TAG_HEADER_SIZE;
         iovs[1].iov_base = msg->payload();
         iovs[1].iov_len = msg->size();
-        iovs[2].iov_base = pts;
         iovs[2].iov_len = SRS_FLV_PREVIOUS_TAG_SIZE;
 
         // Move to next cache.
@@ -563,6 +607,21 @@ srs_error_t SrsFlvTransmuxer::write_tags(SrsMediaPacket **msgs, int count)
     return err;
 }
 
+void SrsFlvTransmuxer::cache_tag(SrsMediaPacket *msg, char *cache, char *pts)
+{
+    // Cache FLV packet header.
+    if (msg->is_audio()) {
+        cache_audio(msg->timestamp_, msg->payload(), msg->size(), cache);
+    } else if (msg->is_video()) {
+        cache_video(msg->timestamp_, msg->payload(), msg->size(), cache);
+    } else {
+        cache_metadata(SrsFrameTypeScript, msg->payload(), msg->size(), cache);
+    }
+
+    // Cache FLV pts.
+    cache_pts(SRS_FLV_TAG_HEADER_SIZE + msg->size(), pts);
+}
+
 void SrsFlvTransmuxer::cache_metadata(char type, char *data, int size, char *cache)
 {
     srs_assert(data);
@@ -337,6 +337,8 @@ public:
 
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
+    // Serialize the tag header to cache and the previous tag size to pts.
+    virtual void cache_tag(SrsMediaPacket *msg, char *cache, char *pts);
     virtual void cache_metadata(char type, char *data, int size, char *cache);
     virtual void cache_audio(int64_t timestamp, char *data, int size, char *cache);
     virtual void cache_video(int64_t timestamp, char *data, int size, char *cache);
@@ -443,6 +445,13 @@ extern int srs_rtmp_prefer_cid(SrsFrameType message_type);
 // @return the size of header. 0 if cache not enough.
 extern int srs_rtmp_write_chunk_header(SrsMediaPacket *msg, char *cache, int nb_cache, bool c0);
 
+// Get the RTMP chunk headers of audio or video message, which are serialized once to the payload and
+// shared by all players, c0 for the first chunk and c3 for the others, because the c3 header of each
+// chunk is the same whatever the chunk size is.
+// @return Whether got the shared headers, false if not audio or video, or cached for another
+//       timestamp or stream id, then the caller should serialize the headers itself.
+extern bool srs_rtmp_shared_chunk_header(SrsMediaPacket *msg, char **pc0, int *pnb_c0, char **pc3, int *pnb_c3);
+
 // Generate the c0 chunk header for msg.
 // @param cache, the cache to write header.
 // @param nb_cache, the size of cache.
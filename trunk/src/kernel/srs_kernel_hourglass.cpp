@@ -6,7 +6,6 @@
 
 #include <srs_kernel_hourglass.hpp>
 
-#include <algorithm>
 using namespace std;
 
 #include <srs_core_time.hpp>
@@ -152,20 +151,74 @@ ISrsFastTimer::~ISrsFastTimer()
 {
 }
 
-SrsFastTimer::SrsFastTimer(std::string label, srs_utime_t interval)
+SrsTimerHandle::SrsTimerHandle(ISrsFastTimerHandler *handler)
 {
-    interval_ = interval;
+    handler_ = handler;
+    wheel_ = NULL;
+    prev_ = next_ = NULL;
+    expire_ = ticks_ = 0;
+    interval_ = 0;
+}
+
+SrsTimerHandle::~SrsTimerHandle()
+{
+    if (wheel_) {
+        wheel_->cancel(this);
+    }
+}
+
+bool SrsTimerHandle::scheduled()
+{
+    return wheel_ != NULL;
+}
+
+ISrsTimingWheel::ISrsTimingWheel()
+{
+}
+
+ISrsTimingWheel::~ISrsTimingWheel()
+{
+}
+
+SrsTimingWheel::SrsTimingWheel(std::string label, srs_utime_t resolution)
+{
+    resolution_ = srs_max(1, resolution);
+    coalesce_ = true;
+    current_ = 0;
+    nn_timers_ = 0;
+
+    for (int i = 0; i < SRS_TIMING_WHEEL_LEVELS; i++) {
+        for (int j = 0; j < SRS_TIMING_WHEEL_SLOTS; j++) {
+            SrsTimerHandle *slot = &slots_[i][j];
+            slot->prev_ = slot->next_ = slot;
+        }
+    }
+    fired_.prev_ = fired_.next_ = &fired_;
+
     trd_ = _srs_kernel_factory->create_coroutine(label, this, _srs_context->get_id());
     time_ = _srs_kernel_factory->create_time();
 }
 
-SrsFastTimer::~SrsFastTimer()
+SrsTimingWheel::~SrsTimingWheel()
 {
     srs_freep(trd_);
     srs_freep(time_);
+
+    // Detach the timers, which are owned by user.
+    for (int i = 0; i < SRS_TIMING_WHEEL_LEVELS; i++) {
+        for (int j = 0; j < SRS_TIMING_WHEEL_SLOTS; j++) {
+            SrsTimerHandle *slot = &slots_[i][j];
+            while (slot->next_ != slot) {
+                cancel(slot->next_);
+            }
+        }
+    }
+    while (fired_.next_ != &fired_) {
+        cancel(fired_.next_);
+    }
 }
 
-srs_error_t SrsFastTimer::start()
+srs_error_t SrsTimingWheel::start()
 {
     srs_error_t err = srs_success;
 
@@ -176,22 +229,93 @@ srs_error_t SrsFastTimer::start()
     return err;
 }
 
-void SrsFastTimer::subscribe(ISrsFastTimerHandler *timer)
+void SrsTimingWheel::set_coalesce(bool v)
+{
+    coalesce_ = v;
+}
+
+int SrsTimingWheel::size()
+{
+    return nn_timers_;
+}
+
+void SrsTimingWheel::schedule(SrsTimerHandle *timer, srs_utime_t interval)
+{
+    cancel(timer);
+
+    timer->wheel_ = this;
+    timer->interval_ = interval;
+    timer->ticks_ = srs_max(1, (interval + resolution_ - 1) / resolution_);
+
+    // Align the timers of the same interval, to fire in the same tick.
+    if (coalesce_) {
+        timer->expire_ = (current_ / timer->ticks_ + 1) * timer->ticks_;
+    } else {
+        timer->expire_ = current_ + timer->ticks_;
+    }
+
+    link(timer, false);
+    nn_timers_++;
+}
+
+void SrsTimingWheel::cancel(SrsTimerHandle *timer)
 {
-    if (std::find(handlers_.begin(), handlers_.end(), timer) == handlers_.end()) {
-        handlers_.push_back(timer);
+    if (timer->wheel_ != this) {
+        return;
     }
+
+    timer->prev_->next_ = timer->next_;
+    timer->next_->prev_ = timer->prev_;
+    timer->prev_ = timer->next_ = NULL;
+    timer->wheel_ = NULL;
+    nn_timers_--;
 }
 
-void SrsFastTimer::unsubscribe(ISrsFastTimerHandler *timer)
+void SrsTimingWheel::tick()
 {
-    vector<ISrsFastTimerHandler *>::iterator it = std::find(handlers_.begin(), handlers_.end(), timer);
-    if (it != handlers_.end()) {
-        handlers_.erase(it);
+    srs_error_t err = srs_success;
+
+    current_++;
+
+    // Cascade the timers of upper level, when lower level wraps around.
+    for (int level = 1; level < SRS_TIMING_WHEEL_LEVELS; level++) {
+        uint64_t mask = (((uint64_t)1) << (level * SRS_TIMING_WHEEL_BITS)) - 1;
+        if ((current_ & mask) != 0) {
+            break;
+        }
+        cascade(level);
+    }
+
+    // Move the expired timers to fire, because handler might cancel or free other timers.
+    SrsTimerHandle *slot = &slots_[0][current_ & (SRS_TIMING_WHEEL_SLOTS - 1)];
+    if (slot->next_ == slot) {
+        return;
+    }
+
+    fired_.next_ = slot->next_;
+    fired_.prev_ = slot->prev_;
+    fired_.next_->prev_ = &fired_;
+    fired_.prev_->next_ = &fired_;
+    slot->prev_ = slot->next_ = slot;
+
+    while (fired_.next_ != &fired_) {
+        SrsTimerHandle *timer = fired_.next_;
+
+        // Schedule the next tick before fire, so handler is able to cancel or free the timer.
+        timer->prev_->next_ = timer->next_;
+        timer->next_->prev_ = timer->prev_;
+        timer->expire_ += timer->ticks_;
+        link(timer, false);
+
+        ++_srs_pps_timer->sugar_;
+
+        if ((err = timer->handler_->on_timer(timer->interval_)) != srs_success) {
+            srs_freep(err); // Ignore any error for shared timer.
+        }
     }
 }
 
-srs_error_t SrsFastTimer::cycle()
+srs_error_t SrsTimingWheel::cycle()
 {
     srs_error_t err = srs_success;
 
@@ -200,22 +324,121 @@ srs_error_t SrsFastTimer::cycle()
             return srs_error_wrap(err, "quit");
         }
 
-        ++_srs_pps_timer->sugar_;
+        tick();
+
+        time_->usleep(resolution_);
+    }
 
-        for (int i = 0; i < (int)handlers_.size(); i++) {
-            ISrsFastTimerHandler *timer = handlers_.at(i);
+    return err;
+}
 
-            if ((err = timer->on_timer(interval_)) != srs_success) {
-                srs_freep(err); // Ignore any error for shared timer.
-            }
-        }
+void SrsTimingWheel::link(SrsTimerHandle *timer, bool cascading)
+{
+    // The max interval of wheel, never exceed it.
+    uint64_t max = (((uint64_t)1) << (SRS_TIMING_WHEEL_LEVELS * SRS_TIMING_WHEEL_BITS)) - 1;
+    if (cascading && timer->expire_ < current_) {
+        timer->expire_ = current_;
+    } else if (!cascading && timer->expire_ <= current_) {
+        timer->expire_ = current_ + 1;
+    } else if (timer->expire_ - current_ > max) {
+        timer->expire_ = current_ + max;
+    }
+
+    // Find the level by the distance to expire.
+    uint64_t delta = timer->expire_ - current_;
+    int level = 0;
+    while (level < SRS_TIMING_WHEEL_LEVELS - 1 && delta >= (((uint64_t)1) << ((level + 1) * SRS_TIMING_WHEEL_BITS))) {
+        level++;
+    }
+
+    int index = (int)((timer->expire_ >> (level * SRS_TIMING_WHEEL_BITS)) & (SRS_TIMING_WHEEL_SLOTS - 1));
+    SrsTimerHandle *slot = &slots_[level][index];
+
+    // Append to the tail, to fire in order of schedule.
+    timer->next_ = slot;
+    timer->prev_ = slot->prev_;
+    slot->prev_->next_ = timer;
+    slot->prev_ = timer;
+}
+
+void SrsTimingWheel::cascade(int level)
+{
+    int index = (int)((current_ >> (level * SRS_TIMING_WHEEL_BITS)) & (SRS_TIMING_WHEEL_SLOTS - 1));
+    SrsTimerHandle *slot = &slots_[level][index];
+
+    while (slot->next_ != slot) {
+        SrsTimerHandle *timer = slot->next_;
+        timer->prev_->next_ = timer->next_;
+        timer->next_->prev_ = timer->prev_;
+        link(timer, true);
+    }
+}
+
+SrsFastTimer::SrsFastTimer(std::string label, srs_utime_t interval)
+{
+    interval_ = interval;
+    wheel_ = new SrsTimingWheel(label, interval);
+    owned_ = true;
+}
+
+SrsFastTimer::SrsFastTimer(SrsTimingWheel *wheel, srs_utime_t interval)
+{
+    interval_ = interval;
+    wheel_ = wheel;
+    owned_ = false;
+}
+
+SrsFastTimer::~SrsFastTimer()
+{
+    std::map<ISrsFastTimerHandler *, SrsTimerHandle *>::iterator it;
+    for (it = handlers_.begin(); it != handlers_.end(); ++it) {
+        SrsTimerHandle *timer = it->second;
+        srs_freep(timer);
+    }
+    handlers_.clear();
+
+    if (owned_) {
+        srs_freep(wheel_);
+    }
+}
+
+srs_error_t SrsFastTimer::start()
+{
+    srs_error_t err = srs_success;
+
+    // The shared wheel is started by owner.
+    if (!owned_) {
+        return err;
+    }
 
-        time_->usleep(interval_);
+    if ((err = wheel_->start()) != srs_success) {
+        return srs_error_wrap(err, "start timer");
     }
 
     return err;
 }
 
+void SrsFastTimer::subscribe(ISrsFastTimerHandler *timer)
+{
+    if (handlers_.find(timer) != handlers_.end()) {
+        return;
+    }
+
+    SrsTimerHandle *handle = new SrsTimerHandle(timer);
+    handlers_[timer] = handle;
+    wheel_->schedule(handle, interval_);
+}
+
+void SrsFastTimer::unsubscribe(ISrsFastTimerHandler *timer)
+{
+    std::map<ISrsFastTimerHandler *, SrsTimerHandle *>::iterator it = handlers_.find(timer);
+    if (it != handlers_.end()) {
+        SrsTimerHandle *handle = it->second;
+        handlers_.erase(it);
+        srs_freep(handle);
+    }
+}
+
 SrsClockWallMonitor::SrsClockWallMonitor()
 {
     time_ = _srs_kernel_factory->create_time();
@@ -274,6 +497,7 @@ ISrsSharedTimer::~ISrsSharedTimer()
 
 SrsSharedTimer::SrsSharedTimer()
 {
+    wheel_ = NULL;
     timer20ms_ = NULL;
     timer100ms_ = NULL;
     timer1s_ = NULL;
@@ -288,34 +512,23 @@ SrsSharedTimer::~SrsSharedTimer()
     srs_freep(timer1s_);
     srs_freep(timer5s_);
     srs_freep(clock_monitor_);
+    srs_freep(wheel_);
 }
 
 srs_error_t SrsSharedTimer::initialize()
 {
     srs_error_t err = srs_success;
 
-    // Initialize global shared timers
-    timer20ms_ = new SrsFastTimer("shared", 20 * SRS_UTIME_MILLISECONDS);
-    timer100ms_ = new SrsFastTimer("shared", 100 * SRS_UTIME_MILLISECONDS);
-    timer1s_ = new SrsFastTimer("shared", 1 * SRS_UTIME_SECONDS);
-    timer5s_ = new SrsFastTimer("shared", 5 * SRS_UTIME_SECONDS);
+    // Initialize global shared timers, all in the same timing wheel.
+    wheel_ = new SrsTimingWheel("shared", 20 * SRS_UTIME_MILLISECONDS);
+    timer20ms_ = new SrsFastTimer(wheel_, 20 * SRS_UTIME_MILLISECONDS);
+    timer100ms_ = new SrsFastTimer(wheel_, 100 * SRS_UTIME_MILLISECONDS);
+    timer1s_ = new SrsFastTimer(wheel_, 1 * SRS_UTIME_SECONDS);
+    timer5s_ = new SrsFastTimer(wheel_, 5 * SRS_UTIME_SECONDS);
     clock_monitor_ = new SrsClockWallMonitor();
 
-    // Start all timers
-    if ((err = timer20ms_->start()) != srs_success) {
-        return srs_error_wrap(err, "start timer20ms");
-    }
-
-    if ((err = timer100ms_->start()) != srs_success) {
-        return srs_error_wrap(err, "start timer100ms");
-    }
-
-    if ((err = timer1s_->start()) != srs_success) {
-        return srs_error_wrap(err, "start timer1s");
-    }
-
-    if ((err = timer5s_->start()) != srs_success) {
-        return srs_error_wrap(err, "start timer5s");
+    if ((err = wheel_->start()) != srs_success) {
+        return srs_error_wrap(err, "start timer wheel");
     }
 
     // Register clock monitor to 20ms timer
@@ -344,4 +557,9 @@ ISrsFastTimer *SrsSharedTimer::timer5s()
     return timer5s_;
 }
 
+ISrsTimingWheel *SrsSharedTimer::wheel()
+{
+    return wheel_;
+}
+
 SrsSharedTimer *_srs_shared_timer = NULL;
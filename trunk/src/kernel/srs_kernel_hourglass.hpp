@@ -135,20 +135,137 @@ public:
     virtual void unsubscribe(ISrsFastTimerHandler *timer) = 0;
 };
 
+class SrsTimingWheel;
+
+// The number of levels and slots of timing wheel, each level has 64 slots, so the max interval is
+// 64^4 ticks, which is about 3.9 days for 20ms tick.
+#define SRS_TIMING_WHEEL_LEVELS 4
+#define SRS_TIMING_WHEEL_BITS 6
+#define SRS_TIMING_WHEEL_SLOTS (1 << SRS_TIMING_WHEEL_BITS)
+
+// The handle of timer in timing wheel, which is owned by user, such as a connection, and linked in
+// a slot of the wheel when scheduled, so it's O(1) to schedule and cancel it. The handle cancels
+// itself when freed.
+class SrsTimerHandle
+{
+    friend class SrsTimingWheel;
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    ISrsFastTimerHandler *handler_;
+    SrsTimingWheel *wheel_;
+    // The siblings in a circular list, whose sentinel is the slot.
+    SrsTimerHandle *prev_;
+    SrsTimerHandle *next_;
+    // The tick to fire, and the interval in ticks to repeat.
+    uint64_t expire_;
+    uint64_t ticks_;
+    srs_utime_t interval_;
+
+public:
+    SrsTimerHandle(ISrsFastTimerHandler *handler = NULL);
+    virtual ~SrsTimerHandle();
+
+public:
+    // Whether the timer is scheduled in wheel.
+    bool scheduled();
+};
+
+// The interface for timing wheel.
+class ISrsTimingWheel
+{
+public:
+    ISrsTimingWheel();
+    virtual ~ISrsTimingWheel();
+
+public:
+    // Schedule the timer to fire every interval, which is rounded up to the tick of wheel. The timer
+    // is rescheduled if it's already scheduled.
+    virtual void schedule(SrsTimerHandle *timer, srs_utime_t interval) = 0;
+    // Cancel the timer, ignore if not scheduled.
+    virtual void cancel(SrsTimerHandle *timer) = 0;
+};
+
+// The hierarchical timing wheel, to schedule and cancel timers in O(1), with only one coroutine for
+// all timers. The timers are linked in slots of wheels, and only the timers in the current slot
+// are fired for each tick, while the timers of upper levels are cascaded to lower level when the
+// lower level wraps around.
+//
+// In coalescing mode, the timers of the same interval are aligned to the multiple of interval, so
+// they fire in the same tick as a batch, like the timers of a shared SrsFastTimer.
+//
+// Usage:
+//      SrsTimingWheel *wheel = new SrsTimingWheel("timer", 20 * SRS_UTIME_MILLISECONDS);
+//      wheel->start();
+//
+//      SrsTimerHandle *timer = new SrsTimerHandle(handler);
+//      wheel->schedule(timer, 100 * SRS_UTIME_MILLISECONDS);
+//      srs_freep(timer); // Or wheel->cancel(timer);
+class SrsTimingWheel : public ISrsCoroutineHandler, public ISrsTimingWheel
+{
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    ISrsCoroutine *trd_;
+    ISrsTime *time_;
+    srs_utime_t resolution_;
+    bool coalesce_;
+    // The current tick of wheel.
+    uint64_t current_;
+    // The slots of each level, as the sentinel of timers.
+    SrsTimerHandle slots_[SRS_TIMING_WHEEL_LEVELS][SRS_TIMING_WHEEL_SLOTS];
+    // The timers to fire in this tick, which might be canceled by handler.
+    SrsTimerHandle fired_;
+    int nn_timers_;
+
+public:
+    SrsTimingWheel(std::string label, srs_utime_t resolution);
+    virtual ~SrsTimingWheel();
+
+public:
+    srs_error_t start();
+    // Whether align the timers to fire in batch, default to true.
+    void set_coalesce(bool v);
+    // The number of scheduled timers.
+    int size();
+
+public:
+    virtual void schedule(SrsTimerHandle *timer, srs_utime_t interval);
+    virtual void cancel(SrsTimerHandle *timer);
+
+public:
+    // Advance a tick, and fire the expired timers.
+    void tick();
+    // Interface ISrsCoroutineHandler
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    virtual srs_error_t cycle();
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // Link the timer to the slot by its expire tick. When cascading, the slot of current tick is not
+    // fired yet, so the timer expires in current tick is linked to it, rather than the next tick.
+    void link(SrsTimerHandle *timer, bool cascading);
+    // Move the timers of slot in level to lower levels.
+    void cascade(int level);
+};
+
 // The fast timer, shared by objects, for high performance.
 // For example, we should never start a timer for each connection or publisher or player,
 // instead, we should start only one fast timer in server.
-class SrsFastTimer : public ISrsCoroutineHandler, public ISrsFastTimer
+// @remark The handlers are scheduled in the timing wheel, which is shared by the timers of server,
+//      or owned by this timer if created with label.
+class SrsFastTimer : public ISrsFastTimer
 {
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
-    ISrsCoroutine *trd_;
+    SrsTimingWheel *wheel_;
+    bool owned_;
     srs_utime_t interval_;
-    std::vector<ISrsFastTimerHandler *> handlers_;
-    ISrsTime *time_;
+    std::map<ISrsFastTimerHandler *, SrsTimerHandle *> handlers_;
 
 public:
     SrsFastTimer(std::string label, srs_utime_t interval);
+    SrsFastTimer(SrsTimingWheel *wheel, srs_utime_t interval);
     virtual ~SrsFastTimer();
 
 public:
@@ -157,12 +274,6 @@ public:
 public:
     void subscribe(ISrsFastTimerHandler *timer);
     void unsubscribe(ISrsFastTimerHandler *timer);
-    // Interface ISrsCoroutineHandler
-// clang-format off
-SRS_DECLARE_PRIVATE: // clang-format on
-    // Cycle the hourglass, which will sleep resolution every time.
-    // and call handler when ticked.
-    virtual srs_error_t cycle();
 };
 
 // To monitor the system wall clock timer deviation.
@@ -193,6 +304,8 @@ public:
     virtual ISrsFastTimer *timer100ms() = 0;
     virtual ISrsFastTimer *timer1s() = 0;
     virtual ISrsFastTimer *timer5s() = 0;
+    // The timing wheel of all shared timers, to schedule the timer handles, such as per connection.
+    virtual ISrsTimingWheel *wheel() = 0;
 };
 
 // Global shared timer manager
@@ -200,6 +313,7 @@ class SrsSharedTimer : public ISrsSharedTimer
 {
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
+    SrsTimingWheel *wheel_;
     SrsFastTimer *timer20ms_;
     SrsFastTimer *timer100ms_;
     SrsFastTimer *timer1s_;
@@ -220,6 +334,7 @@ public:
     ISrsFastTimer *timer100ms();
     ISrsFastTimer *timer1s();
     ISrsFastTimer *timer5s();
+    ISrsTimingWheel *wheel();
 };
 
 // Global shared timer instance
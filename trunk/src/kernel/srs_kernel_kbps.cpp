@@ -317,10 +317,12 @@ srs_error_t srs_global_kbps_initialize()
 #endif
 
     _srs_pps_rpkts = new SrsPps();
+    _srs_pps_rmmsgs = new SrsPps();
     _srs_pps_addrs = new SrsPps();
     _srs_pps_fast_addrs = new SrsPps();
 
     _srs_pps_spkts = new SrsPps();
+    _srs_pps_smmsgs = new SrsPps();
     _srs_pps_objs_msgs = new SrsPps();
 
     _srs_pps_sstuns = new SrsPps();
@@ -501,8 +503,9 @@ void srs_global_rtc_update(SrsKbsRtcStats *stats)
     _srs_pps_rrtps->update();
     _srs_pps_rstuns->update();
     _srs_pps_rrtcps->update();
-    if (_srs_pps_rpkts->r10s() || _srs_pps_rrtps->r10s() || _srs_pps_rstuns->r10s() || _srs_pps_rrtcps->r10s()) {
-        snprintf(buf, sizeof(buf), ", rpkts=(%d,rtp:%d,stun:%d,rtcp:%d)", _srs_pps_rpkts->r10s(), _srs_pps_rrtps->r10s(), _srs_pps_rstuns->r10s(), _srs_pps_rrtcps->r10s());
+    _srs_pps_rmmsgs->update();
+    if (_srs_pps_rpkts->r10s() || _srs_pps_rrtps->r10s() || _srs_pps_rstuns->r10s() || _srs_pps_rrtcps->r10s() || _srs_pps_rmmsgs->r10s()) {
+        snprintf(buf, sizeof(buf), ", rpkts=(%d,rtp:%d,stun:%d,rtcp:%d,mmsg:%d)", _srs_pps_rpkts->r10s(), _srs_pps_rrtps->r10s(), _srs_pps_rstuns->r10s(), _srs_pps_rrtcps->r10s(), _srs_pps_rmmsgs->r10s());
         rpkts_desc = buf;
     }
 
@@ -511,8 +514,9 @@ void srs_global_rtc_update(SrsKbsRtcStats *stats)
     _srs_pps_srtps->update();
     _srs_pps_sstuns->update();
     _srs_pps_srtcps->update();
-    if (_srs_pps_spkts->r10s() || _srs_pps_srtps->r10s() || _srs_pps_sstuns->r10s() || _srs_pps_srtcps->r10s()) {
-        snprintf(buf, sizeof(buf), ", spkts=(%d,rtp:%d,stun:%d,rtcp:%d)", _srs_pps_spkts->r10s(), _srs_pps_srtps->r10s(), _srs_pps_sstuns->r10s(), _srs_pps_srtcps->r10s());
+    _srs_pps_smmsgs->update();
+    if (_srs_pps_spkts->r10s() || _srs_pps_srtps->r10s() || _srs_pps_sstuns->r10s() || _srs_pps_srtcps->r10s() || _srs_pps_smmsgs->r10s()) {
+        snprintf(buf, sizeof(buf), ", spkts=(%d,rtp:%d,stun:%d,rtcp:%d,mmsg:%d)", _srs_pps_spkts->r10s(), _srs_pps_srtps->r10s(), _srs_pps_sstuns->r10s(), _srs_pps_srtcps->r10s(), _srs_pps_smmsgs->r10s());
         spkts_desc = buf;
     }
 
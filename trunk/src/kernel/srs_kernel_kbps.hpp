@@ -135,6 +135,7 @@ extern SrsPps *_srs_pps_timer_s;
 
 // WebRTC packet statistics
 extern SrsPps *_srs_pps_rpkts;
+extern SrsPps *_srs_pps_rmmsgs;
 extern SrsPps *_srs_pps_rstuns;
 extern SrsPps *_srs_pps_rrtps;
 extern SrsPps *_srs_pps_rrtcps;
@@ -142,6 +143,7 @@ extern SrsPps *_srs_pps_addrs;
 extern SrsPps *_srs_pps_fast_addrs;
 
 extern SrsPps *_srs_pps_spkts;
+extern SrsPps *_srs_pps_smmsgs;
 extern SrsPps *_srs_pps_sstuns;
 extern SrsPps *_srs_pps_srtcps;
 extern SrsPps *_srs_pps_srtps;
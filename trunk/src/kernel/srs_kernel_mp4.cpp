@@ -6272,6 +6272,11 @@ srs_error_t SrsMp4Decoder::initialize(ISrsReadSeeker *rs)
     return err;
 }
 
+SrsMp4SampleManager *SrsMp4Decoder::samples()
+{
+    return samples_;
+}
+
 srs_error_t SrsMp4Decoder::read_sample(SrsMp4HandlerType *pht, uint16_t *pft, uint16_t *pct, uint32_t *pdts, uint32_t *ppts, uint8_t **psample, uint32_t *pnb_sample)
 {
     srs_error_t err = srs_success;
@@ -2691,6 +2691,8 @@ public:
     // @remark The decoder will generate the first two audio/video sequence header.
     virtual srs_error_t read_sample(SrsMp4HandlerType *pht, uint16_t *pft, uint16_t *pct,
                                     uint32_t *pdts, uint32_t *ppts, uint8_t **psample, uint32_t *pnb_sample);
+    // Get the samples loaded from moov, ordered by offset.
+    virtual SrsMp4SampleManager *samples();
 
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
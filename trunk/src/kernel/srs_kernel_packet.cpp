@@ -9,6 +9,7 @@
 #include <srs_kernel_error.hpp>
 #include <srs_kernel_kbps.hpp>
 #include <srs_kernel_log.hpp>
+#include <srs_kernel_pool.hpp>
 #include <srs_kernel_utility.hpp>
 
 using namespace std;
@@ -37,6 +38,29 @@ SrsNaluSample *SrsNaluSample::copy()
     return p;
 }
 
+static SrsObjectPool *_srs_pool_media_packet = NULL;
+
+void *SrsMediaPacket::operator new(size_t size)
+{
+    if (!_srs_pool_media_packet) {
+        // Never create the pool in other pthreads, because it's not thread-safe.
+        if (!srs_object_pool_available()) {
+            return ::operator new(size);
+        }
+        _srs_pool_media_packet = srs_object_pool_create("media_packet", sizeof(SrsMediaPacket));
+    }
+    return _srs_pool_media_packet->allocate(size);
+}
+
+void SrsMediaPacket::operator delete(void *p, size_t size)
+{
+    if (!_srs_pool_media_packet) {
+        ::operator delete(p);
+        return;
+    }
+    _srs_pool_media_packet->deallocate(p, size);
+}
+
 SrsMediaPacket::SrsMediaPacket()
 {
     timestamp_ = 0;
@@ -59,6 +83,12 @@ void SrsMediaPacket::wrap(char *payload, int size)
     payload_->attach(payload, size);
 }
 
+void SrsMediaPacket::wrap(char *payload, int size, SrsObjectPool *pool)
+{
+    payload_ = SrsSharedPtr<SrsMemoryBlock>(new SrsMemoryBlock());
+    payload_->attach(payload, size, pool);
+}
+
 bool SrsMediaPacket::check(int stream_id)
 {
     // Ignore error when message has no payload.
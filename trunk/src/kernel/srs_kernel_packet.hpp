@@ -11,6 +11,8 @@
 
 #include <srs_kernel_codec.hpp>
 
+class SrsObjectPool;
+
 /**
  * A sample is the NAL unit of a parsed packet.
  * It's a NALU for H.264, H.265.
@@ -59,6 +61,11 @@ public:
     SrsMediaPacket();
     virtual ~SrsMediaPacket();
 
+public:
+    // Allocate from the object pool, because it's frequently allocated and freed.
+    static void *operator new(size_t size);
+    static void operator delete(void *p, size_t size);
+
 public:
     // Backward compatibility accessors
     char *payload() { return payload_.get() ? payload_->payload() : NULL; }
@@ -68,6 +75,9 @@ public:
     // Create shared ptr message from RAW payload.
     // @remark Note that the header is set to zero.
     virtual void wrap(char *payload, int size);
+    // Create shared ptr message from RAW payload, which is allocated from the pool and released
+    // back to it when the last copy is freed.
+    virtual void wrap(char *payload, int size, SrsObjectPool *pool);
     // check prefer cid and stream id.
     // @return whether stream id already set.
     virtual bool check(int stream_id);
@@ -0,0 +1,151 @@
+//
+// Copyright (c) 2013-2025 The SRS Authors
+//
+// SPDX-License-Identifier: MIT
+//
+
+#include <srs_kernel_pool.hpp>
+
+#include <srs_kernel_utility.hpp>
+
+using namespace std;
+
+// The current ST thread, which is NULL for the pthreads that never run ST, for example, the SRT
+// ingest threads, or before ST is initialized.
+extern "C" {
+extern __thread struct _st_thread *_st_this_thread;
+}
+
+bool srs_object_pool_available()
+{
+    return _st_this_thread != NULL;
+}
+
+SrsObjectPool::SrsObjectPool(string name, size_t size)
+{
+    name_ = name;
+    size_ = size;
+    nn_used_ = 0;
+    high_water_ = 0;
+
+    nn_allocs_ = 0;
+    nn_hits_ = 0;
+    nn_trims_ = 0;
+}
+
+SrsObjectPool::~SrsObjectPool()
+{
+    for (int i = 0; i < (int)free_.size(); i++) {
+        ::operator delete(free_[i]);
+    }
+    free_.clear();
+}
+
+void *SrsObjectPool::allocate(size_t size)
+{
+    // The pool is not thread-safe, so never touch it from other pthreads.
+    if (size != size_ || !srs_object_pool_available()) {
+        return ::operator new(size);
+    }
+
+    nn_allocs_++;
+    nn_used_++;
+    high_water_ = srs_max(high_water_, nn_used_);
+
+    if (free_.empty()) {
+        return ::operator new(size);
+    }
+
+    nn_hits_++;
+    void *p = free_.back();
+    free_.pop_back();
+    return p;
+}
+
+void SrsObjectPool::deallocate(void *p, size_t size)
+{
+    if (!p) {
+        return;
+    }
+
+    // The pool is not thread-safe, so never touch it from other pthreads.
+    if (size != size_ || !srs_object_pool_available()) {
+        ::operator delete(p);
+        return;
+    }
+
+    // The object might be allocated by other pthreads, which is not counted.
+    nn_used_ = srs_max(0, nn_used_ - 1);
+    free_.push_back(p);
+}
+
+void SrsObjectPool::trim()
+{
+    // Keep enough free objects to reach the high water mark again.
+    int keep = srs_max(0, high_water_ - nn_used_);
+    while ((int)free_.size() > keep) {
+        ::operator delete(free_.back());
+        free_.pop_back();
+        nn_trims_++;
+    }
+
+    // Start a new period of high water mark.
+    high_water_ = nn_used_;
+}
+
+string SrsObjectPool::name()
+{
+    return name_;
+}
+
+size_t SrsObjectPool::size()
+{
+    return size_;
+}
+
+int SrsObjectPool::nn_used()
+{
+    return nn_used_;
+}
+
+int SrsObjectPool::nn_free()
+{
+    return (int)free_.size();
+}
+
+int64_t SrsObjectPool::nn_allocs()
+{
+    return nn_allocs_;
+}
+
+int64_t SrsObjectPool::nn_hits()
+{
+    return nn_hits_;
+}
+
+int64_t SrsObjectPool::nn_trims()
+{
+    return nn_trims_;
+}
+
+vector<SrsObjectPool *> &srs_object_pools()
+{
+    // Never free the pools, because the pooled objects might be freed when process exit.
+    static vector<SrsObjectPool *> *pools = new vector<SrsObjectPool *>();
+    return *pools;
+}
+
+SrsObjectPool *srs_object_pool_create(string name, size_t size)
+{
+    SrsObjectPool *pool = new SrsObjectPool(name, size);
+    srs_object_pools().push_back(pool);
+    return pool;
+}
+
+void srs_object_pools_trim()
+{
+    vector<SrsObjectPool *> &pools = srs_object_pools();
+    for (int i = 0; i < (int)pools.size(); i++) {
+        pools[i]->trim();
+    }
+}
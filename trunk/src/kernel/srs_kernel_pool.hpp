@@ -0,0 +1,73 @@
+//
+// Copyright (c) 2013-2025 The SRS Authors
+//
+// SPDX-License-Identifier: MIT
+//
+
+#ifndef SRS_KERNEL_POOL_HPP
+#define SRS_KERNEL_POOL_HPP
+
+#include <srs_core.hpp>
+
+#include <string>
+#include <vector>
+
+// The pool of objects in the same size, which reuses the memory of objects that are frequently
+// allocated and freed, for example, the packet copied for each consumer and freed after sent. The
+// freed objects are kept in a free list, and trimmed to the high water mark of objects in use.
+// @remark The pool is not thread-safe, because all streams are served by the same ST thread. For
+// other pthreads, the objects are allocated and freed by the global operator new and delete.
+class SrsObjectPool
+{
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    std::string name_;
+    // The size of object, the other sizes such as subclass are not pooled.
+    size_t size_;
+    // The free list of objects.
+    std::vector<void *> free_;
+    // The number of objects in use, and the max number since last trim.
+    int nn_used_;
+    int high_water_;
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // The number of allocations, and the times reused object from free list.
+    int64_t nn_allocs_;
+    int64_t nn_hits_;
+    // The number of objects freed by trim.
+    int64_t nn_trims_;
+
+public:
+    SrsObjectPool(std::string name, size_t size);
+    virtual ~SrsObjectPool();
+
+public:
+    // Allocate the memory for object, reuse the free object if size matches.
+    void *allocate(size_t size);
+    // Free the memory of object, keep it in the free list if size matches.
+    void deallocate(void *p, size_t size);
+    // Free the objects in free list, which exceed the high water mark since last trim, so the
+    // memory is returned when the load goes down.
+    void trim();
+
+public:
+    std::string name();
+    size_t size();
+    int nn_used();
+    int nn_free();
+    int64_t nn_allocs();
+    int64_t nn_hits();
+    int64_t nn_trims();
+};
+
+// Whether the pools are available for current pthread, that is the ST thread.
+extern bool srs_object_pool_available();
+// Create a pool and register it, the pool lives for the whole process.
+extern SrsObjectPool *srs_object_pool_create(std::string name, size_t size);
+// Get all registered pools, for statistics.
+extern std::vector<SrsObjectPool *> &srs_object_pools();
+// Trim all registered pools.
+extern void srs_object_pools_trim();
+
+#endif
@@ -60,7 +60,8 @@ public:
 };
 
 // The resource managed by ISrsResourceManager.
-class ISrsResource
+// @remark It's a SrsSharedObject, so SrsSharedResource never allocates a separate count.
+class ISrsResource : public SrsSharedObject
 {
 public:
     ISrsResource();
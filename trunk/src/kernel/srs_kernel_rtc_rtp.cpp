@@ -15,6 +15,7 @@ using namespace std;
 #include <srs_kernel_error.hpp>
 #include <srs_kernel_flv.hpp>
 #include <srs_kernel_log.hpp>
+#include <srs_kernel_pool.hpp>
 #include <srs_kernel_utility.hpp>
 
 #include <srs_kernel_kbps.hpp>
@@ -757,6 +758,44 @@ ISrsRtpPacketDecodeHandler::~ISrsRtpPacketDecodeHandler()
 {
 }
 
+SrsRtpSharedPayload::SrsRtpSharedPayload(ISrsRtpPayloader *p)
+{
+    payload_ = p;
+}
+
+SrsRtpSharedPayload::~SrsRtpSharedPayload()
+{
+    srs_freep(payload_);
+}
+
+ISrsRtpPayloader *SrsRtpSharedPayload::payload()
+{
+    return payload_;
+}
+
+static SrsObjectPool *_srs_pool_rtp_packet = NULL;
+
+void *SrsRtpPacket::operator new(size_t size)
+{
+    if (!_srs_pool_rtp_packet) {
+        // Never create the pool in other pthreads, because it's not thread-safe.
+        if (!srs_object_pool_available()) {
+            return ::operator new(size);
+        }
+        _srs_pool_rtp_packet = srs_object_pool_create("rtp_packet", sizeof(SrsRtpPacket));
+    }
+    return _srs_pool_rtp_packet->allocate(size);
+}
+
+void SrsRtpPacket::operator delete(void *p, size_t size)
+{
+    if (!_srs_pool_rtp_packet) {
+        ::operator delete(p);
+        return;
+    }
+    _srs_pool_rtp_packet->deallocate(p, size);
+}
+
 SrsRtpPacket::SrsRtpPacket()
 {
     payload_ = NULL;
@@ -775,8 +814,11 @@ SrsRtpPacket::SrsRtpPacket()
 
 SrsRtpPacket::~SrsRtpPacket()
 {
-    srs_freep(payload_);
-    // shared_buffer_ automatically cleaned up by SrsSharedPtr
+    // The shared payload is freed by the last packet which refers to it.
+    if (!shared_payload_.get()) {
+        srs_freep(payload_);
+    }
+    // shared_buffer_ and shared_payload_ automatically cleaned up by SrsSharedPtr
 }
 
 char *SrsRtpPacket::wrap(int size)
@@ -825,9 +867,18 @@ SrsRtpPacket *SrsRtpPacket::copy()
     SrsRtpPacket *cp = new SrsRtpPacket();
 
     cp->header_ = header_;
-    cp->payload_ = payload_ ? payload_->copy() : NULL;
     cp->payload_type_ = payload_type_;
 
+    // Share the payload with the copy, which is immutable, so we only need to create the
+    // shared object once for the first copy, no matter how many copies there are.
+    if (payload_ && !shared_payload_.get()) {
+        shared_payload_ = SrsSharedPtr<SrsRtpSharedPayload>(new SrsRtpSharedPayload(payload_));
+    }
+    if (shared_payload_.get()) {
+        cp->shared_payload_ = shared_payload_;
+        cp->payload_ = payload_;
+    }
+
     cp->nalu_type_ = nalu_type_;
     cp->shared_buffer_ = shared_buffer_; // Copy shared pointer
     cp->actual_buffer_size_ = actual_buffer_size_;
@@ -842,6 +893,24 @@ SrsRtpPacket *SrsRtpPacket::copy()
     return cp;
 }
 
+void SrsRtpPacket::set_payload(ISrsRtpPayloader *p, SrsRtpPacketPayloadType pt)
+{
+    // Never change the shared payload, which is used by other packets.
+    if (shared_payload_.get()) {
+        unshare_payload();
+    }
+
+    payload_ = p;
+    payload_type_ = pt;
+}
+
+void SrsRtpPacket::unshare_payload()
+{
+    // The payload is freed with the shared object, by the last packet which refers to it.
+    shared_payload_ = SrsSharedPtr<SrsRtpSharedPayload>(NULL);
+    payload_ = NULL;
+}
+
 void SrsRtpPacket::set_padding(int size)
 {
     header_.set_padding(size);
@@ -921,6 +990,11 @@ srs_error_t SrsRtpPacket::decode(SrsBuffer *buf)
     }
     buf->set_size(buf->size() - padding);
 
+    // Never decode to the shared payload, which is used by other packets.
+    if (shared_payload_.get()) {
+        unshare_payload();
+    }
+
     // TODO: FIXME: We should keep payload to NULL and return if buffer is empty.
     // If user set the decode handler, call it to set the payload.
     if (decode_handler_) {
@@ -1002,6 +1076,29 @@ bool SrsRtpPacket::is_keyframe(SrsVideoCodecId codec_id)
     return false;
 }
 
+static SrsObjectPool *_srs_pool_rtp_raw = NULL;
+
+void *SrsRtpRawPayload::operator new(size_t size)
+{
+    if (!_srs_pool_rtp_raw) {
+        // Never create the pool in other pthreads, because it's not thread-safe.
+        if (!srs_object_pool_available()) {
+            return ::operator new(size);
+        }
+        _srs_pool_rtp_raw = srs_object_pool_create("rtp_raw_payload", sizeof(SrsRtpRawPayload));
+    }
+    return _srs_pool_rtp_raw->allocate(size);
+}
+
+void SrsRtpRawPayload::operator delete(void *p, size_t size)
+{
+    if (!_srs_pool_rtp_raw) {
+        ::operator delete(p);
+        return;
+    }
+    _srs_pool_rtp_raw->deallocate(p, size);
+}
+
 SrsRtpRawPayload::SrsRtpRawPayload()
 {
     payload_ = NULL;
@@ -1486,6 +1583,29 @@ ISrsRtpPayloader *SrsRtpFUAPayload::copy()
     return cp;
 }
 
+static SrsObjectPool *_srs_pool_rtp_fua = NULL;
+
+void *SrsRtpFUAPayload2::operator new(size_t size)
+{
+    if (!_srs_pool_rtp_fua) {
+        // Never create the pool in other pthreads, because it's not thread-safe.
+        if (!srs_object_pool_available()) {
+            return ::operator new(size);
+        }
+        _srs_pool_rtp_fua = srs_object_pool_create("rtp_fua_payload", sizeof(SrsRtpFUAPayload2));
+    }
+    return _srs_pool_rtp_fua->allocate(size);
+}
+
+void SrsRtpFUAPayload2::operator delete(void *p, size_t size)
+{
+    if (!_srs_pool_rtp_fua) {
+        ::operator delete(p);
+        return;
+    }
+    _srs_pool_rtp_fua->deallocate(p, size);
+}
+
 SrsRtpFUAPayload2::SrsRtpFUAPayload2()
 {
     start_ = end_ = false;
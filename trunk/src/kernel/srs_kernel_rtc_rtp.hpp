@@ -327,6 +327,23 @@ public:
     virtual void on_before_decode_payload(SrsRtpPacket *pkt, SrsBuffer *buf, ISrsRtpPayloader **ppayload, SrsRtpPacketPayloadType *ppt) = 0;
 };
 
+// The payload shared by the copies of RTP packet, for example, the packets fan-out to
+// subscribers. It's immutable once shared, so the copies only rewrite their own header.
+// @remark The count is intrusive and managed by SrsSharedPtr.
+class SrsRtpSharedPayload : public SrsSharedObject
+{
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    ISrsRtpPayloader *payload_;
+
+public:
+    SrsRtpSharedPayload(ISrsRtpPayloader *p);
+    virtual ~SrsRtpSharedPayload();
+
+public:
+    ISrsRtpPayloader *payload();
+};
+
 // The RTP packet with cached shared message.
 class SrsRtpPacket
 {
@@ -338,6 +355,8 @@ public:
 SRS_DECLARE_PRIVATE: // clang-format on
     ISrsRtpPayloader *payload_;
     SrsRtpPacketPayloadType payload_type_;
+    // The payload is shared with other packets if not NULL, see copy().
+    SrsSharedPtr<SrsRtpSharedPayload> shared_payload_;
 
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
@@ -371,13 +390,20 @@ public:
     SrsRtpPacket();
     virtual ~SrsRtpPacket();
 
+public:
+    // Allocate from the object pool, because it's frequently allocated and freed.
+    static void *operator new(size_t size);
+    static void operator delete(void *p, size_t size);
+
 public:
     // Wrap buffer to shared_message, which is managed by us.
     char *wrap(int size);
     char *wrap(char *data, int size);
     // Wrap the shared memory block, we copy it.
     char *wrap(SrsSharedPtr<SrsMemoryBlock> block);
-    // Copy the RTP packet.
+    // Copy the RTP packet, the header is copied while the payload is shared without copy, so the
+    // copy is cheap for fan-out to lots of subscribers.
+    // @remark The payload must not be changed after copy, because it's shared by all copies.
     virtual SrsRtpPacket *copy();
 
 public:
@@ -385,11 +411,7 @@ public:
     void enable_twcc_decode() { header_.enable_twcc_decode(); } // SrsRtpPacket::enable_twcc_decode
     // Get and set the payload of packet.
     // @remark Note that return NULL if no payload.
-    void set_payload(ISrsRtpPayloader *p, SrsRtpPacketPayloadType pt)
-    {
-        payload_ = p;
-        payload_type_ = pt;
-    }
+    void set_payload(ISrsRtpPayloader *p, SrsRtpPacketPayloadType pt);
     ISrsRtpPayloader *payload() { return payload_; }
     // Set the padding of RTP packet.
     void set_padding(int size);
@@ -412,6 +434,11 @@ public:
     // Get and set the packet sync time in milliseconds.
     void set_avsync_time(int64_t avsync_time) { avsync_time_ = avsync_time; }
     int64_t get_avsync_time() const { return avsync_time_; }
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // Stop sharing the payload, free it if we are the last one.
+    void unshare_payload();
 };
 
 // Single payload data.
@@ -430,6 +457,11 @@ public:
 public:
     SrsRtpRawPayload();
     virtual ~SrsRtpRawPayload();
+
+public:
+    // Allocate from the object pool, because it's frequently allocated and freed.
+    static void *operator new(size_t size);
+    static void operator delete(void *p, size_t size);
     // interface ISrsRtpPayloader
 public:
     virtual uint64_t nb_bytes();
@@ -538,6 +570,11 @@ public:
 public:
     SrsRtpFUAPayload2();
     virtual ~SrsRtpFUAPayload2();
+
+public:
+    // Allocate from the object pool, because it's frequently allocated and freed.
+    static void *operator new(size_t size);
+    static void operator delete(void *p, size_t size);
     // interface ISrsRtpPayloader
 public:
     virtual uint64_t nb_bytes();
@@ -23,7 +23,7 @@ using namespace std;
 #include <srs_kernel_stream.hpp>
 #include <srs_kernel_utility.hpp>
 
-#define HLS_AES_ENCRYPT_BLOCK_LENGTH SRS_TS_PACKET_SIZE * 4
+#define HLS_AES_ENCRYPT_BLOCK_LENGTH (SRS_TS_PACKET_SIZE * 4)
 
 // the mpegts header specifed the video/audio pid.
 #define TS_PMT_NUMBER 1
@@ -120,7 +120,14 @@ uint32_t __crc32_table_driven(uint32_t *t, const void *buf, int size, uint32_t p
 // @see pycrc https://github.com/winlinvip/pycrc/blob/master/pycrc/algorithms.py#L238
 // IEEETable is the table for the MPEG polynomial.
 static uint32_t __crc32_MPEG_table[256];
-static bool __crc32_MPEG_table_initialized = false;
+
+// Build the table when loading, before any ingest thread decodes the PSI of TS.
+static bool __crc32_MPEG_table_init()
+{
+    __crc32_make_table(__crc32_MPEG_table, 0x04C11DB7, false);
+    return true;
+}
+static bool __crc32_MPEG_table_initialized = __crc32_MPEG_table_init();
 
 // @see pycrc https://github.com/winlinvip/pycrc/blob/master/pycrc/models.py#L238
 //      crc32('123456789') = 0x0376e6e7
@@ -326,10 +333,16 @@ SrsTsContext::SrsTsContext()
     sync_byte_ = 0x47; // ts default sync byte.
     vcodec_ = SrsVideoCodecIdReserved;
     acodec_ = SrsAudioCodecIdReserved1;
+
+    pkts_ = NULL;
+    nb_pkts_ = 0;
+    max_pkts_ = 0;
 }
 
 SrsTsContext::~SrsTsContext()
 {
+    srs_freepa(pkts_);
+
     std::map<int, SrsTsChannel *>::iterator it;
     for (it = pids_.begin(); it != pids_.end(); ++it) {
         SrsTsChannel *channel = it->second;
@@ -514,45 +527,48 @@ srs_error_t SrsTsContext::encode_pat_pmt(ISrsStreamWriter *writer, int16_t vpid,
 
     int16_t pmt_number = TS_PMT_NUMBER;
     int16_t pmt_pid = TS_PMT_PID;
+
+    // Drop the packets left by previous failed encoding.
+    nb_pkts_ = 0;
+
     if (true) {
         SrsUniquePtr<SrsTsPacket> pkt(SrsTsPacket::create_pat(this, pmt_number, pmt_pid));
 
         pkt->sync_byte_ = sync_byte_;
 
-        SrsUniquePtr<char[]> buf(new char[SRS_TS_PACKET_SIZE]);
+        char *buf = alloc_packet();
 
         // set the left bytes with 0xFF.
         int nb_buf = pkt->size();
         srs_assert(nb_buf < SRS_TS_PACKET_SIZE);
-        memset(buf.get() + nb_buf, 0xFF, SRS_TS_PACKET_SIZE - nb_buf);
+        memset(buf + nb_buf, 0xFF, SRS_TS_PACKET_SIZE - nb_buf);
 
-        SrsBuffer stream(buf.get(), nb_buf);
+        SrsBuffer stream(buf, nb_buf);
         if ((err = pkt->encode(&stream)) != srs_success) {
             return srs_error_wrap(err, "ts: encode packet");
         }
-        if ((err = writer->write(buf.get(), SRS_TS_PACKET_SIZE, NULL)) != srs_success) {
-            return srs_error_wrap(err, "ts: write packet");
-        }
     }
     if (true) {
         SrsUniquePtr<SrsTsPacket> pkt(SrsTsPacket::create_pmt(this, pmt_number, pmt_pid, vpid, vs, apid, as));
 
         pkt->sync_byte_ = sync_byte_;
 
-        SrsUniquePtr<char[]> buf(new char[SRS_TS_PACKET_SIZE]);
+        char *buf = alloc_packet();
 
         // set the left bytes with 0xFF.
         int nb_buf = pkt->size();
         srs_assert(nb_buf < SRS_TS_PACKET_SIZE);
-        memset(buf.get() + nb_buf, 0xFF, SRS_TS_PACKET_SIZE - nb_buf);
+        memset(buf + nb_buf, 0xFF, SRS_TS_PACKET_SIZE - nb_buf);
 
-        SrsBuffer stream(buf.get(), nb_buf);
+        SrsBuffer stream(buf, nb_buf);
         if ((err = pkt->encode(&stream)) != srs_success) {
             return srs_error_wrap(err, "ts: encode packet");
         }
-        if ((err = writer->write(buf.get(), SRS_TS_PACKET_SIZE, NULL)) != srs_success) {
-            return srs_error_wrap(err, "ts: write packet");
-        }
+    }
+
+    // Write the PAT and PMT in one batch.
+    if ((err = flush_packets(writer)) != srs_success) {
+        return srs_error_wrap(err, "ts: write packet");
     }
 
     // When PAT and PMT are writen, the context is ready now.
@@ -588,6 +604,9 @@ srs_error_t SrsTsContext::encode_pes(ISrsStreamWriter *writer, SrsTsMessage *msg
     char *end = start + msg->payload_->length();
     char *p = start;
 
+    // Drop the packets left by previous failed encoding.
+    nb_pkts_ = 0;
+
     while (p < end) {
         SrsTsPacket *pkt_raw = NULL;
         if (p == start) {
@@ -623,7 +642,7 @@ srs_error_t SrsTsContext::encode_pes(ISrsStreamWriter *writer, SrsTsMessage *msg
 
         pkt->sync_byte_ = sync_byte_;
 
-        SrsUniquePtr<char[]> buf(new char[SRS_TS_PACKET_SIZE]);
+        char *buf = alloc_packet();
 
         // set the left bytes with 0xFF.
         int nb_buf = pkt->size();
@@ -633,7 +652,7 @@ srs_error_t SrsTsContext::encode_pes(ISrsStreamWriter *writer, SrsTsMessage *msg
         int nb_stuffings = SRS_TS_PACKET_SIZE - nb_buf - left;
         if (nb_stuffings > 0) {
             // set all bytes to stuffings.
-            memset(buf.get(), 0xFF, SRS_TS_PACKET_SIZE);
+            memset(buf, 0xFF, SRS_TS_PACKET_SIZE);
 
             // padding with stuffings.
             pkt->padding(nb_stuffings);
@@ -646,16 +665,53 @@ srs_error_t SrsTsContext::encode_pes(ISrsStreamWriter *writer, SrsTsMessage *msg
             nb_stuffings = SRS_TS_PACKET_SIZE - nb_buf - left;
             srs_assert(nb_stuffings == 0);
         }
-        memcpy(buf.get() + nb_buf, p, left);
+        memcpy(buf + nb_buf, p, left);
         p += left;
 
-        SrsBuffer stream(buf.get(), nb_buf);
+        SrsBuffer stream(buf, nb_buf);
         if ((err = pkt->encode(&stream)) != srs_success) {
             return srs_error_wrap(err, "ts: encode packet");
         }
-        if ((err = writer->write(buf.get(), SRS_TS_PACKET_SIZE, NULL)) != srs_success) {
-            return srs_error_wrap(err, "ts: write packet");
+    }
+
+    // Write all packets of message in one batch, rather than one write per packet.
+    if ((err = flush_packets(writer)) != srs_success) {
+        return srs_error_wrap(err, "ts: write packet");
+    }
+
+    return err;
+}
+
+char *SrsTsContext::alloc_packet()
+{
+    if (nb_pkts_ >= max_pkts_) {
+        int max_pkts = srs_max(16, max_pkts_ * 2);
+        char *pkts = new char[max_pkts * SRS_TS_PACKET_SIZE];
+        if (nb_pkts_ > 0) {
+            memcpy(pkts, pkts_, nb_pkts_ * SRS_TS_PACKET_SIZE);
         }
+
+        srs_freepa(pkts_);
+        pkts_ = pkts;
+        max_pkts_ = max_pkts;
+    }
+
+    return pkts_ + SRS_TS_PACKET_SIZE * (nb_pkts_++);
+}
+
+srs_error_t SrsTsContext::flush_packets(ISrsStreamWriter *writer)
+{
+    srs_error_t err = srs_success;
+
+    int nb_pkts = nb_pkts_;
+    nb_pkts_ = 0;
+
+    if (nb_pkts <= 0) {
+        return err;
+    }
+
+    if ((err = writer->write(pkts_, nb_pkts * SRS_TS_PACKET_SIZE, NULL)) != srs_success) {
+        return srs_error_wrap(err, "write %d packets", nb_pkts);
     }
 
     return err;
@@ -2846,11 +2902,15 @@ SrsEncFileWriter::SrsEncFileWriter()
 
     nb_buf = 0;
     key = (unsigned char *)new AES_KEY();
+
+    cipher = NULL;
+    nb_cipher = 0;
 }
 
 SrsEncFileWriter::~SrsEncFileWriter()
 {
     srs_freepa(buf);
+    srs_freepa(cipher);
 
     AES_KEY *k = (AES_KEY *)key;
     srs_freep(k);
@@ -2860,24 +2920,55 @@ srs_error_t SrsEncFileWriter::write(void *data, size_t count, ssize_t *pnwrite)
 {
     srs_error_t err = srs_success;
 
-    srs_assert(count == SRS_TS_PACKET_SIZE);
+    srs_assert(count % SRS_TS_PACKET_SIZE == 0);
 
-    if (nb_buf < HLS_AES_ENCRYPT_BLOCK_LENGTH) {
-        memcpy(buf + nb_buf, (char *)data, SRS_TS_PACKET_SIZE);
-        nb_buf += SRS_TS_PACKET_SIZE;
-    }
+    AES_KEY *k = (AES_KEY *)key;
+    char *p = (char *)data;
+    size_t left = count;
+
+    // Fill the pending block, encrypt and write it when full.
+    if (nb_buf > 0) {
+        int nn = (int)srs_min(left, (size_t)(HLS_AES_ENCRYPT_BLOCK_LENGTH - nb_buf));
+        memcpy(buf + nb_buf, p, nn);
+        nb_buf += nn;
+        p += nn;
+        left -= nn;
+
+        if (nb_buf < HLS_AES_ENCRYPT_BLOCK_LENGTH) {
+            return err;
+        }
 
-    if (nb_buf == HLS_AES_ENCRYPT_BLOCK_LENGTH) {
         nb_buf = 0;
+        AES_cbc_encrypt((unsigned char *)buf, (unsigned char *)buf, HLS_AES_ENCRYPT_BLOCK_LENGTH, k, iv, AES_ENCRYPT);
 
-        SrsUniquePtr<char[]> cipher(new char[HLS_AES_ENCRYPT_BLOCK_LENGTH]);
+        if ((err = SrsFileWriter::write(buf, HLS_AES_ENCRYPT_BLOCK_LENGTH, pnwrite)) != srs_success) {
+            return srs_error_wrap(err, "write cipher");
+        }
+    }
 
-        AES_KEY *k = (AES_KEY *)key;
-        AES_cbc_encrypt((unsigned char *)buf, (unsigned char *)cipher.get(), HLS_AES_ENCRYPT_BLOCK_LENGTH, k, iv, AES_ENCRYPT);
+    // Encrypt all whole blocks to the cipher buffer, never change the data of caller, and write them in one batch.
+    size_t nb_bytes = left - left % HLS_AES_ENCRYPT_BLOCK_LENGTH;
+    if (nb_bytes > 0) {
+        if (nb_cipher < (int)nb_bytes) {
+            srs_freepa(cipher);
+            nb_cipher = (int)nb_bytes;
+            cipher = new char[nb_cipher];
+        }
+
+        AES_cbc_encrypt((unsigned char *)p, (unsigned char *)cipher, nb_bytes, k, iv, AES_ENCRYPT);
 
-        if ((err = SrsFileWriter::write(cipher.get(), HLS_AES_ENCRYPT_BLOCK_LENGTH, pnwrite)) != srs_success) {
+        if ((err = SrsFileWriter::write(cipher, nb_bytes, pnwrite)) != srs_success) {
             return srs_error_wrap(err, "write cipher");
         }
+
+        p += nb_bytes;
+        left -= nb_bytes;
+    }
+
+    // Keep the left packets, which is not a whole block.
+    if (left > 0) {
+        memcpy(buf, p, left);
+        nb_buf = (int)left;
     }
 
     return err;
@@ -2905,13 +2996,11 @@ void SrsEncFileWriter::close()
             memset(buf + nb_buf, nb_padding, nb_padding);
         }
 
-        SrsUniquePtr<char[]> cipher(new char[nb_buf + nb_padding]);
-
         AES_KEY *k = (AES_KEY *)key;
-        AES_cbc_encrypt((unsigned char *)buf, (unsigned char *)cipher.get(), nb_buf + nb_padding, k, iv, AES_ENCRYPT);
+        AES_cbc_encrypt((unsigned char *)buf, (unsigned char *)buf, nb_buf + nb_padding, k, iv, AES_ENCRYPT);
 
         srs_error_t err = srs_success;
-        if ((err = SrsFileWriter::write(cipher.get(), nb_buf + nb_padding, NULL)) != srs_success) {
+        if ((err = SrsFileWriter::write(buf, nb_buf + nb_padding, NULL)) != srs_success) {
             srs_warn("ignore err %s", srs_error_desc(err).c_str());
             srs_freep(err);
         }
@@ -357,6 +357,15 @@ SRS_DECLARE_PRIVATE: // clang-format on
     SrsVideoCodecId vcodec_;
     SrsAudioCodecId acodec_;
 
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
+    // The reusable buffer of TS packets, to encode all packets of a message then write in one batch.
+    char *pkts_;
+    // The number of packets in buffer.
+    int nb_pkts_;
+    // The capacity of buffer, in packets.
+    int max_pkts_;
+
 public:
     SrsTsContext();
     virtual ~SrsTsContext();
@@ -398,6 +407,10 @@ public:
 SRS_DECLARE_PRIVATE: // clang-format on
     virtual srs_error_t encode_pat_pmt(ISrsStreamWriter *writer, int16_t vpid, SrsTsStream vs, int16_t apid, SrsTsStream as);
     virtual srs_error_t encode_pes(ISrsStreamWriter *writer, SrsTsMessage *msg, int16_t pid, SrsTsStream sid, bool pure_audio);
+    // Get the next packet in buffer, grow the buffer if full.
+    virtual char *alloc_packet();
+    // Write all packets in buffer to writer in one batch, then reset the buffer.
+    virtual srs_error_t flush_packets(ISrsStreamWriter *writer);
 };
 
 // The packet in ts stream,
@@ -1420,6 +1433,8 @@ public:
     virtual ~SrsEncFileWriter();
 
 public:
+    // Write one or more TS packets, the count must be multiple of SRS_TS_PACKET_SIZE.
+    // @remark The data is never modified, it's encrypted to the internal cipher buffer.
     virtual srs_error_t write(void *data, size_t count, ssize_t *pnwrite);
     virtual void close();
 
@@ -1435,6 +1450,9 @@ SRS_DECLARE_PRIVATE: // clang-format on
 SRS_DECLARE_PRIVATE: // clang-format on
     char *buf;
     int nb_buf;
+    // The buffer for encrypted blocks, grows to the max size of whole blocks in a write.
+    char *cipher;
+    int nb_cipher;
 };
 
 // Interface for TS messages cache.
@@ -540,9 +540,22 @@ bool SrsPath::exists(std::string path)
 }
 
 srs_error_t SrsPath::unlink(std::string path)
+{
+    if (forbidden(path)) {
+        return srs_error_new(ERROR_SYSTEM_FILE_UNLINK, "unlink forbidden %s", path.c_str());
+    }
+
+    if (::unlink(path.c_str()) < 0) {
+        return srs_error_new(ERROR_SYSTEM_FILE_UNLINK, "unlink %s", path.c_str());
+    }
+
+    return srs_success;
+}
+
+bool SrsPath::forbidden(std::string path)
 {
     // Define the directories that are forbidden to delete.
-    std::string forbidden[] = {
+    std::string dirs[] = {
         "./",
         "../",
         "/",
@@ -569,17 +582,13 @@ srs_error_t SrsPath::unlink(std::string path)
         "/usr",
         "/var",
     };
-    for (int i = 0; i < (int)(sizeof(forbidden) / sizeof(string)); i++) {
-        if (path == forbidden[i]) {
-            return srs_error_new(ERROR_SYSTEM_FILE_UNLINK, "unlink forbidden %s", path.c_str());
+    for (int i = 0; i < (int)(sizeof(dirs) / sizeof(string)); i++) {
+        if (path == dirs[i]) {
+            return true;
         }
     }
 
-    if (::unlink(path.c_str()) < 0) {
-        return srs_error_new(ERROR_SYSTEM_FILE_UNLINK, "unlink %s", path.c_str());
-    }
-
-    return srs_success;
+    return false;
 }
 
 std::string SrsPath::filepath_dir(std::string path)
@@ -138,6 +138,8 @@ public:
     virtual bool exists(std::string path);
     // Remove or unlink file.
     virtual srs_error_t unlink(std::string path);
+    // Whether the path is a system directory, which is forbidden to unlink.
+    virtual bool forbidden(std::string path);
     // Get the dirname of path, for instance, dirname("/live/livestream")="/live"
     virtual std::string filepath_dir(std::string path);
     // Get the basename of path, for instance, basename("/live/livestream")="livestream"
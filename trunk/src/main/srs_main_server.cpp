@@ -41,6 +41,7 @@ using namespace std;
 #include <srs_app_server.hpp>
 #include <srs_app_srt_server.hpp>
 #include <srs_app_utility.hpp>
+#include <srs_app_workers.hpp>
 #include <srs_core_autofree.hpp>
 #include <srs_core_performance.hpp>
 #include <srs_kernel_error.hpp>
@@ -51,6 +52,7 @@ using namespace std;
 
 // pre-declare
 srs_error_t run_directly_or_daemon();
+srs_error_t run_workers_or_server();
 srs_error_t run_srs_server();
 void show_macro_features();
 
@@ -410,7 +412,7 @@ srs_error_t run_directly_or_daemon()
 
     // If not daemon, directly run hybrid server.
     if (!run_as_daemon) {
-        if ((err = run_srs_server()) != srs_success) {
+        if ((err = run_workers_or_server()) != srs_success) {
             return srs_error_wrap(err, "run server");
         }
         return srs_success;
@@ -447,13 +449,39 @@ srs_error_t run_directly_or_daemon()
     // son
     srs_trace("son(daemon) process running.");
 
-    if ((err = run_srs_server()) != srs_success) {
+    if ((err = run_workers_or_server()) != srs_success) {
         return srs_error_wrap(err, "daemon run server");
     }
 
     return err;
 }
 
+srs_error_t run_workers_or_server()
+{
+    srs_error_t err = srs_success;
+
+    // Fork workers before initializing ST, so each worker has its own ST loop.
+    _srs_workers = new SrsWorkerManager();
+    if ((err = _srs_workers->initialize()) != srs_success) {
+        return srs_error_wrap(err, "workers initialize");
+    }
+
+    if ((err = _srs_workers->spawn()) != srs_success) {
+        return srs_error_wrap(err, "workers spawn");
+    }
+
+    // The master only supervises the workers, never serves.
+    if (_srs_workers->is_master()) {
+        return err;
+    }
+
+    if ((err = run_srs_server()) != srs_success) {
+        return srs_error_wrap(err, "run server");
+    }
+
+    return err;
+}
+
 srs_error_t run_srs_server()
 {
     srs_error_t err = srs_success;
@@ -466,6 +494,12 @@ srs_error_t run_srs_server()
     // For primordial thread, share the default cid.
     _srs_context->set_id(_srs_context->get_id());
 
+    // Start the flusher thread of log after forked, because the thread is not inherited.
+    SrsFileLog *file_log = dynamic_cast<SrsFileLog *>(_srs_log);
+    if (file_log && (err = file_log->start_async()) != srs_success) {
+        return srs_error_wrap(err, "log async");
+    }
+
     _srs_server = new SrsServer();
 
     // Do some system initialize.
@@ -481,6 +515,11 @@ srs_error_t run_srs_server()
     // After all done, stop and cleanup.
     _srs_server->stop();
 
+    // Write out the logs in ring before quit.
+    if (file_log) {
+        file_log->stop_async();
+    }
+
     return err;
 }
 // LCOV_EXCL_STOP
@@ -178,6 +178,11 @@ srs_error_t SrsTcpConnection::writev(const iovec *iov, int iov_size, ssize_t *nw
     return skt_->writev(iov, iov_size, nwrite);
 }
 
+srs_error_t SrsTcpConnection::sendfile(int fd, off_t offset, size_t size, ssize_t *nwrite)
+{
+    return skt_->sendfile(fd, offset, size, nwrite);
+}
+
 SrsBufferedReadWriter::SrsBufferedReadWriter(ISrsProtocolReadWriter *io)
 {
     io_ = io;
@@ -302,6 +307,16 @@ srs_error_t SrsBufferedReadWriter::writev(const iovec *iov, int iov_size, ssize_
     return io_->writev(iov, iov_size, nwrite);
 }
 
+srs_error_t SrsBufferedReadWriter::sendfile(int fd, off_t offset, size_t size, ssize_t *nwrite)
+{
+    ISrsProtocolFileSender *sender = dynamic_cast<ISrsProtocolFileSender *>(io_);
+    if (!sender) {
+        return srs_error_new(ERROR_SYSTEM_IO_INVALID, "sendfile not supported");
+    }
+
+    return sender->sendfile(fd, offset, size, nwrite);
+}
+
 ISrsSslConnection::ISrsSslConnection()
 {
 }
@@ -49,14 +49,14 @@ public:
 // The basic connection of SRS, for TCP based protocols,
 // all connections accept from listener must extends from this base class,
 // server will add the connection to manager, and delete it when remove.
-class SrsTcpConnection : public ISrsProtocolReadWriter
+class SrsTcpConnection : public ISrsProtocolReadWriter, public ISrsProtocolFileSender
 {
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
     // The underlayer st fd handler.
     srs_netfd_t stfd_;
     // The underlayer socket.
-    ISrsProtocolReadWriter *skt_;
+    SrsStSocket *skt_;
 
 public:
     SrsTcpConnection(srs_netfd_t c);
@@ -79,11 +79,14 @@ public:
     virtual srs_utime_t get_send_timeout();
     virtual srs_error_t write(void *buf, size_t size, ssize_t *nwrite);
     virtual srs_error_t writev(const iovec *iov, int iov_size, ssize_t *nwrite);
+    // Interface ISrsProtocolFileSender
+public:
+    virtual srs_error_t sendfile(int fd, off_t offset, size_t size, ssize_t *nwrite);
 };
 
 // With a small fast read buffer, to support peek for protocol detecting. Note that directly write to io without any
 // cache or buffer.
-class SrsBufferedReadWriter : public ISrsProtocolReadWriter
+class SrsBufferedReadWriter : public ISrsProtocolReadWriter, public ISrsProtocolFileSender
 {
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
@@ -118,6 +121,10 @@ public:
     virtual srs_utime_t get_send_timeout();
     virtual srs_error_t write(void *buf, size_t size, ssize_t *nwrite);
     virtual srs_error_t writev(const iovec *iov, int iov_size, ssize_t *nwrite);
+    // Interface ISrsProtocolFileSender
+public:
+    // Send file by the under-layer transport, which must be a file sender.
+    virtual srs_error_t sendfile(int fd, off_t offset, size_t size, ssize_t *nwrite);
 };
 
 // The interface for SSL connection.
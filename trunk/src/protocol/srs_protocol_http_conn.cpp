@@ -962,6 +962,48 @@ srs_error_t SrsHttpMessageWriter::send_header(char *data, int size)
     return skt_->write((void *)buf.c_str(), buf.length(), NULL);
 }
 
+bool SrsHttpMessageWriter::sendfile_enabled()
+{
+    // The chunked encoding requires the header of each chunk, so we never send file directly.
+    if (!header_wrote_ || content_length_ == -1) {
+        return false;
+    }
+
+    // The encrypted socket, for example, HTTPS, never support it.
+    return dynamic_cast<ISrsProtocolFileSender *>(skt_) != NULL;
+}
+
+srs_error_t SrsHttpMessageWriter::sendfile(int fd, off_t offset, int64_t size)
+{
+    srs_error_t err = srs_success;
+
+    ISrsProtocolFileSender *sender = dynamic_cast<ISrsProtocolFileSender *>(skt_);
+    if (!sender || !header_wrote_ || content_length_ == -1) {
+        return srs_error_new(ERROR_HTTP_CONTENT_LENGTH, "sendfile not enabled, content-length=%" PRId64, content_length_);
+    }
+
+    // whatever header is wrote, we should try to send header.
+    if ((err = send_header(NULL, 0)) != srs_success) {
+        return srs_error_wrap(err, "send header");
+    }
+
+    // check the bytes send and content length.
+    written_ += size;
+    if (written_ > content_length_) {
+        return srs_error_new(ERROR_HTTP_CONTENT_LENGTH, "overflow writen=%" PRId64 ", max=%" PRId64, written_, content_length_);
+    }
+
+    if (size <= 0) {
+        return err;
+    }
+
+    if ((err = sender->sendfile(fd, offset, (size_t)size, NULL)) != srs_success) {
+        return srs_error_wrap(err, "sendfile");
+    }
+
+    return err;
+}
+
 bool SrsHttpMessageWriter::header_wrote()
 {
     return header_wrote_;
@@ -1008,6 +1050,16 @@ srs_error_t SrsHttpResponseWriter::writev(const iovec *iov, int iovcnt, ssize_t
     return writer_->writev(iov, iovcnt, pnwrite);
 }
 
+bool SrsHttpResponseWriter::sendfile_enabled()
+{
+    return writer_->sendfile_enabled();
+}
+
+srs_error_t SrsHttpResponseWriter::sendfile(int fd, off_t offset, int64_t size)
+{
+    return writer_->sendfile(fd, offset, size);
+}
+
 void SrsHttpResponseWriter::write_header(int code)
 {
     if (writer_->header_wrote()) {
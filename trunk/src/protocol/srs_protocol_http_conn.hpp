@@ -323,6 +323,10 @@ public:
     virtual srs_error_t writev(const iovec *iov, int iovcnt, ssize_t *pnwrite);
     virtual void write_header();
     virtual srs_error_t send_header(char *data, int size);
+    // Whether the socket is able to send file, and the content length is determined.
+    virtual bool sendfile_enabled();
+    // Send the file in kernel as body, never in chunked encoding.
+    virtual srs_error_t sendfile(int fd, off_t offset, int64_t size);
 
 public:
     bool header_wrote();
@@ -330,7 +334,7 @@ public:
 };
 
 // Response writer use st socket
-class SrsHttpResponseWriter : public ISrsHttpResponseWriter, public ISrsHttpFirstLineWriter
+class SrsHttpResponseWriter : public ISrsHttpResponseWriter, public ISrsHttpFileSender, public ISrsHttpFirstLineWriter
 {
 // clang-format off
 SRS_DECLARE_PROTECTED: // clang-format on
@@ -351,6 +355,10 @@ public:
     virtual srs_error_t write(char *data, int size);
     virtual srs_error_t writev(const iovec *iov, int iovcnt, ssize_t *pnwrite);
     virtual void write_header(int code);
+    // Interface ISrsHttpFileSender
+public:
+    virtual bool sendfile_enabled();
+    virtual srs_error_t sendfile(int fd, off_t offset, int64_t size);
     // Interface ISrsHttpFirstLineWriter
 public:
     virtual srs_error_t build_first_line(std::stringstream &ss, char *data, int size);
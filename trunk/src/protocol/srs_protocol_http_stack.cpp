@@ -420,6 +420,14 @@ ISrsHttpResponseWriter::~ISrsHttpResponseWriter()
 {
 }
 
+ISrsHttpFileSender::ISrsHttpFileSender()
+{
+}
+
+ISrsHttpFileSender::~ISrsHttpFileSender()
+{
+}
+
 ISrsHttpResponseReader::ISrsHttpResponseReader()
 {
 }
@@ -528,6 +536,52 @@ string srs_http_fs_fullpath(string dir, string pattern, string upath)
     return fullpath;
 }
 
+string srs_http_fs_content_type(string fullpath)
+{
+    static std::map<std::string, std::string> _mime;
+    if (_mime.empty()) {
+        _mime[".ts"] = "video/MP2T";
+        _mime[".flv"] = "video/x-flv";
+        _mime[".m4v"] = "video/x-m4v";
+        _mime[".3gpp"] = "video/3gpp";
+        _mime[".3gp"] = "video/3gpp";
+        _mime[".mp4"] = "video/mp4";
+        _mime[".aac"] = "audio/x-aac";
+        _mime[".mp3"] = "audio/mpeg";
+        _mime[".m4a"] = "audio/x-m4a";
+        _mime[".ogg"] = "audio/ogg";
+        // @see hls-m3u8-draft-pantos-http-live-streaming-12.pdf, page 5.
+        _mime[".m3u8"] = "application/vnd.apple.mpegurl"; // application/x-mpegURL
+        _mime[".rss"] = "application/rss+xml";
+        _mime[".json"] = "application/json";
+        _mime[".swf"] = "application/x-shockwave-flash";
+        _mime[".doc"] = "application/msword";
+        _mime[".zip"] = "application/zip";
+        _mime[".rar"] = "application/x-rar-compressed";
+        _mime[".xml"] = "text/xml";
+        _mime[".html"] = "text/html";
+        _mime[".js"] = "text/javascript";
+        _mime[".css"] = "text/css";
+        _mime[".ico"] = "image/x-icon";
+        _mime[".png"] = "image/png";
+        _mime[".jpeg"] = "image/jpeg";
+        _mime[".jpg"] = "image/jpeg";
+        _mime[".gif"] = "image/gif";
+        // For MPEG-DASH.
+        _mime[".mpd"] = "application/dash+xml";
+        _mime[".m4s"] = "video/iso.segment";
+        _mime[".mp4v"] = "video/mp4";
+    }
+
+    SrsPath path;
+    std::string ext = path.filepath_ext(fullpath);
+
+    if (_mime.find(ext) == _mime.end()) {
+        return "application/octet-stream";
+    }
+    return _mime[ext];
+}
+
 SrsHttpFileServer::SrsHttpFileServer(string root_dir)
 {
     dir = root_dir;
@@ -607,51 +661,7 @@ srs_error_t SrsHttpFileServer::serve_file(ISrsHttpResponseWriter *w, ISrsHttpMes
     // unset the content length to encode in chunked encoding.
     w->header()->set_content_length(length);
 
-    static std::map<std::string, std::string> _mime;
-    if (_mime.empty()) {
-        _mime[".ts"] = "video/MP2T";
-        _mime[".flv"] = "video/x-flv";
-        _mime[".m4v"] = "video/x-m4v";
-        _mime[".3gpp"] = "video/3gpp";
-        _mime[".3gp"] = "video/3gpp";
-        _mime[".mp4"] = "video/mp4";
-        _mime[".aac"] = "audio/x-aac";
-        _mime[".mp3"] = "audio/mpeg";
-        _mime[".m4a"] = "audio/x-m4a";
-        _mime[".ogg"] = "audio/ogg";
-        // @see hls-m3u8-draft-pantos-http-live-streaming-12.pdf, page 5.
-        _mime[".m3u8"] = "application/vnd.apple.mpegurl"; // application/x-mpegURL
-        _mime[".rss"] = "application/rss+xml";
-        _mime[".json"] = "application/json";
-        _mime[".swf"] = "application/x-shockwave-flash";
-        _mime[".doc"] = "application/msword";
-        _mime[".zip"] = "application/zip";
-        _mime[".rar"] = "application/x-rar-compressed";
-        _mime[".xml"] = "text/xml";
-        _mime[".html"] = "text/html";
-        _mime[".js"] = "text/javascript";
-        _mime[".css"] = "text/css";
-        _mime[".ico"] = "image/x-icon";
-        _mime[".png"] = "image/png";
-        _mime[".jpeg"] = "image/jpeg";
-        _mime[".jpg"] = "image/jpeg";
-        _mime[".gif"] = "image/gif";
-        // For MPEG-DASH.
-        _mime[".mpd"] = "application/dash+xml";
-        _mime[".m4s"] = "video/iso.segment";
-        _mime[".mp4v"] = "video/mp4";
-    }
-
-    if (true) {
-        SrsPath path;
-        std::string ext = path.filepath_ext(fullpath);
-
-        if (_mime.find(ext) == _mime.end()) {
-            w->header()->set_content_type("application/octet-stream");
-        } else {
-            w->header()->set_content_type(_mime[ext]);
-        }
-    }
+    w->header()->set_content_type(srs_http_fs_content_type(fullpath));
 
     // Enter chunked mode, because we didn't set the content-length.
     w->write_header(SRS_CONSTS_HTTP_OK);
@@ -686,6 +696,12 @@ srs_error_t SrsHttpFileServer::serve_flv_file(ISrsHttpResponseWriter *w, ISrsHtt
 
 srs_error_t SrsHttpFileServer::serve_mp4_file(ISrsHttpResponseWriter *w, ISrsHttpMessage *r, string fullpath)
 {
+    // for player to seek mp4 by time in seconds.
+    std::string seek = r->query_get("start");
+    if (!seek.empty() && ::atof(seek.c_str()) > 0) {
+        return serve_mp4_seek(w, r, fullpath, (srs_utime_t)(::atof(seek.c_str()) * SRS_UTIME_SECONDS));
+    }
+
     // for flash to request mp4 range in query string.
     std::string range = r->query_get("range");
     // or, use bytes to request range.
@@ -742,6 +758,12 @@ srs_error_t SrsHttpFileServer::serve_mp4_stream(ISrsHttpResponseWriter *w, ISrsH
     return serve_file(w, r, fullpath);
 }
 
+srs_error_t SrsHttpFileServer::serve_mp4_seek(ISrsHttpResponseWriter *w, ISrsHttpMessage *r, string fullpath, srs_utime_t start)
+{
+    // @remark For common http file server, we don't support stream request, please use SrsVodStream instead.
+    return serve_file(w, r, fullpath);
+}
+
 srs_error_t SrsHttpFileServer::serve_m3u8_ctx(ISrsHttpResponseWriter *w, ISrsHttpMessage *r, std::string fullpath)
 {
     // @remark For common http file server, we don't support stream request, please use SrsVodStream instead.
@@ -758,6 +780,19 @@ srs_error_t SrsHttpFileServer::copy(ISrsHttpResponseWriter *w, SrsFileReader *fs
 {
     srs_error_t err = srs_success;
 
+    // Send file in kernel if possible, for the VOD server is bound by memory bandwidth when copying
+    // the data twice. For HTTPS, the data must be encrypted, so we read and write it.
+    ISrsHttpFileSender *sender = dynamic_cast<ISrsHttpFileSender *>(w);
+    if (sender && fs->fd() >= 0 && sender->sendfile_enabled()) {
+        int64_t offset = fs->tellg();
+        if ((err = sender->sendfile(fs->fd(), (off_t)offset, size)) != srs_success) {
+            return srs_error_wrap(err, "sendfile offset=%" PRId64 ", size=%" PRId64, offset, size);
+        }
+
+        fs->seek2(offset + size);
+        return err;
+    }
+
     int64_t left = size;
     SrsUniquePtr<char[]> buf(new char[SRS_HTTP_TS_SEND_BUFFER_SIZE]);
 
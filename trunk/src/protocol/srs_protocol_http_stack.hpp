@@ -203,6 +203,22 @@ public:
     virtual void write_header(int code) = 0;
 };
 
+// The response writer which is able to send the body from file in kernel, without copying data to
+// user space, for example, the static files of plaintext HTTP.
+class ISrsHttpFileSender
+{
+public:
+    ISrsHttpFileSender();
+    virtual ~ISrsHttpFileSender();
+
+public:
+    // Whether able to send file, it's false for HTTPS or chunked encoding.
+    // @remark Should be called after write_header, when the content length is determined.
+    virtual bool sendfile_enabled() = 0;
+    // Send size bytes of file fd from offset, as the body of response.
+    virtual srs_error_t sendfile(int fd, off_t offset, int64_t size) = 0;
+};
+
 // The reader interface for http response.
 class ISrsHttpResponseReader : public ISrsReader
 {
@@ -334,6 +350,9 @@ public:
 // Build the file path from request r.
 extern std::string srs_http_fs_fullpath(std::string dir, std::string pattern, std::string upath);
 
+// Get the content type of file by its extension, for example, video/MP2T for .ts file.
+extern std::string srs_http_fs_content_type(std::string fullpath);
+
 // FileServer returns a handler that serves HTTP requests
 // with the contents of the file system rooted at root.
 //
@@ -368,9 +387,12 @@ public:
     virtual srs_error_t serve_http(ISrsHttpResponseWriter *w, ISrsHttpMessage *r);
 
 // clang-format off
-SRS_DECLARE_PRIVATE: // clang-format on
+SRS_DECLARE_PROTECTED: // clang-format on
     // Serve the file by specified path
     virtual srs_error_t serve_file(ISrsHttpResponseWriter *w, ISrsHttpMessage *r, std::string fullpath);
+
+// clang-format off
+SRS_DECLARE_PRIVATE: // clang-format on
     virtual srs_error_t serve_flv_file(ISrsHttpResponseWriter *w, ISrsHttpMessage *r, std::string fullpath);
     virtual srs_error_t serve_mp4_file(ISrsHttpResponseWriter *w, ISrsHttpMessage *r, std::string fullpath);
 
@@ -383,6 +405,9 @@ SRS_DECLARE_PROTECTED: // clang-format on
     // @param end the end offset in bytes. -1 to end of file.
     // @remark response data in [start, end].
     virtual srs_error_t serve_mp4_stream(ISrsHttpResponseWriter *w, ISrsHttpMessage *r, std::string fullpath, int64_t start, int64_t end);
+    // When access mp4 file with x.mp4?start=time, the time in seconds, for example, x.mp4?start=10.5
+    // @remark response a playable mp4 from the keyframe before the time.
+    virtual srs_error_t serve_mp4_seek(ISrsHttpResponseWriter *w, ISrsHttpMessage *r, std::string fullpath, srs_utime_t start);
     // For HLS protocol.
     // When the request url, like as "http://127.0.0.1:8080/live/livestream.m3u8",
     // returns the response like as "http://127.0.0.1:8080/live/livestream.m3u8?hls_ctx=12345678" .
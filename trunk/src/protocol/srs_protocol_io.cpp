@@ -29,3 +29,11 @@ ISrsProtocolReadWriter::ISrsProtocolReadWriter()
 ISrsProtocolReadWriter::~ISrsProtocolReadWriter()
 {
 }
+
+ISrsProtocolFileSender::ISrsProtocolFileSender()
+{
+}
+
+ISrsProtocolFileSender::~ISrsProtocolFileSender()
+{
+}
@@ -88,4 +88,20 @@ public:
     virtual ~ISrsProtocolReadWriter();
 };
 
+/**
+ * The sender to send file to the channel in kernel, without copying data to user space, for
+ * example, by sendfile(2) for plaintext TCP socket. The encrypted channel never supports it.
+ */
+class ISrsProtocolFileSender
+{
+public:
+    ISrsProtocolFileSender();
+    virtual ~ISrsProtocolFileSender();
+
+public:
+    // Send size bytes of file fd from offset, the file offset of fd is not changed.
+    // @param nwrite, the actually sent size, NULL to ignore.
+    virtual srs_error_t sendfile(int fd, off_t offset, size_t size, ssize_t *nwrite) = 0;
+};
+
 #endif
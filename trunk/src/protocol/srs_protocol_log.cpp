@@ -54,12 +54,13 @@ const SrsContextId &SrsThreadContext::get_id()
         return _srs_context_default;
     }
 
-    ++_srs_pps_cids_get->sugar_;
-
+    // Only the ST thread has context, and counts in the stat, which is not thread-safe.
     if (!srs_thread_self()) {
         return _srs_context_default;
     }
 
+    ++_srs_pps_cids_get->sugar_;
+
     void *cid = srs_thread_getspecific(_srs_context_key);
     if (!cid) {
         return _srs_context_default;
@@ -410,16 +410,30 @@ srs_error_t SrsProtocol::do_send_messages(SrsMediaPacket **msgs, int nb_msgs)
         char *p = msg->payload();
         char *pend = msg->payload() + msg->size();
 
+        // use the chunk headers shared by all players of the message if possible.
+        char *c0 = NULL, *c3 = NULL;
+        int nb_c0 = 0, nb_c3 = 0;
+        bool shared = srs_rtmp_shared_chunk_header(msg, &c0, &nb_c0, &c3, &nb_c3);
+
         // always write the header event payload is empty.
         while (p < pend) {
             // always has header
-            int nb_cache = SRS_CONSTS_C0C3_HEADERS_MAX - c0c3_cache_index;
-            int nbh = srs_rtmp_write_chunk_header(msg, c0c3_cache, nb_cache, p == msg->payload());
-            srs_assert(nbh > 0);
+            if (shared) {
+                iovs[0].iov_base = (p == msg->payload()) ? c0 : c3;
+                iovs[0].iov_len = (p == msg->payload()) ? nb_c0 : nb_c3;
+            } else {
+                int nb_cache = SRS_CONSTS_C0C3_HEADERS_MAX - c0c3_cache_index;
+                int nbh = srs_rtmp_write_chunk_header(msg, c0c3_cache, nb_cache, p == msg->payload());
+                srs_assert(nbh > 0);
 
-            // header iov
-            iovs[0].iov_base = c0c3_cache;
-            iovs[0].iov_len = nbh;
+                // header iov
+                iovs[0].iov_base = c0c3_cache;
+                iovs[0].iov_len = nbh;
+
+                // to next c0c3 header cache
+                c0c3_cache_index += nbh;
+                c0c3_cache = out_c0c3_caches_ + c0c3_cache_index;
+            }
 
             // payload iov
             int payload_size = srs_min(out_chunk_size_, (int)(pend - p));
@@ -444,10 +458,6 @@ srs_error_t SrsProtocol::do_send_messages(SrsMediaPacket **msgs, int nb_msgs)
             iov_index += 2;
             iovs = out_iovs_ + iov_index;
 
-            // to next c0c3 header cache
-            c0c3_cache_index += nbh;
-            c0c3_cache = out_c0c3_caches_ + c0c3_cache_index;
-
             // the cache header should never be realloc again,
             // for the ptr is set to iovs, so we just warn user to set larger
             // and use another loop to send again.
@@ -1207,6 +1217,16 @@ srs_error_t SrsProtocol::read_message_payload(SrsChunkStream *chunk, SrsRtmpComm
         chunk->writing_pos_ = chunk->msg_->payload();
     }
 
+    // For the publisher, the large message such as video frame is mostly in buffer, because of the
+    // merged read, so we assemble all its chunks at once.
+    if (nn_written == 0 && assemble_message_payload(chunk)) {
+        *pmsg = chunk->msg_;
+
+        chunk->msg_ = NULL;
+        chunk->writing_pos_ = NULL;
+        return err;
+    }
+
     // read payload to buffer
     if ((err = in_buffer_->grow(skt_, payload_size)) != srs_success) {
         return srs_error_wrap(err, "read %d bytes payload", payload_size);
@@ -1227,6 +1247,51 @@ srs_error_t SrsProtocol::read_message_payload(SrsChunkStream *chunk, SrsRtmpComm
     return err;
 }
 
+bool SrsProtocol::assemble_message_payload(SrsChunkStream *chunk)
+{
+    int size = chunk->header_.payload_length_;
+    if (size <= in_chunk_size_) {
+        return false;
+    }
+
+    // Only for the 1 byte basic header of fmt=3, without the extended timestamp.
+    if (chunk->cid_ < 2 || chunk->cid_ > 63 || chunk->has_extended_timestamp_) {
+        return false;
+    }
+
+    // The message is in buffer, if the payload and the header of each following chunk is there.
+    int nn_chunks = (size + in_chunk_size_ - 1) / in_chunk_size_;
+    int required = size + nn_chunks - 1;
+    if (in_buffer_->size() < required) {
+        return false;
+    }
+
+    // Check the basic header of each following chunk, which should be fmt=3 of the same chunk
+    // stream, or it's interlaced by other chunk streams.
+    char *p = in_buffer_->bytes();
+    char c3 = (char)(0xC0 | chunk->cid_);
+    for (int i = 1; i < nn_chunks; i++) {
+        if (p[i * (in_chunk_size_ + 1) - 1] != c3) {
+            return false;
+        }
+    }
+
+    p = in_buffer_->read_slice(required);
+    for (int left = size; left > 0;) {
+        int nn = srs_min(left, in_chunk_size_);
+        memcpy(chunk->writing_pos_, p, nn);
+
+        chunk->writing_pos_ += nn;
+        p += nn + 1;
+        left -= nn;
+    }
+
+    // Each chunk is a message header for the chunk stream.
+    chunk->msg_count_ += nn_chunks - 1;
+
+    return true;
+}
+
 srs_error_t SrsProtocol::on_recv_message(SrsRtmpCommonMessage *msg)
 {
     srs_error_t err = srs_success;
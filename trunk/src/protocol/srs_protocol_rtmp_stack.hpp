@@ -370,6 +370,10 @@ SRS_DECLARE_PRIVATE: // clang-format on
     // Read the chunk payload, remove the used bytes in buffer,
     // if got entire message, set the pmsg.
     virtual srs_error_t read_message_payload(SrsChunkStream *chunk, SrsRtmpCommonMessage **pmsg);
+    // Assemble the whole payload of a fresh message in a batch, when all its chunks are already in
+    // buffer, parsing the fmt=3 headers in place rather than a round of header and payload reading
+    // for each chunk. Return false if not in buffer or interlaced, then read chunk by chunk.
+    virtual bool assemble_message_payload(SrsChunkStream *chunk);
     // When recv message, update the context.
     virtual srs_error_t on_recv_message(SrsRtmpCommonMessage *msg);
     // When message sentout, update the context.
@@ -837,6 +837,40 @@ srs_error_t SrsSrtSocket::recvmsg(void *buf, size_t size, ssize_t *nread)
     return err;
 }
 
+srs_error_t SrsSrtSocket::recvmsgs(iovec *iovs, int nn_iovs, int *nn_msgs)
+{
+    srs_error_t err = srs_success;
+
+    *nn_msgs = 0;
+    if (nn_iovs <= 0) {
+        return err;
+    }
+
+    // Wait for the first message.
+    ssize_t nread = 0;
+    if ((err = recvmsg(iovs[0].iov_base, iovs[0].iov_len, &nread)) != srs_success) {
+        return srs_error_wrap(err, "recvmsg");
+    }
+    iovs[0].iov_len = nread;
+
+    // Drain the received messages, never wait, because there are messages to process. If error, for example, the
+    // connection is closed, we return the received messages, and the error is returned by next read.
+    int nn = 1;
+    for (; nn < nn_iovs; nn++) {
+        int ret = srt_recvmsg(srt_fd_, (char *)iovs[nn].iov_base, iovs[nn].iov_len);
+        if (ret < 0) {
+            break;
+        }
+
+        recv_bytes_ += ret;
+        iovs[nn].iov_len = ret;
+    }
+
+    *nn_msgs = nn;
+
+    return err;
+}
+
 srs_error_t SrsSrtSocket::sendmsg(void *buf, size_t size, ssize_t *nwrite)
 {
     srs_error_t err = srs_success;
@@ -13,6 +13,8 @@
 #include <map>
 #include <vector>
 
+#include <sys/uio.h>
+
 class SrsSrtSocket;
 
 extern srs_error_t srs_srt_log_initialize();
@@ -125,6 +127,10 @@ public:
 
 public:
     virtual srs_error_t recvmsg(void *buf, size_t size, ssize_t *nread) = 0;
+    // Receive messages in batch, wait for the first message, then drain the received messages without waiting.
+    // The iov_len of each iovec is the size of buffer, and updated to the size of message, the nn_msgs is the
+    // number of received messages.
+    virtual srs_error_t recvmsgs(iovec *iovs, int nn_iovs, int *nn_msgs) = 0;
     virtual srs_error_t sendmsg(void *buf, size_t size, ssize_t *nwrite) = 0;
     virtual void set_recv_timeout(srs_utime_t tm) = 0;
     virtual void set_send_timeout(srs_utime_t tm) = 0;
@@ -145,6 +151,7 @@ public: // IO API
     srs_error_t connect(const std::string &ip, int port);
     srs_error_t accept(srs_srt_t *client_srt_fd);
     srs_error_t recvmsg(void *buf, size_t size, ssize_t *nread);
+    srs_error_t recvmsgs(iovec *iovs, int nn_iovs, int *nn_msgs);
     srs_error_t sendmsg(void *buf, size_t size, ssize_t *nwrite);
 
 public:
@@ -8,9 +8,11 @@
 
 #include <fcntl.h>
 #include <netdb.h>
+#include <poll.h>
 #include <st.h>
 #include <sys/resource.h>
 #include <sys/socket.h>
+#include <unistd.h>
 using namespace std;
 
 #include <srs_core_autofree.hpp>
@@ -23,8 +25,12 @@ using namespace std;
 // nginx also set to 512
 #define SERVER_LISTEN_BACKLOG 512
 
+// The buffer to send file, when sendfile(2) is not available.
+#define SRS_SENDFILE_BUFFER_SIZE 65536
+
 #ifdef __linux__
 #include <sys/epoll.h>
+#include <sys/sendfile.h>
 
 bool srs_st_epoll_is_supported(void)
 {
@@ -562,6 +568,83 @@ int srs_sendmsg(srs_netfd_t stfd, const struct msghdr *msg, int flags, srs_utime
     return st_sendmsg((st_netfd_t)stfd, msg, flags, (st_utime_t)timeout);
 }
 
+int srs_sendmmsg(srs_netfd_t stfd, struct mmsghdr *msgvec, unsigned int vlen, int flags, srs_utime_t timeout)
+{
+#if defined(__linux__)
+    // ST doesn't provide the sendmmsg, so we do the same as st_sendmsg, that is, try to send on the
+    // non-blocking fd and wait for POLLOUT event when EAGAIN.
+    int osfd = st_netfd_fileno((st_netfd_t)stfd);
+
+    int r0 = 0;
+    while ((r0 = ::sendmmsg(osfd, msgvec, vlen, flags)) < 0) {
+        if (errno == EINTR) {
+            continue;
+        }
+        if (errno != EAGAIN && errno != EWOULDBLOCK) {
+            return -1;
+        }
+        // Wait until the fd is writable, or timeout with errno ETIME.
+        if (st_netfd_poll((st_netfd_t)stfd, POLLOUT, (st_utime_t)timeout) < 0) {
+            return -1;
+        }
+    }
+
+    return r0;
+#else
+    for (unsigned int i = 0; i < vlen; i++) {
+        struct mmsghdr *p = msgvec + i;
+
+        int r0 = st_sendmsg((st_netfd_t)stfd, &p->msg_hdr, flags, (st_utime_t)timeout);
+        if (r0 < 0) {
+            // Return the number of sent messages, or error if nothing sent.
+            return i > 0 ? (int)i : -1;
+        }
+
+        p->msg_len = r0;
+    }
+
+    return (int)vlen;
+#endif
+}
+
+int srs_recvmmsg(srs_netfd_t stfd, struct mmsghdr *msgvec, unsigned int vlen, int flags, srs_utime_t timeout)
+{
+#if defined(__linux__)
+    // ST doesn't provide the recvmmsg, so we do the same as st_recvmsg, that is, try to read on the
+    // non-blocking fd and wait for POLLIN event when EAGAIN. Note that we never pass a timeout to the
+    // recvmmsg, so it returns the messages already in the socket buffer without blocking.
+    int osfd = st_netfd_fileno((st_netfd_t)stfd);
+
+    int r0 = 0;
+    while ((r0 = ::recvmmsg(osfd, msgvec, vlen, flags, NULL)) < 0) {
+        if (errno == EINTR) {
+            continue;
+        }
+        if (errno != EAGAIN && errno != EWOULDBLOCK) {
+            return -1;
+        }
+        // Wait until the fd is readable, or timeout with errno ETIME.
+        if (st_netfd_poll((st_netfd_t)stfd, POLLIN, (st_utime_t)timeout) < 0) {
+            return -1;
+        }
+    }
+
+    return r0;
+#else
+    if (vlen == 0) {
+        return 0;
+    }
+
+    int r0 = st_recvmsg((st_netfd_t)stfd, &msgvec->msg_hdr, flags, (st_utime_t)timeout);
+    if (r0 < 0) {
+        return -1;
+    }
+
+    msgvec->msg_len = r0;
+    return 1;
+#endif
+}
+
 srs_netfd_t srs_accept(srs_netfd_t stfd, struct sockaddr *addr, int *addrlen, srs_utime_t timeout)
 {
     return (srs_netfd_t)st_accept((st_netfd_t)stfd, addr, addrlen, (st_utime_t)timeout);
@@ -766,6 +849,76 @@ srs_error_t SrsStSocket::writev(const iovec *iov, int iov_size, ssize_t *nwrite)
     return err;
 }
 
+srs_error_t SrsStSocket::sendfile(int fd, off_t offset, size_t size, ssize_t *nwrite)
+{
+    srs_error_t err = srs_success;
+
+    srs_assert(stfd_);
+
+    size_t left = size;
+#ifdef __linux__
+    int sfd = srs_netfd_fileno(stfd_);
+    st_utime_t timeout = (stm_ == SRS_UTIME_NO_TIMEOUT) ? ST_UTIME_NO_TIMEOUT : stm_;
+
+    while (left > 0) {
+        ssize_t nb_write = ::sendfile(sfd, fd, &offset, left);
+        if (nb_write > 0) {
+            left -= nb_write;
+            sbytes_ += nb_write;
+            continue;
+        }
+
+        // The file is truncated, there is no more data to send.
+        if (nb_write == 0) {
+            err = srs_error_new(ERROR_SOCKET_WRITE, "sendfile eof, size=%d, left=%d", (int)size, (int)left);
+            break;
+        }
+
+        if (errno == EINTR) {
+            continue;
+        }
+        if (errno != EAGAIN) {
+            err = srs_error_new(ERROR_SOCKET_WRITE, "sendfile");
+            break;
+        }
+
+        // The socket buffer is full, switch to other coroutines until it's writable.
+        if (st_netfd_poll((st_netfd_t)stfd_, POLLOUT, timeout) == -1) {
+            if (errno == ETIME) {
+                err = srs_error_new(ERROR_SOCKET_TIMEOUT, "sendfile timeout %d ms", srsu2msi(stm_));
+            } else {
+                err = srs_error_new(ERROR_SOCKET_WRITE, "sendfile poll");
+            }
+            break;
+        }
+    }
+#else
+    // There is no compatible sendfile(2), so we read the file to user space and send it.
+    SrsUniquePtr<char[]> buf(new char[SRS_SENDFILE_BUFFER_SIZE]);
+    while (left > 0) {
+        ssize_t nb_read = ::pread(fd, buf.get(), srs_min(left, (size_t)SRS_SENDFILE_BUFFER_SIZE), offset);
+        if (nb_read <= 0) {
+            err = srs_error_new(ERROR_SOCKET_WRITE, "sendfile read, size=%d, left=%d", (int)size, (int)left);
+            break;
+        }
+
+        if ((err = write(buf.get(), nb_read, NULL)) != srs_success) {
+            err = srs_error_wrap(err, "sendfile write");
+            break;
+        }
+
+        left -= nb_read;
+        offset += nb_read;
+    }
+#endif
+
+    if (nwrite) {
+        *nwrite = size - left;
+    }
+
+    return err;
+}
+
 SrsTcpClient::SrsTcpClient(string h, int p, srs_utime_t tm)
 {
     stfd_ = NULL;
@@ -10,6 +10,7 @@
 #include <srs_core.hpp>
 
 #include <string>
+#include <sys/socket.h>
 
 #include <srs_kernel_error.hpp>
 #include <srs_kernel_st.hpp>
@@ -143,6 +144,22 @@ extern int srs_sendto(srs_netfd_t stfd, void *buf, int len, const struct sockadd
 extern int srs_recvmsg(srs_netfd_t stfd, struct msghdr *msg, int flags, srs_utime_t timeout);
 extern int srs_sendmsg(srs_netfd_t stfd, const struct msghdr *msg, int flags, srs_utime_t timeout);
 
+#if !defined(__linux__)
+// The mmsghdr is linux specified, we define it for other platforms, such as OSX.
+struct mmsghdr {
+    struct msghdr msg_hdr;
+    unsigned int msg_len;
+};
+#endif
+// Send multiple messages in one syscall, and set the msg_len of each sent message.
+// @return The number of messages sent, or -1 for error. Note that it may send less than vlen.
+// @remark For platforms without sendmmsg, we fallback to send each message by sendmsg.
+extern int srs_sendmmsg(srs_netfd_t stfd, struct mmsghdr *msgvec, unsigned int vlen, int flags, srs_utime_t timeout);
+// Receive multiple messages in one syscall, and set the msg_len of each received message.
+// @return The number of messages received, or -1 for error. It never blocks once any message is received.
+// @remark For platforms without recvmmsg, we fallback to receive one message by recvmsg.
+extern int srs_recvmmsg(srs_netfd_t stfd, struct mmsghdr *msgvec, unsigned int vlen, int flags, srs_utime_t timeout);
+
 extern srs_netfd_t srs_accept(srs_netfd_t stfd, struct sockaddr *addr, int *addrlen, srs_utime_t timeout);
 
 extern ssize_t srs_read(srs_netfd_t stfd, void *buf, size_t nbyte, srs_utime_t timeout);
@@ -175,7 +192,7 @@ public:
 
 // the socket provides TCP socket over st,
 // that is, the sync socket mechanism.
-class SrsStSocket : public ISrsProtocolReadWriter
+class SrsStSocket : public ISrsProtocolReadWriter, public ISrsProtocolFileSender
 {
 // clang-format off
 SRS_DECLARE_PRIVATE: // clang-format on
@@ -213,6 +230,9 @@ public:
     // @param nwrite, the actual write bytes, ignore if NULL.
     virtual srs_error_t write(void *buf, size_t size, ssize_t *nwrite);
     virtual srs_error_t writev(const iovec *iov, int iov_size, ssize_t *nwrite);
+    // Interface ISrsProtocolFileSender
+public:
+    virtual srs_error_t sendfile(int fd, off_t offset, size_t size, ssize_t *nwrite);
 };
 
 // The client to connect to server over TCP.
@@ -23,6 +23,7 @@
 #include <srs_kernel_st.hpp>
 #include <srs_kernel_stream.hpp>
 #include <srs_kernel_utility.hpp>
+#include <srs_utest_manual_kernel.hpp>
 #include <srs_utest_manual_protocol.hpp>
 
 #include <algorithm>
@@ -2527,6 +2528,77 @@ VOID TEST(KernelRtcRtpTest, SrsRtpPacketCopyAndEncodeDecode)
     EXPECT_EQ(96, decoded.header_.get_payload_type());
 }
 
+VOID TEST(KernelRtcRtpTest, SrsRtpPacketCopySharePayload)
+{
+    srs_error_t err;
+
+    SrsRtpPacket *original = new SrsRtpPacket();
+    original->header_.set_sequence(1000);
+    original->header_.set_ssrc(0x12345678);
+    original->header_.set_payload_type(96);
+
+    SrsRtpRawPayload *raw = new SrsRtpRawPayload();
+    raw->payload_ = original->wrap(100);
+    raw->nn_payload_ = 100;
+    memset(raw->payload_, 0x42, 100);
+    original->set_payload(raw, SrsRtpPacketPayloadTypeRaw);
+    EXPECT_TRUE(original->shared_payload_.get() == NULL);
+
+    // Copies share the same payload, never copy it.
+    SrsRtpPacket *cp1 = original->copy();
+    SrsRtpPacket *cp2 = original->copy();
+    EXPECT_TRUE(original->shared_payload_.get() != NULL);
+    EXPECT_TRUE(cp1->shared_payload_.get() == original->shared_payload_.get());
+    EXPECT_TRUE(cp2->shared_payload_.get() == original->shared_payload_.get());
+    EXPECT_EQ(3, (int)*srs_shared_count(original->shared_payload_.get()));
+    EXPECT_TRUE(cp1->payload() == raw);
+    EXPECT_TRUE(original->shared_payload_->payload() == raw);
+    EXPECT_TRUE(cp2->payload() == raw);
+    EXPECT_EQ(SrsRtpPacketPayloadTypeRaw, cp1->payload_type_);
+
+    // The copy of copy also shares the payload.
+    SrsRtpPacket *cp3 = cp1->copy();
+    EXPECT_TRUE(cp3->payload() == raw);
+    EXPECT_EQ(4, (int)*srs_shared_count(original->shared_payload_.get()));
+
+    // Each copy rewrites its own header.
+    cp1->header_.set_ssrc(0x11111111);
+    cp1->header_.set_sequence(1);
+    cp2->header_.set_ssrc(0x22222222);
+    cp2->header_.set_sequence(2);
+    EXPECT_EQ(0x12345678, original->header_.get_ssrc());
+
+    // Free the original packet first, the copies are still available.
+    SrsRtpSharedPayload *shared = original->shared_payload_.get();
+    srs_freep(original);
+    EXPECT_EQ(3, (int)*srs_shared_count(shared));
+
+    char buf[1500];
+    SrsBuffer b1(buf, sizeof(buf));
+    HELPER_EXPECT_SUCCESS(cp1->encode(&b1));
+    EXPECT_EQ(12 + 100, b1.pos());
+
+    SrsRtpPacket decoded;
+    SrsBuffer b2(buf, b1.pos());
+    HELPER_EXPECT_SUCCESS(decoded.decode(&b2));
+    EXPECT_EQ(0x11111111, decoded.header_.get_ssrc());
+    EXPECT_EQ(1, decoded.header_.get_sequence());
+    EXPECT_EQ(0x42, (uint8_t)buf[12]);
+
+    // Set payload should stop sharing, never change the shared payload.
+    SrsRtpRawPayload *raw2 = new SrsRtpRawPayload();
+    cp2->set_payload(raw2, SrsRtpPacketPayloadTypeRaw);
+    EXPECT_TRUE(cp2->shared_payload_.get() == NULL);
+    EXPECT_TRUE(cp2->payload() == raw2);
+    EXPECT_EQ(2, (int)*srs_shared_count(shared));
+    EXPECT_TRUE(cp3->payload() == raw);
+
+    srs_freep(cp1);
+    srs_freep(cp2);
+    EXPECT_EQ(1, (int)*srs_shared_count(shared));
+    srs_freep(cp3);
+}
+
 VOID TEST(KernelKbpsTest, SrsPps_MockClockUpdate)
 {
     // Test SrsPps::update function with mock clock to verify PPS calculation
@@ -4264,6 +4336,73 @@ VOID TEST(KernelTSTest, SrsEncFileWriter_close)
     path.unlink(temp_file);
 }
 
+VOID TEST(KernelTSTest, SrsEncFileWriter_write_batch)
+{
+    // Writing many packets in one call must produce the same ciphertext as writing them one by one.
+    srs_error_t err = srs_success;
+
+    unsigned char key[16] = {0};
+    unsigned char iv[16] = {0};
+    for (int i = 0; i < 16; i++) {
+        key[i] = i;
+        iv[i] = 0xff - i;
+    }
+
+    // Not multiple of encryption block, to verify the remainder is kept and padded on close.
+    const int nb_packets = 11;
+    unsigned char ts_data[SRS_TS_PACKET_SIZE * nb_packets];
+    for (int i = 0; i < (int)sizeof(ts_data); i++) {
+        ts_data[i] = (unsigned char)(i * 7);
+    }
+
+    std::string files[2];
+    files[0] = "/tmp/srs_test_enc_batch0_" + srs_strconv_format_int(getpid()) + ".ts";
+    files[1] = "/tmp/srs_test_enc_batch1_" + srs_strconv_format_int(getpid()) + ".ts";
+    MockFileRemover remover0(files[0]);
+    MockFileRemover remover1(files[1]);
+
+    for (int k = 0; k < 2; k++) {
+        SrsEncFileWriter writer;
+        HELPER_EXPECT_SUCCESS(writer.config_cipher(key, iv));
+        HELPER_EXPECT_SUCCESS(writer.open(files[k]));
+
+        // The writer never changes the data, see below.
+        unsigned char data[sizeof(ts_data)];
+        memcpy(data, ts_data, sizeof(ts_data));
+
+        if (k == 0) {
+            for (int i = 0; i < nb_packets; i++) {
+                HELPER_EXPECT_SUCCESS(writer.write(data + i * SRS_TS_PACKET_SIZE, SRS_TS_PACKET_SIZE, NULL));
+            }
+        } else {
+            // A single packet first, so the pending block is filled before the batch.
+            HELPER_EXPECT_SUCCESS(writer.write(data, SRS_TS_PACKET_SIZE, NULL));
+            HELPER_EXPECT_SUCCESS(writer.write(data + SRS_TS_PACKET_SIZE, sizeof(data) - SRS_TS_PACKET_SIZE, NULL));
+        }
+
+        writer.close();
+
+        // The data of caller is not encrypted in place.
+        EXPECT_EQ(0, memcmp(data, ts_data, sizeof(ts_data)));
+    }
+
+    std::string contents[2];
+    for (int k = 0; k < 2; k++) {
+        FILE *fp = fopen(files[k].c_str(), "rb");
+        ASSERT_TRUE(fp != NULL);
+        char buf[4096];
+        size_t n = 0;
+        while ((n = fread(buf, 1, sizeof(buf), fp)) > 0) {
+            contents[k].append(buf, n);
+        }
+        fclose(fp);
+    }
+
+    // 11 packets is 2068 bytes, padded to 2080 bytes by PKCS7.
+    EXPECT_EQ(2080, (int)contents[0].length());
+    EXPECT_TRUE(contents[0] == contents[1]);
+}
+
 VOID TEST(KernelTSTest, SrsTsMessageCache_do_cache_mp3)
 {
     // Test SrsTsMessageCache::do_cache_mp3 method
@@ -4372,3 +4511,203 @@ VOID TEST(KernelTSTest, SrsTsTransmuxer_set_has_video)
     // Test passes if methods execute without crashing
     EXPECT_TRUE(true);
 }
+
+VOID TEST(KernelHourglassTest, TimingWheelScheduleAndCancel)
+{
+    SrsTimingWheel wheel("test", 20 * SRS_UTIME_MILLISECONDS);
+
+    MockSrsFastTimer h0, h1;
+    SrsTimerHandle *t0 = new SrsTimerHandle(&h0);
+    SrsTimerHandle *t1 = new SrsTimerHandle(&h1);
+    EXPECT_FALSE(t0->scheduled());
+
+    wheel.schedule(t0, 20 * SRS_UTIME_MILLISECONDS);
+    wheel.schedule(t1, 100 * SRS_UTIME_MILLISECONDS);
+    EXPECT_TRUE(t0->scheduled());
+    EXPECT_EQ(2, wheel.size());
+
+    for (int i = 0; i < 5; i++) {
+        wheel.tick();
+    }
+    EXPECT_EQ(5, (int)h0.timer_calls_.size());
+    EXPECT_EQ(1, (int)h1.timer_calls_.size());
+    EXPECT_EQ(100 * SRS_UTIME_MILLISECONDS, h1.timer_calls_.at(0));
+
+    // Reschedule is the same as schedule.
+    wheel.schedule(t1, 100 * SRS_UTIME_MILLISECONDS);
+    EXPECT_EQ(2, wheel.size());
+
+    // Cancel the timer.
+    wheel.cancel(t0);
+    EXPECT_FALSE(t0->scheduled());
+    EXPECT_EQ(1, wheel.size());
+    for (int i = 0; i < 5; i++) {
+        wheel.tick();
+    }
+    EXPECT_EQ(5, (int)h0.timer_calls_.size());
+    EXPECT_EQ(2, (int)h1.timer_calls_.size());
+
+    // Cancel again is ignored, and free the handle cancels it.
+    wheel.cancel(t0);
+    srs_freep(t0);
+    srs_freep(t1);
+    EXPECT_EQ(0, wheel.size());
+}
+
+VOID TEST(KernelHourglassTest, TimingWheelCascade)
+{
+    SrsTimingWheel wheel("test", 20 * SRS_UTIME_MILLISECONDS);
+
+    // The 5s timer is in level 1, and 100s timer is in level 2.
+    MockSrsFastTimer h0, h1;
+    SrsTimerHandle t0(&h0), t1(&h1);
+    wheel.schedule(&t0, 5 * SRS_UTIME_SECONDS);
+    wheel.schedule(&t1, 100 * SRS_UTIME_SECONDS);
+
+    for (int i = 0; i < 249; i++) {
+        wheel.tick();
+    }
+    EXPECT_EQ(0, (int)h0.timer_calls_.size());
+
+    wheel.tick();
+    EXPECT_EQ(1, (int)h0.timer_calls_.size());
+    EXPECT_EQ(0, (int)h1.timer_calls_.size());
+
+    for (int i = 250; i < 5000; i++) {
+        wheel.tick();
+    }
+    EXPECT_EQ(20, (int)h0.timer_calls_.size());
+    EXPECT_EQ(1, (int)h1.timer_calls_.size());
+    EXPECT_EQ(2, wheel.size());
+}
+
+VOID TEST(KernelHourglassTest, TimingWheelCascadeOnTime)
+{
+    SrsTimingWheel wheel("test", 20 * SRS_UTIME_MILLISECONDS);
+    wheel.set_coalesce(false);
+
+    // The 5s timer is 250 ticks, which expires at the wrap of level 0 every lcm(250, 64) = 8000
+    // ticks, and should fire on time when cascaded, never delayed to next tick.
+    MockSrsFastTimer h0;
+    SrsTimerHandle t0(&h0);
+    wheel.schedule(&t0, 5 * SRS_UTIME_SECONDS);
+
+    int nn_late = 0;
+    for (int i = 1; i <= 16000; i++) {
+        wheel.tick();
+        if ((int)h0.timer_calls_.size() != i / 250) {
+            nn_late++;
+        }
+    }
+    EXPECT_EQ(0, nn_late);
+    EXPECT_EQ(64, (int)h0.timer_calls_.size());
+}
+
+VOID TEST(KernelHourglassTest, TimingWheelCoalesce)
+{
+    if (true) {
+        SrsTimingWheel wheel("test", 20 * SRS_UTIME_MILLISECONDS);
+
+        // The timers of the same interval fire in the same tick.
+        MockSrsFastTimer h0, h1;
+        SrsTimerHandle t0(&h0), t1(&h1);
+        wheel.schedule(&t0, 100 * SRS_UTIME_MILLISECONDS);
+        wheel.tick();
+        wheel.tick();
+        wheel.schedule(&t1, 100 * SRS_UTIME_MILLISECONDS);
+
+        for (int i = 2; i < 5; i++) {
+            wheel.tick();
+        }
+        EXPECT_EQ(1, (int)h0.timer_calls_.size());
+        EXPECT_EQ(1, (int)h1.timer_calls_.size());
+    }
+
+    if (true) {
+        SrsTimingWheel wheel("test", 20 * SRS_UTIME_MILLISECONDS);
+        wheel.set_coalesce(false);
+
+        // The timer fires after the interval since scheduled.
+        MockSrsFastTimer h0, h1;
+        SrsTimerHandle t0(&h0), t1(&h1);
+        wheel.schedule(&t0, 100 * SRS_UTIME_MILLISECONDS);
+        wheel.tick();
+        wheel.tick();
+        wheel.schedule(&t1, 100 * SRS_UTIME_MILLISECONDS);
+
+        for (int i = 2; i < 5; i++) {
+            wheel.tick();
+        }
+        EXPECT_EQ(1, (int)h0.timer_calls_.size());
+        EXPECT_EQ(0, (int)h1.timer_calls_.size());
+
+        wheel.tick();
+        wheel.tick();
+        EXPECT_EQ(1, (int)h1.timer_calls_.size());
+    }
+}
+
+VOID TEST(KernelHourglassTest, TimingWheelCancelInHandler)
+{
+    // The handler which frees another timer of the same tick.
+    class MockTimerHandlerCanceller : public ISrsFastTimerHandler
+    {
+    public:
+        SrsTimerHandle *peer_;
+        int count_;
+
+    public:
+        MockTimerHandlerCanceller()
+        {
+            peer_ = NULL;
+            count_ = 0;
+        }
+        virtual srs_error_t on_timer(srs_utime_t interval)
+        {
+            count_++;
+            srs_freep(peer_);
+            return srs_error_new(ERROR_SOCKET_TIMEOUT, "ignored");
+        }
+    };
+
+    SrsTimingWheel wheel("test", 20 * SRS_UTIME_MILLISECONDS);
+
+    MockTimerHandlerCanceller h0;
+    MockSrsFastTimer h1;
+    SrsTimerHandle t0(&h0);
+    h0.peer_ = new SrsTimerHandle(&h1);
+    wheel.schedule(&t0, 20 * SRS_UTIME_MILLISECONDS);
+    wheel.schedule(h0.peer_, 20 * SRS_UTIME_MILLISECONDS);
+
+    wheel.tick();
+    wheel.tick();
+    EXPECT_EQ(2, h0.count_);
+    EXPECT_EQ(0, (int)h1.timer_calls_.size());
+    EXPECT_EQ(1, wheel.size());
+}
+
+VOID TEST(KernelHourglassTest, FastTimerInSharedWheel)
+{
+    SrsTimingWheel wheel("test", 20 * SRS_UTIME_MILLISECONDS);
+    SrsFastTimer *timer = new SrsFastTimer(&wheel, 100 * SRS_UTIME_MILLISECONDS);
+
+    MockSrsFastTimer h0, h1;
+    timer->subscribe(&h0);
+    timer->subscribe(&h0);
+    timer->subscribe(&h1);
+    EXPECT_EQ(2, wheel.size());
+
+    for (int i = 0; i < 10; i++) {
+        wheel.tick();
+    }
+    EXPECT_EQ(2, (int)h0.timer_calls_.size());
+    EXPECT_EQ(2, (int)h1.timer_calls_.size());
+
+    timer->unsubscribe(&h0);
+    timer->unsubscribe(&h0);
+    EXPECT_EQ(1, wheel.size());
+
+    // The handlers are removed from wheel when timer is freed.
+    srs_freep(timer);
+    EXPECT_EQ(0, wheel.size());
+}
@@ -134,6 +134,8 @@ MockUdpMuxSocket::MockUdpMuxSocket()
     sendto_error_ = srs_success;
     sendto_called_count_ = 0;
     last_sendto_size_ = 0;
+    sendmmsg_called_count_ = 0;
+    last_gso_size_ = 0;
     peer_ip_ = "192.168.1.100";
     peer_port_ = 5000;
     peer_id_ = "192.168.1.100:5000";
@@ -155,6 +157,17 @@ srs_error_t MockUdpMuxSocket::sendto(void *data, int size, srs_utime_t timeout)
     return srs_error_copy(sendto_error_);
 }
 
+srs_error_t MockUdpMuxSocket::sendmmsg(iovec *iovs, int nn_iovs, int gso_size, srs_utime_t timeout)
+{
+    sendmmsg_called_count_++;
+    sendto_called_count_ += nn_iovs;
+    last_gso_size_ = gso_size;
+    if (nn_iovs > 0) {
+        last_sendto_size_ = (int)iovs[nn_iovs - 1].iov_len;
+    }
+    return srs_error_copy(sendto_error_);
+}
+
 std::string MockUdpMuxSocket::get_peer_ip() const
 {
     return peer_ip_;
@@ -358,6 +371,8 @@ void MockRtcNetwork::reset()
     protect_rtp_count_ = 0;
     protect_rtcp_count_ = 0;
     write_count_ = 0;
+    sendmmsg_count_ = 0;
+    last_gso_size_ = 0;
     is_established_ = true;
 }
 
@@ -395,6 +410,12 @@ srs_error_t MockRtcNetwork::protect_rtp(void *packet, int *nb_cipher)
     return srs_error_copy(protect_rtp_error_);
 }
 
+srs_error_t MockRtcNetwork::protect_rtps(iovec *iovs, int nn_iovs)
+{
+    protect_rtp_count_ += nn_iovs;
+    return srs_error_copy(protect_rtp_error_);
+}
+
 srs_error_t MockRtcNetwork::protect_rtcp(void *packet, int *nb_cipher)
 {
     protect_rtcp_count_++;
@@ -421,6 +442,14 @@ bool MockRtcNetwork::is_establelished()
     return is_established_;
 }
 
+srs_error_t MockRtcNetwork::sendmmsg(iovec *iovs, int nn_iovs, int gso_size)
+{
+    sendmmsg_count_++;
+    write_count_ += nn_iovs;
+    last_gso_size_ = gso_size;
+    return srs_error_copy(write_error_);
+}
+
 srs_error_t MockRtcNetwork::write(void *buf, size_t size, ssize_t *nwrite)
 {
     write_count_++;
@@ -524,6 +553,12 @@ srs_error_t MockSrtp::protect_rtp(void *packet, int *nb_cipher)
     return srs_error_copy(protect_rtp_error_);
 }
 
+srs_error_t MockSrtp::protect_rtps(iovec *iovs, int nn_iovs)
+{
+    protect_rtp_count_ += nn_iovs;
+    return srs_error_copy(protect_rtp_error_);
+}
+
 srs_error_t MockSrtp::protect_rtcp(void *packet, int *nb_cipher)
 {
     protect_rtcp_count_++;
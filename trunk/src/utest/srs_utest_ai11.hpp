@@ -77,6 +77,8 @@ public:
     srs_error_t sendto_error_;
     int sendto_called_count_;
     int last_sendto_size_;
+    int sendmmsg_called_count_;
+    int last_gso_size_;
     std::string peer_ip_;
     int peer_port_;
     std::string peer_id_;
@@ -90,6 +92,7 @@ public:
 
 public:
     virtual srs_error_t sendto(void *data, int size, srs_utime_t timeout);
+    virtual srs_error_t sendmmsg(iovec *iovs, int nn_iovs, int gso_size, srs_utime_t timeout);
     virtual std::string get_peer_ip() const;
     virtual int get_peer_port() const;
     virtual std::string peer_id();
@@ -156,6 +159,8 @@ public:
     int protect_rtp_count_;
     int protect_rtcp_count_;
     int write_count_;
+    int sendmmsg_count_;
+    int last_gso_size_;
     bool is_established_;
 
 public:
@@ -169,11 +174,13 @@ public:
     virtual srs_error_t on_dtls_alert(std::string type, std::string desc);
     virtual srs_error_t on_dtls(char *data, int nb_data);
     virtual srs_error_t protect_rtp(void *packet, int *nb_cipher);
+    virtual srs_error_t protect_rtps(iovec *iovs, int nn_iovs);
     virtual srs_error_t protect_rtcp(void *packet, int *nb_cipher);
     virtual srs_error_t on_stun(SrsStunPacket *r, char *data, int nb_data);
     virtual srs_error_t on_rtp(char *data, int nb_data);
     virtual srs_error_t on_rtcp(char *data, int nb_data);
     virtual bool is_establelished();
+    virtual srs_error_t sendmmsg(iovec *iovs, int nn_iovs, int gso_size);
     virtual srs_error_t write(void *buf, size_t size, ssize_t *nwrite);
 
 public:
@@ -210,6 +217,7 @@ public:
 public:
     virtual srs_error_t initialize(std::string recv_key, std::string send_key);
     virtual srs_error_t protect_rtp(void *packet, int *nb_cipher);
+    virtual srs_error_t protect_rtps(iovec *iovs, int nn_iovs);
     virtual srs_error_t protect_rtcp(void *packet, int *nb_cipher);
     virtual srs_error_t unprotect_rtp(void *packet, int *nb_plaintext);
     virtual srs_error_t unprotect_rtcp(void *packet, int *nb_plaintext);
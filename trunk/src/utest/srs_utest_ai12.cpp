@@ -1132,6 +1132,43 @@ srs_error_t MockRtcConnectionForNack::send_rtcp(char *data, int nb_data)
     return send_rtcp_error_;
 }
 
+MockRtcNetworksForBatch::MockRtcNetworksForBatch()
+{
+}
+
+MockRtcNetworksForBatch::~MockRtcNetworksForBatch()
+{
+}
+
+srs_error_t MockRtcNetworksForBatch::initialize(SrsSessionConfig *cfg, bool dtls, bool srtp)
+{
+    return srs_success;
+}
+
+void MockRtcNetworksForBatch::set_state(SrsRtcNetworkState state)
+{
+}
+
+ISrsRtcNetwork *MockRtcNetworksForBatch::udp()
+{
+    return &network_;
+}
+
+ISrsRtcNetwork *MockRtcNetworksForBatch::tcp()
+{
+    return &network_;
+}
+
+ISrsRtcNetwork *MockRtcNetworksForBatch::available()
+{
+    return &network_;
+}
+
+ISrsKbpsDelta *MockRtcNetworksForBatch::delta()
+{
+    return NULL;
+}
+
 void MockRtcConnectionForNack::set_send_rtcp_error(srs_error_t err)
 {
     send_rtcp_error_ = err;
@@ -1636,6 +1673,183 @@ VOID TEST(SrsRtcConnectionTest, DoSendPacketTypicalScenario)
     EXPECT_EQ(0, conn->nn_simulate_player_nack_drop_);
 }
 
+VOID TEST(SrsRtcConnectionTest, DoSendPacketInBatch)
+{
+    srs_error_t err;
+
+    MockRtcAsyncTaskExecutor mock_exec;
+    SrsContextId cid;
+    cid.set_value("test-rtc-connection-send-batch");
+
+    SrsUniquePtr<SrsRtcConnection> conn(new SrsRtcConnection(&mock_exec, cid));
+
+    MockRtcNetworksForBatch *networks = new MockRtcNetworksForBatch();
+    srs_freep(conn->networks_);
+    conn->networks_ = networks;
+    MockRtcNetwork *network = &networks->network_;
+
+    SrsUniquePtr<SrsRtpPacket> pkt(new SrsRtpPacket());
+    pkt->header_.set_sequence(1000);
+    pkt->header_.set_ssrc(0x12345678);
+    pkt->header_.set_payload_type(96);
+
+    SrsRtpRawPayload *raw = new SrsRtpRawPayload();
+    char *payload_data = pkt->wrap(100);
+    memset(payload_data, 0x42, 100);
+    raw->payload_ = payload_data;
+    raw->nn_payload_ = 100;
+    pkt->set_payload(raw, SrsRtpPacketPayloadTypeRaw);
+
+    // Batch is disabled, send packet directly even start batch.
+    conn->batch_max_ = 1;
+    conn->start_batch();
+    EXPECT_FALSE(conn->batching_);
+    EXPECT_TRUE(conn->batch_arena_ == NULL);
+    HELPER_EXPECT_SUCCESS(conn->do_send_packet(pkt.get()));
+    HELPER_EXPECT_SUCCESS(conn->flush_batch());
+    EXPECT_EQ(1, network->write_count_);
+    EXPECT_EQ(0, network->sendmmsg_count_);
+
+    // Enable batch, the packets are sent when arena is full or flush.
+    network->reset();
+    conn->batch_max_ = 4;
+    conn->start_batch();
+    EXPECT_TRUE(conn->batching_);
+    EXPECT_TRUE(conn->batch_arena_ != NULL);
+
+    for (int i = 0; i < 6; i++) {
+        HELPER_EXPECT_SUCCESS(conn->do_send_packet(pkt.get()));
+    }
+    EXPECT_EQ(1, network->sendmmsg_count_);
+    EXPECT_EQ(4, network->write_count_);
+    EXPECT_EQ(4, network->protect_rtp_count_);
+    EXPECT_EQ(2, conn->nn_batch_iovs_);
+    EXPECT_EQ(0, network->last_gso_size_);
+
+    HELPER_EXPECT_SUCCESS(conn->flush_batch());
+    EXPECT_EQ(2, network->sendmmsg_count_);
+    EXPECT_EQ(6, network->write_count_);
+    EXPECT_EQ(6, network->protect_rtp_count_);
+    EXPECT_EQ(0, conn->nn_batch_iovs_);
+    EXPECT_FALSE(conn->batching_);
+
+    // Not batching after flush, send packet directly.
+    HELPER_EXPECT_SUCCESS(conn->do_send_packet(pkt.get()));
+    EXPECT_EQ(2, network->sendmmsg_count_);
+    EXPECT_EQ(7, network->write_count_);
+
+    // Flush nothing is ok.
+    HELPER_EXPECT_SUCCESS(conn->flush_batch());
+    EXPECT_EQ(2, network->sendmmsg_count_);
+}
+
+VOID TEST(SrsRtcConnectionTest, DoSendPacketInBatchWithGso)
+{
+    srs_error_t err;
+
+    MockRtcAsyncTaskExecutor mock_exec;
+    SrsContextId cid;
+    cid.set_value("test-rtc-connection-send-gso");
+
+    SrsUniquePtr<SrsRtcConnection> conn(new SrsRtcConnection(&mock_exec, cid));
+
+    MockRtcNetworksForBatch *networks = new MockRtcNetworksForBatch();
+    srs_freep(conn->networks_);
+    conn->networks_ = networks;
+    MockRtcNetwork *network = &networks->network_;
+
+    SrsUniquePtr<SrsRtpPacket> pkt(new SrsRtpPacket());
+    pkt->header_.set_ssrc(0x12345678);
+    pkt->header_.set_payload_type(96);
+    SrsRtpRawPayload *raw = new SrsRtpRawPayload();
+    raw->payload_ = pkt->wrap(100);
+    raw->nn_payload_ = 100;
+    memset(raw->payload_, 0x42, 100);
+    pkt->set_payload(raw, SrsRtpPacketPayloadTypeRaw);
+
+    SrsUniquePtr<SrsRtpPacket> small(new SrsRtpPacket());
+    small->header_.set_ssrc(0x12345678);
+    small->header_.set_payload_type(96);
+    SrsRtpRawPayload *small_raw = new SrsRtpRawPayload();
+    small_raw->payload_ = small->wrap(10);
+    small_raw->nn_payload_ = 10;
+    memset(small_raw->payload_, 0x42, 10);
+    small->set_payload(small_raw, SrsRtpPacketPayloadTypeRaw);
+
+    conn->batch_max_ = 8;
+    conn->batch_gso_ = true;
+
+    // Same size packets, and the last one is smaller, use GSO.
+    conn->start_batch();
+    HELPER_EXPECT_SUCCESS(conn->do_send_packet(pkt.get()));
+    HELPER_EXPECT_SUCCESS(conn->do_send_packet(pkt.get()));
+    HELPER_EXPECT_SUCCESS(conn->do_send_packet(small.get()));
+    HELPER_EXPECT_SUCCESS(conn->flush_batch());
+    EXPECT_EQ(1, network->sendmmsg_count_);
+    EXPECT_EQ(3, network->write_count_);
+    EXPECT_EQ(12 + 100, network->last_gso_size_);
+
+    // The smaller packet is not the last one, should not use GSO.
+    conn->start_batch();
+    HELPER_EXPECT_SUCCESS(conn->do_send_packet(pkt.get()));
+    HELPER_EXPECT_SUCCESS(conn->do_send_packet(small.get()));
+    HELPER_EXPECT_SUCCESS(conn->do_send_packet(pkt.get()));
+    HELPER_EXPECT_SUCCESS(conn->flush_batch());
+    EXPECT_EQ(2, network->sendmmsg_count_);
+    EXPECT_EQ(0, network->last_gso_size_);
+}
+
+VOID TEST(SrsRtcConnectionTest, DoSendPacketInBatchWithError)
+{
+    srs_error_t err;
+
+    MockRtcAsyncTaskExecutor mock_exec;
+    SrsContextId cid;
+    cid.set_value("test-rtc-connection-send-batch-error");
+
+    SrsUniquePtr<SrsRtcConnection> conn(new SrsRtcConnection(&mock_exec, cid));
+
+    MockRtcNetworksForBatch *networks = new MockRtcNetworksForBatch();
+    srs_freep(conn->networks_);
+    conn->networks_ = networks;
+    MockRtcNetwork *network = &networks->network_;
+
+    SrsUniquePtr<SrsRtpPacket> pkt(new SrsRtpPacket());
+    pkt->header_.set_ssrc(0x12345678);
+    pkt->header_.set_payload_type(96);
+    SrsRtpRawPayload *raw = new SrsRtpRawPayload();
+    raw->payload_ = pkt->wrap(100);
+    raw->nn_payload_ = 100;
+    memset(raw->payload_, 0x42, 100);
+    pkt->set_payload(raw, SrsRtpPacketPayloadTypeRaw);
+
+    conn->batch_max_ = 2;
+    network->write_error_ = srs_error_new(ERROR_SOCKET_WRITE, "mock sendmmsg error");
+
+    // The error of sendmmsg is returned by flush, and the arena is reset.
+    conn->start_batch();
+    HELPER_EXPECT_SUCCESS(conn->do_send_packet(pkt.get()));
+    HELPER_EXPECT_FAILED(conn->flush_batch());
+    EXPECT_EQ(1, network->sendmmsg_count_);
+    EXPECT_EQ(0, conn->nn_batch_iovs_);
+    EXPECT_FALSE(conn->flushing_);
+    EXPECT_FALSE(conn->batching_);
+
+    // The error of sendmmsg is returned by send packet, when arena is full.
+    conn->start_batch();
+    HELPER_EXPECT_SUCCESS(conn->do_send_packet(pkt.get()));
+    HELPER_EXPECT_SUCCESS(conn->do_send_packet(pkt.get()));
+    HELPER_EXPECT_FAILED(conn->do_send_packet(pkt.get()));
+    EXPECT_EQ(2, network->sendmmsg_count_);
+    EXPECT_EQ(0, conn->nn_batch_iovs_);
+
+    // Recover from error.
+    srs_freep(network->write_error_);
+    HELPER_EXPECT_SUCCESS(conn->do_send_packet(pkt.get()));
+    HELPER_EXPECT_SUCCESS(conn->flush_batch());
+    EXPECT_EQ(3, network->sendmmsg_count_);
+}
+
 VOID TEST(SrsRtcConnectionTest, SetAllTracksStatusTypicalScenario)
 {
     // Create mock executor
@@ -155,6 +155,25 @@ public:
     void reset();
 };
 
+// Mock RTC networks for testing batch sending of SrsRtcConnection
+class MockRtcNetworksForBatch : public ISrsRtcNetworks
+{
+public:
+    MockRtcNetwork network_;
+
+public:
+    MockRtcNetworksForBatch();
+    virtual ~MockRtcNetworksForBatch();
+
+public:
+    virtual srs_error_t initialize(SrsSessionConfig *cfg, bool dtls, bool srtp);
+    virtual void set_state(SrsRtcNetworkState state);
+    virtual ISrsRtcNetwork *udp();
+    virtual ISrsRtcNetwork *tcp();
+    virtual ISrsRtcNetwork *available();
+    virtual ISrsKbpsDelta *delta();
+};
+
 // Mock request class for testing SrsRtcConnection::create_publisher
 class MockRtcConnectionRequest : public ISrsRequest
 {
@@ -27,6 +27,7 @@ using namespace std;
 #include <srs_utest_ai22.hpp>
 #include <srs_utest_manual_config.hpp>
 #include <srs_utest_manual_coworkers.hpp>
+#include <srs_utest_manual_mock.hpp>
 #include <srs_utest_manual_protocol2.hpp>
 
 MockMediaPacketForJitter::MockMediaPacketForJitter(int64_t timestamp, bool is_av)
@@ -2609,10 +2610,11 @@ VOID TEST(LiveSourceManagerTest, SetupTicks_TypicalScenario)
     // Call setup_ticks - typical successful scenario
     HELPER_EXPECT_SUCCESS(manager->setup_ticks());
 
-    // Verify tick was called with correct parameters (event=1, interval=3 seconds)
-    EXPECT_EQ(1, mock_timer->tick_count_);
-    EXPECT_EQ(1, mock_timer->tick_event_);
-    EXPECT_EQ(3 * SRS_UTIME_SECONDS, mock_timer->tick_interval_);
+    // Verify tick was called with correct parameters (event=1, interval=3 seconds), and the last
+    // one is to check the media memory budget (event=2, interval=1 second)
+    EXPECT_EQ(2, mock_timer->tick_count_);
+    EXPECT_EQ(2, mock_timer->tick_event_);
+    EXPECT_EQ(1 * SRS_UTIME_SECONDS, mock_timer->tick_interval_);
 
     // Verify start was called
     EXPECT_EQ(1, mock_timer->start_count_);
@@ -2663,6 +2665,94 @@ VOID TEST(LiveSourceManagerTest, FetchOrCreate_TypicalScenario)
     EXPECT_EQ(2, mock_factory->create_live_source_count_);
 }
 
+// Create a H.264 video frame of size bytes, which is not a sequence header.
+static SrsMediaPacket *mock_create_video_frame(int size)
+{
+    SrsMediaPacket *msg = new SrsMediaPacket();
+    msg->message_type_ = SrsFrameTypeVideo;
+
+    char *payload = new char[size];
+    memset(payload, 0, size);
+    payload[0] = 0x17; // Keyframe, AVC.
+    payload[1] = 0x01; // AVC NALU.
+    msg->wrap(payload, size);
+
+    return msg;
+}
+
+VOID TEST(LiveSourceManagerTest, MemoryBudget_EvictGopCacheThenShedConsumer)
+{
+    srs_error_t err;
+
+    MockAppConfig config;
+
+    SrsUniquePtr<SrsLiveSourceManager> manager(new SrsLiveSourceManager());
+    MockAppFactoryForSourceManager *mock_factory = new MockAppFactoryForSourceManager();
+    manager->app_factory_ = mock_factory;
+    manager->config_ = &config;
+
+    MockHlsRequest req1("test.vhost", "live", "stream1");
+    SrsSharedPtr<SrsLiveSource> source1;
+    HELPER_EXPECT_SUCCESS(manager->fetch_or_create(&req1, source1));
+
+    MockHlsRequest req2("test.vhost", "live", "stream2");
+    SrsSharedPtr<SrsLiveSource> source2;
+    HELPER_EXPECT_SUCCESS(manager->fetch_or_create(&req2, source2));
+
+    // Each source caches a gop of 1000 bytes.
+    SrsUniquePtr<SrsMediaPacket> frame0(mock_create_video_frame(1000));
+    SrsUniquePtr<SrsMediaPacket> frame1(mock_create_video_frame(1000));
+    HELPER_EXPECT_SUCCESS(source1->gop_cache_->cache(frame0.get()));
+    HELPER_EXPECT_SUCCESS(source2->gop_cache_->cache(frame1.get()));
+    EXPECT_EQ(1000, source1->gop_cache_bytes());
+
+    // The source2 is watched by two consumers, each holds 3000 bytes in queue, and the payload is
+    // shared by the gop cache and queues, so it's counted only once.
+    SrsUniquePtr<SrsMediaPacket> frame2(mock_create_video_frame(1000));
+    SrsUniquePtr<SrsMediaPacket> frame3(mock_create_video_frame(1000));
+    SrsLiveConsumer *consumer0 = new SrsLiveConsumer(source2.get());
+    SrsLiveConsumer *consumer1 = new SrsLiveConsumer(source2.get());
+    source2->consumers_.push_back(consumer0);
+    source2->consumers_.push_back(consumer1);
+    for (int i = 0; i < (int)source2->consumers_.size(); i++) {
+        SrsLiveConsumer *consumer = source2->consumers_.at(i);
+        HELPER_EXPECT_SUCCESS(consumer->queue_->enqueue(frame1->copy()));
+        HELPER_EXPECT_SUCCESS(consumer->queue_->enqueue(frame2->copy()));
+        HELPER_EXPECT_SUCCESS(consumer->queue_->enqueue(frame3->copy()));
+        EXPECT_EQ(3000, consumer->bytes());
+    }
+    EXPECT_EQ(1000, source1->memory());
+    EXPECT_EQ(3000, source2->memory());
+
+    // No budget, never evict.
+    manager->check_memory_budget();
+    EXPECT_EQ(4000, manager->memory_);
+    EXPECT_EQ(0, manager->nn_gop_evicts_);
+
+    // Exceed the budget, evict the gop cache of the least watched stream first.
+    config.media_memory_budget_ = 3500;
+    manager->check_memory_budget();
+    EXPECT_EQ(3000, manager->memory_);
+    EXPECT_EQ(1, manager->nn_gop_evicts_);
+    EXPECT_EQ(0, source1->gop_cache_bytes());
+    EXPECT_EQ(1000, source2->gop_cache_bytes());
+    EXPECT_EQ(0, manager->nn_consumer_sheds_);
+
+    // Still exceed the budget after all gop caches evicted, because the payload is held by consumers,
+    // so shed the consumers until the payload is freed.
+    config.media_memory_budget_ = 1500;
+    manager->check_memory_budget();
+    EXPECT_EQ(0, manager->memory_);
+    EXPECT_EQ(2, manager->nn_gop_evicts_);
+    EXPECT_EQ(2, manager->nn_consumer_sheds_);
+    EXPECT_EQ(0, consumer0->bytes());
+    EXPECT_EQ(0, consumer1->bytes());
+
+    source2->consumers_.clear();
+    srs_freep(consumer0);
+    srs_freep(consumer1);
+}
+
 // Unit test for SrsOriginHub sequence header request methods
 VOID TEST(AppOriginHubTest, SequenceHeaderRequestTypicalScenario)
 {
@@ -631,8 +631,9 @@ VOID TEST(ServerTest, SetupTicksWithStatsAndHeartbeat)
     // Verify that ticks were registered
     // When stats_enabled: events 2,4,5,6,7,8,10,11,12 (9 ticks)
     // When heartbeat_enabled: event 9 (1 tick)
-    // Total: 10 ticks
-    EXPECT_EQ(10, mock_factory->mock_hourglass_->tick_count_);
+    // Always: event 13 to trim object pools (1 tick)
+    // Total: 11 ticks
+    EXPECT_EQ(11, mock_factory->mock_hourglass_->tick_count_);
 
     // Verify specific tick events are registered
     std::vector<int> &events = mock_factory->mock_hourglass_->tick_events_;
@@ -646,6 +647,7 @@ VOID TEST(ServerTest, SetupTicksWithStatsAndHeartbeat)
     EXPECT_TRUE(std::find(events.begin(), events.end(), 10) != events.end()); // udp snmp
     EXPECT_TRUE(std::find(events.begin(), events.end(), 11) != events.end()); // rtc sessions
     EXPECT_TRUE(std::find(events.begin(), events.end(), 12) != events.end()); // server stats
+    EXPECT_TRUE(std::find(events.begin(), events.end(), 13) != events.end()); // trim pools
 
     // Cleanup: restore original config and factory
     server->config_ = original_config;
@@ -1866,6 +1868,40 @@ VOID TEST(SrsRtmpConnTest, AcquirePublishCrossProtocolCheck)
     srs_freep(mock_srt_sources);
 }
 
+// Test the connection holds the compiled config of vhost, which is not changed by config until the
+// vhost is checked again, for example, when client identified.
+VOID TEST(SrsRtmpConnTest, VhostConfigHeldByConnection)
+{
+    srs_error_t err;
+
+    MockAppConfigForAcquirePublish *mock_config = new MockAppConfigForAcquirePublish();
+    mock_config->default_vhost_ = new SrsConfDirective();
+    mock_config->default_vhost_->name_ = "vhost";
+    mock_config->default_vhost_->args_.push_back("__defaultVhost__");
+
+    if (true) {
+        MockRtmpTransportForDoCycle *mock_transport = new MockRtmpTransportForDoCycle();
+        SrsUniquePtr<SrsRtmpConn> conn(new SrsRtmpConn(mock_transport, "192.168.1.100", 1935));
+        conn->config_ = mock_config;
+        conn->assemble();
+        conn->info_->req_->vhost_ = "__defaultVhost__";
+
+        EXPECT_TRUE(conn->vhost_config()->rtc_enabled_);
+        EXPECT_TRUE(conn->vhost_config()->srt_enabled_);
+
+        // The held config is not changed.
+        mock_config->rtc_enabled_ = false;
+        EXPECT_TRUE(conn->vhost_config()->rtc_enabled_);
+
+        // Load the config again when check vhost.
+        HELPER_EXPECT_SUCCESS(conn->check_vhost(true));
+        EXPECT_FALSE(conn->vhost_config()->rtc_enabled_);
+        EXPECT_TRUE(conn->vhost_config()->srt_enabled_);
+    }
+
+    srs_freep(mock_config);
+}
+
 VOID TEST(SrsRtmpConnTest, HandlePublishMessageFlashRepublish)
 {
     srs_error_t err = srs_success;
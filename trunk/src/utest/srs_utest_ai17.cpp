@@ -129,6 +129,11 @@ void MockFragment::set_path(std::string v)
     path_ = v;
 }
 
+std::string MockFragment::fullpath()
+{
+    return path_;
+}
+
 std::string MockFragment::tmppath()
 {
     tmppath_called_ = true;
@@ -284,6 +289,11 @@ void MockFragmentedMp4::set_path(std::string v)
 {
 }
 
+std::string MockFragmentedMp4::fullpath()
+{
+    return "";
+}
+
 std::string MockFragmentedMp4::tmppath()
 {
     return "";
@@ -373,6 +383,11 @@ void MockInitMp4::set_path(std::string v)
     path_ = v;
 }
 
+std::string MockInitMp4::fullpath()
+{
+    return "";
+}
+
 std::string MockInitMp4::tmppath()
 {
     return "";
@@ -4330,3 +4345,368 @@ VOID TEST(HttpHooksTest, OnForwardBackendSuccess)
     hooks->stat_ = NULL;
     mock_factory->mock_http_client_ = NULL;
 }
+
+// Mock config for the dispatcher of HTTP hooks.
+class MockAppConfigForHooksDispatcher : public MockAppConfig
+{
+public:
+    int keepalive_;
+    int concurrency_;
+    srs_utime_t play_cache_ttl_;
+    bool async_notify_;
+    int retry_queue_;
+
+public:
+    MockAppConfigForHooksDispatcher()
+    {
+        keepalive_ = 0;
+        concurrency_ = 0;
+        play_cache_ttl_ = 0;
+        async_notify_ = false;
+        retry_queue_ = 1024;
+    }
+
+    virtual ~MockAppConfigForHooksDispatcher()
+    {
+    }
+
+public:
+    virtual int get_hooks_keepalive() { return keepalive_; }
+    virtual int get_hooks_concurrency() { return concurrency_; }
+    virtual srs_utime_t get_hooks_play_cache_ttl() { return play_cache_ttl_; }
+    virtual bool get_hooks_async_notify() { return async_notify_; }
+    virtual int get_hooks_retry_queue() { return retry_queue_; }
+};
+
+// Mock HTTP client which responses for each post, to be reused as a keep-alive client.
+class MockHttpClientForHooksDispatcher : public ISrsHttpClient
+{
+public:
+    int *nn_initialize_;
+    int *nn_post_;
+    // The request bodies of all posts, to check the order of hooks.
+    std::vector<std::string> *bodies_;
+    bool fail_;
+
+public:
+    MockHttpClientForHooksDispatcher(int *nn_initialize, int *nn_post)
+    {
+        nn_initialize_ = nn_initialize;
+        nn_post_ = nn_post;
+        bodies_ = NULL;
+        fail_ = false;
+    }
+
+    virtual ~MockHttpClientForHooksDispatcher()
+    {
+    }
+
+public:
+    virtual srs_error_t initialize(std::string schema, std::string h, int p, srs_utime_t tm)
+    {
+        (*nn_initialize_)++;
+        return srs_success;
+    }
+
+    virtual srs_error_t get(std::string path, std::string req, ISrsHttpMessage **ppmsg)
+    {
+        return srs_error_new(ERROR_HTTP_DATA_INVALID, "not supported");
+    }
+
+    virtual srs_error_t post(std::string path, std::string req, ISrsHttpMessage **ppmsg)
+    {
+        (*nn_post_)++;
+        if (bodies_) {
+            bodies_->push_back(req);
+        }
+        if (fail_) {
+            return srs_error_new(ERROR_SOCKET_READ, "closed by server");
+        }
+        *ppmsg = new MockHttpMessageForHooks();
+        return srs_success;
+    }
+
+    virtual void set_recv_timeout(srs_utime_t tm)
+    {
+    }
+
+    virtual void kbps_sample(const char *label, srs_utime_t age)
+    {
+    }
+};
+
+// Mock factory which creates a new client for each hook, and counts the clients.
+class MockAppFactoryForHooksDispatcher : public SrsAppFactory
+{
+public:
+    int nn_clients_;
+    int nn_initialize_;
+    int nn_post_;
+    std::vector<std::string> bodies_;
+    bool fail_;
+    MockHttpClientForHooksDispatcher *last_;
+
+public:
+    MockAppFactoryForHooksDispatcher()
+    {
+        nn_clients_ = 0;
+        nn_initialize_ = 0;
+        nn_post_ = 0;
+        fail_ = false;
+        last_ = NULL;
+    }
+
+    virtual ~MockAppFactoryForHooksDispatcher()
+    {
+    }
+
+public:
+    virtual ISrsHttpClient *create_http_client()
+    {
+        nn_clients_++;
+        last_ = new MockHttpClientForHooksDispatcher(&nn_initialize_, &nn_post_);
+        last_->bodies_ = &bodies_;
+        last_->fail_ = fail_;
+        return last_;
+    }
+};
+
+VOID TEST(HttpHooksTest, DispatcherKeepAlive)
+{
+    srs_error_t err;
+
+    SrsUniquePtr<MockAppFactoryForHooksDispatcher> mock_factory(new MockAppFactoryForHooksDispatcher());
+    SrsUniquePtr<MockStatisticForHooks> mock_stat(new MockStatisticForHooks());
+    SrsUniquePtr<MockAppConfigForHooksDispatcher> mock_config(new MockAppConfigForHooksDispatcher());
+    SrsUniquePtr<MockSrsRequest> req(new MockSrsRequest("test.vhost", "live", "stream1"));
+
+    SrsUniquePtr<SrsHttpHooks> hooks(new SrsHttpHooks());
+    hooks->factory_ = mock_factory.get();
+    hooks->stat_ = mock_stat.get();
+    hooks->config_ = mock_config.get();
+
+    // Without keep-alive, create a client for each hook.
+    std::string url = "http://127.0.0.1:8085/api/v1/clients";
+    HELPER_EXPECT_SUCCESS(hooks->on_connect(url, req.get()));
+    HELPER_EXPECT_SUCCESS(hooks->on_connect(url, req.get()));
+    EXPECT_EQ(2, mock_factory->nn_clients_);
+    EXPECT_EQ(2, mock_factory->nn_initialize_);
+    EXPECT_TRUE(hooks->upstreams_.empty());
+
+    // With keep-alive, reuse the client for the same upstream, never initialize it again.
+    mock_config->keepalive_ = 1;
+    HELPER_EXPECT_SUCCESS(hooks->on_connect(url, req.get()));
+    HELPER_EXPECT_SUCCESS(hooks->on_publish(url, req.get()));
+    HELPER_EXPECT_SUCCESS(hooks->on_play(url, req.get()));
+    EXPECT_EQ(3, mock_factory->nn_clients_);
+    EXPECT_EQ(3, mock_factory->nn_initialize_);
+    EXPECT_EQ(5, mock_factory->nn_post_);
+    EXPECT_EQ(1, (int)hooks->upstreams_.size());
+
+    SrsHttpHookUpstream *upstream = hooks->upstreams_["http://127.0.0.1:8085"];
+    ASSERT_TRUE(upstream != NULL);
+    EXPECT_EQ(1, (int)upstream->idle_.size());
+    EXPECT_EQ(0, upstream->inflight_);
+
+    // Another upstream uses another client.
+    HELPER_EXPECT_SUCCESS(hooks->on_connect("http://127.0.0.1:8086/api/v1/clients", req.get()));
+    EXPECT_EQ(4, mock_factory->nn_clients_);
+    EXPECT_EQ(2, (int)hooks->upstreams_.size());
+
+    // If the keep-alive client is closed by server, retry by a new client.
+    MockHttpClientForHooksDispatcher *idle = dynamic_cast<MockHttpClientForHooksDispatcher *>(upstream->idle_.at(0));
+    idle->fail_ = true;
+    HELPER_EXPECT_SUCCESS(hooks->on_connect(url, req.get()));
+    EXPECT_EQ(5, mock_factory->nn_clients_);
+    EXPECT_EQ(1, (int)upstream->idle_.size());
+    EXPECT_TRUE(upstream->idle_.at(0) == mock_factory->last_);
+
+    // The failed client is never kept alive.
+    mock_factory->last_->fail_ = true;
+    mock_factory->fail_ = true;
+    HELPER_EXPECT_FAILED(hooks->on_connect(url, req.get()));
+    EXPECT_EQ(6, mock_factory->nn_clients_);
+    EXPECT_EQ(0, (int)upstream->idle_.size());
+
+    hooks->factory_ = NULL;
+    hooks->stat_ = NULL;
+    hooks->config_ = NULL;
+}
+
+VOID TEST(HttpHooksTest, DispatcherPlayCache)
+{
+    srs_error_t err;
+
+    SrsUniquePtr<MockAppFactoryForHooksDispatcher> mock_factory(new MockAppFactoryForHooksDispatcher());
+    SrsUniquePtr<MockStatisticForHooks> mock_stat(new MockStatisticForHooks());
+    SrsUniquePtr<MockAppConfigForHooksDispatcher> mock_config(new MockAppConfigForHooksDispatcher());
+    SrsUniquePtr<MockSrsRequest> req(new MockSrsRequest("test.vhost", "live", "stream1"));
+    req->param_ = "?token=abc123";
+
+    SrsUniquePtr<SrsHttpHooks> hooks(new SrsHttpHooks());
+    hooks->factory_ = mock_factory.get();
+    hooks->stat_ = mock_stat.get();
+    hooks->config_ = mock_config.get();
+
+    // Never cache if disabled.
+    std::string url = "http://127.0.0.1:8085/api/v1/sessions";
+    HELPER_EXPECT_SUCCESS(hooks->on_play(url, req.get()));
+    HELPER_EXPECT_SUCCESS(hooks->on_play(url, req.get()));
+    EXPECT_EQ(2, mock_factory->nn_post_);
+    EXPECT_TRUE(hooks->play_cache_.empty());
+
+    // The same stream and token is allowed by cache.
+    mock_config->play_cache_ttl_ = 10 * SRS_UTIME_SECONDS;
+    HELPER_EXPECT_SUCCESS(hooks->on_play(url, req.get()));
+    HELPER_EXPECT_SUCCESS(hooks->on_play(url, req.get()));
+    EXPECT_EQ(3, mock_factory->nn_post_);
+    EXPECT_EQ(1, (int)hooks->play_cache_.size());
+
+    // Another token should be verified by hook.
+    req->param_ = "?token=xyz789";
+    HELPER_EXPECT_SUCCESS(hooks->on_play(url, req.get()));
+    EXPECT_EQ(4, mock_factory->nn_post_);
+    EXPECT_EQ(2, (int)hooks->play_cache_.size());
+
+    // The expired one should be verified again.
+    std::map<std::string, srs_utime_t>::iterator it;
+    for (it = hooks->play_cache_.begin(); it != hooks->play_cache_.end(); ++it) {
+        it->second = 0;
+    }
+    HELPER_EXPECT_SUCCESS(hooks->on_play(url, req.get()));
+    EXPECT_EQ(5, mock_factory->nn_post_);
+
+    // The cache is capped, the oldest one is removed if none expired.
+    hooks->play_cache_.clear();
+    srs_utime_t now = srs_time_now_cached();
+    for (int i = 0; i < 1024; i++) {
+        hooks->play_cache_[srs_fmt_sprintf("stream%d", i)] = now + 100 * SRS_UTIME_SECONDS + i;
+    }
+    hooks->cache_play("stream-new", 10 * SRS_UTIME_SECONDS);
+    EXPECT_EQ(1024, (int)hooks->play_cache_.size());
+    EXPECT_TRUE(hooks->play_cache_.find("stream0") == hooks->play_cache_.end());
+    EXPECT_TRUE(hooks->play_cache_.find("stream-new") != hooks->play_cache_.end());
+
+    // Update the cached one, never remove others.
+    hooks->cache_play("stream1", 10 * SRS_UTIME_SECONDS);
+    EXPECT_EQ(1024, (int)hooks->play_cache_.size());
+    EXPECT_TRUE(hooks->play_cache_.find("stream2") != hooks->play_cache_.end());
+
+    hooks->factory_ = NULL;
+    hooks->stat_ = NULL;
+    hooks->config_ = NULL;
+}
+
+VOID TEST(HttpHooksTest, DispatcherAsyncNotify)
+{
+    srs_error_t err;
+
+    SrsUniquePtr<MockAppFactoryForHooksDispatcher> mock_factory(new MockAppFactoryForHooksDispatcher());
+    SrsUniquePtr<MockStatisticForHooks> mock_stat(new MockStatisticForHooks());
+    SrsUniquePtr<MockAppConfigForHooksDispatcher> mock_config(new MockAppConfigForHooksDispatcher());
+    SrsUniquePtr<MockSrsRequest> req(new MockSrsRequest("test.vhost", "live", "stream1"));
+
+    SrsUniquePtr<SrsHttpHooks> hooks(new SrsHttpHooks());
+    hooks->factory_ = mock_factory.get();
+    hooks->stat_ = mock_stat.get();
+    hooks->config_ = mock_config.get();
+
+    // The notification is queued and delivered by coroutine.
+    mock_config->async_notify_ = true;
+    mock_config->retry_queue_ = 2;
+    std::string url = "http://127.0.0.1:8085/api/v1/sessions";
+    hooks->on_stop(url, req.get());
+    HELPER_EXPECT_SUCCESS(hooks->on_dvr(_srs_context->get_id(), url, req.get(), "./test.flv"));
+    EXPECT_EQ(0, mock_factory->nn_post_);
+    EXPECT_EQ(2, (int)hooks->notifications_.size());
+    EXPECT_TRUE(hooks->trd_ != NULL);
+
+    // Drop the notification when queue is full.
+    hooks->on_unpublish(url, req.get());
+    EXPECT_EQ(2, (int)hooks->notifications_.size());
+
+    srs_usleep(10 * SRS_UTIME_MILLISECONDS);
+    EXPECT_EQ(2, mock_factory->nn_post_);
+    EXPECT_TRUE(hooks->notifications_.empty());
+
+    // Retry the failed notification later, which is kept in queue.
+    SrsHttpHookNotification *n = new SrsHttpHookNotification();
+    n->action_ = "on_stop";
+    n->url_ = url;
+    hooks->notifications_.push_back(n);
+    mock_factory->fail_ = true;
+    hooks->deliver(n);
+    EXPECT_EQ(1, (int)hooks->notifications_.size());
+    EXPECT_EQ(1, n->retries_);
+    EXPECT_GT(n->deliver_at_, srs_time_now_cached());
+
+    // Ignore it when exceed the max retries.
+    n->retries_ = 3;
+    hooks->deliver(n);
+    EXPECT_EQ(4, mock_factory->nn_post_);
+    EXPECT_TRUE(hooks->notifications_.empty());
+
+    // The validation hooks are never async.
+    mock_factory->fail_ = false;
+    HELPER_EXPECT_SUCCESS(hooks->on_play(url, req.get()));
+    EXPECT_EQ(5, mock_factory->nn_post_);
+
+    hooks->factory_ = NULL;
+    hooks->stat_ = NULL;
+    hooks->config_ = NULL;
+}
+
+VOID TEST(HttpHooksTest, DispatcherNotifyInOrder)
+{
+    srs_error_t err;
+
+    SrsUniquePtr<MockAppFactoryForHooksDispatcher> mock_factory(new MockAppFactoryForHooksDispatcher());
+    SrsUniquePtr<MockStatisticForHooks> mock_stat(new MockStatisticForHooks());
+    SrsUniquePtr<MockAppConfigForHooksDispatcher> mock_config(new MockAppConfigForHooksDispatcher());
+    SrsUniquePtr<MockSrsRequest> req(new MockSrsRequest("test.vhost", "live", "stream1"));
+    SrsUniquePtr<MockSrsRequest> req2(new MockSrsRequest("test.vhost", "live", "stream2"));
+
+    SrsUniquePtr<SrsHttpHooks> hooks(new SrsHttpHooks());
+    hooks->factory_ = mock_factory.get();
+    hooks->stat_ = mock_stat.get();
+    hooks->config_ = mock_config.get();
+
+    // The failed notification is kept at head of stream, to retry later.
+    mock_config->async_notify_ = true;
+    mock_factory->fail_ = true;
+    std::string url = "http://127.0.0.1:8085/api/v1/streams";
+    hooks->on_unpublish(url, req.get());
+    srs_usleep(10 * SRS_UTIME_MILLISECONDS);
+    EXPECT_EQ(1, mock_factory->nn_post_);
+    ASSERT_EQ(1, (int)hooks->notifications_.size());
+    EXPECT_EQ(1, hooks->notifications_.front()->retries_);
+
+    // The later one of the same stream waits for it, while the other stream is delivered.
+    mock_factory->fail_ = false;
+    hooks->on_stop(url, req.get());
+    hooks->on_stop(url, req2.get());
+    srs_usleep(10 * SRS_UTIME_MILLISECONDS);
+    EXPECT_EQ(2, mock_factory->nn_post_);
+    ASSERT_EQ(2, (int)hooks->notifications_.size());
+    EXPECT_STREQ("on_unpublish", hooks->notifications_.front()->action_.c_str());
+    EXPECT_STREQ("on_stop", hooks->notifications_.back()->action_.c_str());
+    EXPECT_STREQ(req->get_stream_url().c_str(), hooks->notifications_.back()->stream_.c_str());
+
+    // The queued ones of stream are delivered in order before the validation hook.
+    HELPER_EXPECT_SUCCESS(hooks->on_publish(url, req.get()));
+    EXPECT_EQ(5, mock_factory->nn_post_);
+    EXPECT_TRUE(hooks->notifications_.empty());
+
+    ASSERT_EQ(5, (int)mock_factory->bodies_.size());
+    EXPECT_TRUE(mock_factory->bodies_[2].find("on_unpublish") != std::string::npos);
+    EXPECT_TRUE(mock_factory->bodies_[3].find("on_stop") != std::string::npos);
+    EXPECT_TRUE(mock_factory->bodies_[4].find("on_publish") != std::string::npos);
+
+    // Nothing to flush for the play.
+    HELPER_EXPECT_SUCCESS(hooks->on_play(url, req2.get()));
+    EXPECT_EQ(6, mock_factory->nn_post_);
+
+    hooks->factory_ = NULL;
+    hooks->stat_ = NULL;
+    hooks->config_ = NULL;
+}
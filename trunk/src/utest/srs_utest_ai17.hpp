@@ -109,6 +109,7 @@ public:
 
 public:
     virtual void set_path(std::string v);
+    virtual std::string fullpath();
     virtual std::string tmppath();
     virtual srs_error_t rename();
     virtual void append(int64_t dts);
@@ -169,6 +170,7 @@ public:
 public:
     // ISrsFragment interface implementations
     virtual void set_path(std::string v);
+    virtual std::string fullpath();
     virtual std::string tmppath();
     virtual srs_error_t rename();
     virtual void append(int64_t dts);
@@ -206,6 +208,7 @@ public:
 public:
     // ISrsFragment interface implementations
     virtual void set_path(std::string v);
+    virtual std::string fullpath();
     virtual std::string tmppath();
     virtual srs_error_t rename();
     virtual void append(int64_t dts);
@@ -62,6 +62,19 @@ srs_error_t MockSrtSocket::recvmsg(void *buf, size_t size, ssize_t *nread)
     return srs_success;
 }
 
+srs_error_t MockSrtSocket::recvmsgs(iovec *iovs, int nn_iovs, int *nn_msgs)
+{
+    ssize_t nread = 0;
+    srs_error_t err = recvmsg(iovs[0].iov_base, iovs[0].iov_len, &nread);
+    if (err != srs_success) {
+        return err;
+    }
+
+    iovs[0].iov_len = nread;
+    *nn_msgs = 1;
+    return srs_success;
+}
+
 srs_error_t MockSrtSocket::sendmsg(void *buf, size_t size, ssize_t *nwrite)
 {
     sendmsg_called_count_++;
@@ -509,6 +522,138 @@ VOID TEST(UdpMuxSocketTest, SendtoReplyToClient)
     EXPECT_GT(received_count, 0);
 }
 
+VOID TEST(UdpMuxSocketTest, RecvmmsgBatchFromClient)
+{
+    srs_error_t err;
+
+    // Generate random ports in range [30000, 60000] for server and client
+    SrsRand rand;
+    int server_port = rand.integer(30000, 60000);
+    int client_port = rand.integer(30000, 60000);
+    while (client_port == server_port) {
+        client_port = rand.integer(30000, 60000);
+    }
+
+    srs_netfd_t server_fd = NULL;
+    HELPER_EXPECT_SUCCESS(srs_udp_listen("127.0.0.1", server_port, &server_fd));
+    SrsUniquePtr<srs_netfd_t> server_fd_ptr(&server_fd, srs_close_stfd_ptr);
+
+    srs_netfd_t client_fd = NULL;
+    HELPER_EXPECT_SUCCESS(srs_udp_listen("127.0.0.1", client_port, &client_fd));
+    SrsUniquePtr<srs_netfd_t> client_fd_ptr(&client_fd, srs_close_stfd_ptr);
+
+    // Create SrsUdpMuxSocket wrapping the server socket, with a ring of 4 buffers.
+    SrsUniquePtr<SrsUdpMuxSocket> server_socket(new SrsUdpMuxSocket(server_fd));
+    server_socket->set_recvmmsg(4);
+    EXPECT_EQ(4, server_socket->nn_mmsgs_);
+
+    sockaddr_in dest_addr;
+    memset(&dest_addr, 0, sizeof(dest_addr));
+    dest_addr.sin_family = AF_INET;
+    dest_addr.sin_port = htons(server_port);
+    dest_addr.sin_addr.s_addr = inet_addr("127.0.0.1");
+
+    // Send 6 packets, more than the size of ring.
+    for (int i = 0; i < 6; i++) {
+        std::stringstream ss;
+        ss << "packet" << i;
+        string msg = ss.str();
+        int sent = srs_sendto(client_fd, (void *)msg.c_str(), msg.size(), (sockaddr *)&dest_addr, sizeof(dest_addr), SRS_UTIME_NO_TIMEOUT);
+        EXPECT_EQ(sent, (int)msg.size());
+    }
+    srs_usleep(1 * SRS_UTIME_MILLISECONDS);
+
+    // The first batch should fill the ring.
+    int nn = server_socket->recvmmsg(1 * SRS_UTIME_MILLISECONDS);
+    EXPECT_EQ(4, nn);
+    for (int i = 0; i < nn; i++) {
+        std::stringstream ss;
+        ss << "packet" << i;
+        string msg = ss.str();
+
+        int nread = server_socket->load_mmsg(i);
+        EXPECT_EQ((int)msg.size(), nread);
+        EXPECT_EQ(msg, string(server_socket->data(), server_socket->size()));
+        EXPECT_EQ(nread, server_socket->buffer()->size());
+        EXPECT_EQ(0, server_socket->buffer()->pos());
+
+        // The peer address should be parsed for each datagram.
+        EXPECT_FALSE(server_socket->peer_id().empty());
+        EXPECT_EQ(client_port, server_socket->get_peer_port());
+        EXPECT_EQ("127.0.0.1", server_socket->get_peer_ip());
+    }
+
+    // The second batch gets the left packets.
+    nn = server_socket->recvmmsg(1 * SRS_UTIME_MILLISECONDS);
+    EXPECT_EQ(2, nn);
+    EXPECT_EQ(7, server_socket->load_mmsg(0));
+    EXPECT_EQ("packet4", string(server_socket->data(), server_socket->size()));
+    EXPECT_EQ(7, server_socket->load_mmsg(1));
+    EXPECT_EQ("packet5", string(server_socket->data(), server_socket->size()));
+
+    // Reply to the peer of current datagram.
+    string reply_data = "Hello from server";
+    HELPER_EXPECT_SUCCESS(server_socket->sendto((void *)reply_data.c_str(), reply_data.size(), SRS_UTIME_NO_TIMEOUT));
+    srs_usleep(1 * SRS_UTIME_MILLISECONDS);
+
+    char recv_buf[1024];
+    sockaddr_in from_addr;
+    int from_len = sizeof(from_addr);
+    int nread = srs_recvfrom(client_fd, recv_buf, sizeof(recv_buf), (sockaddr *)&from_addr, &from_len, 1 * SRS_UTIME_MILLISECONDS);
+    EXPECT_EQ((int)reply_data.size(), nread);
+
+    // Timeout when no packet.
+    nn = server_socket->recvmmsg(1 * SRS_UTIME_MILLISECONDS);
+    EXPECT_EQ(-1, nn);
+
+    // The recvfrom still works, using its own buffer.
+    string last = "last";
+    srs_sendto(client_fd, (void *)last.c_str(), last.size(), (sockaddr *)&dest_addr, sizeof(dest_addr), SRS_UTIME_NO_TIMEOUT);
+    srs_usleep(1 * SRS_UTIME_MILLISECONDS);
+    EXPECT_EQ(4, server_socket->recvfrom(1 * SRS_UTIME_MILLISECONDS));
+    EXPECT_EQ(last, string(server_socket->data(), server_socket->size()));
+    EXPECT_TRUE(server_socket->data() == server_socket->buf_);
+}
+
+VOID TEST(UdpMuxListenerTest, ReceivePacketsByRecvmmsg)
+{
+    srs_error_t err;
+
+    SrsRand rand;
+    int port = rand.integer(30000, 60000);
+
+    SrsUniquePtr<MockUdpMuxHandler> mock_handler(new MockUdpMuxHandler());
+
+    // Create UDP mux listener which receives packets by recvmmsg.
+    SrsUniquePtr<SrsUdpMuxListener> listener(new SrsUdpMuxListener(mock_handler.get(), "127.0.0.1", port));
+    listener->set_recvmmsg(8);
+    HELPER_EXPECT_SUCCESS(listener->listen());
+    srs_usleep(1 * SRS_UTIME_MILLISECONDS);
+
+    srs_netfd_t client_fd = NULL;
+    HELPER_EXPECT_SUCCESS(srs_udp_listen("127.0.0.1", 0, &client_fd));
+    SrsUniquePtr<srs_netfd_t> client_fd_ptr(&client_fd, srs_close_stfd_ptr);
+
+    sockaddr_in dest_addr;
+    memset(&dest_addr, 0, sizeof(dest_addr));
+    dest_addr.sin_family = AF_INET;
+    dest_addr.sin_port = htons(port);
+    dest_addr.sin_addr.s_addr = inet_addr("127.0.0.1");
+
+    // Send packets without yield, so that the listener got them in a batch.
+    for (int i = 0; i < 5; i++) {
+        std::stringstream ss;
+        ss << "batch" << i;
+        string msg = ss.str();
+        srs_sendto(client_fd, (void *)msg.c_str(), msg.size(), (sockaddr *)&dest_addr, sizeof(dest_addr), SRS_UTIME_NO_TIMEOUT);
+    }
+    srs_usleep(1 * SRS_UTIME_MILLISECONDS);
+
+    // Each packet should be dispatched to handler, in order.
+    EXPECT_EQ(5, mock_handler->packet_count_);
+    EXPECT_EQ("batch4", mock_handler->last_packet_data_);
+}
+
 VOID TEST(UdpMuxSocketTest, PeerIdGenerationAndCaching)
 {
     srs_error_t err;
@@ -672,6 +817,19 @@ VOID TEST(SrtConnectionTest, ReadWriteAndTimeouts)
     EXPECT_GT(nread, 0);
     EXPECT_EQ(mock_socket->recv_bytes_, nread);
 
+    // Test recvmsgs - should call mock socket's recvmsgs
+    char batch_buf[2][1024];
+    iovec iovs[2];
+    iovs[0].iov_base = batch_buf[0];
+    iovs[0].iov_len = sizeof(batch_buf[0]);
+    iovs[1].iov_base = batch_buf[1];
+    iovs[1].iov_len = sizeof(batch_buf[1]);
+    int nn_msgs = 0;
+    HELPER_EXPECT_SUCCESS(conn->recvmsgs(iovs, 2, &nn_msgs));
+    EXPECT_EQ(1, nn_msgs);
+    EXPECT_EQ(mock_socket->recvmsg_called_count_, 2);
+    EXPECT_EQ(nread, (ssize_t)iovs[0].iov_len);
+
     // Test get_recv_bytes
     EXPECT_EQ(conn->get_recv_bytes(), mock_socket->recv_bytes_);
 
@@ -2495,6 +2653,15 @@ srs_error_t MockRtcConnectionForUpdateSessions::do_send_packet(SrsRtpPacket *pkt
     return srs_success;
 }
 
+void MockRtcConnectionForUpdateSessions::start_batch()
+{
+}
+
+srs_error_t MockRtcConnectionForUpdateSessions::flush_batch()
+{
+    return srs_success;
+}
+
 srs_error_t MockRtcConnectionForUpdateSessions::do_check_send_nacks()
 {
     return srs_success;
@@ -2876,6 +3043,11 @@ srs_error_t MockRtcNetworkForUdpNetwork::protect_rtp(void *packet, int *nb_ciphe
     return srs_success;
 }
 
+srs_error_t MockRtcNetworkForUdpNetwork::protect_rtps(iovec *iovs, int nn_iovs)
+{
+    return srs_success;
+}
+
 srs_error_t MockRtcNetworkForUdpNetwork::protect_rtcp(void *packet, int *nb_cipher)
 {
     return srs_success;
@@ -2886,6 +3058,11 @@ bool MockRtcNetworkForUdpNetwork::is_establelished()
     return true;
 }
 
+srs_error_t MockRtcNetworkForUdpNetwork::sendmmsg(iovec *iovs, int nn_iovs, int gso_size)
+{
+    return srs_success;
+}
+
 srs_error_t MockRtcNetworkForUdpNetwork::write(void *buf, size_t size, ssize_t *nwrite)
 {
     return srs_success;
@@ -43,6 +43,7 @@ public:
 
 public:
     virtual srs_error_t recvmsg(void *buf, size_t size, ssize_t *nread);
+    virtual srs_error_t recvmsgs(iovec *iovs, int nn_iovs, int *nn_msgs);
     virtual srs_error_t sendmsg(void *buf, size_t size, ssize_t *nwrite);
     virtual void set_recv_timeout(srs_utime_t tm);
     virtual void set_send_timeout(srs_utime_t tm);
@@ -318,6 +319,8 @@ public:
     virtual void check_send_nacks(SrsRtpNackForReceiver *nack, uint32_t ssrc, uint32_t &sent_nacks, uint32_t &timeout_nacks);
     virtual srs_error_t send_rtcp_fb_pli(uint32_t ssrc, const SrsContextId &cid_of_subscriber);
     virtual srs_error_t do_send_packet(SrsRtpPacket *pkt);
+    virtual void start_batch();
+    virtual srs_error_t flush_batch();
 
 public:
     // ISrsRtcPacketReceiver interface
@@ -411,8 +414,10 @@ public:
     virtual srs_error_t on_rtp(char *data, int nb_data);
     virtual srs_error_t on_rtcp(char *data, int nb_data);
     virtual srs_error_t protect_rtp(void *packet, int *nb_cipher);
+    virtual srs_error_t protect_rtps(iovec *iovs, int nn_iovs);
     virtual srs_error_t protect_rtcp(void *packet, int *nb_cipher);
     virtual bool is_establelished();
+    virtual srs_error_t sendmmsg(iovec *iovs, int nn_iovs, int gso_size);
     virtual srs_error_t write(void *buf, size_t size, ssize_t *nwrite);
 };
 
@@ -3947,6 +3947,11 @@ ISrsFastTimer *MockSharedTimerForCircuitBreaker::timer5s()
     return NULL;
 }
 
+ISrsTimingWheel *MockSharedTimerForCircuitBreaker::wheel()
+{
+    return NULL;
+}
+
 // Mock ISrsHost implementation for SrsCircuitBreaker
 MockHostForCircuitBreaker::MockHostForCircuitBreaker()
 {
@@ -907,6 +907,7 @@ public:
     virtual ISrsFastTimer *timer100ms();
     virtual ISrsFastTimer *timer1s();
     virtual ISrsFastTimer *timer5s();
+    virtual ISrsTimingWheel *wheel();
 };
 
 // Mock ISrsHost for testing SrsCircuitBreaker
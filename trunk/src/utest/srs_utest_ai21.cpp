@@ -1370,6 +1370,10 @@ srs_error_t MockSrtBridge::on_srt_packet(SrsSrtPacket *packet)
     return srs_error_copy(on_packet_error_);
 }
 
+void MockSrtBridge::flush()
+{
+}
+
 void MockSrtBridge::set_on_publish_error(srs_error_t err)
 {
     srs_freep(on_publish_error_);
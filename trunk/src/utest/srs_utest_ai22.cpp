@@ -3625,6 +3625,143 @@ VOID TEST(DvrMp4SegmenterTest, CloseEncoderFlushSuccess)
     srs_freep(mock_factory);
 }
 
+static int count_mp4_boxes(const string &content, const string &type)
+{
+    int count = 0;
+    for (size_t pos = content.find(type); pos != string::npos; pos = content.find(type, pos + type.length())) {
+        count++;
+    }
+    return count;
+}
+
+// This test covers the fragmented MP4 DVR, which writes the init header once by the first sample,
+// then a moof and mdat for each fragment that starts at keyframe when exceed the fragment duration.
+VOID TEST(DvrFmp4SegmenterTest, WriteFragmentsAtKeyframe)
+{
+    srs_error_t err;
+
+    SrsUniquePtr<MockEdgeRequest> req(new MockEdgeRequest("test.vhost", "live", "stream1"));
+    SrsUniquePtr<MockDvrPlan> plan(new MockDvrPlan());
+
+    SrsUniquePtr<SrsDvrFmp4Segmenter> segmenter(new SrsDvrFmp4Segmenter());
+    HELPER_EXPECT_SUCCESS(segmenter->initialize(plan.get(), req.get()));
+    segmenter->duration_ = 2 * SRS_UTIME_SECONDS;
+
+    MockSrsFileWriter *mock_fs = new MockSrsFileWriter();
+    srs_freep(segmenter->fs_);
+    segmenter->fs_ = mock_fs;
+    HELPER_EXPECT_SUCCESS(segmenter->open_encoder());
+
+    // The format with AVC and AAC sequence headers.
+    MockSrsFormat fmt;
+    SrsUniquePtr<SrsMediaPacket> video(new MockSrsMediaPacket(true, 0));
+    SrsUniquePtr<SrsMediaPacket> audio(new MockSrsMediaPacket(false, 0));
+
+    HELPER_EXPECT_SUCCESS(segmenter->encode_video(video.get(), &fmt));
+    HELPER_EXPECT_SUCCESS(segmenter->encode_audio(audio.get(), &fmt));
+    EXPECT_TRUE(segmenter->has_video_);
+    EXPECT_TRUE(segmenter->has_audio_);
+    EXPECT_EQ(0, (int)mock_fs->filesize());
+
+    uint8_t sample[8] = {0x00, 0x00, 0x00, 0x04, 0x65, 0x88, 0x84, 0x00};
+    fmt.raw_ = (char *)sample;
+    fmt.nb_raw_ = sizeof(sample);
+    fmt.video_->avc_packet_type_ = SrsVideoAvcFrameTraitNALU;
+    fmt.audio_->aac_packet_type_ = SrsAudioAacFrameTraitRawData;
+
+    // A keyframe every second, with an inter frame and an audio frame.
+    for (uint32_t ts = 0; ts <= 4000; ts += 1000) {
+        fmt.video_->frame_type_ = SrsVideoAvcFrameTypeKeyFrame;
+        video->timestamp_ = ts;
+        HELPER_EXPECT_SUCCESS(segmenter->encode_video(video.get(), &fmt));
+
+        audio->timestamp_ = ts + 20;
+        HELPER_EXPECT_SUCCESS(segmenter->encode_audio(audio.get(), &fmt));
+
+        fmt.video_->frame_type_ = SrsVideoAvcFrameTypeInterFrame;
+        video->timestamp_ = ts + 500;
+        HELPER_EXPECT_SUCCESS(segmenter->encode_video(video.get(), &fmt));
+    }
+
+    // The fragments start at 0s, 2s and 4s, and the last one is not flushed yet.
+    string content = mock_fs->str();
+    EXPECT_EQ(1, count_mp4_boxes(content, "ftyp"));
+    EXPECT_EQ(1, count_mp4_boxes(content, "moov"));
+    EXPECT_EQ(2, count_mp4_boxes(content, "moof"));
+    EXPECT_EQ(4, (int)segmenter->sequence_number_);
+    EXPECT_EQ(4000, (int)segmenter->start_dts_);
+    EXPECT_TRUE(segmenter->enc_ != NULL);
+
+    // Flush the last fragment when close.
+    HELPER_EXPECT_SUCCESS(segmenter->close_encoder());
+    EXPECT_EQ(3, count_mp4_boxes(mock_fs->str(), "moof"));
+    EXPECT_TRUE(segmenter->enc_ == NULL);
+}
+
+// The video sequence header comes after the init header with only audio track, the video samples
+// must be ignored, because the track is not in the init header.
+VOID TEST(DvrFmp4SegmenterTest, IgnoreTrackNotInInit)
+{
+    srs_error_t err;
+
+    SrsUniquePtr<MockEdgeRequest> req(new MockEdgeRequest("test.vhost", "live", "stream1"));
+    SrsUniquePtr<MockDvrPlan> plan(new MockDvrPlan());
+
+    SrsUniquePtr<SrsDvrFmp4Segmenter> segmenter(new SrsDvrFmp4Segmenter());
+    HELPER_EXPECT_SUCCESS(segmenter->initialize(plan.get(), req.get()));
+    segmenter->duration_ = 2 * SRS_UTIME_SECONDS;
+
+    MockSrsFileWriter *mock_fs = new MockSrsFileWriter();
+    srs_freep(segmenter->fs_);
+    segmenter->fs_ = mock_fs;
+    HELPER_EXPECT_SUCCESS(segmenter->open_encoder());
+
+    MockSrsFormat fmt;
+    SrsUniquePtr<SrsMediaPacket> video(new MockSrsMediaPacket(true, 0));
+    SrsUniquePtr<SrsMediaPacket> audio(new MockSrsMediaPacket(false, 0));
+
+    // The init header is written by the first audio sample, with only audio track.
+    HELPER_EXPECT_SUCCESS(segmenter->encode_audio(audio.get(), &fmt));
+
+    uint8_t audio_sample[6] = {0x21, 0x10, 0x04, 0x60, 0x8c, 0x1c};
+    uint8_t video_sample[8] = {0x00, 0x00, 0x00, 0x04, 0x65, 0x88, 0x84, 0x00};
+    fmt.audio_->aac_packet_type_ = SrsAudioAacFrameTraitRawData;
+    fmt.raw_ = (char *)audio_sample;
+    fmt.nb_raw_ = sizeof(audio_sample);
+    HELPER_EXPECT_SUCCESS(segmenter->encode_audio(audio.get(), &fmt));
+    EXPECT_TRUE(segmenter->init_written_);
+    EXPECT_FALSE(segmenter->init_video_);
+    EXPECT_TRUE(segmenter->init_audio_);
+
+    // The video sequence header comes later.
+    fmt.video_->avc_packet_type_ = SrsVideoAvcFrameTraitSequenceHeader;
+    HELPER_EXPECT_SUCCESS(segmenter->encode_video(video.get(), &fmt));
+    EXPECT_TRUE(segmenter->has_video_);
+    EXPECT_FALSE(segmenter->init_video_);
+
+    fmt.video_->avc_packet_type_ = SrsVideoAvcFrameTraitNALU;
+    fmt.video_->frame_type_ = SrsVideoAvcFrameTypeKeyFrame;
+    for (uint32_t ts = 1000; ts <= 4000; ts += 1000) {
+        fmt.raw_ = (char *)video_sample;
+        fmt.nb_raw_ = sizeof(video_sample);
+        video->timestamp_ = ts;
+        HELPER_EXPECT_SUCCESS(segmenter->encode_video(video.get(), &fmt));
+
+        fmt.raw_ = (char *)audio_sample;
+        fmt.nb_raw_ = sizeof(audio_sample);
+        audio->timestamp_ = ts + 20;
+        HELPER_EXPECT_SUCCESS(segmenter->encode_audio(audio.get(), &fmt));
+    }
+    HELPER_EXPECT_SUCCESS(segmenter->close_encoder());
+
+    // The fragments are still started by audio, and no video sample is written.
+    string content = mock_fs->str();
+    EXPECT_EQ(1, count_mp4_boxes(content, "moov"));
+    EXPECT_EQ(3, count_mp4_boxes(content, "moof"));
+    EXPECT_EQ(0, count_mp4_boxes(content, string((char *)video_sample, sizeof(video_sample))));
+    EXPECT_EQ(5, count_mp4_boxes(content, string((char *)audio_sample, sizeof(audio_sample))));
+}
+
 // Mock ISrsHttpHooks for testing SrsDvrAsyncCallOnDvr
 MockHttpHooksForDvrAsyncCall::MockHttpHooksForDvrAsyncCall()
 {
@@ -1448,6 +1448,15 @@ srs_error_t MockRtcConnectionForTcpConn::do_send_packet(SrsRtpPacket *pkt)
     return srs_success;
 }
 
+void MockRtcConnectionForTcpConn::start_batch()
+{
+}
+
+srs_error_t MockRtcConnectionForTcpConn::flush_batch()
+{
+    return srs_success;
+}
+
 srs_error_t MockRtcConnectionForTcpConn::do_check_send_nacks()
 {
     return srs_success;
@@ -1694,6 +1703,54 @@ VOID TEST(GbMuxerTest, OnTsMessageAudio)
     srs_freep(mock_queue);
 }
 
+MockAppConfigForGbMuxer::MockAppConfigForGbMuxer()
+{
+}
+
+MockAppConfigForGbMuxer::~MockAppConfigForGbMuxer()
+{
+}
+
+std::vector<std::string> MockAppConfigForGbMuxer::get_listens()
+{
+    return listens_;
+}
+
+bool MockAppConfigForGbMuxer::get_vhost_is_edge(std::string vhost)
+{
+    return !edge_vhost_.empty() && vhost == edge_vhost_;
+}
+
+// Test SrsGbMuxer::is_local_output - the muxer publishes to live source in process only when the
+// output is the RTMP port of this server on loopback, otherwise it uses the RTMP client.
+VOID TEST(GbMuxerTest, IsLocalOutput)
+{
+    SrsUniquePtr<MockGbSessionForMuxer> mock_session(new MockGbSessionForMuxer());
+    SrsUniquePtr<MockAppConfigForGbMuxer> mock_config(new MockAppConfigForGbMuxer());
+    mock_config->listens_.push_back("1935");
+    mock_config->listens_.push_back("0.0.0.0:19350");
+
+    SrsUniquePtr<SrsGbMuxer> muxer(new SrsGbMuxer(mock_session.get()));
+    muxer->config_ = mock_config.get();
+
+    // The default port 1935 and other listen port of this server.
+    EXPECT_TRUE(muxer->is_local_output("rtmp://127.0.0.1/live/livestream"));
+    EXPECT_TRUE(muxer->is_local_output("rtmp://localhost:1935/live/livestream"));
+    EXPECT_TRUE(muxer->is_local_output("rtmp://127.0.0.1:19350/live/livestream?vhost=test.com"));
+
+    // Not the port of this server, or not loopback.
+    EXPECT_FALSE(muxer->is_local_output("rtmp://127.0.0.1:1936/live/livestream"));
+    EXPECT_FALSE(muxer->is_local_output("rtmp://10.0.0.1/live/livestream"));
+    EXPECT_FALSE(muxer->is_local_output("rtmp://ossrs.net:1935/live/livestream"));
+
+    // The edge vhost forwards to origin by the RTMP client.
+    mock_config->edge_vhost_ = "edge.com";
+    EXPECT_FALSE(muxer->is_local_output("rtmp://127.0.0.1:19350/live/livestream?vhost=edge.com"));
+    EXPECT_TRUE(muxer->is_local_output("rtmp://127.0.0.1:19350/live/livestream?vhost=test.com"));
+
+    muxer->config_ = NULL;
+}
+
 // Test SrsPackContext::on_ts_message - covers the major use scenario:
 // 1. Accumulate multiple TS messages in the same PS pack
 // 2. Trigger on_ps_pack callback when a new pack ID is detected
@@ -2347,6 +2404,11 @@ srs_error_t MockRtcNetworkForNetworks::protect_rtp(void *packet, int *nb_cipher)
     return srs_success;
 }
 
+srs_error_t MockRtcNetworkForNetworks::protect_rtps(iovec *iovs, int nn_iovs)
+{
+    return srs_success;
+}
+
 srs_error_t MockRtcNetworkForNetworks::protect_rtcp(void *packet, int *nb_cipher)
 {
     return srs_success;
@@ -2372,6 +2434,11 @@ bool MockRtcNetworkForNetworks::is_establelished()
     return is_established_;
 }
 
+srs_error_t MockRtcNetworkForNetworks::sendmmsg(iovec *iovs, int nn_iovs, int gso_size)
+{
+    return srs_success;
+}
+
 srs_error_t MockRtcNetworkForNetworks::write(void *buf, size_t size, ssize_t *nwrite)
 {
     return srs_success;
@@ -2597,6 +2664,15 @@ srs_error_t MockRtcConnectionForUdpNetwork::do_send_packet(SrsRtpPacket *pkt)
     return srs_success;
 }
 
+void MockRtcConnectionForUdpNetwork::start_batch()
+{
+}
+
+srs_error_t MockRtcConnectionForUdpNetwork::flush_batch()
+{
+    return srs_success;
+}
+
 srs_error_t MockRtcConnectionForUdpNetwork::send_rtcp_rr(uint32_t ssrc, SrsRtpRingBuffer *rtp_queue, const uint64_t &last_send_systime, const SrsNtp &last_send_ntp)
 {
     return srs_success;
@@ -2885,6 +2961,11 @@ srs_error_t MockRtcTransportForUdpNetwork::protect_rtp(void *packet, int *nb_cip
     return srs_success;
 }
 
+srs_error_t MockRtcTransportForUdpNetwork::protect_rtps(iovec *iovs, int nn_iovs)
+{
+    return srs_success;
+}
+
 srs_error_t MockRtcTransportForUdpNetwork::protect_rtcp(void *packet, int *nb_cipher)
 {
     return srs_success;
@@ -3760,6 +3841,15 @@ srs_error_t MockRtcConnectionForTcpConnHandshake::do_send_packet(SrsRtpPacket *p
     return srs_success;
 }
 
+void MockRtcConnectionForTcpConnHandshake::start_batch()
+{
+}
+
+srs_error_t MockRtcConnectionForTcpConnHandshake::flush_batch()
+{
+    return srs_success;
+}
+
 srs_error_t MockRtcConnectionForTcpConnHandshake::do_check_send_nacks()
 {
     return srs_success;
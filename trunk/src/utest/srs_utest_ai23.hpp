@@ -135,6 +135,8 @@ public:
     // ISrsRtcPacketSender interface
     virtual srs_error_t send_rtcp(char *data, int nb_data);
     virtual srs_error_t do_send_packet(SrsRtpPacket *pkt);
+    virtual void start_batch();
+    virtual srs_error_t flush_batch();
     virtual srs_error_t send_rtcp_rr(uint32_t ssrc, SrsRtpRingBuffer *rtp_queue, const uint64_t &last_send_systime, const SrsNtp &last_send_ntp);
     virtual srs_error_t send_rtcp_xr_rrtr(uint32_t ssrc);
     virtual void check_send_nacks(SrsRtpNackForReceiver *nack, uint32_t ssrc, uint32_t &sent_nacks, uint32_t &timeout_nacks);
@@ -357,6 +359,22 @@ public:
     virtual void on_executor_done(ISrsInterruptable *executor);
 };
 
+// Mock ISrsAppConfig for testing SrsGbMuxer::is_local_output
+class MockAppConfigForGbMuxer : public MockAppConfig
+{
+public:
+    std::vector<std::string> listens_;
+    std::string edge_vhost_;
+
+public:
+    MockAppConfigForGbMuxer();
+    virtual ~MockAppConfigForGbMuxer();
+
+public:
+    virtual std::vector<std::string> get_listens();
+    virtual bool get_vhost_is_edge(std::string vhost);
+};
+
 // Mock ISrsInterruptable for testing SrsRtcTcpConn
 class MockInterruptableForRtcTcpConn : public ISrsInterruptable
 {
@@ -409,6 +427,8 @@ public:
     virtual void check_send_nacks(SrsRtpNackForReceiver *nack, uint32_t ssrc, uint32_t &sent_nacks, uint32_t &timeout_nacks);
     virtual srs_error_t send_rtcp_fb_pli(uint32_t ssrc, const SrsContextId &cid_of_subscriber);
     virtual srs_error_t do_send_packet(SrsRtpPacket *pkt);
+    virtual void start_batch();
+    virtual srs_error_t flush_batch();
     virtual srs_error_t do_check_send_nacks();
     virtual void on_connection_established();
     virtual srs_error_t on_dtls_alert(std::string type, std::string desc);
@@ -567,11 +587,13 @@ public:
     virtual srs_error_t on_dtls_alert(std::string type, std::string desc);
     virtual srs_error_t on_dtls(char *data, int nb_data);
     virtual srs_error_t protect_rtp(void *packet, int *nb_cipher);
+    virtual srs_error_t protect_rtps(iovec *iovs, int nn_iovs);
     virtual srs_error_t protect_rtcp(void *packet, int *nb_cipher);
     virtual srs_error_t on_stun(SrsStunPacket *r, char *data, int nb_data);
     virtual srs_error_t on_rtp(char *data, int nb_data);
     virtual srs_error_t on_rtcp(char *data, int nb_data);
     virtual bool is_establelished();
+    virtual srs_error_t sendmmsg(iovec *iovs, int nn_iovs, int gso_size);
     virtual srs_error_t write(void *buf, size_t size, ssize_t *nwrite);
 
 public:
@@ -600,6 +622,7 @@ public:
     virtual srs_error_t on_dtls(char *data, int nb_data);
     virtual srs_error_t on_dtls_alert(std::string type, std::string desc);
     virtual srs_error_t protect_rtp(void *packet, int *nb_cipher);
+    virtual srs_error_t protect_rtps(iovec *iovs, int nn_iovs);
     virtual srs_error_t protect_rtcp(void *packet, int *nb_cipher);
     virtual srs_error_t unprotect_rtp(void *packet, int *nb_plaintext);
     virtual srs_error_t unprotect_rtcp(void *packet, int *nb_plaintext);
@@ -731,6 +754,8 @@ public:
     virtual void check_send_nacks(SrsRtpNackForReceiver *nack, uint32_t ssrc, uint32_t &sent_nacks, uint32_t &timeout_nacks);
     virtual srs_error_t send_rtcp_fb_pli(uint32_t ssrc, const SrsContextId &cid_of_subscriber);
     virtual srs_error_t do_send_packet(SrsRtpPacket *pkt);
+    virtual void start_batch();
+    virtual srs_error_t flush_batch();
     virtual srs_error_t do_check_send_nacks();
     virtual void on_connection_established();
     virtual srs_error_t on_dtls_alert(std::string type, std::string desc);
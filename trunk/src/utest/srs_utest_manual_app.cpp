@@ -7,16 +7,28 @@
 
 using namespace std;
 
+#include <fcntl.h>
+
+#include <srs_app_async_io.hpp>
 #include <srs_app_config.hpp>
 #include <srs_app_fragment.hpp>
+#include <srs_app_hls_ll.hpp>
+#include <srs_app_ingest_thread.hpp>
+#include <srs_app_log.hpp>
+#include <srs_app_segment_cache.hpp>
 #include <srs_app_security.hpp>
+#include <srs_app_srt_conn.hpp>
+#include <srs_app_srt_source.hpp>
 #include <srs_kernel_error.hpp>
 
 #include <srs_app_mpegts_udp.hpp>
 #include <srs_app_st.hpp>
 #include <srs_kernel_buffer.hpp>
+#include <srs_kernel_pool.hpp>
 #include <srs_protocol_conn.hpp>
 #include <srs_protocol_rtmp_stack.hpp>
+#include <srs_utest_manual_kernel.hpp>
+#include <srs_utest_manual_mock.hpp>
 
 class MockIDResource : public ISrsResource
 {
@@ -529,6 +541,751 @@ VOID TEST(AppFragmentTest, CheckDuration)
     }
 }
 
+class MockAsyncIoConfig : public MockAppConfig
+{
+public:
+    virtual bool get_async_io_enabled() { return true; }
+    virtual int get_async_io_threads() { return 2; }
+    virtual int get_async_io_queue() { return 2; }
+};
+
+// Read the whole file to string.
+string mock_aio_read_file(string path)
+{
+    string content;
+
+    FILE *fp = fopen(path.c_str(), "rb");
+    if (!fp) {
+        return content;
+    }
+
+    char buf[4096];
+    size_t n = 0;
+    while ((n = fread(buf, 1, sizeof(buf), fp)) > 0) {
+        content.append(buf, n);
+    }
+    fclose(fp);
+
+    return content;
+}
+
+// Write some data, patch the header by seek, then write data larger than the buffer.
+void mock_aio_write_file(SrsAsyncFileWriter *writer, string path, string &expect)
+{
+    srs_error_t err = srs_success;
+
+    HELPER_EXPECT_SUCCESS(writer->open(path));
+    HELPER_EXPECT_SUCCESS(writer->set_iobuf_size(16));
+
+    HELPER_EXPECT_SUCCESS(writer->write((void *)"0000hello", 9, NULL));
+    EXPECT_EQ(9, writer->tellg());
+
+    off_t pos = 0;
+    HELPER_EXPECT_SUCCESS(writer->lseek(0, SEEK_SET, &pos));
+    EXPECT_EQ(0, (int)pos);
+    HELPER_EXPECT_SUCCESS(writer->write((void *)"size", 4, NULL));
+
+    HELPER_EXPECT_SUCCESS(writer->lseek(0, SEEK_END, &pos));
+    EXPECT_EQ(9, (int)pos);
+
+    string large(100, 'x');
+    HELPER_EXPECT_SUCCESS(writer->write((void *)large.data(), large.length(), NULL));
+    HELPER_EXPECT_SUCCESS(writer->write((void *)"!", 1, NULL));
+    EXPECT_EQ(110, writer->tellg());
+
+    writer->close();
+    EXPECT_FALSE(writer->is_open());
+
+    expect = "sizehello" + large + "!";
+}
+
+VOID TEST(AppAsyncIoTest, WriteInPlace)
+{
+    srs_error_t err = srs_success;
+
+    // The I/O threads are not started, the I/O is done in place.
+    SrsAsyncIo aio;
+    EXPECT_FALSE(aio.enabled());
+
+    string path = "/tmp/srs_utest_aio_inplace_" + srs_strconv_format_int(getpid()) + ".mp4";
+    MockFileRemover remover(path);
+
+    SrsAsyncFileWriter writer;
+    writer.aio_ = &aio;
+
+    string expect;
+    mock_aio_write_file(&writer, path, expect);
+    EXPECT_TRUE(expect == mock_aio_read_file(path));
+
+    // Rename and unlink are also done in place.
+    string target = path + ".renamed";
+    HELPER_EXPECT_SUCCESS(aio.rename(path, target));
+    EXPECT_TRUE(expect == mock_aio_read_file(target));
+
+    HELPER_EXPECT_SUCCESS(aio.unlink(target));
+    SrsPath p;
+    EXPECT_FALSE(p.exists(target));
+
+    // Never unlink the system directories.
+    HELPER_EXPECT_FAILED(aio.unlink("/tmp"));
+}
+
+VOID TEST(AppAsyncIoTest, WriteByThreads)
+{
+    srs_error_t err = srs_success;
+
+    MockAsyncIoConfig config;
+    SrsAsyncIo aio;
+    aio.config_ = &config;
+
+    HELPER_EXPECT_SUCCESS(aio.start());
+    EXPECT_TRUE(aio.enabled());
+    EXPECT_EQ(2, (int)aio.threads_.size());
+
+    string path = "/tmp/srs_utest_aio_threads_" + srs_strconv_format_int(getpid()) + ".mp4";
+    MockFileRemover remover(path);
+
+    // Write by I/O threads, while the coroutine waits for the result.
+    SrsAsyncFileWriter writer;
+    writer.aio_ = &aio;
+
+    string expect;
+    mock_aio_write_file(&writer, path, expect);
+    EXPECT_TRUE(expect == mock_aio_read_file(path));
+    EXPECT_EQ(0, aio.nn_queue_);
+    EXPECT_EQ(0, aio.depth(_srs_context->get_id().c_str()));
+    EXPECT_GT(aio.nn_ops_, 0);
+
+    // Write more than the queue, the writers wait for free slots.
+    for (int i = 0; i < 4; i++) {
+        HELPER_EXPECT_SUCCESS(aio.unlink(path + ".notexists"));
+    }
+    EXPECT_LE(aio.nn_queue_, 2);
+    EXPECT_EQ(aio.nn_queue_, aio.depth(_srs_context->get_id().c_str()));
+    EXPECT_GT(aio.nn_full_, 0);
+
+    string target = path + ".renamed";
+    HELPER_EXPECT_SUCCESS(aio.rename(path, target));
+    EXPECT_TRUE(expect == mock_aio_read_file(target));
+
+    // Open the file which not exists.
+    int fd = -1;
+    HELPER_EXPECT_FAILED(aio.open("/tmp/srs-utest-not-exists/aio.mp4", &fd));
+
+    // The unlink is done in background, and all pending operations are done when stopped.
+    HELPER_EXPECT_SUCCESS(aio.unlink(target));
+    aio.stop();
+    EXPECT_FALSE(aio.enabled());
+    EXPECT_EQ(0, aio.nn_queue_);
+
+    SrsPath p;
+    EXPECT_FALSE(p.exists(target));
+}
+
+// Read the file larger than the buffer, seek and read to EOF.
+void mock_aio_read_file(SrsAsyncIo *aio, string path)
+{
+    srs_error_t err = srs_success;
+
+    string content;
+    for (int i = 0; i < 10000; i++) {
+        content.append("0123456789");
+    }
+
+    FILE *fp = fopen(path.c_str(), "wb");
+    ASSERT_TRUE(fp != NULL);
+    fwrite(content.data(), 1, content.size(), fp);
+    fclose(fp);
+
+    SrsAsyncFileReader reader;
+    reader.aio_ = aio;
+    HELPER_ASSERT_SUCCESS(reader.open(path));
+    EXPECT_TRUE(reader.is_open());
+    EXPECT_EQ((int64_t)content.size(), reader.filesize());
+    EXPECT_GT(reader.mtime(), 0);
+
+    // Read all data by small chunks, from the read ahead buffer.
+    string data;
+    HELPER_EXPECT_SUCCESS(srs_io_readall(&reader, data));
+    EXPECT_TRUE(content == data);
+
+    // Seek back and read the tail.
+    off_t pos = 0;
+    HELPER_EXPECT_SUCCESS(reader.lseek(-5, SEEK_END, &pos));
+    EXPECT_EQ((int)content.size() - 5, (int)pos);
+
+    char buf[16];
+    ssize_t nread = 0;
+    HELPER_EXPECT_SUCCESS(reader.read(buf, sizeof(buf), &nread));
+    EXPECT_EQ(5, (int)nread);
+    EXPECT_TRUE(string(buf, 5) == "56789");
+    HELPER_EXPECT_FAILED(reader.read(buf, sizeof(buf), &nread));
+
+    reader.seek2(10);
+    HELPER_EXPECT_SUCCESS(reader.read(buf, 3, &nread));
+    EXPECT_EQ(3, (int)nread);
+    EXPECT_TRUE(string(buf, 3) == "012");
+    EXPECT_EQ(13, reader.tellg());
+
+    reader.close();
+    EXPECT_FALSE(reader.is_open());
+
+    SrsAsyncFileReader not_exists;
+    not_exists.aio_ = aio;
+    HELPER_EXPECT_FAILED(not_exists.open(path + ".notexists"));
+}
+
+VOID TEST(AppAsyncIoTest, ReadInPlaceAndByThreads)
+{
+    srs_error_t err = srs_success;
+
+    string path = "/tmp/srs_utest_aio_read_" + srs_strconv_format_int(getpid()) + ".mp4";
+    MockFileRemover remover(path);
+
+    if (true) {
+        SrsAsyncIo aio;
+        EXPECT_FALSE(aio.enabled());
+        mock_aio_read_file(&aio, path);
+    }
+
+    if (true) {
+        MockAsyncIoConfig config;
+        SrsAsyncIo aio;
+        aio.config_ = &config;
+        HELPER_ASSERT_SUCCESS(aio.start());
+
+        mock_aio_read_file(&aio, path);
+        EXPECT_GT(aio.nn_ops_, 0);
+        EXPECT_EQ(0, aio.nn_queue_);
+    }
+}
+
+class MockIngestThreadConfig : public MockAppConfig
+{
+public:
+    virtual bool get_ingest_thread_enabled() { return true; }
+    virtual int get_ingest_threads() { return 2; }
+    virtual int get_ingest_thread_queue() { return 2; }
+};
+
+// The task records the thread executed it, and the order of finish.
+class MockIngestTask : public ISrsIngestTask
+{
+public:
+    int id_;
+    std::vector<int> *finished_;
+    int *nn_threaded_;
+    pthread_t executor_;
+    bool executed_;
+
+public:
+    MockIngestTask(int id, std::vector<int> *finished, int *nn_threaded)
+    {
+        id_ = id;
+        finished_ = finished;
+        nn_threaded_ = nn_threaded;
+        executed_ = false;
+    }
+    virtual ~MockIngestTask()
+    {
+    }
+
+public:
+    virtual void execute()
+    {
+        executor_ = pthread_self();
+        executed_ = true;
+    }
+    virtual srs_error_t finish()
+    {
+        if (!executed_) {
+            return srs_error_new(ERROR_SYSTEM_INGEST_THREAD, "not executed");
+        }
+        if (!pthread_equal(executor_, pthread_self())) {
+            (*nn_threaded_)++;
+        }
+        finished_->push_back(id_);
+        return srs_success;
+    }
+};
+
+// Push the items 1 to 100000 to ring, in another thread.
+void *mock_spsc_ring_producer(void *arg)
+{
+    SrsSpscRing *ring = (SrsSpscRing *)arg;
+    for (intptr_t i = 1; i <= 100000; i++) {
+        while (!ring->push((void *)i)) {
+            usleep(1);
+        }
+    }
+    return NULL;
+}
+
+VOID TEST(AppIngestThreadTest, SpscRing)
+{
+    // The capacity is rounded up to power of 2.
+    SrsSpscRing ring(3);
+    EXPECT_EQ(4, ring.capacity());
+    EXPECT_TRUE(ring.empty());
+    EXPECT_TRUE(ring.pop() == NULL);
+
+    for (intptr_t i = 1; i <= 4; i++) {
+        EXPECT_TRUE(ring.push((void *)i));
+    }
+    EXPECT_FALSE(ring.push((void *)5));
+    EXPECT_EQ(4, ring.size());
+
+    // Pop in order, and push again after wrap around.
+    EXPECT_EQ(1, (intptr_t)ring.pop());
+    EXPECT_TRUE(ring.push((void *)5));
+    for (intptr_t i = 2; i <= 5; i++) {
+        EXPECT_EQ(i, (intptr_t)ring.pop());
+    }
+    EXPECT_TRUE(ring.empty());
+
+    // The consumer receives all items in order, from the producer thread.
+    SrsSpscRing ring2(64);
+    pthread_t trd;
+    ASSERT_EQ(0, pthread_create(&trd, NULL, mock_spsc_ring_producer, &ring2));
+
+    intptr_t expect = 1;
+    while (expect <= 100000) {
+        void *item = ring2.pop();
+        if (!item) {
+            continue;
+        }
+        if ((intptr_t)item != expect) {
+            break;
+        }
+        expect++;
+    }
+    pthread_join(trd, NULL);
+
+    EXPECT_EQ(100001, expect);
+    EXPECT_TRUE(ring2.empty());
+}
+
+VOID TEST(AppIngestThreadTest, SubmitInPlace)
+{
+    // The ingest threads are not started, the task is executed and finished in place.
+    SrsIngestThreads threads;
+    EXPECT_FALSE(threads.enabled());
+
+    std::vector<int> finished;
+    int nn_threaded = 0;
+    threads.submit(new MockIngestTask(1, &finished, &nn_threaded), 100);
+    threads.submit(new MockIngestTask(2, &finished, &nn_threaded), 100);
+
+    ASSERT_EQ(2, (int)finished.size());
+    EXPECT_EQ(1, finished[0]);
+    EXPECT_EQ(2, finished[1]);
+    EXPECT_EQ(0, nn_threaded);
+
+    // Never wait for the key without pending tasks.
+    threads.drain(100);
+}
+
+VOID TEST(AppIngestThreadTest, SubmitByThreads)
+{
+    srs_error_t err = srs_success;
+
+    MockIngestThreadConfig config;
+    SrsIngestThreads threads;
+    threads.config_ = &config;
+
+    HELPER_EXPECT_SUCCESS(threads.start());
+    EXPECT_TRUE(threads.enabled());
+    EXPECT_EQ(2, (int)threads.threads_.size());
+
+    // The tasks of each key are executed by ingest thread and finished in order, while the
+    // publisher waits for free slots when exceed the queue.
+    std::vector<int> finished1, finished2;
+    int nn_threaded = 0;
+    for (int i = 0; i < 10; i++) {
+        threads.submit(new MockIngestTask(i, &finished1, &nn_threaded), 1);
+        threads.submit(new MockIngestTask(i, &finished2, &nn_threaded), 2);
+    }
+    threads.drain(1);
+    threads.drain(2);
+
+    ASSERT_EQ(10, (int)finished1.size());
+    ASSERT_EQ(10, (int)finished2.size());
+    for (int i = 0; i < 10; i++) {
+        EXPECT_EQ(i, finished1[i]);
+        EXPECT_EQ(i, finished2[i]);
+    }
+    EXPECT_EQ(20, nn_threaded);
+    EXPECT_EQ(20, threads.nn_tasks_);
+    EXPECT_GT(threads.nn_full_, 0);
+    EXPECT_TRUE(threads.pending_.empty());
+
+    // The pending tasks are finished when stopped.
+    std::vector<int> finished3;
+    threads.submit(new MockIngestTask(0, &finished3, &nn_threaded), 3);
+    threads.stop();
+    EXPECT_FALSE(threads.enabled());
+    EXPECT_EQ(1, (int)finished3.size());
+
+    threads.config_ = NULL;
+}
+
+VOID TEST(AppIngestThreadTest, ThreadOfAlignedKeys)
+{
+    srs_error_t err = srs_success;
+
+    MockIngestThreadConfig config;
+    SrsIngestThreads threads;
+    threads.config_ = &config;
+
+    HELPER_EXPECT_SUCCESS(threads.start());
+    ASSERT_EQ(2, (int)threads.threads_.size());
+
+    // The keys are pointers of streams, which are aligned, but still spread over all threads.
+    int nn_first = 0;
+    for (uint64_t i = 1; i <= 64; i++) {
+        uint64_t key = ((uint64_t)0x7f00 << 32) + i * 64;
+        if (threads.thread_of(key) == threads.threads_[0]) {
+            nn_first++;
+        }
+        EXPECT_EQ(threads.thread_of(key), threads.thread_of(key));
+    }
+    EXPECT_GT(nn_first, 0);
+    EXPECT_LT(nn_first, 64);
+
+    threads.stop();
+    threads.config_ = NULL;
+}
+
+// The ingest threads which execute and finish the task in place, and count the tasks.
+class MockBatchIngestThreads : public ISrsIngestThreads
+{
+public:
+    int nn_submits_;
+    int nn_drains_;
+
+public:
+    MockBatchIngestThreads()
+    {
+        nn_submits_ = 0;
+        nn_drains_ = 0;
+    }
+    virtual ~MockBatchIngestThreads()
+    {
+    }
+
+public:
+    virtual srs_error_t start() { return srs_success; }
+    virtual void stop() {}
+    virtual bool enabled() { return true; }
+    virtual void submit(ISrsIngestTask *task, uint64_t key)
+    {
+        nn_submits_++;
+        task->execute();
+        srs_error_t err = task->finish();
+        srs_freep(err);
+        srs_freep(task);
+    }
+    virtual void drain(uint64_t key) { nn_drains_++; }
+};
+
+VOID TEST(AppIngestThreadTest, SrtFrameBuilderBatch)
+{
+    srs_error_t err = srs_success;
+
+    char data[SRS_TS_PACKET_SIZE * 7];
+    memset(data, 0, sizeof(data));
+
+    SrsSrtPacket pkt;
+    pkt.wrap(data, sizeof(data));
+
+    MockBatchIngestThreads threads;
+    SrsSrtFrameBuilder builder(NULL);
+    builder.ingest_threads_ = &threads;
+
+    // The packets of one wakeup are demuxed by one task, when flush.
+    for (int i = 0; i < 3; i++) {
+        HELPER_EXPECT_SUCCESS(builder.on_srt_packet(&pkt));
+    }
+    EXPECT_EQ(0, threads.nn_submits_);
+    ASSERT_TRUE(builder.batch_ != NULL);
+    EXPECT_EQ(3 * (int)sizeof(data), builder.batch_->size());
+
+    builder.flush();
+    EXPECT_EQ(1, threads.nn_submits_);
+    EXPECT_TRUE(builder.batch_ == NULL);
+
+    // Never submit empty batch.
+    builder.flush();
+    EXPECT_EQ(1, threads.nn_submits_);
+
+    // Submit the batch when full, without flush.
+    int nn_full = SRS_SRT_DEMUX_BATCH_SIZE / (int)sizeof(data);
+    for (int i = 0; i < nn_full; i++) {
+        HELPER_EXPECT_SUCCESS(builder.on_srt_packet(&pkt));
+    }
+    EXPECT_EQ(2, threads.nn_submits_);
+    EXPECT_TRUE(builder.batch_ == NULL);
+
+    // The pending batch is submitted before drain, when unpublish.
+    HELPER_EXPECT_SUCCESS(builder.on_srt_packet(&pkt));
+    builder.on_unpublish();
+    EXPECT_EQ(3, threads.nn_submits_);
+    EXPECT_EQ(1, threads.nn_drains_);
+    EXPECT_TRUE(builder.batch_ == NULL);
+
+    builder.ingest_threads_ = NULL;
+}
+
+VOID TEST(AppIngestThreadTest, SrtDemuxTask)
+{
+    srs_error_t err = srs_success;
+
+    SrsTsContext ctx;
+
+    // The invalid TS packets are demuxed with errors, which are ignored when finish.
+    char data[SRS_TS_PACKET_SIZE * 2];
+    memset(data, 0, sizeof(data));
+
+    SrsSrtPacket pkt;
+    pkt.wrap(data, sizeof(data));
+
+    // The packets are appended to the batch, and demuxed by one task.
+    SrsSrtDemuxTask task(NULL, &ctx);
+    task.append(&pkt);
+    task.append(&pkt);
+    EXPECT_EQ(SRS_TS_PACKET_SIZE * 4, task.size());
+
+    task.execute();
+    EXPECT_EQ(4, (int)task.errs_.size());
+    EXPECT_TRUE(task.msgs_.empty());
+
+    HELPER_EXPECT_SUCCESS(task.finish());
+}
+
+void *mock_srt_demux_thread(void *arg)
+{
+    SrsSrtDemuxTask *task = (SrsSrtDemuxTask *)arg;
+    for (int i = 0; i < 100; i++) {
+        task->execute();
+    }
+    return NULL;
+}
+
+VOID TEST(AppIngestThreadTest, SrtDemuxTaskByThreads)
+{
+    srs_error_t err = srs_success;
+
+    char data[SRS_TS_PACKET_SIZE * 2];
+    memset(data, 0, sizeof(data));
+
+    SrsSrtPacket pkt;
+    pkt.wrap(data, sizeof(data));
+
+    // The demux errors are created by threads at the same time, each with its own message.
+    SrsTsContext ctx0, ctx1;
+    SrsSrtDemuxTask task0(NULL, &ctx0);
+    SrsSrtDemuxTask task1(NULL, &ctx1);
+    task0.append(&pkt);
+    task1.append(&pkt);
+
+    pthread_t trd0, trd1;
+    EXPECT_EQ(0, pthread_create(&trd0, NULL, mock_srt_demux_thread, &task0));
+    EXPECT_EQ(0, pthread_create(&trd1, NULL, mock_srt_demux_thread, &task1));
+    pthread_join(trd0, NULL);
+    pthread_join(trd1, NULL);
+
+    EXPECT_EQ(200, (int)task0.errs_.size());
+    EXPECT_EQ(200, (int)task1.errs_.size());
+    for (int i = 0; i < (int)task0.errs_.size(); i++) {
+        EXPECT_EQ(srs_error_desc(task0.errs_[0]), srs_error_desc(task0.errs_[i]));
+        EXPECT_EQ(srs_error_desc(task0.errs_[i]), srs_error_desc(task1.errs_[i]));
+    }
+
+    HELPER_EXPECT_SUCCESS(task0.finish());
+    HELPER_EXPECT_SUCCESS(task1.finish());
+}
+
+VOID TEST(AppIngestThreadTest, SrtRecvBuffers)
+{
+    SrsSrtRecvBuffers buffers(4);
+    EXPECT_EQ(4, buffers.size());
+
+    iovec *iovs = buffers.prepare();
+    EXPECT_EQ(SRS_SRT_MAX_MSG_SIZE, (int)iovs[0].iov_len);
+    iovs[0].iov_len = 188;
+    iovs[1].iov_len = 376;
+    EXPECT_EQ(188, buffers.length(0));
+    EXPECT_EQ(376, buffers.length(1));
+
+    // Detach the buffer to packet without copy, and the slot is refilled.
+    char *buf = (char *)iovs[0].iov_base;
+    char *unused = (char *)iovs[1].iov_base;
+    SrsObjectPool *pool = buffers.pool();
+
+    int nn_free = 0;
+    if (true) {
+        SrsSrtPacket pkt;
+        pkt.attach(buffers.detach(0), 188, pool);
+        EXPECT_EQ(buf, pkt.data());
+        EXPECT_EQ(188, pkt.size());
+        nn_free = pool->nn_free();
+
+        iovs = buffers.prepare();
+        EXPECT_NE(buf, iovs[0].iov_base);
+        EXPECT_EQ(SRS_SRT_MAX_MSG_SIZE, (int)iovs[0].iov_len);
+
+        // The unused buffer is reused by next batch.
+        EXPECT_EQ(unused, iovs[1].iov_base);
+        EXPECT_EQ(SRS_SRT_MAX_MSG_SIZE, (int)iovs[1].iov_len);
+
+        // The copy shares the buffer, which is released when the last one is freed.
+        SrsUniquePtr<SrsSrtPacket> cp(pkt.copy());
+        EXPECT_EQ(buf, cp->data());
+    }
+
+    // The buffer is released back to pool, and reused when refill the slot.
+    EXPECT_EQ(nn_free + 1, pool->nn_free());
+
+    char *detached = buffers.detach(0);
+    EXPECT_EQ(buf, buffers.prepare()[0].iov_base);
+    pool->deallocate(detached, SRS_SRT_MAX_MSG_SIZE);
+}
+
+VOID TEST(AppLogTest, LogRing)
+{
+    SrsLogRing ring(10);
+    EXPECT_EQ(16, ring.capacity());
+    EXPECT_EQ(0, ring.size());
+
+    iovec iovs[2];
+    int iovcnt = 0;
+    EXPECT_EQ(0, ring.peek(iovs, &iovcnt));
+    EXPECT_EQ(0, iovcnt);
+
+    EXPECT_TRUE(ring.write("0123456789", 10));
+    EXPECT_FALSE(ring.write("0123456789", 10));
+    EXPECT_EQ(10, ring.peek(iovs, &iovcnt));
+    EXPECT_EQ(1, iovcnt);
+    ring.consume(10);
+
+    // Wrap around, in two iovecs.
+    EXPECT_TRUE(ring.write("abcdefghij", 10));
+    EXPECT_EQ(10, ring.peek(iovs, &iovcnt));
+    ASSERT_EQ(2, iovcnt);
+    EXPECT_EQ(6, (int)iovs[0].iov_len);
+    EXPECT_EQ(0, memcmp(iovs[0].iov_base, "abcdef", 6));
+    EXPECT_EQ(4, (int)iovs[1].iov_len);
+    EXPECT_EQ(0, memcmp(iovs[1].iov_base, "ghij", 4));
+    ring.consume(10);
+    EXPECT_EQ(0, ring.size());
+}
+
+// Write a log by the file log, like srs_trace.
+void srs_utest_write_log(SrsFileLog *log, SrsLogLevel level, const char *fmt, ...)
+{
+    va_list ap;
+    va_start(ap, fmt);
+    log->log(level, NULL, _srs_context->get_id(), fmt, ap);
+    va_end(ap);
+}
+
+VOID TEST(AppLogTest, AsyncLog)
+{
+    srs_error_t err = srs_success;
+
+    string filename = _srs_tmp_file_prefix + "utest-async.log";
+    ::unlink(filename.c_str());
+
+    SrsFileLog log;
+    log.log_to_file_tank_ = true;
+    log.filename_ = filename;
+    HELPER_EXPECT_SUCCESS(log.start_flusher(64 * 1024));
+
+    for (int i = 0; i < 100; i++) {
+        srs_utest_write_log(&log, SrsLogLevelTrace, "async log %d", i);
+    }
+
+    // The logs in ring are written out when stop.
+    log.stop_async();
+    EXPECT_TRUE(log.ring_ == NULL);
+    EXPECT_EQ(0, log.dropped());
+
+    SrsFileReader fr;
+    HELPER_EXPECT_SUCCESS(fr.open(filename));
+    string data(fr.filesize(), 0);
+    ssize_t nread = 0;
+    HELPER_EXPECT_SUCCESS(fr.read((void *)data.data(), data.size(), &nread));
+    EXPECT_TRUE(data.find("async log 0\n") != string::npos);
+    EXPECT_TRUE(data.find("async log 99\n") != string::npos);
+    fr.close();
+
+    ::unlink(filename.c_str());
+}
+
+VOID TEST(AppLogTest, LimitAndDrop)
+{
+    srs_error_t err;
+
+    // Drop the lines exceed the limit of level in a second.
+    if (true) {
+        SrsFileLog log;
+        log.limit_ = 2;
+        EXPECT_FALSE(log.is_limited(SrsLogLevelWarn));
+        EXPECT_FALSE(log.is_limited(SrsLogLevelWarn));
+        srs_utest_write_log(&log, SrsLogLevelWarn, "limited");
+        EXPECT_EQ(1, log.dropped());
+
+        // The other levels are not limited.
+        EXPECT_FALSE(log.is_limited(SrsLogLevelError));
+        EXPECT_FALSE(log.is_limited(SrsLogLevelVerbose));
+        EXPECT_EQ(1, log.dropped());
+    }
+
+    // Drop the lines when ring is full, and never block.
+    if (true) {
+        SrsFileLog log;
+        log.log_to_file_tank_ = true;
+        log.ring_ = new SrsLogRing(64);
+
+        char line[] = "0123456789012345678901234567890123456789";
+        log.write_ring(line, 40);
+        EXPECT_EQ(41, log.ring_->size());
+        EXPECT_EQ(0, log.dropped());
+
+        char line2[] = "0123456789012345678901234567890123456789";
+        log.write_ring(line2, 40);
+        EXPECT_EQ(1, log.dropped());
+        srs_freep(log.ring_);
+    }
+
+    // Write the line to file directly when ring is full, in block mode.
+    if (true) {
+        string filename = _srs_tmp_file_prefix + "utest-block.log";
+        ::unlink(filename.c_str());
+
+        SrsFileLog log;
+        log.log_to_file_tank_ = true;
+        log.block_ = true;
+        log.ring_ = new SrsLogRing(64);
+        log.fd_ = ::open(filename.c_str(), O_RDWR | O_CREAT | O_APPEND, S_IRUSR | S_IWUSR);
+
+        char line[] = "0123456789012345678901234567890123456789";
+        log.write_ring(line, 40);
+        char line2[] = "0123456789012345678901234567890123456789";
+        log.write_ring(line2, 40);
+        EXPECT_EQ(41, log.ring_->size());
+        EXPECT_EQ(0, log.dropped());
+        srs_freep(log.ring_);
+
+        SrsFileReader fr;
+        HELPER_EXPECT_SUCCESS(fr.open(filename));
+        EXPECT_EQ(41, fr.filesize());
+        fr.close();
+
+        ::unlink(filename.c_str());
+    }
+}
+
 VOID TEST(AppSecurity, CheckSecurity)
 {
     srs_error_t err;
@@ -891,3 +1648,226 @@ VOID TEST(AppSecurity, CheckSecurity)
     //       3. allow if matches allow strategy.
     //       4. deny if matches deny strategy.
 }
+
+VOID TEST(AppHlsLowLatencyTest, ParseUri)
+{
+    string m3u8;
+    int msn = -1, part = -1;
+
+    EXPECT_TRUE(srs_hls_ll_parse_uri("/live/livestream.10.2.ts", m3u8, msn, part));
+    EXPECT_STREQ("/live/livestream.m3u8", m3u8.c_str());
+    EXPECT_EQ(10, msn);
+    EXPECT_EQ(2, part);
+
+    EXPECT_TRUE(srs_hls_ll_parse_uri("/live/livestream.10.ts", m3u8, msn, part));
+    EXPECT_STREQ("/live/livestream.m3u8", m3u8.c_str());
+    EXPECT_EQ(10, msn);
+    EXPECT_EQ(-1, part);
+
+    EXPECT_FALSE(srs_hls_ll_parse_uri("/live/livestream-10.ts", m3u8, msn, part));
+    EXPECT_FALSE(srs_hls_ll_parse_uri("/live/.10.ts", m3u8, msn, part));
+    EXPECT_FALSE(srs_hls_ll_parse_uri("/live/livestream.10.m4s", m3u8, msn, part));
+}
+
+VOID TEST(AppHlsLowLatencyTest, PartsAndPlaylist)
+{
+    srs_error_t err;
+
+    SrsHlsLowLatency ll("livestream", 500 * SRS_UTIME_MILLISECONDS);
+    ll.set_target_duration(2 * SRS_UTIME_SECONDS);
+    EXPECT_EQ(-1, ll.last_msn());
+    EXPECT_TRUE(ll.playlist().empty());
+
+    // Segment 0, frames every 100ms, the part is finished before exceeding 500ms.
+    ll.on_segment_open(0);
+    for (int i = 0; i < 10; i++) {
+        ll.on_frame(i * 100, i == 0 || i == 5);
+        HELPER_EXPECT_SUCCESS(ll.write((void *)"ab", 2));
+    }
+    EXPECT_EQ(0, ll.last_msn());
+    EXPECT_TRUE(ll.has(0, 0));
+    EXPECT_FALSE(ll.has(0, 1));
+    EXPECT_FALSE(ll.has(0, -1));
+
+    ll.on_segment_close(1000 * SRS_UTIME_MILLISECONDS);
+    EXPECT_TRUE(ll.has(0, 1));
+    EXPECT_TRUE(ll.has(0, -1));
+    EXPECT_FALSE(ll.has(0, 2));
+
+    // The parts of segment.
+    if (true) {
+        std::vector<SrsSharedPtr<SrsMemoryBlock> > blocks;
+        EXPECT_TRUE(ll.fetch(0, 1, blocks));
+        ASSERT_EQ(1, (int)blocks.size());
+        EXPECT_EQ(10, blocks[0]->size());
+        EXPECT_EQ(0, memcmp("ababababab", blocks[0]->payload(), 10));
+    }
+
+    // The whole segment is all parts.
+    if (true) {
+        std::vector<SrsSharedPtr<SrsMemoryBlock> > blocks;
+        EXPECT_TRUE(ll.fetch(0, -1, blocks));
+        EXPECT_EQ(2, (int)blocks.size());
+        EXPECT_FALSE(ll.fetch(0, 2, blocks));
+        EXPECT_FALSE(ll.fetch(1, -1, blocks));
+    }
+
+    // Segment 1 with one part, which is not completed.
+    ll.on_segment_open(1);
+    ll.on_discontinuity();
+    ll.on_frame(1000, true);
+    HELPER_EXPECT_SUCCESS(ll.write((void *)"cd", 2));
+    ll.on_frame(1600, false);
+    HELPER_EXPECT_SUCCESS(ll.write((void *)"cd", 2));
+    EXPECT_TRUE(ll.has(0, 2));
+    EXPECT_TRUE(ll.has(1, 0));
+    EXPECT_FALSE(ll.has(1, -1));
+
+    string playlist = ll.playlist();
+    EXPECT_TRUE(playlist.find("#EXT-X-PART-INF:PART-TARGET=0.500") != string::npos);
+    EXPECT_TRUE(playlist.find("#EXT-X-MEDIA-SEQUENCE:0") != string::npos);
+    EXPECT_TRUE(playlist.find("#EXT-X-PART:DURATION=0.500,URI=\"livestream.0.0.ts\",INDEPENDENT=YES") != string::npos);
+    EXPECT_TRUE(playlist.find("#EXT-X-PART:DURATION=0.500,URI=\"livestream.0.1.ts\",INDEPENDENT=YES") != string::npos);
+    EXPECT_TRUE(playlist.find("#EXTINF:1.000, no desc\nlivestream.0.ts") != string::npos);
+    EXPECT_TRUE(playlist.find("#EXT-X-DISCONTINUITY\n#EXT-X-PART:DURATION=0.600,URI=\"livestream.1.0.ts\",INDEPENDENT=YES") != string::npos);
+    EXPECT_TRUE(playlist.find("#EXT-X-PRELOAD-HINT:TYPE=PART,URI=\"livestream.1.1.ts\"") != string::npos);
+
+    // Remove the expired segment.
+    ll.shrink(1);
+    if (true) {
+        std::vector<SrsSharedPtr<SrsMemoryBlock> > blocks;
+        EXPECT_FALSE(ll.fetch(0, 0, blocks));
+        EXPECT_TRUE(ll.has(0, -1));
+    }
+    EXPECT_TRUE(ll.playlist().find("#EXT-X-MEDIA-SEQUENCE:1") != string::npos);
+
+    EXPECT_FALSE(ll.eof());
+    ll.on_unpublish();
+    EXPECT_TRUE(ll.eof());
+}
+
+VOID TEST(AppSegmentCacheTest, PutFetchAndEvict)
+{
+    MockAppConfig config;
+    config.segment_cache_size_ = 10;
+
+    SrsSegmentCache cache;
+    cache.config_ = &config;
+    EXPECT_TRUE(cache.enabled("__defaultVhost__"));
+
+    SrsSharedPtr<SrsMemoryBlock> data(NULL);
+    string etag;
+    EXPECT_FALSE(cache.fetch("./live/livestream-0.ts", data, etag));
+    EXPECT_EQ(1, cache.nn_misses_);
+
+    cache.put("__defaultVhost__", "./live/livestream-0.ts", string("0123"));
+    cache.put("__defaultVhost__", "./live/livestream-1.ts", string("4567"));
+    EXPECT_TRUE(cache.fetch("./live/livestream-0.ts", data, etag));
+    EXPECT_EQ(4, data->size());
+    EXPECT_EQ(0, memcmp("0123", data->payload(), 4));
+    EXPECT_FALSE(etag.empty());
+    EXPECT_EQ(1, cache.nn_hits_);
+    EXPECT_EQ(4, cache.hit_bytes_);
+
+    // The livestream-1.ts is least recently used, so it's evicted.
+    cache.put("__defaultVhost__", "./live/livestream-2.ts", string("89ab"));
+    EXPECT_EQ(1, cache.nn_evicts_);
+    EXPECT_FALSE(cache.fetch("./live/livestream-1.ts", data, etag));
+    EXPECT_TRUE(cache.fetch("./live/livestream-0.ts", data, etag));
+    EXPECT_TRUE(cache.fetch("./live/livestream-2.ts", data, etag));
+
+    // The content is replaced, with a different etag.
+    string etag2;
+    cache.put("__defaultVhost__", "./live/livestream-2.ts", string("cdef"));
+    EXPECT_TRUE(cache.fetch("./live/livestream-2.ts", data, etag2));
+    EXPECT_STRNE(etag.c_str(), etag2.c_str());
+    EXPECT_EQ(8, cache.fetch_vhost("__defaultVhost__")->size_);
+
+    // Ignore the file larger than the budget.
+    cache.put("__defaultVhost__", "./live/livestream.m3u8", string("0123456789abcdef"));
+    EXPECT_FALSE(cache.fetch("./live/livestream.m3u8", data, etag));
+    EXPECT_EQ(2, (int)cache.entries_.size());
+
+    cache.remove("./live/livestream-0.ts");
+    EXPECT_FALSE(cache.fetch("./live/livestream-0.ts", data, etag));
+    EXPECT_EQ(4, cache.fetch_vhost("__defaultVhost__")->size_);
+
+    cache.config_ = NULL;
+}
+
+VOID TEST(AppSegmentCacheTest, ReloadBudget)
+{
+    srs_error_t err;
+
+    MockAppConfig config;
+    config.segment_cache_size_ = 10;
+
+    SrsSegmentCache cache;
+    cache.config_ = &config;
+
+    cache.put("__defaultVhost__", "./live/livestream-0.ts", string("0123"));
+    cache.put("__defaultVhost__", "./live/livestream-1.ts", string("4567"));
+    EXPECT_EQ(8, cache.fetch_vhost("__defaultVhost__")->size_);
+
+    // Ignore the vhost without entries.
+    HELPER_EXPECT_SUCCESS(cache.on_reload_vhost_segment_cache("other"));
+
+    // The budget is reduced by reload, evict the least recently used entries.
+    config.segment_cache_size_ = 5;
+    HELPER_EXPECT_SUCCESS(cache.on_reload_vhost_segment_cache("__defaultVhost__"));
+    EXPECT_EQ(4, cache.fetch_vhost("__defaultVhost__")->size_);
+    EXPECT_EQ(1, (int)cache.entries_.size());
+    EXPECT_TRUE(cache.entries_.find("./live/livestream-1.ts") != cache.entries_.end());
+
+    // The cache is disabled by reload, evict all entries.
+    config.segment_cache_size_ = 0;
+    HELPER_EXPECT_SUCCESS(cache.on_reload_vhost_segment_cache("__defaultVhost__"));
+    EXPECT_EQ(0, cache.fetch_vhost("__defaultVhost__")->size_);
+    EXPECT_TRUE(cache.entries_.empty());
+
+    cache.config_ = NULL;
+}
+
+VOID TEST(AppSegmentCacheTest, WriterOnReap)
+{
+    srs_error_t err;
+
+    MockAppConfig config;
+    config.segment_cache_size_ = 1024;
+
+    SrsSegmentCache cache;
+    cache.config_ = &config;
+
+    SrsSegmentCacheWriter writer("__defaultVhost__", new MockSrsFileWriter());
+    writer.cache_ = &cache;
+
+    // Write the data, then overwrite the header by seek back, like the size of mp4 box.
+    HELPER_EXPECT_SUCCESS(writer.open("./live/livestream-0.m4s.tmp"));
+    HELPER_EXPECT_SUCCESS(writer.write((void *)"xxxxbody", 8, NULL));
+    HELPER_EXPECT_SUCCESS(writer.lseek(0, SEEK_SET, NULL));
+    HELPER_EXPECT_SUCCESS(writer.write((void *)"head", 4, NULL));
+    writer.close();
+    writer.on_reap("./live/livestream-0.m4s");
+
+    SrsSharedPtr<SrsMemoryBlock> data(NULL);
+    string etag;
+    EXPECT_TRUE(cache.fetch("./live/livestream-0.m4s", data, etag));
+    ASSERT_EQ(8, data->size());
+    EXPECT_EQ(0, memcmp("headbody", data->payload(), 8));
+
+    // Seek beyond the end, the data is not cached.
+    SrsSegmentCacheWriter writer2("__defaultVhost__", new MockSrsFileWriter());
+    writer2.cache_ = &cache;
+
+    HELPER_EXPECT_SUCCESS(writer2.open("./live/livestream-1.m4s.tmp"));
+    HELPER_EXPECT_SUCCESS(writer2.write((void *)"body", 4, NULL));
+    writer2.seek2(8);
+    HELPER_EXPECT_SUCCESS(writer2.write((void *)"tail", 4, NULL));
+    writer2.close();
+    writer2.on_reap("./live/livestream-1.m4s");
+    EXPECT_FALSE(cache.fetch("./live/livestream-1.m4s", data, etag));
+
+    writer.cache_ = NULL;
+    writer2.cache_ = NULL;
+    cache.config_ = NULL;
+}
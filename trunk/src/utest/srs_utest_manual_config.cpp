@@ -3914,6 +3914,16 @@ VOID TEST(ConfigMainTest, CheckVhostConfig5)
         EXPECT_STREQ("xxx2", conf.get_vhost_http_dir("ossrs.net").c_str());
     }
 
+    if (true) {
+        MockSrsConfig conf;
+        HELPER_ASSERT_SUCCESS(conf.mock_parse(_MIN_OK_CONF "vhost ossrs.net{http_static{segment_cache 64;}}"));
+        EXPECT_EQ(64 * 1024 * 1024, conf.get_vhost_http_segment_cache("ossrs.net"));
+        EXPECT_EQ(0, conf.get_vhost_http_segment_cache("other.net"));
+
+        SrsSetEnvConfig(conf, segment_cache, "SRS_VHOST_HTTP_STATIC_SEGMENT_CACHE", "8");
+        EXPECT_EQ(8 * 1024 * 1024, conf.get_vhost_http_segment_cache("ossrs.net"));
+    }
+
     if (true) {
         MockSrsConfig conf;
         HELPER_ASSERT_SUCCESS(conf.mock_parse(_MIN_OK_CONF "vhost ossrs.net{http_remux{enabled on;fast_cache 10;mount xxx;}}"));
@@ -5407,3 +5417,50 @@ VOID TEST(ConfigEnvTest, CheckEnvValuesHooksWithWhitespaces)
         ASSERT_STREQ("dvr", dir->arg0().c_str());
     }
 }
+
+VOID TEST(ConfigMainTest, CheckVhostSnapshot)
+{
+    srs_error_t err;
+
+    MockSrsConfig conf;
+    HELPER_ASSERT_SUCCESS(conf.mock_parse(_MIN_OK_CONF "vhost v1{play{gop_cache off;queue_length 20;}rtc{enabled on;}} "
+                                                       "vhost __defaultVhost__{cluster{mode remote;}}"));
+
+    // The compiled values, and the vhost not in config fallback to default vhost.
+    SrsSharedPtr<SrsConfigSnapshot> snapshot = conf.snapshot();
+    SrsVhostSnapshot *v1 = snapshot->vhost("v1");
+    EXPECT_FALSE(v1->gop_cache_);
+    EXPECT_EQ(20 * SRS_UTIME_SECONDS, v1->queue_length_);
+    EXPECT_TRUE(v1->rtc_enabled_);
+    EXPECT_FALSE(v1->is_edge_);
+
+    SrsVhostSnapshot *v2 = snapshot->vhost("v2");
+    EXPECT_TRUE(v2->gop_cache_);
+    EXPECT_TRUE(v2->is_edge_);
+    EXPECT_FALSE(v2->rtc_enabled_);
+    EXPECT_TRUE(snapshot->vhost(SRS_CONSTS_RTMP_DEFAULT_VHOST)->is_edge_);
+
+    // The getters read the compiled values.
+    EXPECT_FALSE(conf.get_gop_cache("v1"));
+    EXPECT_TRUE(conf.get_rtc_enabled("v1"));
+    EXPECT_TRUE(conf.get_vhost_is_edge("v2"));
+    EXPECT_TRUE(conf.get_vhost("v2") == conf.get_vhost(SRS_CONSTS_RTMP_DEFAULT_VHOST));
+    EXPECT_TRUE(conf.get_vhost("v2", false) == NULL);
+
+    // The held snapshot is not changed by parsing new config.
+    HELPER_ASSERT_SUCCESS(conf.mock_parse(_MIN_OK_CONF "vhost v1{play{gop_cache on;}}"));
+    EXPECT_TRUE(conf.get_gop_cache("v1"));
+    EXPECT_FALSE(conf.get_rtc_enabled("v1"));
+    EXPECT_FALSE(conf.get_vhost_is_edge("v2"));
+    EXPECT_FALSE(v1->gop_cache_);
+    EXPECT_TRUE(v1->rtc_enabled_);
+    EXPECT_TRUE(snapshot->vhost("v2")->is_edge_);
+
+    // The env overrides are resolved when compiling.
+    if (true) {
+        SrsSetEnvConfig(conf, gop_cache, "SRS_VHOST_PLAY_GOP_CACHE", "off");
+        EXPECT_FALSE(conf.get_gop_cache("v1"));
+        EXPECT_FALSE(conf.snapshot()->vhost("v1")->gop_cache_);
+    }
+    EXPECT_TRUE(conf.get_gop_cache("v1"));
+}
@@ -60,12 +60,14 @@ public:
         conf = c;
         key = k;
         srs_setenv(k, v, overwrite);
+        conf->snapshot_ = SrsSharedPtr<SrsConfigSnapshot>(NULL);
     }
     virtual ~ISrsSetEnvConfig()
     {
         srs_unsetenv(key);
         srs_freep(conf->env_cache_);
         conf->env_cache_ = new SrsConfDirective();
+        conf->snapshot_ = SrsSharedPtr<SrsConfigSnapshot>(NULL);
     }
 
 // clang-format off
@@ -3428,6 +3428,38 @@ VOID TEST(ConfigMainTest, CheckTcmallocReleaseRate)
     }
 }
 
+VOID TEST(ConfigMainTest, CheckWorkers)
+{
+    srs_error_t err;
+
+    // Test default values when no workers section
+    if (true) {
+        MockSrsConfig conf;
+        HELPER_ASSERT_SUCCESS(conf.mock_parse(_MIN_OK_CONF));
+        EXPECT_FALSE(conf.get_workers_enabled());
+        EXPECT_EQ(0, conf.get_workers_count());
+        EXPECT_TRUE(conf.get_workers_cpu_affinity());
+        EXPECT_EQ(19350, conf.get_workers_relay_port());
+    }
+
+    // Test workers with custom values
+    if (true) {
+        MockSrsConfig conf;
+        HELPER_ASSERT_SUCCESS(conf.mock_parse(_MIN_OK_CONF "workers{enabled on; count 4; cpu_affinity off; relay_port 29350;}"));
+        EXPECT_TRUE(conf.get_workers_enabled());
+        EXPECT_EQ(4, conf.get_workers_count());
+        EXPECT_FALSE(conf.get_workers_cpu_affinity());
+        EXPECT_EQ(29350, conf.get_workers_relay_port());
+    }
+
+    // Test invalid count falls back to 0, the number of CPUs
+    if (true) {
+        MockSrsConfig conf;
+        HELPER_ASSERT_SUCCESS(conf.mock_parse(_MIN_OK_CONF "workers{count -1;}"));
+        EXPECT_EQ(0, conf.get_workers_count());
+    }
+}
+
 VOID TEST(ConfigMainTest, CheckCircuitBreakerEnabled)
 {
     srs_error_t err;
@@ -4784,6 +4816,73 @@ VOID TEST(ConfigRtcServerTest, CheckRtcServerMergeNalus)
     }
 }
 
+VOID TEST(ConfigRtcServerTest, CheckRtcServerRecvmmsg)
+{
+    srs_error_t err;
+
+    // Test default value (16) when no rtc_server section
+    if (true) {
+        MockSrsConfig conf;
+        HELPER_ASSERT_SUCCESS(conf.mock_parse(_MIN_OK_CONF));
+        EXPECT_EQ(16, conf.get_rtc_server_recvmmsg());
+    }
+
+    // Test default value (16) when rtc_server section exists but no recvmmsg directive
+    if (true) {
+        MockSrsConfig conf;
+        HELPER_ASSERT_SUCCESS(conf.mock_parse(_MIN_OK_CONF "rtc_server{enabled on;}"));
+        EXPECT_EQ(16, conf.get_rtc_server_recvmmsg());
+    }
+
+    // Test recvmmsg disabled by 1
+    if (true) {
+        MockSrsConfig conf;
+        HELPER_ASSERT_SUCCESS(conf.mock_parse(_MIN_OK_CONF "rtc_server{recvmmsg 1;}"));
+        EXPECT_EQ(1, conf.get_rtc_server_recvmmsg());
+    }
+
+    // Test recvmmsg with custom value
+    if (true) {
+        MockSrsConfig conf;
+        HELPER_ASSERT_SUCCESS(conf.mock_parse(_MIN_OK_CONF "rtc_server{recvmmsg 32;}"));
+        EXPECT_EQ(32, conf.get_rtc_server_recvmmsg());
+    }
+
+    // Test recvmmsg overwrite by env.
+    if (true) {
+        MockSrsConfig conf;
+        HELPER_ASSERT_SUCCESS(conf.mock_parse(_MIN_OK_CONF "rtc_server{recvmmsg 32;}"));
+
+        SrsSetEnvConfig(conf, recvmmsg, "SRS_RTC_SERVER_RECVMMSG", "8");
+        EXPECT_EQ(8, conf.get_rtc_server_recvmmsg());
+    }
+}
+
+VOID TEST(ConfigRtcServerTest, CheckRtcServerSendmmsg)
+{
+    srs_error_t err;
+
+    if (true) {
+        MockSrsConfig conf;
+        HELPER_ASSERT_SUCCESS(conf.mock_parse(_MIN_OK_CONF));
+        EXPECT_EQ(16, conf.get_rtc_server_sendmmsg());
+    }
+
+    if (true) {
+        MockSrsConfig conf;
+        HELPER_ASSERT_SUCCESS(conf.mock_parse(_MIN_OK_CONF "rtc_server{sendmmsg 64;}"));
+        EXPECT_EQ(64, conf.get_rtc_server_sendmmsg());
+    }
+
+    if (true) {
+        MockSrsConfig conf;
+        HELPER_ASSERT_SUCCESS(conf.mock_parse(_MIN_OK_CONF "rtc_server{sendmmsg 64;}"));
+
+        SrsSetEnvConfig(conf, sendmmsg, "SRS_RTC_SERVER_SENDMMSG", "8");
+        EXPECT_EQ(8, conf.get_rtc_server_sendmmsg());
+    }
+}
+
 VOID TEST(ConfigRtcServerTest, CheckRtcServerBlackHole)
 {
     srs_error_t err;
@@ -335,6 +335,75 @@ VOID TEST(CoreSmartPtr, SharedPtrAssign)
     EXPECT_EQ(200, *ptr1);
 }
 
+class MockSharedObject : public SrsSharedObject
+{
+public:
+    int *ptr;
+
+public:
+    MockSharedObject(int *p)
+    {
+        ptr = p;
+        *ptr = *ptr + 1;
+    }
+    ~MockSharedObject()
+    {
+        *ptr = *ptr - 1;
+    }
+};
+
+VOID TEST(CoreSmartPtr, SharedPtrIntrusive)
+{
+    int counter = 0;
+
+    // The count is in the object, never allocated.
+    if (true) {
+        SrsSharedPtr<MockSharedObject> p(new MockSharedObject(&counter));
+        EXPECT_EQ(1, counter);
+        EXPECT_FALSE(p.own_count_);
+        EXPECT_TRUE(p.ref_count_ == srs_shared_count(p.get()));
+        EXPECT_EQ(1, (int)*p.ref_count_);
+
+        SrsSharedPtr<MockSharedObject> q = p;
+        EXPECT_EQ(2, (int)*p.ref_count_);
+
+        SrsSharedPtr<MockSharedObject> r(NULL);
+        r = q;
+        EXPECT_EQ(3, (int)*p.ref_count_);
+        EXPECT_FALSE(r.own_count_);
+
+        r.reset();
+        EXPECT_EQ(2, (int)*p.ref_count_);
+        EXPECT_EQ(1, counter);
+    }
+    EXPECT_EQ(0, counter);
+
+    // The count of object is never copied.
+    if (true) {
+        SrsSharedObject o;
+        *srs_shared_count(&o) = 3;
+
+        SrsSharedObject cp(o);
+        EXPECT_EQ(0, (int)*srs_shared_count(&cp));
+
+        cp = o;
+        EXPECT_EQ(0, (int)*srs_shared_count(&cp));
+        EXPECT_EQ(3, (int)*srs_shared_count(&o));
+    }
+
+    // The count is allocated for other objects, and none for NULL.
+    if (true) {
+        SrsSharedPtr<int> p(new int(100));
+        EXPECT_TRUE(p.own_count_);
+
+        SrsSharedPtr<int> q(NULL);
+        EXPECT_TRUE(q.ref_count_ == NULL);
+        q = p;
+        EXPECT_TRUE(q.own_count_);
+        EXPECT_EQ(2, (int)*p.ref_count_);
+    }
+}
+
 template <typename T>
 SrsSharedPtr<T> mock_shared_ptr_move_assign(SrsSharedPtr<T> p)
 {
@@ -35,7 +35,7 @@ MockSrsFormat::MockSrsFormat()
     initialize();
 
     // Setup video sequence header (H.264 AVC)
-    uint8_t video_raw[] = {
+    static uint8_t video_raw[] = {
         0x17,
         0x00, 0x00, 0x00, 0x00, 0x01, 0x64, 0x00, 0x20, 0xff, 0xe1, 0x00, 0x19, 0x67, 0x64, 0x00, 0x20,
         0xac, 0xd9, 0x40, 0xc0, 0x29, 0xb0, 0x11, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00,
@@ -43,7 +43,7 @@ MockSrsFormat::MockSrsFormat()
     on_video(0, (char *)video_raw, sizeof(video_raw));
 
     // Setup audio sequence header (AAC)
-    uint8_t audio_raw[] = {
+    static uint8_t audio_raw[] = {
         0xaf, 0x00, 0x12, 0x10};
     on_audio(0, (char *)audio_raw, sizeof(audio_raw));
 }
@@ -6,6 +6,8 @@
 #include <srs_utest_manual_http.hpp>
 
 #include <sstream>
+#include <sys/socket.h>
+#include <unistd.h>
 using namespace std;
 
 #include <srs_app_http_static.hpp>
@@ -15,6 +17,7 @@ using namespace std;
 #include <srs_protocol_http_conn.hpp>
 #include <srs_protocol_http_stack.hpp>
 #include <srs_protocol_json.hpp>
+#include <srs_protocol_st.hpp>
 #include <srs_protocol_utility.hpp>
 #include <srs_utest_manual_kernel.hpp>
 #include <srs_utest_manual_protocol.hpp>
@@ -2625,3 +2628,64 @@ VOID TEST(ProtocolHTTPTest, PathEscape)
         EXPECT_EQ(0, memcmp(d.in.c_str(), value.c_str(), d.in.length()));
     }
 }
+
+VOID TEST(ProtocolHTTPTest, ResponseWriterSendfile)
+{
+    srs_error_t err;
+
+    string filepath = _srs_tmp_file_prefix + "utest-sendfile.log";
+    MockFileRemover _mfr(filepath);
+
+    if (true) {
+        SrsFileWriter fw;
+        HELPER_ASSERT_SUCCESS(fw.open(filepath));
+        HELPER_ASSERT_SUCCESS(fw.write((void *)"Hello, world!", 13, NULL));
+    }
+
+    SrsFileReader fr;
+    HELPER_ASSERT_SUCCESS(fr.open(filepath));
+    ASSERT_GT(fr.fd(), 0);
+
+    int fds[2];
+    ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, fds));
+    srs_netfd_t stfd = srs_netfd_open_socket(fds[0]);
+    SrsStSocket skt(stfd);
+
+    // Send the body in kernel, the offset of file is not changed.
+    if (true) {
+        SrsHttpResponseWriter w(&skt);
+        w.header()->set_content_length(6);
+        w.write_header(SRS_CONSTS_HTTP_OK);
+        EXPECT_TRUE(w.sendfile_enabled());
+        HELPER_EXPECT_SUCCESS(w.sendfile(fr.fd(), 7, 6));
+        HELPER_EXPECT_SUCCESS(w.final_request());
+        EXPECT_EQ(0, fr.tellg());
+
+        char buf[1024];
+        ssize_t nn = ::read(fds[1], buf, sizeof(buf));
+        ASSERT_GT(nn, 0);
+        string res(buf, nn);
+        EXPECT_EQ(0, (int)res.find("HTTP/1.1 200 OK"));
+        EXPECT_TRUE(srs_strings_ends_with(res, "\r\n\r\nworld!"));
+    }
+
+    // Never send file in chunked encoding.
+    if (true) {
+        SrsHttpResponseWriter w(&skt);
+        w.write_header(SRS_CONSTS_HTTP_OK);
+        EXPECT_FALSE(w.sendfile_enabled());
+        HELPER_EXPECT_FAILED(w.sendfile(fr.fd(), 0, 13));
+    }
+
+    // Never send file if the socket does not support, for example, HTTPS.
+    if (true) {
+        MockBufferIO io;
+        SrsHttpResponseWriter w(&io);
+        w.header()->set_content_length(13);
+        w.write_header(SRS_CONSTS_HTTP_OK);
+        EXPECT_FALSE(w.sendfile_enabled());
+    }
+
+    srs_close_stfd(stfd);
+    ::close(fds[1]);
+}
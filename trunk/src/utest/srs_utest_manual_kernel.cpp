@@ -20,6 +20,8 @@ using namespace std;
 #include <srs_kernel_log.hpp>
 #include <srs_kernel_mp3.hpp>
 #include <srs_kernel_mp4.hpp>
+#include <srs_kernel_packet.hpp>
+#include <srs_kernel_pool.hpp>
 #include <srs_kernel_ts.hpp>
 #include <srs_kernel_utility.hpp>
 #include <srs_protocol_http_stack.hpp>
@@ -27,6 +29,8 @@ using namespace std;
 #include <srs_protocol_rtc_stun.hpp>
 #include <srs_protocol_utility.hpp>
 
+#include <pthread.h>
+
 #define MAX_MOCK_DATA_SIZE 1024 * 1024
 
 MockSrsFile::MockSrsFile()
@@ -5827,6 +5831,63 @@ VOID TEST(KernelFLVTest, CoverAll)
     }
 }
 
+VOID TEST(KernelFLVTest, SharedTagHeader)
+{
+    srs_error_t err;
+
+    SrsMessageHeader h;
+    h.initialize_video(3, 30, 1);
+
+    SrsRtmpCommonMessage common_msg;
+    char *data = new char[3];
+    data[0] = 0x17;
+    data[1] = 0x01;
+    data[2] = 0x00;
+    HELPER_EXPECT_SUCCESS(common_msg.create(&h, data, 3));
+
+    // The viewers have their own copy of message, but share the payload.
+    SrsMediaPacket m;
+    common_msg.to_msg(&m);
+    SrsUniquePtr<SrsMediaPacket> copy(m.copy());
+
+    // The first viewer serializes the tag header to payload, which is reused by others.
+    MockSrsFileWriter f0;
+    SrsFlvTransmuxer mux0;
+    HELPER_EXPECT_SUCCESS(mux0.initialize(&f0));
+    SrsMediaPacket *msgs = &m;
+    HELPER_EXPECT_SUCCESS(mux0.write_tags(&msgs, 1));
+
+    char *tag = m.payload_->header(SrsMemoryBlockHeaderFlv, 30, 15);
+    ASSERT_TRUE(tag != NULL);
+
+    MockSrsFileWriter f1;
+    SrsFlvTransmuxer mux1;
+    HELPER_EXPECT_SUCCESS(mux1.initialize(&f1));
+    msgs = copy.get();
+    HELPER_EXPECT_SUCCESS(mux1.write_tags(&msgs, 1));
+    EXPECT_EQ(tag, m.payload_->header(SrsMemoryBlockHeaderFlv, 30, 15));
+
+    ASSERT_EQ(18, f0.uf->_data.length());
+    ASSERT_EQ(18, f1.uf->_data.length());
+    EXPECT_EQ(0, memcmp(f0.uf->_data.bytes(), f1.uf->_data.bytes(), 18));
+    EXPECT_EQ(9, f0.uf->_data.bytes()[0]);
+    EXPECT_EQ(30, f0.uf->_data.bytes()[6]);
+    EXPECT_EQ(14, f0.uf->_data.bytes()[17]);
+
+    // The viewer with different timestamp, for example, by jitter, serializes its own tag header.
+    copy->timestamp_ = 40;
+    MockSrsFileWriter f2;
+    SrsFlvTransmuxer mux2;
+    HELPER_EXPECT_SUCCESS(mux2.initialize(&f2));
+    HELPER_EXPECT_SUCCESS(mux2.write_tags(&msgs, 1));
+    EXPECT_EQ(tag, m.payload_->header(SrsMemoryBlockHeaderFlv, 30, 15));
+    EXPECT_TRUE(m.payload_->header(SrsMemoryBlockHeaderFlv, 40, 15) == NULL);
+
+    ASSERT_EQ(18, f2.uf->_data.length());
+    EXPECT_EQ(40, f2.uf->_data.bytes()[6]);
+    EXPECT_EQ(0, memcmp(f0.uf->_data.bytes() + 7, f2.uf->_data.bytes() + 7, 11));
+}
+
 VOID TEST(KernelFLVTest, CoverSharedPtrMessage)
 {
     srs_error_t err;
@@ -7553,3 +7614,142 @@ VOID TEST(KernelKbpsTest, SrsKbsRtcStats_FieldNaming)
         EXPECT_STREQ("test_fid", stats.fid_desc_.c_str());
     }
 }
+
+VOID TEST(KernelPoolTest, ObjectPoolReuseAndTrim)
+{
+    if (true) {
+        SrsObjectPool pool("test", 16);
+
+        void *p0 = pool.allocate(16);
+        void *p1 = pool.allocate(16);
+        EXPECT_EQ(2, pool.nn_used());
+        EXPECT_EQ(0, pool.nn_free());
+        EXPECT_EQ(0, pool.nn_hits());
+
+        // The freed object is reused.
+        pool.deallocate(p1, 16);
+        EXPECT_EQ(1, pool.nn_used());
+        EXPECT_EQ(1, pool.nn_free());
+
+        void *p2 = pool.allocate(16);
+        EXPECT_TRUE(p1 == p2);
+        EXPECT_EQ(1, pool.nn_hits());
+        EXPECT_EQ(3, pool.nn_allocs());
+
+        // Other sizes are not pooled.
+        void *p3 = pool.allocate(32);
+        pool.deallocate(p3, 32);
+        EXPECT_EQ(2, pool.nn_used());
+        EXPECT_EQ(0, pool.nn_free());
+        EXPECT_EQ(3, pool.nn_allocs());
+
+        pool.deallocate(p0, 16);
+        pool.deallocate(p2, 16);
+        EXPECT_EQ(0, pool.nn_used());
+        EXPECT_EQ(2, pool.nn_free());
+
+        // Keep the free objects to reach the high water mark.
+        pool.trim();
+        EXPECT_EQ(2, pool.nn_free());
+        EXPECT_EQ(0, pool.nn_trims());
+
+        // No objects used in the last period, free all.
+        pool.trim();
+        EXPECT_EQ(0, pool.nn_free());
+        EXPECT_EQ(2, pool.nn_trims());
+    }
+}
+
+VOID TEST(KernelPoolTest, MediaPacketFromPool)
+{
+    if (true) {
+        SrsMediaPacket *msg = new SrsMediaPacket();
+        SrsMediaPacket *copy = msg->copy();
+        void *addr = copy;
+        srs_freep(copy);
+
+        // The copy is freed to pool, and reused by next copy.
+        SrsMediaPacket *copy2 = msg->copy();
+        EXPECT_TRUE(addr == copy2);
+        srs_freep(copy2);
+        srs_freep(msg);
+
+        bool found = false;
+        std::vector<SrsObjectPool *> &pools = srs_object_pools();
+        for (int i = 0; i < (int)pools.size(); i++) {
+            if (pools[i]->name() == "media_packet") {
+                EXPECT_EQ(sizeof(SrsMediaPacket), pools[i]->size());
+                found = true;
+            }
+        }
+        EXPECT_TRUE(found);
+    }
+}
+
+struct MockPoolThreadArgs {
+    SrsObjectPool *pool_;
+    void *p_;
+    int nn_used_;
+};
+
+static void *mock_pool_thread_allocate(void *arg)
+{
+    MockPoolThreadArgs *args = (MockPoolThreadArgs *)arg;
+    args->p_ = args->pool_->allocate(16);
+    args->nn_used_ = args->pool_->nn_used();
+    return NULL;
+}
+
+static void *mock_pool_thread_free(void *arg)
+{
+    MockPoolThreadArgs *args = (MockPoolThreadArgs *)arg;
+    args->pool_->deallocate(args->p_, 16);
+    return NULL;
+}
+
+VOID TEST(KernelPoolTest, ObjectPoolOtherThread)
+{
+    EXPECT_TRUE(srs_object_pool_available());
+
+    // Allocate in other pthread, the pool is not used.
+    if (true) {
+        SrsObjectPool pool("test", 16);
+        void *p0 = pool.allocate(16);
+        pool.deallocate(p0, 16);
+        EXPECT_EQ(1, pool.nn_free());
+
+        MockPoolThreadArgs args;
+        args.pool_ = &pool;
+        args.p_ = NULL;
+        args.nn_used_ = -1;
+
+        pthread_t tid;
+        ASSERT_EQ(0, pthread_create(&tid, NULL, mock_pool_thread_allocate, &args));
+        pthread_join(tid, NULL);
+        EXPECT_TRUE(args.p_ != NULL);
+        EXPECT_EQ(0, args.nn_used_);
+        EXPECT_EQ(1, pool.nn_free());
+        EXPECT_EQ(1, pool.nn_allocs());
+
+        // Free in ST thread, the object is not counted as in use.
+        pool.deallocate(args.p_, 16);
+        EXPECT_EQ(0, pool.nn_used());
+        EXPECT_EQ(2, pool.nn_free());
+    }
+
+    // Free in other pthread, the pool is not used.
+    if (true) {
+        SrsObjectPool pool("test", 16);
+
+        MockPoolThreadArgs args;
+        args.pool_ = &pool;
+        args.p_ = pool.allocate(16);
+        args.nn_used_ = -1;
+        EXPECT_EQ(1, pool.nn_used());
+
+        pthread_t tid;
+        ASSERT_EQ(0, pthread_create(&tid, NULL, mock_pool_thread_free, &args));
+        pthread_join(tid, NULL);
+        EXPECT_EQ(0, pool.nn_free());
+    }
+}
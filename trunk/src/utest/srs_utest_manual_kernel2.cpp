@@ -792,6 +792,27 @@ VOID TEST(KernelMemoryBlockTest, MemoryBlockBasic)
     }
 }
 
+VOID TEST(KernelMemoryBlockTest, HoldInRound)
+{
+    SrsMemoryBlock block;
+    block.create(1024);
+
+    // Only the first holder in a round counts the block.
+    EXPECT_TRUE(block.hold(1));
+    EXPECT_FALSE(block.hold(1));
+
+    // The block is freed when the last holder unholds it.
+    EXPECT_FALSE(block.unhold(1));
+    EXPECT_TRUE(block.unhold(1));
+    EXPECT_FALSE(block.unhold(1));
+
+    // A new round resets the holders, and unhold of other round is ignored.
+    EXPECT_TRUE(block.hold(1));
+    EXPECT_TRUE(block.hold(2));
+    EXPECT_FALSE(block.unhold(1));
+    EXPECT_TRUE(block.unhold(2));
+}
+
 VOID TEST(KernelMemoryBlockTest, SharedMemoryBlock)
 {
 
@@ -770,6 +770,15 @@ srs_error_t MockRtcPacketSender::do_send_packet(SrsRtpPacket *pkt)
     return send_packet_error_;
 }
 
+void MockRtcPacketSender::start_batch()
+{
+}
+
+srs_error_t MockRtcPacketSender::flush_batch()
+{
+    return srs_success;
+}
+
 void MockRtcPacketSender::set_send_packet_error(srs_error_t err)
 {
     send_packet_error_ = err;
@@ -1819,6 +1828,30 @@ srs_error_t MockSrtConnection::get_stats(SrsSrtStat &stat)
     return srs_success;
 }
 
+srs_error_t MockSrtConnection::recvmsgs(iovec *iovs, int nn_iovs, int *nn_msgs)
+{
+    srs_error_t err = srs_success;
+
+    // Wait for the first message, like read.
+    ssize_t nread = 0;
+    if ((err = read(iovs[0].iov_base, iovs[0].iov_len, &nread)) != srs_success) {
+        return err;
+    }
+    iovs[0].iov_len = nread;
+
+    // Drain the left messages without waiting.
+    int nn = 1;
+    for (; nn < nn_iovs && !recv_msgs_.empty() && read_error_ == srs_success; nn++) {
+        if ((err = read(iovs[nn].iov_base, iovs[nn].iov_len, &nread)) != srs_success) {
+            return err;
+        }
+        iovs[nn].iov_len = nread;
+    }
+
+    *nn_msgs = nn;
+    return err;
+}
+
 // Mock ISrsHttpParser implementation for testing SrsHttpConn::cycle()
 MockHttpParser::MockHttpParser()
 {
@@ -272,6 +272,8 @@ public:
 
 public:
     virtual srs_error_t do_send_packet(SrsRtpPacket *pkt);
+    virtual void start_batch();
+    virtual srs_error_t flush_batch();
     void set_send_packet_error(srs_error_t err);
 };
 
@@ -326,6 +328,9 @@ public:
     bool rtc_enabled_;
     bool rtc_init_rate_from_sdp_;
     bool asprocess_;
+    int64_t segment_cache_size_;
+    int64_t media_memory_budget_;
+    srs_utime_t dvr_mp4_fragment_;
 
 public:
     MockAppConfig()
@@ -356,6 +361,9 @@ public:
         rtc_server_enabled_ = false;
         rtc_enabled_ = false;
         rtc_init_rate_from_sdp_ = false;
+        segment_cache_size_ = 0;
+        media_memory_budget_ = 0;
+        dvr_mp4_fragment_ = 0;
         asprocess_ = false;
     }
     virtual ~MockAppConfig()
@@ -400,6 +408,7 @@ public:
     virtual SrsConfDirective *get_root() { return NULL; }
     virtual std::string cwd() { return "./"; }
     virtual int get_max_connections() { return 1000; }
+    virtual int64_t get_media_memory_budget() { return media_memory_budget_; }
     virtual std::string get_pid_file() { return ""; }
     virtual bool empty_ip_ok() { return false; }
     virtual bool get_asprocess() { return asprocess_; }
@@ -450,6 +459,9 @@ public:
     }
     virtual int get_rtc_server_reuseport() { return 1; }
     virtual bool get_rtc_server_encrypt() { return false; }
+    virtual int get_rtc_server_sendmmsg() { return 1; }
+    virtual int get_rtc_server_recvmmsg() { return 1; }
+    virtual bool get_rtc_server_gso() { return false; }
     virtual bool get_api_as_candidates() { return api_as_candidates_; }
     virtual bool get_resolve_api_domain() { return resolve_api_domain_; }
     virtual bool get_keep_api_domain() { return keep_api_domain_; }
@@ -483,8 +495,30 @@ public:
     virtual int get_critical_pulse() { return 0; }
     virtual int get_dying_threshold() { return 0; }
     virtual int get_dying_pulse() { return 0; }
+    virtual bool get_workers_enabled() { return false; }
+    virtual int get_workers_count() { return 0; }
+    virtual bool get_workers_cpu_affinity() { return true; }
+    virtual int get_workers_relay_port() { return 19350; }
+    virtual bool get_async_io_enabled() { return false; }
+    virtual int get_async_io_threads() { return 2; }
+    virtual int get_async_io_queue() { return 1024; }
+    virtual bool get_ingest_thread_enabled() { return false; }
+    virtual int get_ingest_threads() { return 2; }
+    virtual int get_ingest_thread_queue() { return 4096; }
+    virtual int get_hooks_keepalive() { return 0; }
+    virtual int get_hooks_concurrency() { return 0; }
+    virtual srs_utime_t get_hooks_play_cache_ttl() { return 0; }
+    virtual bool get_hooks_async_notify() { return false; }
+    virtual int get_hooks_retry_queue() { return 1024; }
     virtual std::string get_rtmps_ssl_cert() { return ""; }
     virtual std::string get_rtmps_ssl_key() { return ""; }
+    // Compile the snapshot from the mocked getters for each call, so tests could change them.
+    virtual SrsSharedPtr<SrsConfigSnapshot> snapshot()
+    {
+        SrsConfigSnapshot *snapshot = new SrsConfigSnapshot();
+        snapshot->default_ = srs_config_compile_vhost(this, SRS_CONSTS_RTMP_DEFAULT_VHOST);
+        return SrsSharedPtr<SrsConfigSnapshot>(snapshot);
+    }
     virtual SrsConfDirective *get_vhost(std::string vhost, bool try_default_vhost = true) { return default_vhost_; }
     virtual bool get_vhost_enabled(std::string vhost) { return true; }
     virtual bool get_debug_srs_upnode(std::string vhost) { return true; }
@@ -570,6 +604,9 @@ public:
     virtual bool get_hls_ctx_enabled(std::string vhost) { return true; }
     virtual bool get_hls_ts_ctx_enabled(std::string vhost) { return true; }
     virtual bool get_hls_master_m3u8_path_relative(std::string vhost) { return false; }
+    virtual bool get_hls_ll(std::string vhost) { return false; }
+    virtual srs_utime_t get_hls_part(std::string vhost) { return 500 * SRS_UTIME_MILLISECONDS; }
+    virtual bool get_hls_ll_persist(std::string vhost) { return true; }
     virtual bool get_hls_recover(std::string vhost) { return true; }
     virtual bool get_forward_enabled(std::string vhost) { return forwards_directive_ != NULL || backend_directive_ != NULL; }
     virtual SrsConfDirective *get_forwards(std::string vhost) { return forwards_directive_; }
@@ -591,7 +628,9 @@ public:
     virtual srs_utime_t get_dvr_duration(std::string vhost) { return 30 * SRS_UTIME_SECONDS; }
     virtual int get_dvr_time_jitter(std::string vhost) { return 0; }
     virtual bool get_dvr_wait_keyframe(std::string vhost) { return true; }
+    virtual srs_utime_t get_dvr_mp4_fragment(std::string vhost) { return dvr_mp4_fragment_; }
     virtual bool get_vhost_enabled(SrsConfDirective *conf) { return true; }
+    virtual int64_t get_vhost_http_segment_cache(std::string vhost) { return segment_cache_size_; }
     virtual bool get_vhost_http_remux_enabled(std::string vhost) { return false; }
     virtual bool get_vhost_http_remux_enabled(SrsConfDirective *vhost) { return false; }
     virtual srs_utime_t get_vhost_http_remux_fast_cache(std::string vhost) { return 0; }
@@ -1060,6 +1099,7 @@ public:
     virtual srs_srt_t srtfd();
     virtual srs_error_t get_streamid(std::string &streamid);
     virtual srs_error_t get_stats(SrsSrtStat &stat);
+    virtual srs_error_t recvmsgs(iovec *iovs, int nn_iovs, int *nn_msgs);
 };
 
 // Mock ISrsHttpParser for testing SrsHttpConn::cycle()
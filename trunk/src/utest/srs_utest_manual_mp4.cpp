@@ -8,10 +8,14 @@
 #include <sstream>
 using namespace std;
 
+#include <srs_app_async_io.hpp>
 #include <srs_app_hls.hpp>
+#include <srs_app_mp4_index.hpp>
 #include <srs_core_autofree.hpp>
 #include <srs_kernel_error.hpp>
+#include <srs_kernel_file.hpp>
 #include <srs_kernel_mp4.hpp>
+#include <srs_kernel_utility.hpp>
 #include <srs_utest_manual_kernel.hpp>
 
 VOID TEST(KernelMp4Test, PrintPadding)
@@ -2595,3 +2599,287 @@ VOID TEST(KernelMp4Test, SrsMp4DvrJitter)
         EXPECT_EQ(0, jitter.get_first_sample_delta(SrsFrameTypeAudio));
     }
 }
+
+// Create a MP4 of 3s, with a video keyframe every second, and audio frames between video frames.
+static srs_error_t mock_create_mp4_for_index(MockSrsFileWriter *f)
+{
+    srs_error_t err = srs_success;
+
+    SrsMp4Encoder enc;
+    SrsFormat fmt;
+    if ((err = enc.initialize(f)) != srs_success) {
+        return srs_error_wrap(err, "init encoder");
+    }
+    if ((err = fmt.initialize()) != srs_success) {
+        return srs_error_wrap(err, "init format");
+    }
+
+    uint8_t vsh[] = {
+        0x17, 0x00, 0x00, 0x00, 0x00, 0x01, 0x64, 0x00, 0x20, 0xff, 0xe1, 0x00, 0x19, 0x67, 0x64, 0x00, 0x20, 0xac, 0xd9, 0x40, 0xc0, 0x29, 0xb0, 0x11, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x03, 0x00, 0x32, 0x0f, 0x18, 0x31, 0x96, 0x01, 0x00, 0x05, 0x68, 0xeb, 0xec, 0xb2, 0x2c};
+    if ((err = fmt.on_video(0, (char *)vsh, sizeof(vsh))) != srs_success) {
+        return srs_error_wrap(err, "video sh");
+    }
+    if ((err = enc.write_sample(&fmt, SrsMp4HandlerTypeVIDE, fmt.video_->frame_type_, fmt.video_->avc_packet_type_, 0, 0, (uint8_t *)fmt.raw_, fmt.nb_raw_)) != srs_success) {
+        return srs_error_wrap(err, "write video sh");
+    }
+
+    uint8_t ash[] = {0xaf, 0x00, 0x12, 0x10};
+    if ((err = fmt.on_audio(0, (char *)ash, sizeof(ash))) != srs_success) {
+        return srs_error_wrap(err, "audio sh");
+    }
+    if ((err = enc.write_sample(&fmt, SrsMp4HandlerTypeSOUN, 0x00, fmt.audio_->aac_packet_type_, 0, 0, (uint8_t *)fmt.raw_, fmt.nb_raw_)) != srs_success) {
+        return srs_error_wrap(err, "write audio sh");
+    }
+
+    uint8_t frame[] = {0x00, 0x00, 0x00, 0x04, 0x65, 0x88, 0x84, 0x00};
+    uint8_t audio[] = {0x21, 0x11, 0x45, 0x00};
+    for (uint32_t dts = 0; dts < 3000; dts += 500) {
+        SrsVideoAvcFrameType ft = (dts % 1000) ? SrsVideoAvcFrameTypeInterFrame : SrsVideoAvcFrameTypeKeyFrame;
+        if ((err = enc.write_sample(&fmt, SrsMp4HandlerTypeVIDE, ft, SrsVideoAvcFrameTraitNALU, dts, dts, frame, sizeof(frame))) != srs_success) {
+            return srs_error_wrap(err, "write video");
+        }
+        if ((err = enc.write_sample(&fmt, SrsMp4HandlerTypeSOUN, 0x00, SrsAudioAacFrameTraitRawData, dts + 20, dts + 20, audio, sizeof(audio))) != srs_success) {
+            return srs_error_wrap(err, "write audio");
+        }
+    }
+
+    enc.acodec_ = SrsAudioCodecIdAAC;
+    enc.vcodec_ = SrsVideoCodecIdAVC;
+
+    if ((err = enc.flush()) != srs_success) {
+        return srs_error_wrap(err, "flush");
+    }
+
+    return err;
+}
+
+VOID TEST(AppMp4IndexTest, BuildSeekAndSidecar)
+{
+    srs_error_t err;
+
+    MockSrsFileWriter f;
+    HELPER_ASSERT_SUCCESS(mock_create_mp4_for_index(&f));
+
+    SrsMp4SampleIndex index;
+    if (true) {
+        MockSrsFileReader fr((const char *)f.data(), f.filesize());
+        HELPER_ASSERT_SUCCESS(index.build(&fr));
+    }
+    ASSERT_EQ(12, index.nn_samples());
+
+    // The seek points are the keyframes at 0s, 1s and 2s.
+    vector<uint64_t> keyframes;
+    for (int i = 0; i < index.nn_samples(); i++) {
+        if (index.flags_[i] & SRS_MP4_INDEX_FLAG_KEYFRAME) {
+            keyframes.push_back(index.offsets_[i]);
+        }
+    }
+    ASSERT_EQ(3, (int)keyframes.size());
+
+    EXPECT_EQ((int64_t)keyframes[0], index.seek(0));
+    EXPECT_EQ((int64_t)keyframes[0], index.seek(900 * SRS_UTIME_MILLISECONDS));
+    EXPECT_EQ((int64_t)keyframes[1], index.seek(1500 * SRS_UTIME_MILLISECONDS));
+    EXPECT_EQ((int64_t)keyframes[2], index.seek(60 * SRS_UTIME_SECONDS));
+
+    // The sidecar file should be decoded to the same index.
+    index.file_size_ = f.filesize();
+    index.file_mtime_ = 1234;
+
+    string data;
+    index.encode(data);
+
+    SrsMp4SampleIndex decoded;
+    HELPER_ASSERT_SUCCESS(decoded.decode(data.data(), (int)data.size()));
+    EXPECT_EQ(index.file_size_, decoded.file_size_);
+    EXPECT_EQ(1234, decoded.file_mtime_);
+    EXPECT_EQ(index.nn_samples(), decoded.nn_samples());
+    EXPECT_TRUE(index.offsets_ == decoded.offsets_);
+    EXPECT_TRUE(index.dts_ == decoded.dts_);
+    EXPECT_TRUE(index.cts_ == decoded.cts_);
+    EXPECT_TRUE(index.ftyp_ == decoded.ftyp_);
+    EXPECT_TRUE(index.moov_ == decoded.moov_);
+    EXPECT_EQ(index.video_tbn_, decoded.video_tbn_);
+    EXPECT_EQ(index.audio_tbn_, decoded.audio_tbn_);
+    EXPECT_EQ((int64_t)keyframes[1], decoded.seek(1500 * SRS_UTIME_MILLISECONDS));
+
+    // Corrupt or truncated sidecar file.
+    HELPER_EXPECT_FAILED(decoded.decode(data.data(), 10));
+    HELPER_EXPECT_FAILED(decoded.decode(data.data(), (int)data.size() - 1));
+
+    string corrupt = data;
+    corrupt[0] = 'X';
+    HELPER_EXPECT_FAILED(decoded.decode(corrupt.data(), (int)corrupt.size()));
+}
+
+VOID TEST(AppMp4IndexTest, RewriteToPlayableMp4)
+{
+    srs_error_t err;
+
+    MockSrsFileWriter f;
+    HELPER_ASSERT_SUCCESS(mock_create_mp4_for_index(&f));
+
+    SrsMp4SampleIndex index;
+    if (true) {
+        MockSrsFileReader fr((const char *)f.data(), f.filesize());
+        HELPER_ASSERT_SUCCESS(index.build(&fr));
+    }
+
+    // Seek to 1.5s, start from the keyframe at 1s.
+    string header;
+    int64_t start = 0, end = 0;
+    HELPER_ASSERT_SUCCESS(index.rewrite(1500 * SRS_UTIME_MILLISECONDS, header, &start, &end));
+    EXPECT_EQ(index.seek(1500 * SRS_UTIME_MILLISECONDS), start);
+    EXPECT_LE(end, f.filesize());
+
+    string mp4 = header + string((const char *)f.data() + start, end - start);
+
+    // The generated MP4 is playable, with the video from keyframe at 1s, and the audio since 1s.
+    SrsMp4Decoder dec;
+    MockSrsFileReader fr(mp4.data(), (int)mp4.size());
+    HELPER_ASSERT_SUCCESS(dec.initialize(&fr));
+
+    uint8_t frame[] = {0x00, 0x00, 0x00, 0x04, 0x65, 0x88, 0x84, 0x00};
+    uint8_t audio[] = {0x21, 0x11, 0x45, 0x00};
+
+    int nn_video = 0, nn_audio = 0;
+    while (true) {
+        SrsMp4HandlerType ht = SrsMp4HandlerTypeForbidden;
+        uint16_t ft = 0, ct = 0;
+        uint32_t dts = 0, pts = 0, nb_sample = 0;
+        uint8_t *sample = NULL;
+        if ((err = dec.read_sample(&ht, &ft, &ct, &dts, &pts, &sample, &nb_sample)) != srs_success) {
+            EXPECT_EQ(ERROR_SYSTEM_FILE_EOF, srs_error_code(err));
+            srs_freep(err);
+            break;
+        }
+        SrsUniquePtr<uint8_t[]> sample_uptr(sample);
+
+        if (ct == SrsVideoAvcFrameTraitSequenceHeader || ct == SrsAudioAacFrameTraitSequenceHeader) {
+            continue;
+        }
+
+        if (ht == SrsMp4HandlerTypeVIDE) {
+            // The first video frame is keyframe, at 0s of generated MP4.
+            if (nn_video++ == 0) {
+                EXPECT_EQ(SrsVideoAvcFrameTypeKeyFrame, ft);
+                EXPECT_EQ(0, (int)dts);
+            }
+            EXPECT_EQ(sizeof(frame), nb_sample);
+            EXPECT_EQ(0, memcmp(frame, sample, sizeof(frame)));
+        } else {
+            nn_audio++;
+            EXPECT_EQ(sizeof(audio), nb_sample);
+            EXPECT_EQ(0, memcmp(audio, sample, sizeof(audio)));
+        }
+    }
+    EXPECT_EQ(4, nn_video);
+    EXPECT_EQ(4, nn_audio);
+
+    // Index the generated MP4, the duration and keyframes are trimmed.
+    SrsMp4SampleIndex trimmed;
+    if (true) {
+        MockSrsFileReader tfr(mp4.data(), (int)mp4.size());
+        HELPER_ASSERT_SUCCESS(trimmed.build(&tfr));
+    }
+    EXPECT_EQ(8, trimmed.nn_samples());
+    EXPECT_EQ(SRS_MP4_INDEX_FLAG_VIDEO | SRS_MP4_INDEX_FLAG_KEYFRAME, trimmed.flags_[0]);
+    EXPECT_EQ(0, (int)trimmed.dts_ms(0));
+    EXPECT_EQ((int64_t)header.size(), (int64_t)trimmed.offsets_[0]);
+
+    // Seek to the start, the whole samples.
+    HELPER_ASSERT_SUCCESS(index.rewrite(0, header, &start, &end));
+    EXPECT_EQ((int64_t)index.offsets_[0], start);
+
+    // No sample to seek.
+    SrsMp4SampleIndex empty;
+    HELPER_EXPECT_FAILED(empty.rewrite(0, header, &start, &end));
+}
+
+VOID TEST(AppMp4IndexTest, CacheBuildOnceAndLoadSidecar)
+{
+    srs_error_t err;
+
+    MockSrsFileWriter f;
+    HELPER_ASSERT_SUCCESS(mock_create_mp4_for_index(&f));
+
+    string path = "/tmp/srs-utest-mp4-index.mp4";
+    string idx_path = path + ".idx";
+    if (true) {
+        SrsFileWriter fw;
+        HELPER_ASSERT_SUCCESS(fw.open(path));
+        HELPER_ASSERT_SUCCESS(fw.write(f.data(), f.filesize(), NULL));
+    }
+
+    // The files are read and written in place, for the I/O threads are not started.
+    SrsAsyncIo aio;
+    SrsAsyncIo *aio_backup = _srs_async_io;
+    _srs_async_io = &aio;
+
+    // Build by parsing moov, and write the sidecar file.
+    if (true) {
+        SrsMp4IndexCache cache;
+        SrsMp4SampleIndex *index = NULL;
+        HELPER_ASSERT_SUCCESS(cache.fetch(path, &index));
+        EXPECT_EQ(12, index->nn_samples());
+        EXPECT_EQ(1, cache.nn_builds_);
+        EXPECT_EQ(0, cache.nn_loads_);
+
+        // Hit the cache.
+        HELPER_ASSERT_SUCCESS(cache.fetch(path, &index));
+        EXPECT_EQ(1, cache.nn_hits_);
+        EXPECT_EQ(1, cache.nn_builds_);
+    }
+
+    SrsPath path_util;
+    EXPECT_TRUE(path_util.exists(idx_path));
+
+    // The new cache loads the sidecar file, without parsing the moov.
+    if (true) {
+        SrsMp4IndexCache cache;
+        SrsMp4SampleIndex *index = NULL;
+        HELPER_ASSERT_SUCCESS(cache.fetch(path, &index));
+        EXPECT_EQ(12, index->nn_samples());
+        EXPECT_EQ(0, cache.nn_builds_);
+        EXPECT_EQ(1, cache.nn_loads_);
+
+        // Not exists file.
+        HELPER_EXPECT_FAILED(cache.fetch("/tmp/srs-utest-mp4-index-not-exists.mp4", &index));
+    }
+
+    // The least recently used index is evicted.
+    if (true) {
+        string other = "/tmp/srs-utest-mp4-index-other.mp4";
+        if (true) {
+            SrsFileWriter fw;
+            HELPER_ASSERT_SUCCESS(fw.open(other));
+            HELPER_ASSERT_SUCCESS(fw.write(f.data(), f.filesize(), NULL));
+        }
+
+        SrsMp4IndexCache cache;
+        cache.max_entries_ = 2;
+
+        SrsMp4SampleIndex *index = NULL;
+        HELPER_EXPECT_SUCCESS(cache.fetch(path, &index));
+        HELPER_EXPECT_SUCCESS(cache.fetch(other, &index));
+        HELPER_EXPECT_SUCCESS(cache.fetch(path, &index));
+        EXPECT_TRUE(cache.lru_.front() == path);
+        EXPECT_EQ(1, cache.nn_hits_);
+
+        // Load the other again, which evicts the path.
+        cache.max_entries_ = 1;
+        cache.remove(other);
+        HELPER_EXPECT_SUCCESS(cache.fetch(other, &index));
+        EXPECT_EQ(2, cache.nn_loads_);
+        EXPECT_EQ(1, cache.nn_evicts_);
+        EXPECT_EQ(1, (int)cache.indexes_.size());
+        EXPECT_EQ(1, (int)cache.positions_.size());
+        EXPECT_TRUE(cache.lru_.front() == other);
+
+        path_util.unlink(other);
+        path_util.unlink(other + ".idx");
+    }
+
+    _srs_async_io = aio_backup;
+    path_util.unlink(path);
+    path_util.unlink(idx_path);
+}
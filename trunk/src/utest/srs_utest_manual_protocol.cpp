@@ -965,6 +965,217 @@ VOID TEST(ProtocolStackTest, ProtocolBytes)
     EXPECT_TRUE(0 < proto.get_send_bytes());
 }
 
+/**
+ * the players share the chunk headers of message, whatever the chunk size is.
+ */
+VOID TEST(ProtocolStackTest, ProtocolSendSharedChunkHeader)
+{
+    srs_error_t err = srs_success;
+
+    SrsMessageHeader h;
+    h.initialize_video(300, 30, 1);
+
+    char *data = new char[300];
+    memset(data, 0x17, 300);
+    SrsRtmpCommonMessage common_msg;
+    HELPER_EXPECT_SUCCESS(common_msg.create(&h, data, 300));
+
+    SrsMediaPacket m;
+    common_msg.to_msg(&m);
+
+    // Player with chunk size 128, which serializes the shared headers.
+    MockBufferIO bio0;
+    SrsProtocol proto0(&bio0);
+    HELPER_EXPECT_SUCCESS(proto0.send_and_free_message(m.copy(), 1));
+
+    char *c0 = NULL, *c3 = NULL;
+    int nb_c0 = 0, nb_c3 = 0;
+    EXPECT_TRUE(srs_rtmp_shared_chunk_header(&m, &c0, &nb_c0, &c3, &nb_c3));
+    EXPECT_EQ(12, nb_c0);
+    EXPECT_EQ(1, nb_c3);
+    EXPECT_EQ((char)0xC6, c3[0]);
+
+    // 12B c0, 128B, 1B c3, 128B, 1B c3, 44B.
+    char *p = bio0.out_buffer.bytes();
+    ASSERT_EQ(314, bio0.out_buffer.length());
+    EXPECT_EQ(0, memcmp(p, c0, 12));
+    EXPECT_EQ(30, p[3]);
+    EXPECT_EQ((char)0xC6, p[12 + 128]);
+    EXPECT_EQ((char)0xC6, p[12 + 128 + 1 + 128]);
+
+    // Player with chunk size 200, which reuses the shared headers.
+    MockBufferIO bio1;
+    SrsProtocol proto1(&bio1);
+    proto1.out_chunk_size_ = 200;
+    HELPER_EXPECT_SUCCESS(proto1.send_and_free_message(m.copy(), 1));
+
+    p = bio1.out_buffer.bytes();
+    ASSERT_EQ(313, bio1.out_buffer.length());
+    EXPECT_EQ(0, memcmp(p, c0, 12));
+    EXPECT_EQ((char)0xC6, p[12 + 200]);
+
+    // Player with different timestamp, which serializes its own headers.
+    SrsMediaPacket *copy = m.copy();
+    copy->timestamp_ = 40;
+    MockBufferIO bio2;
+    SrsProtocol proto2(&bio2);
+    HELPER_EXPECT_SUCCESS(proto2.send_and_free_message(copy, 1));
+
+    p = bio2.out_buffer.bytes();
+    ASSERT_EQ(314, bio2.out_buffer.length());
+    EXPECT_EQ(40, p[3]);
+    EXPECT_EQ(0, memcmp(p + 4, c0 + 4, 8));
+    EXPECT_TRUE(srs_rtmp_shared_chunk_header(&m, &c0, &nb_c0, &c3, &nb_c3));
+    EXPECT_EQ(30, c0[3]);
+}
+
+// The reader to replay the data, without erasing the consumed bytes.
+class MockReplayBufferIO : public MockBufferIO
+{
+public:
+    std::string data_;
+    size_t pos_;
+
+public:
+    MockReplayBufferIO(std::string data)
+    {
+        data_ = data;
+        pos_ = 0;
+    }
+    virtual ~MockReplayBufferIO()
+    {
+    }
+
+public:
+    virtual srs_error_t read(void *buf, size_t size, ssize_t *nread)
+    {
+        if (pos_ >= data_.size()) {
+            return srs_error_new(ERROR_SOCKET_READ, "read");
+        }
+
+        size_t available = srs_min(data_.size() - pos_, size);
+        memcpy(buf, data_.data() + pos_, available);
+        pos_ += available;
+
+        if (nread) {
+            *nread = available;
+        }
+        return srs_success;
+    }
+};
+
+// Serialize the video messages in chunks, by the chunk size.
+static std::string mock_rtmp_video_chunks(int chunk_size, int nn_msgs, int msg_size)
+{
+    srs_error_t err = srs_success;
+
+    MockBufferIO bio;
+    SrsProtocol proto(&bio);
+    proto.out_chunk_size_ = chunk_size;
+
+    for (int i = 0; i < nn_msgs; i++) {
+        SrsMessageHeader h;
+        h.initialize_video(msg_size, 40 * i, 1);
+
+        char *data = new char[msg_size];
+        for (int j = 0; j < msg_size; j++) {
+            data[j] = (char)(i + j);
+        }
+
+        SrsRtmpCommonMessage common_msg;
+        HELPER_EXPECT_SUCCESS(common_msg.create(&h, data, msg_size));
+
+        SrsMediaPacket *m = new SrsMediaPacket();
+        common_msg.to_msg(m);
+        HELPER_EXPECT_SUCCESS(proto.send_and_free_message(m, 1));
+    }
+
+    return std::string(bio.out_buffer.bytes(), bio.out_buffer.length());
+}
+
+/**
+ * the chunks of message in buffer are assembled at once, and interlaced chunks are read one by one.
+ */
+VOID TEST(ProtocolStackTest, ProtocolRecvAssembleChunks)
+{
+    srs_error_t err;
+
+    // Messages in buffer, each is assembled at once.
+    if (true) {
+        MockReplayBufferIO bio(mock_rtmp_video_chunks(128, 3, 1000));
+        SrsProtocol proto(&bio);
+
+        for (int i = 0; i < 3; i++) {
+            SrsRtmpCommonMessage *msg = NULL;
+            HELPER_ASSERT_SUCCESS(proto.recv_message(&msg));
+            SrsUniquePtr<SrsRtmpCommonMessage> msg_uptr(msg);
+
+            EXPECT_TRUE(msg->header_.is_video());
+            EXPECT_EQ(40 * i, msg->header_.timestamp_);
+            ASSERT_EQ(1000, msg->size());
+            for (int j = 0; j < 1000; j++) {
+                ASSERT_EQ((char)(i + j), msg->payload()[j]);
+            }
+        }
+    }
+
+    // Video message of 300 bytes interlaced by an audio chunk, which is read chunk by chunk.
+    if (true) {
+        std::string video = mock_rtmp_video_chunks(128, 1, 300);
+        ASSERT_EQ(12 + 128 + 1 + 128 + 1 + 44, (int)video.size());
+
+        uint8_t audio[] = {
+            0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x01, 0x00, 0x00, 0x00,
+            0xaf, 0x01};
+
+        std::string data = video.substr(0, 12 + 128);
+        data.append((char *)audio, sizeof(audio));
+        data.append(video.substr(12 + 128));
+
+        MockReplayBufferIO bio(data);
+        SrsProtocol proto(&bio);
+
+        SrsRtmpCommonMessage *msg = NULL;
+        HELPER_ASSERT_SUCCESS(proto.recv_message(&msg));
+        SrsUniquePtr<SrsRtmpCommonMessage> audio_uptr(msg);
+        EXPECT_TRUE(msg->header_.is_audio());
+        EXPECT_EQ(2, msg->size());
+
+        HELPER_ASSERT_SUCCESS(proto.recv_message(&msg));
+        SrsUniquePtr<SrsRtmpCommonMessage> video_uptr(msg);
+        EXPECT_TRUE(msg->header_.is_video());
+        ASSERT_EQ(300, msg->size());
+        for (int j = 0; j < 300; j++) {
+            ASSERT_EQ((char)j, msg->payload()[j]);
+        }
+    }
+}
+
+/**
+ * recv bulk of large messages, in small and large chunk size.
+ */
+VOID TEST(ProtocolStackTest, ProtocolRecvChunksInBulk)
+{
+    srs_error_t err;
+
+    int chunk_sizes[] = {128, 60000};
+    for (int i = 0; i < (int)(sizeof(chunk_sizes) / sizeof(int)); i++) {
+        int chunk_size = chunk_sizes[i];
+        int nn_msgs = 16, msg_size = 64 * 1024;
+
+        MockReplayBufferIO bio(mock_rtmp_video_chunks(chunk_size, nn_msgs, msg_size));
+        SrsProtocol proto(&bio);
+        proto.in_chunk_size_ = chunk_size;
+
+        for (int j = 0; j < nn_msgs; j++) {
+            SrsRtmpCommonMessage *msg = NULL;
+            HELPER_ASSERT_SUCCESS(proto.recv_message(&msg));
+            EXPECT_EQ(msg_size, msg->size());
+            srs_freep(msg);
+        }
+    }
+}
+
 /**
  * recv a SrsConnectAppPacket packet.
  */
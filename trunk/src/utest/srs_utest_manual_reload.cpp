@@ -22,11 +22,12 @@ MockReloadHandler::~MockReloadHandler()
 void MockReloadHandler::reset()
 {
     vhost_chunk_size_reloaded = false;
+    vhost_segment_cache_reloaded = false;
 }
 
 int MockReloadHandler::count_total()
 {
-    return 1;
+    return 2;
 }
 
 int MockReloadHandler::count_true()
@@ -35,6 +36,8 @@ int MockReloadHandler::count_true()
 
     if (vhost_chunk_size_reloaded)
         count_true++;
+    if (vhost_segment_cache_reloaded)
+        count_true++;
 
     return count_true;
 }
@@ -45,6 +48,8 @@ int MockReloadHandler::count_false()
 
     if (!vhost_chunk_size_reloaded)
         count_false++;
+    if (!vhost_segment_cache_reloaded)
+        count_false++;
 
     return count_false;
 }
@@ -65,6 +70,12 @@ srs_error_t MockReloadHandler::on_reload_vhost_chunk_size(string /*vhost*/)
     return srs_success;
 }
 
+srs_error_t MockReloadHandler::on_reload_vhost_segment_cache(string /*vhost*/)
+{
+    vhost_segment_cache_reloaded = true;
+    return srs_success;
+}
+
 MockSrsReloadConfig::MockSrsReloadConfig()
 {
 }
@@ -112,6 +123,30 @@ VOID TEST(ConfigReloadTest, ReloadVhostChunkSize)
     handler.reset();
 }
 
+VOID TEST(ConfigReloadTest, ReloadVhostSegmentCache)
+{
+    srs_error_t err = srs_success;
+
+    MockReloadHandler handler;
+    MockSrsReloadConfig conf;
+
+    conf.subscribe(&handler);
+    HELPER_EXPECT_SUCCESS(conf.mock_parse(_MIN_OK_CONF "vhost ossrs.net { http_static { segment_cache 64; } }"));
+    HELPER_EXPECT_SUCCESS(conf.do_reload(_MIN_OK_CONF "vhost ossrs.net { http_static { segment_cache 64; } }"));
+    EXPECT_TRUE(handler.all_false());
+    handler.reset();
+
+    HELPER_EXPECT_SUCCESS(conf.do_reload(_MIN_OK_CONF "vhost ossrs.net { http_static { segment_cache 16; } }"));
+    EXPECT_TRUE(handler.vhost_segment_cache_reloaded);
+    EXPECT_EQ(1, handler.count_true());
+    handler.reset();
+
+    // Disable the segment cache.
+    HELPER_EXPECT_SUCCESS(conf.do_reload(_MIN_OK_CONF "vhost ossrs.net { }"));
+    EXPECT_TRUE(handler.vhost_segment_cache_reloaded);
+    handler.reset();
+}
+
 VOID TEST(ConfigReloadTest, ReloadAddNewVhost)
 {
     srs_error_t err = srs_success;
@@ -19,6 +19,7 @@ class MockReloadHandler : public ISrsReloadHandler
 {
 public:
     bool vhost_chunk_size_reloaded;
+    bool vhost_segment_cache_reloaded;
 
 public:
     MockReloadHandler();
@@ -34,6 +35,7 @@ public:
 
 public:
     virtual srs_error_t on_reload_vhost_chunk_size(std::string vhost);
+    virtual srs_error_t on_reload_vhost_segment_cache(std::string vhost);
 };
 
 class MockSrsReloadConfig : public MockSrsConfig
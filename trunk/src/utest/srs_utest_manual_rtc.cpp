@@ -6,6 +6,7 @@
 #include <srs_utest_manual_rtc.hpp>
 
 #include <srs_app_rtc_conn.hpp>
+#include <srs_app_rtc_dtls.hpp>
 #include <srs_app_rtc_source.hpp>
 #include <srs_app_utility.hpp>
 #include <srs_core_autofree.hpp>
@@ -2700,3 +2701,96 @@ VOID TEST(KernelRTCTest, H265RtpRawNALUsSkipBytes)
         }
     }
 }
+
+// Build a RTP packet in buffer, return the size of packet.
+static int mock_srtp_rtp_packet(char *buf, uint16_t seq, int nn_payload)
+{
+    SrsBuffer b(buf, 12 + nn_payload);
+    b.write_1bytes(0x80);
+    b.write_1bytes(96);
+    b.write_2bytes(seq);
+    b.write_4bytes(seq * 3000);
+    b.write_4bytes(0x12345678);
+    memset(buf + 12, (char)seq, nn_payload);
+    return 12 + nn_payload;
+}
+
+VOID TEST(KernelRTCTest, SrtpProtectBatch)
+{
+    srs_error_t err;
+
+    // The master key and salt of AES-CM is 30 bytes with 10 bytes tag, while GCM is 28 bytes with 16 bytes tag.
+    int key_sizes[] = {SRTP_AES_ICM_128_KEY_LEN_WSALT, SRTP_AES_GCM_128_KEY_LEN_WSALT};
+    int tag_sizes[] = {10, 16};
+    for (int i = 0; i < 2; i++) {
+        if (key_sizes[i] == SRTP_AES_GCM_128_KEY_LEN_WSALT && !srs_srtp_gcm_supported()) {
+            continue;
+        }
+
+        std::string key(key_sizes[i], (char)0x0f);
+        SrsSRTP sender, receiver;
+        HELPER_ASSERT_SUCCESS(sender.initialize(key, key));
+        HELPER_ASSERT_SUCCESS(receiver.initialize(key, key));
+
+        char packets[3][1500];
+        iovec iovs[3];
+        for (int j = 0; j < 3; j++) {
+            iovs[j].iov_base = packets[j];
+            iovs[j].iov_len = mock_srtp_rtp_packet(packets[j], 100 + j, 200 + j);
+        }
+
+        HELPER_ASSERT_SUCCESS(sender.protect_rtps(iovs, 3));
+
+        for (int j = 0; j < 3; j++) {
+            EXPECT_EQ(12 + 200 + j + tag_sizes[i], (int)iovs[j].iov_len);
+
+            char plaintext[1500];
+            int nn_plaintext = mock_srtp_rtp_packet(plaintext, 100 + j, 200 + j);
+            EXPECT_NE(0, memcmp(plaintext + 12, packets[j] + 12, nn_plaintext - 12));
+
+            int nn = (int)iovs[j].iov_len;
+            HELPER_ASSERT_SUCCESS(receiver.unprotect_rtp(packets[j], &nn));
+            EXPECT_EQ(nn_plaintext, nn);
+            EXPECT_EQ(0, memcmp(plaintext, packets[j], nn));
+        }
+    }
+
+    // Fail if not ready.
+    if (true) {
+        SrsSRTP srtp;
+        iovec iov;
+        HELPER_EXPECT_FAILED(srtp.protect_rtps(&iov, 1));
+    }
+}
+
+VOID TEST(KernelRTCTest, SrtpProtectBursts)
+{
+    srs_error_t err;
+
+    int key_sizes[] = {SRTP_AES_ICM_128_KEY_LEN_WSALT, SRTP_AES_GCM_128_KEY_LEN_WSALT};
+    for (int i = 0; i < 2; i++) {
+        if (key_sizes[i] == SRTP_AES_GCM_128_KEY_LEN_WSALT && !srs_srtp_gcm_supported()) {
+            continue;
+        }
+
+        SrsSRTP sender;
+        HELPER_ASSERT_SUCCESS(sender.initialize(std::string(key_sizes[i], 'k'), std::string(key_sizes[i], 'k')));
+
+        // Protect the bursts of packets, like the batch of a player.
+        const int nn_bursts = 4, nn_burst = 64, nn_payload = 1200;
+        SrsUniquePtr<char[]> arena(new char[nn_burst * 1500]);
+        iovec iovs[nn_burst];
+
+        for (int j = 0; j < nn_bursts; j++) {
+            for (int k = 0; k < nn_burst; k++) {
+                iovs[k].iov_base = arena.get() + k * 1500;
+                iovs[k].iov_len = mock_srtp_rtp_packet((char *)iovs[k].iov_base, (uint16_t)(j * nn_burst + k), nn_payload);
+            }
+            HELPER_ASSERT_SUCCESS(sender.protect_rtps(iovs, nn_burst));
+
+            for (int k = 0; k < nn_burst; k++) {
+                EXPECT_GT((int)iovs[k].iov_len, 12 + nn_payload);
+            }
+        }
+    }
+}
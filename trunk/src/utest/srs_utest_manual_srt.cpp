@@ -321,6 +321,96 @@ VOID TEST(ServiceStSRTTest, ReadWrite)
     }
 }
 
+VOID TEST(ServiceStSRTTest, RecvMsgsInBatch)
+{
+    srs_error_t err = srs_success;
+
+    std::string server_ip = "127.0.0.1";
+    int server_port = 19000;
+
+    MockSrtServer srt_server;
+    HELPER_EXPECT_SUCCESS(srt_server.create_socket());
+    HELPER_EXPECT_SUCCESS(srt_server.listen(server_ip, server_port));
+
+    srs_srt_t srt_client_fd = srs_srt_socket_invalid();
+    HELPER_EXPECT_SUCCESS(srs_srt_socket_with_default_option(&srt_client_fd));
+    SrsUniquePtr<SrsSrtSocket> srt_client_socket(new SrsSrtSocket(_srt_eventloop->poller(), srt_client_fd));
+    HELPER_EXPECT_SUCCESS(srt_client_socket->connect(server_ip, server_port));
+
+    srs_srt_t srt_server_accepted_fd = srs_srt_socket_invalid();
+    HELPER_EXPECT_SUCCESS(srt_server.accept(&srt_server_accepted_fd));
+    EXPECT_NE(srt_server_accepted_fd, srs_srt_socket_invalid());
+    SrsUniquePtr<SrsSrtSocket> srt_server_accepted_socket(new SrsSrtSocket(_srt_eventloop->poller(), srt_server_accepted_fd));
+    srt_server_accepted_socket->set_recv_timeout(50 * SRS_UTIME_MILLISECONDS);
+
+    char bufs[4][1500];
+    iovec iovs[4];
+
+    // Drain all the received messages in a batch, and stop when no more message, without waiting.
+    if (true) {
+        for (int i = 0; i < 3; i++) {
+            std::string content = srs_fmt_sprintf("Hello, SRS SRT %d!", i);
+            ssize_t nb_write = 0;
+            HELPER_EXPECT_SUCCESS(srt_client_socket->sendmsg((char *)content.data(), content.size(), &nb_write));
+        }
+
+        // Wait for the messages to be delivered, after the latency of SRT.
+        srs_usleep(500 * SRS_UTIME_MILLISECONDS);
+
+        for (int i = 0; i < 4; i++) {
+            iovs[i].iov_base = bufs[i];
+            iovs[i].iov_len = sizeof(bufs[i]);
+        }
+
+        int nn_msgs = 0;
+        HELPER_EXPECT_SUCCESS(srt_server_accepted_socket->recvmsgs(iovs, 4, &nn_msgs));
+        ASSERT_EQ(3, nn_msgs);
+        for (int i = 0; i < nn_msgs; i++) {
+            std::string content = srs_fmt_sprintf("Hello, SRS SRT %d!", i);
+            EXPECT_EQ(content, std::string(bufs[i], iovs[i].iov_len));
+        }
+
+        // The unused iovec is untouched.
+        EXPECT_EQ(sizeof(bufs[3]), iovs[3].iov_len);
+    }
+
+    // Never receive more than the iovecs, the left ones are received by next batch.
+    if (true) {
+        for (int i = 0; i < 3; i++) {
+            std::string content = srs_fmt_sprintf("Hello, SRS SRT %d!", i);
+            ssize_t nb_write = 0;
+            HELPER_EXPECT_SUCCESS(srt_client_socket->sendmsg((char *)content.data(), content.size(), &nb_write));
+        }
+        srs_usleep(500 * SRS_UTIME_MILLISECONDS);
+
+        for (int i = 0; i < 4; i++) {
+            iovs[i].iov_base = bufs[i];
+            iovs[i].iov_len = sizeof(bufs[i]);
+        }
+
+        int nn_msgs = 0;
+        HELPER_EXPECT_SUCCESS(srt_server_accepted_socket->recvmsgs(iovs, 2, &nn_msgs));
+        EXPECT_EQ(2, nn_msgs);
+        EXPECT_EQ("Hello, SRS SRT 1!", std::string(bufs[1], iovs[1].iov_len));
+
+        iovs[0].iov_len = sizeof(bufs[0]);
+        HELPER_EXPECT_SUCCESS(srt_server_accepted_socket->recvmsgs(iovs, 2, &nn_msgs));
+        EXPECT_EQ(1, nn_msgs);
+        EXPECT_EQ("Hello, SRS SRT 2!", std::string(bufs[0], iovs[0].iov_len));
+    }
+
+    // Wait for the first message, which is timeout if no message.
+    if (true) {
+        iovs[0].iov_len = sizeof(bufs[0]);
+
+        int nn_msgs = 0;
+        err = srt_server_accepted_socket->recvmsgs(iovs, 4, &nn_msgs);
+        EXPECT_EQ(srs_error_code(err), ERROR_SRT_TIMEOUT);
+        EXPECT_EQ(0, nn_msgs);
+        srs_freep(err);
+    }
+}
+
 // Test srt server
 class MockSrtHandler : public ISrsSrtHandler
 {
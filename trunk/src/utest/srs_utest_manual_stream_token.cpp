@@ -10,6 +10,7 @@ using namespace std;
 
 #include <srs_app_st.hpp>
 #include <srs_app_stream_token.hpp>
+#include <srs_app_workers.hpp>
 #include <srs_kernel_error.hpp>
 #include <srs_kernel_log.hpp>
 #include <srs_kernel_utility.hpp>
@@ -623,3 +624,190 @@ VOID TEST(StreamTokenTest, TokenManagerMemoryLeakPrevention)
     // If we reach here without crashes or excessive memory usage, test passes
     EXPECT_TRUE(true);
 }
+
+VOID TEST(StreamTokenTest, WorkerManagerDisabled)
+{
+    srs_error_t err;
+
+    SrsWorkerManager workers;
+    EXPECT_FALSE(workers.enabled());
+    EXPECT_EQ(-1, workers.worker_id());
+    EXPECT_EQ(8000, workers.exclusive_port(8000));
+    EXPECT_TRUE(workers.relay_listen().empty());
+
+    // Always success and no relay, if not in workers mode.
+    HELPER_EXPECT_SUCCESS(workers.acquire("/live/livestream"));
+    EXPECT_TRUE(workers.relay_of("/live/livestream").empty());
+    workers.release("/live/livestream");
+}
+
+VOID TEST(StreamTokenTest, WorkerManagerStreamAffinity)
+{
+    srs_error_t err;
+
+    SrsWorkerManager workers;
+    HELPER_EXPECT_SUCCESS(workers.create_table());
+    workers.relay_port_ = 19350;
+
+    // Publish stream on worker 0.
+    workers.worker_id_ = 0;
+    EXPECT_TRUE(workers.enabled());
+    EXPECT_STREQ("127.0.0.1:19350", workers.relay_listen().c_str());
+    HELPER_EXPECT_SUCCESS(workers.acquire("/live/livestream"));
+    EXPECT_TRUE(workers.relay_of("/live/livestream").empty());
+
+    // Play stream on worker 1, should pull from worker 0, and not able to publish.
+    workers.worker_id_ = 1;
+    EXPECT_EQ(8001, workers.exclusive_port(8000));
+    EXPECT_STREQ("127.0.0.1:19351", workers.relay_listen().c_str());
+    EXPECT_STREQ("127.0.0.1:19350", workers.relay_of("/live/livestream").c_str());
+    EXPECT_TRUE(workers.relay_of("/live/other").empty());
+    HELPER_EXPECT_FAILED(workers.acquire("/live/livestream"));
+
+    // Only the owner is able to release the stream.
+    workers.release("/live/livestream");
+    EXPECT_STREQ("127.0.0.1:19350", workers.relay_of("/live/livestream").c_str());
+
+    // After unpublished on worker 0, worker 1 is able to publish it.
+    workers.worker_id_ = 0;
+    workers.release("/live/livestream");
+    workers.worker_id_ = 1;
+    EXPECT_TRUE(workers.relay_of("/live/livestream").empty());
+    HELPER_EXPECT_SUCCESS(workers.acquire("/live/livestream"));
+
+    // The stream owned by a dead worker is free, even the pid is reused by other process.
+    SrsWorkerStreamSlot *slot = workers.find_slot("/live/livestream");
+    EXPECT_TRUE(slot != NULL);
+    slot->worker_ = 2;
+    EXPECT_STREQ("127.0.0.1:19352", workers.relay_of("/live/livestream").c_str());
+    workers.table_->workers_[2].generation_++;
+    EXPECT_TRUE(workers.relay_of("/live/livestream").empty());
+    HELPER_EXPECT_SUCCESS(workers.acquire("/live/livestream"));
+    EXPECT_EQ(1, slot->worker_);
+}
+
+VOID TEST(StreamTokenTest, WorkerManagerHashCollision)
+{
+    srs_error_t err;
+
+    SrsWorkerManager workers;
+    HELPER_EXPECT_SUCCESS(workers.create_table());
+    workers.relay_port_ = 19350;
+    workers.worker_id_ = 0;
+
+    // Publish many streams, which must collide in the table.
+    for (int i = 0; i < 2 * SRS_WORKERS_MAX_STREAMS / 3; i++) {
+        HELPER_ASSERT_SUCCESS(workers.acquire("/live/s" + srs_strconv_format_int(i)));
+    }
+
+    // Unpublish the even streams, the odd streams are still found, for the probe sequence is kept.
+    for (int i = 0; i < 2 * SRS_WORKERS_MAX_STREAMS / 3; i += 2) {
+        workers.release("/live/s" + srs_strconv_format_int(i));
+    }
+
+    workers.worker_id_ = 1;
+    for (int i = 0; i < 2 * SRS_WORKERS_MAX_STREAMS / 3; i++) {
+        string relay = workers.relay_of("/live/s" + srs_strconv_format_int(i));
+        if (i % 2) {
+            ASSERT_STREQ("127.0.0.1:19350", relay.c_str());
+        } else {
+            ASSERT_TRUE(relay.empty());
+        }
+    }
+
+    // The sequence is even when no writer.
+    EXPECT_EQ(0, (int)(workers.table_->seq_ & 0x01));
+}
+
+VOID TEST(StreamTokenTest, WorkerManagerReclaimDeadWorker)
+{
+    srs_error_t err;
+
+    SrsWorkerManager workers;
+    HELPER_EXPECT_SUCCESS(workers.create_table());
+    workers.relay_port_ = 19350;
+
+    workers.worker_id_ = 0;
+    HELPER_EXPECT_SUCCESS(workers.acquire("/live/a"));
+    HELPER_EXPECT_SUCCESS(workers.acquire("/live/b"));
+
+    workers.worker_id_ = 1;
+    HELPER_EXPECT_SUCCESS(workers.acquire("/live/c"));
+
+    // The master reclaims the streams of dead worker.
+    workers.reclaim(0);
+    EXPECT_TRUE(workers.find_slot("/live/a") == NULL);
+    EXPECT_TRUE(workers.find_slot("/live/b") == NULL);
+    EXPECT_TRUE(workers.find_slot("/live/c") != NULL);
+
+    // The restarted worker is able to publish again.
+    workers.worker_id_ = 0;
+    HELPER_EXPECT_SUCCESS(workers.acquire("/live/a"));
+    workers.worker_id_ = 1;
+    EXPECT_STREQ("127.0.0.1:19350", workers.relay_of("/live/a").c_str());
+}
+
+#if defined(__linux__)
+static void *srs_utest_lock_and_quit(void *arg)
+{
+    pthread_mutex_lock((pthread_mutex_t *)arg);
+    return NULL;
+}
+
+VOID TEST(StreamTokenTest, WorkerManagerRecoverLockFromDeadOwner)
+{
+    srs_error_t err;
+
+    SrsWorkerManager workers;
+    HELPER_EXPECT_SUCCESS(workers.create_table());
+    workers.relay_port_ = 19350;
+    workers.worker_id_ = 0;
+
+    // The owner quit without unlock, like a worker crashed with the lock.
+    pthread_t trd;
+    ASSERT_EQ(0, pthread_create(&trd, NULL, srs_utest_lock_and_quit, &workers.table_->lock_));
+    pthread_join(trd, NULL);
+
+    // The lock is recovered, never deadlock.
+    HELPER_EXPECT_SUCCESS(workers.acquire("/live/livestream"));
+    EXPECT_TRUE(workers.find_slot("/live/livestream") != NULL);
+    workers.release("/live/livestream");
+    EXPECT_TRUE(workers.find_slot("/live/livestream") == NULL);
+}
+#endif
+
+VOID TEST(StreamTokenTest, TokenManagerWithWorkers)
+{
+    srs_error_t err;
+
+    SrsWorkerManager workers;
+    HELPER_EXPECT_SUCCESS(workers.create_table());
+    workers.relay_port_ = 19350;
+
+    SrsStreamPublishTokenManager manager;
+    manager.workers_ = &workers;
+
+    // Publish stream on worker 0.
+    workers.worker_id_ = 0;
+    MockStreamTokenRequest req("/live/livestream");
+    SrsStreamPublishToken *token = NULL;
+    HELPER_EXPECT_SUCCESS(manager.acquire_token(&req, token));
+    EXPECT_TRUE(token != NULL);
+
+    // Publish the same stream on worker 1 should fail, without token left.
+    SrsStreamPublishTokenManager manager2;
+    manager2.workers_ = &workers;
+    workers.worker_id_ = 1;
+    SrsStreamPublishToken *token2 = NULL;
+    HELPER_EXPECT_FAILED(manager2.acquire_token(&req, token2));
+    EXPECT_TRUE(token2 == NULL);
+    EXPECT_TRUE(manager2.tokens_.empty());
+
+    // Release the token on worker 0, then worker 1 is able to publish.
+    workers.worker_id_ = 0;
+    srs_freep(token);
+    workers.worker_id_ = 1;
+    HELPER_EXPECT_SUCCESS(manager2.acquire_token(&req, token2));
+    EXPECT_TRUE(token2 != NULL);
+    srs_freep(token2);
+}
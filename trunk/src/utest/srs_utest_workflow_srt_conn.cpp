@@ -129,6 +129,24 @@ VOID TEST(BasicWorkflowSrtConnTest, ManuallyVerifyForPublisher)
         EXPECT_EQ(1, mock_srt_source->on_packet_count_);
     }
 
+    // All received messages are drained in a batch per wakeup.
+    if (true) {
+        char ts_packet[188];
+        memset(ts_packet, 0, sizeof(ts_packet));
+        ts_packet[0] = 0x47; // Sync byte
+
+        mock_srt_conn->recv_msgs_.push_back(std::string(ts_packet, sizeof(ts_packet)));
+        mock_srt_conn->recv_msgs_.push_back(std::string(ts_packet, sizeof(ts_packet)));
+        mock_srt_conn->cond_->signal();
+
+        // Wait for processing
+        srs_usleep(1 * SRS_UTIME_MILLISECONDS);
+
+        EXPECT_EQ(3, mock_srt_conn->read_count_);
+        EXPECT_EQ(3, mock_srt_source->on_packet_count_);
+        EXPECT_TRUE(mock_srt_conn->recv_msgs_.empty());
+    }
+
     // Simulate client quit event
     if (true) {
         mock_srt_conn->read_error_ = srs_error_new(ERROR_SOCKET_READ, "mock client quit");